@@ -0,0 +1,166 @@
+#include "EYEDaemon/DaemonProtocol.h"
+
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <cstdlib>
+#include <cerrno>
+
+namespace Eye
+{
+	namespace Daemon
+	{
+		DaemonRequestType StringToDaemonRequestType(const std::string& type)
+		{
+			if (type == "check")
+				return DaemonRequestType::Check;
+			else if (type == "compile")
+				return DaemonRequestType::Compile;
+			else if (type == "stats")
+				return DaemonRequestType::Stats;
+			else if (type == "shutdown")
+				return DaemonRequestType::Shutdown;
+			return DaemonRequestType::Invalid;
+		}
+
+		const char* DaemonRequestTypeToString(DaemonRequestType type)
+		{
+			switch (type)
+			{
+			case DaemonRequestType::Check:
+				return "check";
+			case DaemonRequestType::Compile:
+				return "compile";
+			case DaemonRequestType::Stats:
+				return "stats";
+			case DaemonRequestType::Shutdown:
+				return "shutdown";
+			default:
+				break;
+			}
+			return "invalid";
+		}
+
+		std::string GetDefaultSocketPath()
+		{
+			if (const char* runtimeDir = std::getenv("XDG_RUNTIME_DIR"))
+				return std::string(runtimeDir) + "/eyed.sock";
+			return "/tmp/eyed-" + std::to_string(getuid()) + ".sock";
+		}
+
+		DaemonConnection::DaemonConnection(int socket)
+			: m_Socket(socket)
+		{
+		}
+
+		DaemonConnection::~DaemonConnection()
+		{
+			if (m_Socket >= 0)
+				close(m_Socket);
+		}
+
+		bool DaemonConnection::Receive()
+		{
+			return Fill();
+		}
+
+		bool DaemonConnection::HasRequest() const
+		{
+			return (m_Buffer.find('\n') != std::string::npos);
+		}
+
+		bool DaemonConnection::ReadRequest(DaemonRequest& request)
+		{
+			std::string line;
+			if (!ReadLine(line))
+				return false;
+
+			size_t separator = line.find(' ');
+			request.Type = StringToDaemonRequestType(line.substr(0, separator));
+			request.Path = (separator == std::string::npos ? "" : line.substr(separator + 1));
+			return true;
+		}
+
+		bool DaemonConnection::WriteRequest(const DaemonRequest& request)
+		{
+			return WriteAll(std::string(DaemonRequestTypeToString(request.Type)) + (request.Path.empty() ? "" : " " + request.Path) + "\n");
+		}
+
+		bool DaemonConnection::ReadResponse(DaemonResponse& response)
+		{
+			std::string line;
+			if (!ReadLine(line))
+				return false;
+
+			size_t separator = line.find(' ');
+			if (separator == std::string::npos)
+				return false;
+
+			response.Success = (line.substr(0, separator) == "OK");
+			return ReadExact(std::strtoull(line.c_str() + separator + 1, nullptr, 10), response.Payload);
+		}
+
+		bool DaemonConnection::WriteResponse(const DaemonResponse& response)
+		{
+			return WriteAll(std::string(response.Success ? "OK " : "ERROR ") + std::to_string(response.Payload.size()) + "\n" + response.Payload);
+		}
+
+		bool DaemonConnection::ReadLine(std::string& line)
+		{
+			size_t end;
+			while ((end = m_Buffer.find('\n')) == std::string::npos)
+			{
+				if (!Fill())
+					return false;
+			}
+
+			line = m_Buffer.substr(0, end);
+			m_Buffer.erase(0, end + 1);
+			return true;
+		}
+
+		bool DaemonConnection::ReadExact(size_t size, std::string& data)
+		{
+			while (m_Buffer.size() < size)
+			{
+				if (!Fill())
+					return false;
+			}
+
+			data = m_Buffer.substr(0, size);
+			m_Buffer.erase(0, size);
+			return true;
+		}
+
+		bool DaemonConnection::Fill()
+		{
+			char buffer[4096];
+			ssize_t size;
+			do
+			{
+				size = read(m_Socket, buffer, sizeof(buffer));
+			} while (size < 0 && errno == EINTR);
+
+			if (size <= 0)
+				return false;
+
+			m_Buffer.append(buffer, size);
+			return true;
+		}
+
+		bool DaemonConnection::WriteAll(const std::string& data)
+		{
+			size_t written = 0;
+			while (written < data.size())
+			{
+				ssize_t size = send(m_Socket, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+				if (size < 0 && errno == EINTR)
+					continue;
+				if (size <= 0)
+					return false;
+				written += size;
+			}
+			return true;
+		}
+	}
+}
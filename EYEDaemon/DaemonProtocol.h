@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+
+namespace Eye
+{
+	namespace Daemon
+	{
+		/*
+			Protocol
+				Request: '<command> [<absolute path>]\n', commands: check, compile, stats, shutdown
+				Response: '<OK|ERROR> <payload size>\n<payload>'
+				A Connection may carry any number of Requests.
+		*/
+		enum class DaemonRequestType
+		{
+			Invalid,
+			Check,
+			Compile,
+			Stats,
+			Shutdown,
+		};
+
+		struct DaemonRequest
+		{
+			DaemonRequestType Type = DaemonRequestType::Invalid;
+			std::string Path;
+		};
+
+		struct DaemonResponse
+		{
+			bool Success = false;
+			std::string Payload;
+		};
+
+		DaemonRequestType StringToDaemonRequestType(const std::string& type);
+		const char* DaemonRequestTypeToString(DaemonRequestType type);
+		std::string GetDefaultSocketPath();
+
+		class DaemonConnection
+		{
+		public:
+			DaemonConnection(int socket);
+			~DaemonConnection();
+
+			DaemonConnection(const DaemonConnection&) = delete;
+			DaemonConnection& operator=(const DaemonConnection&) = delete;
+
+			// Reads once whatever the Socket holds without waiting for more, false once the Peer is gone
+			bool Receive();
+			// A whole Request is buffered, ReadRequest() will not block
+			bool HasRequest() const;
+
+			bool ReadRequest(DaemonRequest& request);
+			bool WriteRequest(const DaemonRequest& request);
+			bool ReadResponse(DaemonResponse& response);
+			bool WriteResponse(const DaemonResponse& response);
+
+		private:
+			bool ReadLine(std::string& line);
+			bool ReadExact(size_t size, std::string& data);
+			bool Fill();
+			bool WriteAll(const std::string& data);
+
+		private:
+			int m_Socket;
+			std::string m_Buffer;
+		};
+	}
+}
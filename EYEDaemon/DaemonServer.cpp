@@ -0,0 +1,256 @@
+#include "EYEDaemon/DaemonServer.h"
+#include "Eye/Utility/Logger.h"
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include <cstring>
+#include <cerrno>
+#include <vector>
+
+namespace Eye
+{
+	namespace Daemon
+	{
+		DaemonServer::DaemonServer(const std::string& socketPath, size_t threadCount)
+			: m_SocketPath(socketPath), m_ThreadPool(threadCount)
+		{
+		}
+
+		DaemonServer::~DaemonServer()
+		{
+			Stop();
+			m_ThreadPool.Wait();
+			m_Connections.clear();
+
+			if (m_ListenSocket >= 0)
+			{
+				close(m_ListenSocket);
+				unlink(m_SocketPath.c_str());
+			}
+			for (int fd : m_WakePipe)
+			{
+				if (fd >= 0)
+					close(fd);
+			}
+		}
+
+		bool DaemonServer::Run()
+		{
+			if (!Listen())
+				return false;
+
+			EYE_LOG_INFO("EYEDaemon Listening on {} with {} Workers", m_SocketPath, m_ThreadPool.GetThreadCount());
+
+			m_Running = true;
+			std::vector<pollfd> fds;
+			while (m_Running)
+			{
+				fds = { { m_ListenSocket, POLLIN, 0 }, { m_WakePipe[0], POLLIN, 0 } };
+				{
+					std::lock_guard<std::mutex> lock(m_ConnectionsMutex);
+					for (const auto& [socket, connection] : m_Connections)
+					{
+						if (!connection.Busy)
+							fds.push_back({ socket, POLLIN, 0 });
+					}
+				}
+
+				if (poll(fds.data(), fds.size(), -1) < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					EYE_LOG_ERROR("EYEDaemon Failed to Poll: {}", std::strerror(errno));
+					break;
+				}
+
+				if (fds[1].revents)
+				{
+					char buffer[64];
+					while (read(m_WakePipe[0], buffer, sizeof(buffer)) > 0);
+				}
+				if (!m_Running)
+					break;
+				if (fds[0].revents)
+					Accept();
+				for (size_t i = 2; i < fds.size(); i++)
+				{
+					if (fds[i].revents)
+						ReceiveRequest(fds[i].fd);
+				}
+			}
+
+			Stop();
+			m_ThreadPool.Wait();
+			{
+				std::lock_guard<std::mutex> lock(m_ConnectionsMutex);
+				m_Connections.clear();
+			}
+			EYE_LOG_INFO("EYEDaemon Stopped");
+			return true;
+		}
+
+		bool DaemonServer::Listen()
+		{
+			sockaddr_un address = {};
+			address.sun_family = AF_UNIX;
+			if (m_SocketPath.size() >= sizeof(address.sun_path))
+			{
+				EYE_LOG_ERROR("EYEDaemon Socket Path too long: {}", m_SocketPath);
+				return false;
+			}
+			std::strncpy(address.sun_path, m_SocketPath.c_str(), sizeof(address.sun_path) - 1);
+
+			// A Socket File nobody answers on is left over from a Daemon that died, anything else is a live Daemon
+			int probe = socket(AF_UNIX, SOCK_STREAM, 0);
+			if (probe >= 0 && connect(probe, (sockaddr*)&address, sizeof(address)) == 0)
+			{
+				close(probe);
+				EYE_LOG_ERROR("EYEDaemon already Running on {}", m_SocketPath);
+				return false;
+			}
+			if (probe >= 0)
+				close(probe);
+			unlink(m_SocketPath.c_str());
+
+			if (pipe2(m_WakePipe, O_NONBLOCK | O_CLOEXEC) < 0)
+			{
+				EYE_LOG_ERROR("EYEDaemon Failed to Create Wake Pipe: {}", std::strerror(errno));
+				return false;
+			}
+
+			m_ListenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+			if (m_ListenSocket < 0)
+			{
+				EYE_LOG_ERROR("EYEDaemon Failed to Create Socket: {}", std::strerror(errno));
+				return false;
+			}
+
+			mode_t mask = umask(0077);
+			int bound = bind(m_ListenSocket, (sockaddr*)&address, sizeof(address));
+			umask(mask);
+			if (bound < 0 || listen(m_ListenSocket, SOMAXCONN) < 0)
+			{
+				EYE_LOG_ERROR("EYEDaemon Failed to Listen on {}: {}", m_SocketPath, std::strerror(errno));
+				close(m_ListenSocket);
+				m_ListenSocket = -1;
+				return false;
+			}
+
+			return true;
+		}
+
+		void DaemonServer::Accept()
+		{
+			int socket = accept(m_ListenSocket, nullptr, nullptr);
+			if (socket < 0)
+			{
+				if (errno != EINTR && errno != ECONNABORTED && errno != EAGAIN)
+					EYE_LOG_ERROR("EYEDaemon Failed to Accept: {}", std::strerror(errno));
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(m_ConnectionsMutex);
+			m_Connections[socket].Stream = std::make_unique<DaemonConnection>(socket);
+		}
+
+		void DaemonServer::ReceiveRequest(int socket)
+		{
+			std::lock_guard<std::mutex> lock(m_ConnectionsMutex);
+			auto it = m_Connections.find(socket);
+			if (it == m_Connections.end())
+				return;
+
+			// Poll reported the Socket readable, one read never blocks
+			if (!it->second.Stream->Receive())
+			{
+				m_Connections.erase(it);
+				return;
+			}
+			if (!it->second.Stream->HasRequest())
+				return;
+
+			it->second.Busy = true;
+			DaemonConnection* connection = it->second.Stream.get();
+			m_ThreadPool.Submit([this, socket, connection]() { ServeRequests(socket, connection); });
+		}
+
+		void DaemonServer::ServeRequests(int socket, DaemonConnection* connection)
+		{
+			bool open = true;
+			try
+			{
+				// Requests the Client pipelined are answered in one go
+				DaemonRequest request;
+				while (open && connection->HasRequest() && connection->ReadRequest(request))
+					open = (connection->WriteResponse(HandleRequest(request)) && request.Type != DaemonRequestType::Shutdown);
+			}
+			catch (const std::exception& ex)
+			{
+				EYE_LOG_ERROR("EYEDaemon Connection Failed: {}", ex.what());
+				open = false;
+			}
+			catch (...)
+			{
+				EYE_LOG_ERROR("EYEDaemon Connection Failed: Unknown Exception");
+				open = false;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_ConnectionsMutex);
+				if (open && m_Running)
+					m_Connections[socket].Busy = false;
+				else
+					m_Connections.erase(socket);
+			}
+			Wake();
+		}
+
+		DaemonResponse DaemonServer::HandleRequest(const DaemonRequest& request)
+		{
+			switch (request.Type)
+			{
+			case DaemonRequestType::Check:
+			case DaemonRequestType::Compile:
+			{
+				if (request.Path.empty() || request.Path.front() != '/')
+					return { false, "Expected an Absolute Path, got '" + request.Path + "'" };
+
+				auto entry = m_ASTCache.Get({ { request.Path, EyeSourceType::File } });
+				if (entry->Diagnostic)
+					return { false, std::string(entry->Diagnostic->GetMessage()) };
+				return { true, (request.Type == DaemonRequestType::Compile ? entry->GetSerializedAST() : "") };
+			}
+			case DaemonRequestType::Stats:
+				return { true, "entries " + std::to_string(m_ASTCache.GetEntryCount()) + "\nbytes " + std::to_string(m_ASTCache.GetByteCount()) + "\nhits " + std::to_string(m_ASTCache.GetHitCount()) + "\nmisses " + std::to_string(m_ASTCache.GetMissCount()) + "\nevictions " + std::to_string(m_ASTCache.GetEvictionCount()) + "\n" };
+			case DaemonRequestType::Shutdown:
+				Stop();
+				return { true, "" };
+			default:
+				break;
+			}
+			return { false, "Invalid Request" };
+		}
+
+		void DaemonServer::Wake()
+		{
+			if (m_WakePipe[1] < 0)
+				return;
+
+			// A full Pipe wakes the Thread already, a failed Write needs no Retry
+			char signal = 0;
+			ssize_t written = write(m_WakePipe[1], &signal, 1);
+			(void)written;
+		}
+
+		void DaemonServer::Stop()
+		{
+			m_Running = false;
+			Wake();
+		}
+	}
+}
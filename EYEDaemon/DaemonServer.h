@@ -0,0 +1,61 @@
+#pragma once
+
+#include "EYEDaemon/DaemonProtocol.h"
+#include "Eye/ASTGenerator/ASTCache.h"
+#include "Eye/Utility/ThreadPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <unordered_map>
+
+namespace Eye
+{
+	namespace Daemon
+	{
+		/*
+			DaemonServer
+				Serves check/compile Requests on a Unix Domain Socket readable by the owning user only.
+				The Run() Thread polls the Listening Socket & every idle Connection, a Worker is taken only once a whole Request arrived
+				and hands the Connection back after answering it, so idle Clients never hold a Worker.
+				Generated ASTs stay in an ASTCache across Requests, unchanged Sources are answered without re-running the Pipeline.
+		*/
+		class DaemonServer
+		{
+		public:
+			DaemonServer(const std::string& socketPath, size_t threadCount = 0);
+			~DaemonServer();
+
+			// Blocks until a shutdown Request arrives, false if the Socket could not be set up
+			bool Run();
+
+		private:
+			struct Connection
+			{
+				std::unique_ptr<DaemonConnection> Stream;
+				// Owned by a Worker, not polled
+				bool Busy = false;
+			};
+
+		private:
+			bool Listen();
+			void Accept();
+			void ReceiveRequest(int socket);
+			void ServeRequests(int socket, DaemonConnection* connection);
+			DaemonResponse HandleRequest(const DaemonRequest& request);
+			void Wake();
+			void Stop();
+
+		private:
+			std::string m_SocketPath;
+			int m_ListenSocket = -1;
+			// Workers & Stop() wake the polling Thread through it
+			int m_WakePipe[2] = { -1, -1 };
+			std::atomic<bool> m_Running = false;
+			std::mutex m_ConnectionsMutex;
+			std::unordered_map<int, Connection> m_Connections;
+			ASTCache m_ASTCache;
+			ThreadPool m_ThreadPool;
+		};
+	}
+}
@@ -0,0 +1,98 @@
+#include "EYEDaemon/DaemonServer.h"
+#include "EYEDaemon/DaemonProtocol.h"
+#include "Eye/Utility/Logger.h"
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <iostream>
+#include <filesystem>
+#include <cstring>
+
+static int Usage()
+{
+	std::cerr << "Usage: eyed [--socket <path>] [--threads <count>]             Start the Daemon\n"
+		<< "       eyed [--socket <path>] check|compile <file>              Send a Request\n"
+		<< "       eyed [--socket <path>] stats|shutdown\n";
+	return 2;
+}
+
+static int SendRequest(const std::string& socketPath, const Eye::Daemon::DaemonRequest& request)
+{
+	sockaddr_un address = {};
+	address.sun_family = AF_UNIX;
+	std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+	int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+	if (socket < 0 || connect(socket, (sockaddr*)&address, sizeof(address)) < 0)
+	{
+		std::cerr << "eyed: No Daemon Listening on " << socketPath << "\n";
+		if (socket >= 0)
+			close(socket);
+		return 2;
+	}
+
+	Eye::Daemon::DaemonConnection connection(socket);
+	Eye::Daemon::DaemonResponse response;
+	if (!connection.WriteRequest(request) || !connection.ReadResponse(response))
+	{
+		std::cerr << "eyed: Connection to " << socketPath << " Lost\n";
+		return 2;
+	}
+
+	(response.Success ? std::cout : std::cerr) << response.Payload;
+	if (!response.Payload.empty() && response.Payload.back() != '\n')
+		(response.Success ? std::cout : std::cerr) << "\n";
+	return (response.Success ? 0 : 1);
+}
+
+int main(int argc, char** argv)
+{
+	std::string socketPath = Eye::Daemon::GetDefaultSocketPath();
+	size_t threadCount = 0;
+	std::vector<std::string> arguments;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		if (argument == "--socket" && i + 1 < argc)
+			socketPath = argv[++i];
+		else if (argument == "--threads" && i + 1 < argc)
+			threadCount = std::strtoull(argv[++i], nullptr, 10);
+		else if (argument.starts_with("--"))
+			return Usage();
+		else
+			arguments.push_back(argument);
+	}
+
+	if (arguments.empty())
+	{
+		Eye::Logger::Init();
+		Eye::Daemon::DaemonServer server(socketPath, threadCount);
+		return (server.Run() ? 0 : 1);
+	}
+
+	Eye::Daemon::DaemonRequest request;
+	request.Type = Eye::Daemon::StringToDaemonRequestType(arguments[0]);
+	if (request.Type == Eye::Daemon::DaemonRequestType::Invalid)
+		return Usage();
+
+	if (request.Type == Eye::Daemon::DaemonRequestType::Check || request.Type == Eye::Daemon::DaemonRequestType::Compile)
+	{
+		if (arguments.size() != 2)
+			return Usage();
+
+		// The Daemon does not share our Working Directory
+		std::error_code ec;
+		request.Path = std::filesystem::absolute(arguments[1], ec).string();
+		if (ec)
+			request.Path = arguments[1];
+	}
+	else if (arguments.size() != 1)
+	{
+		return Usage();
+	}
+
+	return SendRequest(socketPath, request);
+}
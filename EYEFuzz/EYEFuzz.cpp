@@ -0,0 +1,336 @@
+#include "EYEFuzz/FuzzTarget.h"
+#include "EYEFuzz/GrammarGenerator.h"
+#include "Eye/Utility/Logger.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <malloc.h>
+#include <signal.h>
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+/*
+	eyefuzz
+		Standalone Driver next to the libFuzzer Harnesses, needs no Clang.
+		Feeds GrammarGenerator Programs (or replays Files) through RunFuzzPipeline and reports exec/s.
+		Every Run is measured in Time & Peak Heap per Input Byte, Runs far above the Median are flagged as Superlinear
+		and re-run at 2x & 4x the Input to estimate the Growth. Crashes & Hangs past --timeout-ms leave the Input in --artifacts.
+*/
+
+// Heap Accounting for the Peak of every Run
+static std::atomic<size_t> s_LiveBytes = 0;
+static std::atomic<size_t> s_PeakBytes = 0;
+
+void* operator new(size_t size)
+{
+	void* ptr = std::malloc(size ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+
+	size_t live = s_LiveBytes.fetch_add(malloc_usable_size(ptr), std::memory_order_relaxed) + malloc_usable_size(ptr);
+	size_t peak = s_PeakBytes.load(std::memory_order_relaxed);
+	while (live > peak && !s_PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed));
+	return ptr;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	if (!ptr)
+		return;
+	s_LiveBytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	operator delete(ptr);
+}
+
+// Crash & Hang Reporting, the Handlers only touch Async-Signal-Safe Calls and preformatted Paths
+static const std::string* s_CurrentInput = nullptr;
+static std::string s_CrashPath;
+static std::string s_TimeoutPath;
+static std::atomic<int64_t> s_RunStart = 0;
+
+static int64_t NowNanoseconds()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void WriteInput(const std::string& path)
+{
+	int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return;
+	if (s_CurrentInput && write(fd, s_CurrentInput->data(), s_CurrentInput->size()) < 0)
+		(void)0;
+	close(fd);
+}
+
+static void CrashHandler(int signal)
+{
+	WriteInput(s_CrashPath);
+	const char message[] = "eyefuzz: Crash, Input written to the Artifacts\n";
+	if (write(STDERR_FILENO, message, sizeof(message) - 1) < 0)
+		(void)0;
+	::signal(signal, SIG_DFL);
+	raise(signal);
+}
+
+struct FuzzOptions
+{
+	Eye::Fuzz::FuzzStage Stage = Eye::Fuzz::FuzzStage::TypeChecker;
+	size_t Runs = 0;
+	double Seconds = 60;
+	uint64_t Seed = 0;
+	size_t MaxInputBytes = 4096;
+	int64_t TimeoutMilliseconds = 10000;
+	double SlowFactor = 20;
+	std::string ArtifactsPath = ".";
+	Eye::Fuzz::GrammarGeneratorProperties Generator;
+	std::vector<std::string> Files;
+};
+
+struct FuzzMeasurement
+{
+	Eye::Fuzz::FuzzStage Stage;
+	double Nanoseconds;
+	size_t PeakBytes;
+};
+
+static FuzzMeasurement Measure(const FuzzOptions& options, const std::string& text)
+{
+	s_CurrentInput = &text;
+	size_t baseline = s_LiveBytes.load(std::memory_order_relaxed);
+	s_PeakBytes.store(baseline, std::memory_order_relaxed);
+
+	int64_t start = NowNanoseconds();
+	s_RunStart.store(start);
+	Eye::Fuzz::FuzzStage stage = Eye::Fuzz::RunFuzzPipeline(options.Stage, text);
+	int64_t stop = NowNanoseconds();
+	s_RunStart.store(0);
+
+	return { stage, (double)(stop - start), s_PeakBytes.load(std::memory_order_relaxed) - baseline };
+}
+
+static std::string Repeat(const std::string& text, size_t count)
+{
+	std::string repeated;
+	for (size_t i = 0; i < count; i++)
+		repeated += text + "\n";
+	return repeated;
+}
+
+// Median of the last Window Samples, Outliers against it are flagged
+class CostWindow
+{
+public:
+	void Add(double cost)
+	{
+		if (m_Samples.size() < Window)
+			m_Samples.push_back(cost);
+		else
+			m_Samples[m_Next++ % Window] = cost;
+	}
+
+	double GetMedian() const
+	{
+		if (m_Samples.size() < Window / 4)
+			return 0;
+		std::vector<double> samples = m_Samples;
+		std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+		return samples[samples.size() / 2];
+	}
+
+private:
+	static constexpr size_t Window = 1024;
+	std::vector<double> m_Samples;
+	size_t m_Next = 0;
+};
+
+static int Usage()
+{
+	std::cerr << "Usage: eyefuzz [--stage lexer|parser|semantic|typechecker] [--runs <count>] [--seconds <count>] [--seed <seed>]\n"
+		<< "               [--max-bytes <count>] [--max-depth <count>] [--max-statements <count>] [--timeout-ms <count>]\n"
+		<< "               [--slow-factor <factor>] [--artifacts <dir>] [files...]\n";
+	return 2;
+}
+
+static bool ParseOptions(int argc, char** argv, FuzzOptions& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+		bool hasValue = (i + 1 < argc);
+		if (argument == "--stage" && hasValue)
+			options.Stage = Eye::Fuzz::StringToFuzzStage(argv[++i]);
+		else if (argument == "--runs" && hasValue)
+			options.Runs = std::strtoull(argv[++i], nullptr, 10);
+		else if (argument == "--seconds" && hasValue)
+			options.Seconds = std::strtod(argv[++i], nullptr);
+		else if (argument == "--seed" && hasValue)
+			options.Seed = std::strtoull(argv[++i], nullptr, 10);
+		else if (argument == "--max-bytes" && hasValue)
+			options.MaxInputBytes = std::strtoull(argv[++i], nullptr, 10);
+		else if (argument == "--max-depth" && hasValue)
+			options.Generator.MaxDepth = std::strtoull(argv[++i], nullptr, 10);
+		else if (argument == "--max-statements" && hasValue)
+			options.Generator.MaxStatements = std::strtoull(argv[++i], nullptr, 10);
+		else if (argument == "--timeout-ms" && hasValue)
+			options.TimeoutMilliseconds = std::strtoll(argv[++i], nullptr, 10);
+		else if (argument == "--slow-factor" && hasValue)
+			options.SlowFactor = std::strtod(argv[++i], nullptr);
+		else if (argument == "--artifacts" && hasValue)
+			options.ArtifactsPath = argv[++i];
+		else if (argument.starts_with("--"))
+			return false;
+		else
+			options.Files.push_back(argument);
+	}
+	return options.Stage != Eye::Fuzz::FuzzStage::None;
+}
+
+static int Replay(const FuzzOptions& options)
+{
+	for (const auto& file : options.Files)
+	{
+		std::ifstream stream(file, std::ios::binary);
+		if (!stream)
+		{
+			std::cerr << "eyefuzz: Failed to Open '" << file << "'\n";
+			return 2;
+		}
+
+		std::ostringstream content;
+		content << stream.rdbuf();
+		std::string text = content.str();
+		FuzzMeasurement measurement = Measure(options, text);
+		std::cout << file << ": " << text.size() << " Bytes, Accepted by " << Eye::Fuzz::FuzzStageToString(measurement.Stage) << ", "
+			<< measurement.Nanoseconds / 1e6 << " ms, Peak " << measurement.PeakBytes << " Bytes\n";
+	}
+	return 0;
+}
+
+static void ReportSlowInput(const FuzzOptions& options, const std::string& text, const FuzzMeasurement& measurement, const char* reason, size_t& slowCount)
+{
+	// Growth Exponent between 2x & 4x the Input, ~1 is linear
+	FuzzMeasurement doubled = Measure(options, Repeat(text, 2));
+	FuzzMeasurement quadrupled = Measure(options, Repeat(text, 4));
+	double timeGrowth = std::log2(std::max(quadrupled.Nanoseconds, 1.0) / std::max(doubled.Nanoseconds, 1.0));
+	double memoryGrowth = std::log2((double)std::max<size_t>(quadrupled.PeakBytes, 1) / (double)std::max<size_t>(doubled.PeakBytes, 1));
+
+	std::string path = (std::filesystem::path(options.ArtifactsPath) / ("slow-" + std::to_string(slowCount++) + ".eye")).string();
+	std::ofstream(path, std::ios::binary) << text;
+	std::cout << "SLOW (" << reason << ") " << path << ": " << text.size() << " Bytes, " << measurement.Nanoseconds / 1e6 << " ms, Peak "
+		<< measurement.PeakBytes << " Bytes, Growth Time n^" << timeGrowth << " Memory n^" << memoryGrowth << "\n";
+}
+
+static int Fuzz(const FuzzOptions& options)
+{
+	Eye::Fuzz::GrammarGenerator generator(options.Generator);
+	std::mt19937_64 random(options.Seed);
+	std::vector<uint8_t> data;
+	std::string text;
+
+	CostWindow timeWindow, memoryWindow;
+	size_t accepted[5] = {};
+	size_t runs = 0, slowCount = 0;
+	int64_t start = NowNanoseconds(), lastReport = start;
+
+	while ((options.Runs == 0 || runs < options.Runs) && (options.Runs != 0 || (NowNanoseconds() - start) / 1e9 < options.Seconds))
+	{
+		data.resize(std::uniform_int_distribution<size_t>(0, options.MaxInputBytes)(random));
+		for (auto& byte : data)
+			byte = (uint8_t)random();
+		text = generator.Generate(data.data(), data.size());
+
+		FuzzMeasurement measurement = Measure(options, text);
+		accepted[(size_t)measurement.Stage]++;
+		runs++;
+
+		// Tiny Inputs are dominated by fixed Costs
+		if (text.size() >= 64)
+		{
+			double timePerByte = measurement.Nanoseconds / text.size();
+			double memoryPerByte = (double)measurement.PeakBytes / text.size();
+			double timeMedian = timeWindow.GetMedian(), memoryMedian = memoryWindow.GetMedian();
+			if (timeMedian > 0 && timePerByte > options.SlowFactor * timeMedian)
+				ReportSlowInput(options, text, measurement, "Time", slowCount);
+			else if (memoryMedian > 0 && memoryPerByte > options.SlowFactor * memoryMedian)
+				ReportSlowInput(options, text, measurement, "Memory", slowCount);
+			timeWindow.Add(timePerByte);
+			memoryWindow.Add(memoryPerByte);
+		}
+
+		int64_t now = NowNanoseconds();
+		if (now - lastReport >= 1000000000)
+		{
+			std::cout << "#" << runs << " exec/s: " << (size_t)(runs / ((now - start) / 1e9)) << " accepted lexer: " << accepted[1] << " parser: " << accepted[2]
+				<< " semantic: " << accepted[3] << " typechecker: " << accepted[4] << " rejected: " << accepted[0] << " slow: " << slowCount << std::endl;
+			lastReport = now;
+		}
+	}
+
+	double seconds = (NowNanoseconds() - start) / 1e9;
+	std::cout << "Done " << runs << " Runs in " << seconds << " s, exec/s: " << (size_t)(runs / std::max(seconds, 1e-9)) << ", slow: " << slowCount << std::endl;
+	return (slowCount ? 1 : 0);
+}
+
+int main(int argc, char** argv)
+{
+	FuzzOptions options;
+	if (!ParseOptions(argc, argv, options))
+		return Usage();
+
+	Eye::Logger::Init();
+
+	std::filesystem::create_directories(options.ArtifactsPath);
+	s_CrashPath = (std::filesystem::path(options.ArtifactsPath) / "crash.eye").string();
+	s_TimeoutPath = (std::filesystem::path(options.ArtifactsPath) / "timeout.eye").string();
+	for (int signal : { SIGSEGV, SIGABRT, SIGFPE, SIGBUS, SIGILL })
+		::signal(signal, CrashHandler);
+
+	std::thread([timeout = options.TimeoutMilliseconds * 1000000]()
+		{
+			while (true)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				int64_t runStart = s_RunStart.load();
+				if (runStart && NowNanoseconds() - runStart > timeout)
+				{
+					WriteInput(s_TimeoutPath);
+					std::cerr << "eyefuzz: Timeout, Input written to " << s_TimeoutPath << std::endl;
+					std::_Exit(3);
+				}
+			}
+		}).detach();
+
+	return (options.Files.empty() ? Fuzz(options) : Replay(options));
+}
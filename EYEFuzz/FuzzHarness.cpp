@@ -0,0 +1,21 @@
+#include "EYEFuzz/FuzzTarget.h"
+#include "EYEFuzz/GrammarGenerator.h"
+#include "Eye/Utility/Logger.h"
+
+// libFuzzer Entry, built once per Harness: EYE_FUZZ_STAGE names the last FuzzStage, EYE_FUZZ_GRAMMAR reads the Input as GrammarGenerator Choices
+extern "C" int LLVMFuzzerInitialize(int*, char***)
+{
+	Eye::Logger::Init();
+	return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+#ifdef EYE_FUZZ_GRAMMAR
+	static Eye::Fuzz::GrammarGenerator generator;
+	Eye::Fuzz::RunFuzzPipeline(Eye::Fuzz::FuzzStage::EYE_FUZZ_STAGE, generator.Generate(data, size));
+#else
+	Eye::Fuzz::RunFuzzPipeline(Eye::Fuzz::FuzzStage::EYE_FUZZ_STAGE, std::string((const char*)data, size));
+#endif
+	return 0;
+}
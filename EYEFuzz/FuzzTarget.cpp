@@ -0,0 +1,73 @@
+#include "EYEFuzz/FuzzTarget.h"
+#include "Eye/Lexer/Lexer.h"
+#include "Eye/MacroExpander/MacroExpander.h"
+#include "Eye/Parser/Parser.h"
+#include "Eye/Semantic/NamespaceResolver.h"
+#include "Eye/Semantic/Semantic.h"
+#include "Eye/TypeChecker/TypeChecker.h"
+
+namespace Eye
+{
+	namespace Fuzz
+	{
+		const char* FuzzStageToString(FuzzStage stage)
+		{
+			switch (stage)
+			{
+			case FuzzStage::Lexer:
+				return "lexer";
+			case FuzzStage::Parser:
+				return "parser";
+			case FuzzStage::Semantic:
+				return "semantic";
+			case FuzzStage::TypeChecker:
+				return "typechecker";
+			default:
+				return "none";
+			}
+		}
+
+		FuzzStage StringToFuzzStage(const std::string& stage)
+		{
+			for (FuzzStage candidate : { FuzzStage::Lexer, FuzzStage::Parser, FuzzStage::Semantic, FuzzStage::TypeChecker })
+				if (stage == FuzzStageToString(candidate))
+					return candidate;
+			return FuzzStage::None;
+		}
+
+		FuzzStage RunFuzzPipeline(FuzzStage lastStage, const std::string& text)
+		{
+			// A String Source is copied into every Token, the Region Overload keeps Token Sources to the short Label
+			Lexer lexer;
+			auto lexerRes = lexer.Tokenize(EyeSource("<fuzz>", EyeSourceType::String), text);
+			if (!lexerRes.has_value())
+				return FuzzStage::None;
+			if (lastStage == FuzzStage::Lexer)
+				return FuzzStage::Lexer;
+
+			MacroExpander macroExpander;
+			auto macroExpanderRes = macroExpander.Expand(std::move(lexerRes.value()));
+			if (!macroExpanderRes.has_value())
+				return FuzzStage::Lexer;
+
+			Parser parser;
+			auto parserRes = parser.Parse(std::move(macroExpanderRes.value()));
+			if (!parserRes.has_value())
+				return FuzzStage::Lexer;
+			if (lastStage == FuzzStage::Parser)
+				return FuzzStage::Parser;
+
+			NamespaceResolver namespaceResolver;
+			Semantic semanticValidator;
+			if (!namespaceResolver.Resolve(parserRes.value().get()).has_value() || !semanticValidator.Validate(parserRes.value().get()).has_value())
+				return FuzzStage::Parser;
+			if (lastStage == FuzzStage::Semantic)
+				return FuzzStage::Semantic;
+
+			TypeChecker typeChecker;
+			if (!typeChecker.TypeCheck(parserRes.value().get()).has_value())
+				return FuzzStage::Semantic;
+			return FuzzStage::TypeChecker;
+		}
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace Eye
+{
+	namespace Fuzz
+	{
+		enum class FuzzStage : uint8_t
+		{
+			None,
+			Lexer,
+			Parser,
+			Semantic,
+			TypeChecker,
+		};
+		const char* FuzzStageToString(FuzzStage stage);
+		FuzzStage StringToFuzzStage(const std::string& stage);
+
+		/*
+			RunFuzzPipeline
+				Runs text through Lexer, MacroExpander, Parser, Semantic & TypeChecker up to lastStage, stopping at the first Diagnostic.
+				Returns the last Stage that accepted the Input. Diagnostics are expected, a Crash or Hang is the Finding.
+		*/
+		FuzzStage RunFuzzPipeline(FuzzStage lastStage, const std::string& text);
+	}
+}
@@ -0,0 +1,404 @@
+#include "EYEFuzz/GrammarGenerator.h"
+
+namespace Eye
+{
+	namespace Fuzz
+	{
+		static const char* s_Identifiers[] = { "a", "b", "c", "i", "f", "g", "value" };
+		static const char* s_DataTypes[] = { "int", "float", "str", "bool", "void" };
+		static const char* s_BinaryOperators[] = { "+", "-", "*", "/", "%", "<", "<=", ">", ">=", "==", "!=", "&&", "||", "&", "|", "^", "<<", ">>" };
+		static const char* s_AssignmentOperators[] = { "=", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "<<=", ">>=" };
+		static const char* s_UnaryOperators[] = { "-", "+", "!", "~", "++", "--" };
+		static const char* s_Strings[] = { "\"\"", "\"eye\"", "\"\\n\\t\"", "\"0123456789\"" };
+
+		template<typename T, size_t N>
+		static constexpr size_t CountOf(T(&)[N]) { return N; }
+
+		FuzzChoices::FuzzChoices(const uint8_t* data, size_t size)
+			: m_Data(data), m_Size(size)
+		{
+		}
+
+		size_t FuzzChoices::Choose(size_t count)
+		{
+			if (count <= 1 || IsExhausted())
+				return 0;
+
+			size_t value = m_Data[m_Index++];
+			if (count > 256 && !IsExhausted())
+				value = (value << 8) | m_Data[m_Index++];
+			return value % count;
+		}
+
+		GrammarGenerator::GrammarGenerator(const GrammarGeneratorProperties& properties)
+			: m_Properties(properties)
+		{
+		}
+
+		/*
+			Program
+				: StatementList
+				;
+		*/
+		std::string GrammarGenerator::Generate(const uint8_t* data, size_t size)
+		{
+			FuzzChoices choices(data, size);
+			m_Choices = &choices;
+			m_Output.clear();
+			m_StatementCount = 0;
+
+			while (m_StatementCount < m_Properties.MaxStatements && m_Choices->Choose(16) != 0)
+				Statement(0);
+
+			m_Choices = nullptr;
+			return m_Output;
+		}
+
+		void GrammarGenerator::Statement(size_t depth)
+		{
+			m_StatementCount++;
+
+			// Past the Depth Limit only Statements without Sub-Statements are produced
+			size_t choice = m_Choices->Choose(depth >= m_Properties.MaxDepth ? 3 : 12);
+			switch (choice)
+			{
+			case 0:
+				Expression(depth + 1);
+				Emit(";");
+				break;
+			case 1:
+				VariableStatement(depth, true);
+				break;
+			case 2:
+				Emit(m_Choices->Choose(2) ? "break;" : "continue;");
+				break;
+			case 3:
+				BlockStatement(depth);
+				break;
+			case 4:
+				ControlStatement(depth);
+				break;
+			case 5:
+			case 6:
+				IterationStatement(depth);
+				break;
+			case 7:
+			case 8:
+				FunctionStatement(depth);
+				break;
+			case 9:
+				Emit("return");
+				if (m_Choices->Choose(2))
+					Expression(depth + 1);
+				Emit(";");
+				break;
+			case 10:
+				Emit("import");
+				Emit(s_Strings[m_Choices->Choose(CountOf(s_Strings))]);
+				Emit(";");
+				break;
+			default:
+				Emit(";");
+				break;
+			}
+		}
+
+		/*
+			BlockStatement
+				: '{' OptionalStatementList '}'
+				;
+		*/
+		void GrammarGenerator::BlockStatement(size_t depth)
+		{
+			Emit("{");
+			while (m_StatementCount < m_Properties.MaxStatements && m_Choices->Choose(4) != 0)
+				Statement(depth + 1);
+			Emit("}");
+		}
+
+		/*
+			VariableStatement
+				: OptionalTypeQualifier DatatypeKeyword VariableDeclarationList ';'
+				;
+		*/
+		void GrammarGenerator::VariableStatement(size_t depth, bool terminate)
+		{
+			if (m_Choices->Choose(4) == 1)
+				Emit("const");
+			DataType(true);
+
+			size_t declarationCount = 1 + (m_Choices->Choose(4) == 1 ? m_Choices->Choose(3) : 0);
+			for (size_t i = 0; i < declarationCount; i++)
+			{
+				if (i > 0)
+					Emit(",");
+				Identifier();
+				if (m_Choices->Choose(4) != 0)
+				{
+					Emit("=");
+					Expression(depth + 1);
+				}
+			}
+
+			if (terminate)
+				Emit(";");
+		}
+
+		/*
+			ControlStatement
+				: 'if' '(' Expression ')' Statement
+				| 'if' '(' Expression ')' Statement 'else' Statement
+				;
+		*/
+		void GrammarGenerator::ControlStatement(size_t depth)
+		{
+			Emit("if");
+			Emit("(");
+			Expression(depth + 1);
+			Emit(")");
+			Statement(depth + 1);
+			if (m_Choices->Choose(2))
+			{
+				Emit("else");
+				Statement(depth + 1);
+			}
+		}
+
+		/*
+			IterationStatement
+				: WhileStatement
+				| DoWhileStatement
+				| ForStatement
+				;
+		*/
+		void GrammarGenerator::IterationStatement(size_t depth)
+		{
+			switch (m_Choices->Choose(3))
+			{
+			case 0:
+				Emit("while");
+				Emit("(");
+				Expression(depth + 1);
+				Emit(")");
+				Statement(depth + 1);
+				break;
+			case 1:
+				Emit("do");
+				Statement(depth + 1);
+				Emit("while");
+				Emit("(");
+				Expression(depth + 1);
+				Emit(")");
+				Emit(";");
+				break;
+			default:
+				Emit("for");
+				Emit("(");
+				switch (m_Choices->Choose(3))
+				{
+				case 1:
+					VariableStatement(depth, false);
+					break;
+				case 2:
+					Expression(depth + 1);
+					break;
+				default:
+					break;
+				}
+				Emit(";");
+				if (m_Choices->Choose(2))
+					Expression(depth + 1);
+				Emit(";");
+				if (m_Choices->Choose(2))
+					Expression(depth + 1);
+				Emit(")");
+				Statement(depth + 1);
+				break;
+			}
+		}
+
+		/*
+			FunctionStatement
+				: 'function' DataTypeKeyword Identifier '(' OptionalFunctionParameterList ')' BlockStatement
+				;
+		*/
+		void GrammarGenerator::FunctionStatement(size_t depth)
+		{
+			Emit("function");
+			DataType(true);
+			Identifier();
+			Emit("(");
+			size_t parameterCount = m_Choices->Choose(4);
+			for (size_t i = 0; i < parameterCount; i++)
+			{
+				if (i > 0)
+					Emit(",");
+				if (m_Choices->Choose(4) == 1)
+					Emit("const");
+				DataType(false);
+				Identifier();
+				if (m_Choices->Choose(4) == 1)
+				{
+					Emit("=");
+					LiteralExpression();
+				}
+			}
+			Emit(")");
+			BlockStatement(depth);
+		}
+
+		/*
+			Expression
+				: AssignmentExpression
+				;
+
+			Covers every Level from AssignmentExpression down to PrimaryExpression. Operands are not parenthesized
+			so Precedence Climbing sees unbalanced Chains, only an Assignment inside an Operand needs Parentheses.
+		*/
+		void GrammarGenerator::Expression(size_t depth, bool operand)
+		{
+			if (depth >= m_Properties.MaxDepth)
+			{
+				PrimaryExpression();
+				return;
+			}
+
+			switch (m_Choices->Choose(8))
+			{
+			case 0:
+				PrimaryExpression();
+				break;
+			case 1:
+			case 2:
+				Expression(depth + 1, true);
+				Emit(s_BinaryOperators[m_Choices->Choose(CountOf(s_BinaryOperators))]);
+				Expression(depth + 1, true);
+				break;
+			case 3:
+				Emit(s_UnaryOperators[m_Choices->Choose(CountOf(s_UnaryOperators))]);
+				Expression(depth + 1, true);
+				break;
+			case 4:
+				if (operand)
+					Emit("(");
+				LHSExpression(depth + 1);
+				Emit(s_AssignmentOperators[m_Choices->Choose(CountOf(s_AssignmentOperators))]);
+				Expression(depth + 1);
+				if (operand)
+					Emit(")");
+				break;
+			case 5:
+				// PostfixExpression binds before MemberExpression, only a plain Identifier takes the Operator
+				Identifier();
+				Emit(m_Choices->Choose(2) ? "--" : "++");
+				break;
+			case 6:
+			{
+				Identifier();
+				Emit("(");
+				size_t argumentCount = m_Choices->Choose(4);
+				for (size_t i = 0; i < argumentCount; i++)
+				{
+					if (i > 0)
+						Emit(",");
+					Expression(depth + 1);
+				}
+				Emit(")");
+				break;
+			}
+			default:
+				Emit("(");
+				Expression(depth + 1);
+				Emit(")");
+				break;
+			}
+		}
+
+		/*
+			MemberExpression
+				: PrimaryExpression
+				| MemberExpression '.' IdentifierExpression
+				| MemberExpression '[' Expression ']'
+				;
+		*/
+		void GrammarGenerator::LHSExpression(size_t depth)
+		{
+			Identifier();
+			switch (depth >= m_Properties.MaxDepth ? 0 : m_Choices->Choose(4))
+			{
+			case 1:
+				Emit(".");
+				Identifier();
+				break;
+			case 2:
+				Emit("[");
+				Expression(depth + 1);
+				Emit("]");
+				break;
+			default:
+				break;
+			}
+		}
+
+		void GrammarGenerator::PrimaryExpression()
+		{
+			if (m_Choices->Choose(2))
+				LiteralExpression();
+			else
+				Identifier();
+		}
+
+		/*
+			LiteralExpression
+				: IntegerLiteral
+				| FloatLiteral
+				| StringLiteral
+				| BooleanLiteral
+				| NullLiteral
+				;
+		*/
+		void GrammarGenerator::LiteralExpression()
+		{
+			switch (m_Choices->Choose(6))
+			{
+			case 0:
+				Emit(std::to_string(m_Choices->Choose(65536)).c_str());
+				break;
+			case 1:
+				Emit((std::to_string(m_Choices->Choose(1024)) + "." + std::to_string(m_Choices->Choose(100))).c_str());
+				break;
+			case 2:
+				Emit(s_Strings[m_Choices->Choose(CountOf(s_Strings))]);
+				break;
+			case 3:
+				Emit(m_Choices->Choose(2) ? "true" : "false");
+				break;
+			case 4:
+				Emit("null");
+				break;
+			default:
+				// Lexer Limits, the Parser sees the Token Value only
+				Emit(m_Choices->Choose(2) ? "9223372036854775807" : "0x7fffffff");
+				break;
+			}
+		}
+
+		void GrammarGenerator::Identifier()
+		{
+			Emit(s_Identifiers[m_Choices->Choose(CountOf(s_Identifiers))]);
+		}
+
+		void GrammarGenerator::DataType(bool allowVoid)
+		{
+			Emit(s_DataTypes[m_Choices->Choose(CountOf(s_DataTypes) - (allowVoid ? 0 : 1))]);
+		}
+
+		void GrammarGenerator::Emit(const char* text)
+		{
+			// Tokens are always separated, '- -' must not lex as '--'
+			if (!m_Output.empty())
+				m_Output += (m_Output.back() == ';' || m_Output.back() == '{' || m_Output.back() == '}') ? '\n' : ' ';
+			m_Output += text;
+		}
+	}
+}
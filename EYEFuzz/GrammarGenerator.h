@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace Eye
+{
+	namespace Fuzz
+	{
+		/*
+			FuzzChoices
+				Reads the Fuzzer's Bytes as a Stream of Decisions.
+				Exhausted Data always picks 0, the shortest Production, so every Byte String maps to a finite Program.
+		*/
+		class FuzzChoices
+		{
+		public:
+			FuzzChoices(const uint8_t* data, size_t size);
+
+			size_t Choose(size_t count);
+			inline bool IsExhausted() const { return m_Index >= m_Size; }
+
+		private:
+			const uint8_t* m_Data;
+			size_t m_Size;
+			size_t m_Index = 0;
+		};
+
+		struct GrammarGeneratorProperties
+		{
+			size_t MaxDepth = 8;
+			size_t MaxStatements = 64;
+		};
+
+		/*
+			GrammarGenerator
+				Builds syntactically valid Programs following Specs/Grammar.txt, the Input Bytes pick the Productions.
+				Identifiers come from a small Pool so Declarations, Uses & Calls meet and reach Semantic & TypeChecker.
+		*/
+		class GrammarGenerator
+		{
+		public:
+			GrammarGenerator(const GrammarGeneratorProperties& properties = {});
+
+			std::string Generate(const uint8_t* data, size_t size);
+
+		private:
+			void Statement(size_t depth);
+			void BlockStatement(size_t depth);
+			void VariableStatement(size_t depth, bool terminate);
+			void ControlStatement(size_t depth);
+			void IterationStatement(size_t depth);
+			void FunctionStatement(size_t depth);
+
+			void Expression(size_t depth, bool operand = false);
+			void LHSExpression(size_t depth);
+			void PrimaryExpression();
+			void LiteralExpression();
+
+			void Identifier();
+			void DataType(bool allowVoid);
+			void Emit(const char* text);
+
+		private:
+			GrammarGeneratorProperties m_Properties;
+			FuzzChoices* m_Choices = nullptr;
+			std::string m_Output;
+			size_t m_StatementCount = 0;
+		};
+	}
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTCache.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+namespace Eye
+{
+	TEST(ASTCacheTest, String)
+	{
+		ASTCache cache;
+
+		auto first = cache.Get({ { "int x = 12;", EyeSourceType::String } });
+		auto second = cache.Get({ { "int x = 12;", EyeSourceType::String } });
+		ASSERT_EQ(first.get(), second.get());
+		ASSERT_EQ(first->Diagnostic.has_value(), false);
+		ASSERT_EQ(first->Program->GetStatementList().size(), 1);
+		ASSERT_EQ(first->GetSerializedAST().empty(), false);
+
+		auto failed = cache.Get({ { "int x = 12 +;", EyeSourceType::String } });
+		ASSERT_EQ(failed->Diagnostic.has_value(), true);
+		ASSERT_EQ(failed->Diagnostic->GetType(), Error::ErrorType::ParserSyntaxError);
+
+		ASSERT_EQ(cache.GetHitCount(), 1);
+		ASSERT_EQ(cache.GetMissCount(), 2);
+		ASSERT_EQ(cache.GetEntryCount(), 2);
+	}
+
+	TEST(ASTCacheTest, File)
+	{
+		ASTCache cache;
+		std::string filepath = (std::filesystem::temp_directory_path() / "ASTCacheTest.eye").string();
+
+		std::ofstream(filepath) << "int x = 12;";
+		auto first = cache.Get({ { filepath, EyeSourceType::File } });
+		auto second = cache.Get({ { filepath, EyeSourceType::File } });
+		ASSERT_EQ(first.get(), second.get());
+		ASSERT_EQ(first->Program->GetStatementList().size(), 1);
+
+		std::ofstream(filepath) << "int x = 12; int y = x;";
+		auto edited = cache.Get({ { filepath, EyeSourceType::File } });
+		ASSERT_NE(edited.get(), first.get());
+		ASSERT_EQ(edited->Program->GetStatementList().size(), 2);
+		ASSERT_EQ(first->Program->GetStatementList().size(), 1);
+
+		std::filesystem::remove(filepath);
+		auto missing = cache.Get({ { filepath, EyeSourceType::File } });
+		ASSERT_EQ(missing->Diagnostic.has_value(), true);
+		ASSERT_EQ(missing->Diagnostic->GetType(), Error::ErrorType::ASTGeneratorBadSource);
+
+		ASSERT_EQ(cache.GetHitCount(), 1);
+		ASSERT_EQ(cache.GetMissCount(), 2);
+	}
+
+	TEST(ASTCacheTest, Eviction)
+	{
+		std::string a = "int a = 1;", b = "int b = 2;", c = "int c = 3;";
+		ASTCache cache(3 * (a.size() + 40));
+
+		auto first = cache.Get({ { a, EyeSourceType::String } });
+		cache.Get({ { b, EyeSourceType::String } });
+		cache.Get({ { c, EyeSourceType::String } });
+		ASSERT_EQ(cache.GetEntryCount(), 3);
+
+		// a is used again, b is the least recently used when d arrives
+		ASSERT_EQ(cache.Get({ { a, EyeSourceType::String } }).get(), first.get());
+		cache.Get({ { "int d = 4;", EyeSourceType::String } });
+		ASSERT_EQ(cache.GetEntryCount(), 3);
+		ASSERT_EQ(cache.GetEvictionCount(), 1);
+		ASSERT_LE(cache.GetByteCount(), 3 * (a.size() + 40));
+
+		size_t misses = cache.GetMissCount();
+		ASSERT_EQ(cache.Get({ { a, EyeSourceType::String } }).get(), first.get());
+		cache.Get({ { b, EyeSourceType::String } });
+		ASSERT_EQ(cache.GetMissCount(), misses + 1);
+
+		// Entries over the whole Budget are never kept
+		std::string large;
+		for (size_t i = 0; i < 100; i++)
+			large += "int v" + std::to_string(i) + " = " + std::to_string(i) + ";";
+		auto uncached = cache.Get({ { large, EyeSourceType::String } });
+		ASSERT_EQ(uncached->Program->GetStatementList().size(), 100);
+		ASSERT_NE(cache.Get({ { large, EyeSourceType::String } }).get(), uncached.get());
+		ASSERT_EQ(cache.GetEntryCount(), 3);
+		ASSERT_EQ(first->Program->GetStatementList().size(), 1);
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	TEST(ASTGeneratorBatchTest, Sources)
+	{
+		ASTGenerator astGenerator;
+
+		std::vector<ASTGeneratorProperties> sources;
+		for (size_t i = 0; i < 64; i++)
+			sources.push_back({ { "function int add(int x, int y) { return x + y; } int number" + std::to_string(i) + " = add(" + std::to_string(i) + ", 2);", EyeSourceType::String } });
+
+		auto results = astGenerator.GenerateBatchAST(sources, 4);
+		ASSERT_EQ(results.size(), sources.size());
+		for (const auto& res : results)
+		{
+			ASSERT_EQ(res.has_value(), true);
+			ASSERT_EQ(res.value()->GetStatementList().size(), 2);
+		}
+	}
+
+	TEST(ASTGeneratorBatchTest, Diagnostics)
+	{
+		ASTGenerator astGenerator;
+
+		auto results = astGenerator.GenerateBatchAST({
+			{ { "int x = 12;", EyeSourceType::String } },
+			{ { "int x = 12 +;", EyeSourceType::String } },
+			{ { "int x = \"hello\";", EyeSourceType::String } },
+			{ { "x = 12;", EyeSourceType::String } },
+			{ { "Eye/Missing/Source.eye", EyeSourceType::File } },
+			{ { "int x = 12 $ 5;", EyeSourceType::String } },
+		}, 3);
+
+		ASSERT_EQ(results.size(), 6);
+		ASSERT_EQ(results[0].has_value(), true);
+		ASSERT_EQ(!results[1].has_value(), true);
+		ASSERT_EQ(results[1].error().GetType(), Error::ErrorType::ParserSyntaxError);
+		ASSERT_EQ(!results[2].has_value(), true);
+		ASSERT_EQ(results[2].error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+		ASSERT_EQ(!results[3].has_value(), true);
+		ASSERT_EQ(results[3].error().GetType(), Error::ErrorType::SemanticNotDeclared);
+		ASSERT_EQ(!results[4].has_value(), true);
+		ASSERT_EQ(results[4].error().GetType(), Error::ErrorType::ASTGeneratorBadSource);
+		ASSERT_EQ(!results[5].has_value(), true);
+		ASSERT_EQ(results[5].error().GetType(), Error::ErrorType::LexerUnexpectedToken);
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/ASTSerializer/StringSerializer.h"
+#include "Eye/TypeChecker/TypeTable.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+namespace Eye
+{
+	static std::string RepeatTerms(const std::string& term, const std::string& op, size_t count)
+	{
+		std::string source = term;
+		for (size_t i = 1; i < count; i++)
+			source += op + term;
+		return source;
+	}
+
+	TEST(ASTGeneratorNestingDepthTest, LongBinaryChain)
+	{
+		// String Sources are copied into every Token, Generated Code comes from a File
+		std::string filepath = (std::filesystem::temp_directory_path() / "NestingDepthTest.eye").string();
+		std::ofstream(filepath) << "int a = 1; int b = " + RepeatTerms("a", " + ", 100000) + "; int c = " + RepeatTerms("1", " + ", 100000) + "; b = b + c;";
+
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { filepath, EyeSourceType::File } });
+		std::filesystem::remove(filepath);
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(res.value()->GetStatementList().size(), 4);
+
+		const AST::Expression* initializer = static_cast<const AST::VariableStatement*>(res.value()->GetStatementList()[1].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		ASSERT_EQ(initializer->GetType(), AST::ExpressionType::BinaryExpression);
+		ASSERT_EQ(static_cast<const AST::BinaryExpression*>(initializer)->GetLeftSpine().size(), 99999);
+		ASSERT_EQ(res.value()->GetTypeTable()->GetType(static_cast<const AST::BinaryExpression*>(initializer)->GetLeftSpine().back()), Type::Integer);
+
+		// Folded bottom-up into a single Constant
+		initializer = static_cast<const AST::VariableStatement*>(res.value()->GetStatementList()[2].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		ASSERT_EQ(initializer->GetType(), AST::ExpressionType::LiteralExpression);
+		ASSERT_EQ(static_cast<const AST::LiteralExpression*>(initializer)->GetValue<AST::LiteralIntegerType>(), 100000);
+
+		ASTSerializer::StringSerializer astSerializer;
+		std::string serialized = astSerializer.Serialize(res.value().get());
+		size_t binaryCount = 0;
+		for (size_t pos = serialized.find("{\"BinaryExpression\""); pos != std::string::npos; pos = serialized.find("{\"BinaryExpression\"", pos + 1))
+			binaryCount++;
+		ASSERT_EQ(binaryCount, 100000);
+	}
+
+	TEST(ASTGeneratorNestingDepthTest, NestedBlocks)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "int a = 1;" + std::string(1000, '{') + "a = a + 1;" + std::string(1000, '}'), EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+
+		ASTGeneratorProperties properties = { { "int a = 1;" + std::string(2000, '{') + "int b = a;" + std::string(2000, '}'), EyeSourceType::String } };
+		res = astGenerator.GenerateAST(properties);
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ParserNestingLimit);
+
+		properties.MaxNestingDepth = 4096;
+		res = astGenerator.GenerateAST(properties);
+		ASSERT_EQ(res.has_value(), true);
+	}
+
+	TEST(ASTGeneratorNestingDepthTest, NestingLimit)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "int a = " + std::string(5000, '(') + "1" + std::string(5000, ')') + ";", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ParserNestingLimit);
+
+		res = astGenerator.GenerateAST({ { "int a = " + std::string(5000, '!') + "1;", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ParserNestingLimit);
+
+		ASTGeneratorProperties properties = { { "int a = " + std::string(100, '(') + "1" + std::string(100, ')') + ";", EyeSourceType::String } };
+		properties.MaxNestingDepth = 50;
+		res = astGenerator.GenerateAST(properties);
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ParserNestingLimit);
+
+		properties.MaxNestingDepth = 200;
+		res = astGenerator.GenerateAST(properties);
+		ASSERT_EQ(res.has_value(), true);
+	}
+}
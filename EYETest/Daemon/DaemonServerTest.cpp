@@ -0,0 +1,128 @@
+#pragma once
+
+#include "EYEDaemon/DaemonServer.h"
+#include "EYEDaemon/DaemonProtocol.h"
+
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace Eye
+{
+	static int ConnectDaemon(const std::string& socketPath)
+	{
+		sockaddr_un address = {};
+		address.sun_family = AF_UNIX;
+		std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+		// The Server Thread may not be Listening yet
+		for (size_t attempt = 0; attempt < 500; attempt++)
+		{
+			int socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+			if (connect(socket, (sockaddr*)&address, sizeof(address)) == 0)
+				return socket;
+			close(socket);
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		return -1;
+	}
+
+	TEST(DaemonTest, Protocol)
+	{
+		int sockets[2];
+		ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+		Daemon::DaemonConnection client(sockets[0]);
+		Daemon::DaemonConnection server(sockets[1]);
+
+		ASSERT_EQ(client.WriteRequest({ Daemon::DaemonRequestType::Compile, "/tmp/a b.eye" }), true);
+		ASSERT_EQ(client.WriteRequest({ Daemon::DaemonRequestType::Stats, "" }), true);
+		Daemon::DaemonRequest request;
+		ASSERT_EQ(server.ReadRequest(request), true);
+		ASSERT_EQ(request.Type, Daemon::DaemonRequestType::Compile);
+		ASSERT_EQ(request.Path, "/tmp/a b.eye");
+		ASSERT_EQ(server.HasRequest(), true);
+		ASSERT_EQ(server.ReadRequest(request), true);
+		ASSERT_EQ(request.Type, Daemon::DaemonRequestType::Stats);
+		ASSERT_EQ(request.Path, "");
+
+		// A partial Line is not a Request yet
+		ASSERT_EQ(write(sockets[0], "shut", 4), 4);
+		ASSERT_EQ(server.Receive(), true);
+		ASSERT_EQ(server.HasRequest(), false);
+		ASSERT_EQ(write(sockets[0], "down\n", 5), 5);
+		ASSERT_EQ(server.Receive(), true);
+		ASSERT_EQ(server.ReadRequest(request), true);
+		ASSERT_EQ(request.Type, Daemon::DaemonRequestType::Shutdown);
+
+		ASSERT_EQ(server.WriteResponse({ true, "line\n\nmore" }), true);
+		ASSERT_EQ(server.WriteResponse({ false, "" }), true);
+		Daemon::DaemonResponse response;
+		ASSERT_EQ(client.ReadResponse(response), true);
+		ASSERT_EQ(response.Success, true);
+		ASSERT_EQ(response.Payload, "line\n\nmore");
+		ASSERT_EQ(client.ReadResponse(response), true);
+		ASSERT_EQ(response.Success, false);
+		ASSERT_EQ(response.Payload, "");
+
+		ASSERT_EQ(Daemon::StringToDaemonRequestType("bogus"), Daemon::DaemonRequestType::Invalid);
+		ASSERT_EQ(Daemon::StringToDaemonRequestType(Daemon::DaemonRequestTypeToString(Daemon::DaemonRequestType::Check)), Daemon::DaemonRequestType::Check);
+	}
+
+	TEST(DaemonTest, IdleConnections)
+	{
+		std::string socketPath = (std::filesystem::temp_directory_path() / ("DaemonTest-" + std::to_string(getpid()) + ".sock")).string();
+		std::string filepath = (std::filesystem::temp_directory_path() / "DaemonTest.eye").string();
+		std::ofstream(filepath) << "int x = 12;";
+
+		// One Worker, Idle & half-sent Connections must not hold it
+		Daemon::DaemonServer server(socketPath, 1);
+		bool ran = false;
+		std::thread serverThread([&server, &ran]() { ran = server.Run(); });
+
+		std::vector<int> idle;
+		for (size_t i = 0; i < 4; i++)
+			idle.push_back(ConnectDaemon(socketPath));
+		ASSERT_EQ(write(idle.back(), "check /tm", 9), 9);
+
+		int socket = ConnectDaemon(socketPath);
+		ASSERT_GE(socket, 0);
+		{
+			Daemon::DaemonConnection connection(socket);
+			Daemon::DaemonResponse response;
+			ASSERT_EQ(connection.WriteRequest({ Daemon::DaemonRequestType::Check, filepath }), true);
+			ASSERT_EQ(connection.ReadResponse(response), true);
+			ASSERT_EQ(response.Success, true);
+
+			ASSERT_EQ(connection.WriteRequest({ Daemon::DaemonRequestType::Compile, filepath }), true);
+			ASSERT_EQ(connection.ReadResponse(response), true);
+			ASSERT_EQ(response.Success, true);
+			ASSERT_EQ(response.Payload.empty(), false);
+
+			ASSERT_EQ(connection.WriteRequest({ Daemon::DaemonRequestType::Check, "relative.eye" }), true);
+			ASSERT_EQ(connection.ReadResponse(response), true);
+			ASSERT_EQ(response.Success, false);
+
+			ASSERT_EQ(connection.WriteRequest({ Daemon::DaemonRequestType::Stats, "" }), true);
+			ASSERT_EQ(connection.ReadResponse(response), true);
+			ASSERT_EQ(response.Payload.starts_with("entries 1\n"), true);
+			ASSERT_NE(response.Payload.find("hits 1\n"), std::string::npos);
+
+			ASSERT_EQ(connection.WriteRequest({ Daemon::DaemonRequestType::Shutdown, "" }), true);
+			ASSERT_EQ(connection.ReadResponse(response), true);
+			ASSERT_EQ(response.Success, true);
+		}
+
+		serverThread.join();
+		ASSERT_EQ(ran, true);
+		for (int idleSocket : idle)
+			close(idleSocket);
+		std::filesystem::remove(filepath);
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "EYEFuzz/GrammarGenerator.h"
+#include "EYEFuzz/FuzzTarget.h"
+
+#include <gtest/gtest.h>
+#include <random>
+
+namespace Eye
+{
+	TEST(FuzzGrammarGeneratorTest, Deterministic)
+	{
+		Fuzz::GrammarGenerator generator;
+		ASSERT_EQ(generator.Generate(nullptr, 0), "");
+
+		std::vector<uint8_t> data(512);
+		std::mt19937_64 random(7);
+		for (auto& byte : data)
+			byte = (uint8_t)random();
+		ASSERT_EQ(generator.Generate(data.data(), data.size()), generator.Generate(data.data(), data.size()));
+	}
+
+	TEST(FuzzGrammarGeneratorTest, ProgramsParse)
+	{
+		Fuzz::GrammarGenerator generator;
+		std::mt19937_64 random(1);
+		std::vector<uint8_t> data;
+		for (size_t i = 0; i < 500; i++)
+		{
+			data.resize(random() % 2048);
+			for (auto& byte : data)
+				byte = (uint8_t)random();
+
+			std::string text = generator.Generate(data.data(), data.size());
+			ASSERT_EQ(Fuzz::RunFuzzPipeline(Fuzz::FuzzStage::Parser, text), Fuzz::FuzzStage::Parser) << text;
+		}
+	}
+
+	TEST(FuzzGrammarGeneratorTest, Findings)
+	{
+		// Inputs that used to end in EYE_LOG_CRITICAL or a Null Dereference, now Diagnostics
+		ASSERT_EQ(Fuzz::RunFuzzPipeline(Fuzz::FuzzStage::TypeChecker, "while (true) { continue; break; }"), Fuzz::FuzzStage::TypeChecker);
+		ASSERT_EQ(Fuzz::RunFuzzPipeline(Fuzz::FuzzStage::TypeChecker, "function int f() { ; return 1; }"), Fuzz::FuzzStage::TypeChecker);
+		ASSERT_EQ(Fuzz::RunFuzzPipeline(Fuzz::FuzzStage::TypeChecker, "int a = 1; int b = ++a;"), Fuzz::FuzzStage::TypeChecker);
+		ASSERT_EQ(Fuzz::RunFuzzPipeline(Fuzz::FuzzStage::TypeChecker, "{ { function float i() { return; } } }"), Fuzz::FuzzStage::Semantic);
+		ASSERT_EQ(Fuzz::RunFuzzPipeline(Fuzz::FuzzStage::TypeChecker, "bool b = null;"), Fuzz::FuzzStage::Semantic);
+		ASSERT_EQ(Fuzz::RunFuzzPipeline(Fuzz::FuzzStage::TypeChecker, "int a = $;"), Fuzz::FuzzStage::None);
+	}
+}
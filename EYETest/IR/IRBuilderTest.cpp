@@ -0,0 +1,201 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/IR/IRVerifier.h"
+#include "Eye/IR/IRPrinter.h"
+#include "EYETest/IR/IRTestUtility.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	static size_t CountOpcode(const IR::BasicBlock* block, IR::Opcode opcode)
+	{
+		return std::count_if(block->GetInstructions().begin(), block->GetInstructions().end(), [opcode](const auto& instruction) { return instruction->GetOpcode() == opcode; });
+	}
+
+	static const IR::BasicBlock* GetBlock(const IR::Function* function, const std::string& name)
+	{
+		for (const auto& block : function->GetBlocks())
+		{
+			if (block->GetName() == name)
+				return block.get();
+		}
+		return nullptr;
+	}
+
+	TEST(IRBuilderTest, Function)
+	{
+		auto module = GenerateIR("function int add(int x, int y) { return x + y; }");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+
+		IR::IRPrinter irPrinter;
+		ASSERT_EQ(irPrinter.Print(module.get()), "function void @.init()\n{\nentry:\n\tret void\n}\n\nfunction int @add(int %x, int %y)\n{\nentry:\n\t%0 = add int %x, %y\n\tret int %0\n}\n");
+	}
+
+	TEST(IRBuilderTest, ControlMerge)
+	{
+		auto module = GenerateIR("function int pick(bool c, int y) { int x = 1; if (c) { x = 2; } else { x = 3; } return x + y; }");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+
+		const IR::BasicBlock* endBlock = GetBlock(module->GetFunction("pick"), "if.end");
+		ASSERT_NE(endBlock, nullptr);
+		// Only x changes along the Branches, y needs no Phi
+		ASSERT_EQ(CountOpcode(endBlock, IR::Opcode::Phi), 1);
+		ASSERT_EQ(endBlock->GetInstructions()[0]->GetOperands().size(), 2);
+	}
+
+	TEST(IRBuilderTest, Loop)
+	{
+		auto module = GenerateIR("function int sum(int n) { int total = 0; int unused = 7; for (int i = 0; i < n; i++) { total = total + i; } return total; }");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+
+		const IR::BasicBlock* conditionBlock = GetBlock(module->GetFunction("sum"), "for.cond");
+		ASSERT_NE(conditionBlock, nullptr);
+		// total & i are carried around the Loop, the unchanged unused is not
+		ASSERT_EQ(CountOpcode(conditionBlock, IR::Opcode::Phi), 2);
+	}
+
+	TEST(IRBuilderTest, JumpStatements)
+	{
+		auto module = GenerateIR("function int f(int n) { int i = 0; do { i++; if (i > n) { break; i = 100; } if (i % 2 == 0) continue; n = n - 1; } while (true); return i; }", false);
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+
+		// Code after break is dropped
+		for (const auto& block : module->GetFunction("f")->GetBlocks())
+			ASSERT_NE(block->GetName().substr(0, 4), "dead");
+	}
+
+	TEST(IRBuilderTest, GlobalsAndShortCircuit)
+	{
+		auto module = GenerateIR("int g = 1; function bool both(bool a, bool b) { return a && b; } function void bump() { g = g + 1; } bump();");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+		ASSERT_EQ(module->GetGlobals().size(), 1);
+		ASSERT_EQ(module->GetGlobals()[0].Name, "g");
+
+		const IR::Function* both = module->GetFunction("both");
+		ASSERT_EQ(both->GetBlocks().size(), 3);
+		ASSERT_EQ(CountOpcode(GetBlock(both, "and.end"), IR::Opcode::Phi), 1);
+
+		const IR::BasicBlock* bump = module->GetFunction("bump")->GetEntryBlock();
+		ASSERT_EQ(CountOpcode(bump, IR::Opcode::Load), 1);
+		ASSERT_EQ(CountOpcode(bump, IR::Opcode::Store), 1);
+	}
+
+	TEST(IRBuilderTest, DefaultParameters)
+	{
+		auto module = GenerateIR("function float scale(float x, float factor = 2) { return x * factor; } float r = scale(3.0);");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+
+		IR::IRPrinter irPrinter;
+		ASSERT_NE(irPrinter.Print(module.get()).find("call float @scale(float 3.0, float 2.0)"), std::string::npos);
+	}
+
+	TEST(IRBuilderTest, Structs)
+	{
+		auto module = GenerateIR("struct Vec { float x; float y; } struct Body { int id; Vec position; } Body g; g.position.y = 2; function float sum(float x) { Vec v; v.x = x; v.y = g.position.y; Vec w = v; w.y += 1; return w.x + w.y; }");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+		ASSERT_EQ(module->GetGlobals().size(), 1);
+		ASSERT_EQ(module->GetGlobals()[0].VariableType, Type::Struct);
+		ASSERT_EQ(module->GetGlobals()[0].Slots, (std::vector<Type>{ Type::Integer, Type::Float, Type::Float }));
+
+		// Fields of Globals are constant Offsets, Struct Locals live in SSA Values
+		IR::IRPrinter irPrinter;
+		std::string ir = irPrinter.Print(module.get());
+		ASSERT_NE(ir.find("global { int, float, float } @g\n"), std::string::npos);
+		ASSERT_NE(ir.find("store float 2.0, @g+2\n"), std::string::npos);
+		const IR::BasicBlock* sum = module->GetFunction("sum")->GetEntryBlock();
+		ASSERT_EQ(CountOpcode(sum, IR::Opcode::Load), 1);
+		ASSERT_EQ(CountOpcode(sum, IR::Opcode::Store), 0);
+		ASSERT_NE(ir.find("load float @g+2\n"), std::string::npos);
+
+		// Without a TypeTable Fields have no Offsets
+		ASSERT_EQ(GenerateIR("struct Vec { float x; } Vec v; v.x = 1;", false), nullptr);
+	}
+
+	TEST(IRBuilderTest, Arrays)
+	{
+		auto module = GenerateIR("float[4] g; function void sum(int i) { int[8] a; a[i] = i; g[i] += a[i]; float x = g[0]; { int[8] a; a[0] = 1; } }");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+		ASSERT_EQ(module->GetArrays().size(), 1);
+		ASSERT_EQ(module->GetArrays()[0].ElementType, Type::Float);
+		ASSERT_EQ(module->GetArrays()[0].Length, 4);
+
+		// Locals are reset at their Declaration & shadowing Arrays get their own Symbol
+		const IR::Function* sum = module->GetFunction("sum");
+		ASSERT_EQ(sum->GetArrays().size(), 2);
+		ASSERT_EQ(CountOpcode(sum->GetEntryBlock(), IR::Opcode::ClearArray), 2);
+		ASSERT_EQ(CountOpcode(sum->GetEntryBlock(), IR::Opcode::BoundsCheck), 5);
+		ASSERT_EQ(CountOpcode(sum->GetEntryBlock(), IR::Opcode::StoreElement), 3);
+		ASSERT_EQ(CountOpcode(sum->GetEntryBlock(), IR::Opcode::LoadElement), 3);
+
+		IR::IRPrinter irPrinter;
+		std::string ir = irPrinter.Print(module.get());
+		ASSERT_NE(ir.find("array float[4] @g\n"), std::string::npos);
+		ASSERT_NE(ir.find("\tarray int[8] %a.1\n"), std::string::npos);
+		ASSERT_NE(ir.find("boundscheck %a.0[%i]\n"), std::string::npos);
+		ASSERT_NE(ir.find("storeelem int 1, %a.1[0]\n"), std::string::npos);
+	}
+
+	TEST(IRBuilderTest, Closures)
+	{
+		auto module = GenerateIR("function int f(int n) { int total = 0; int step = 3; function void add(int v) { total = total + v * step; } function int twice(int n) { add(n); add(n); return total; } for (int i = 0; i < n; i++) { add(i); } return twice(n); } { int x = 1; function int g() { return x; } x = g(); }");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+
+		// Closures are lifted & take their Captures after their Parameters, only total is assigned by one
+		IR::IRPrinter irPrinter;
+		std::string ir = irPrinter.Print(module.get());
+		ASSERT_NE(ir.find("function void @f.add(int %v, int %total, int %step)\n"), std::string::npos);
+		ASSERT_NE(ir.find("function int @f.twice(int %n, int %total, int %step)\n"), std::string::npos);
+		ASSERT_NE(ir.find("function int @.init.g(int %x)\n"), std::string::npos);
+		ASSERT_NE(ir.find("\t%0 = box int 0\n"), std::string::npos);
+		ASSERT_NE(ir.find("storebox int %2, %total\n"), std::string::npos);
+		ASSERT_NE(ir.find("call void @f.add(int %1, int %0, int 3)\n"), std::string::npos);
+		ASSERT_EQ(CountOpcode(module->GetFunction("f")->GetEntryBlock(), IR::Opcode::Box), 1);
+		ASSERT_EQ(CountOpcode(module->GetFunction(".init.g")->GetEntryBlock(), IR::Opcode::LoadBox), 0);
+
+		// Captures must be scalar Locals
+		ASSERT_EQ(GenerateIR("function int f() { int[4] a; function int g() { return a[0]; } return g(); }"), nullptr);
+	}
+
+	TEST(IRBuilderTest, Namespaces)
+	{
+		auto module = GenerateIR("namespace Math { int k = 2; function int sq(int x) { return x * x * k; } namespace Trig { function int sq(int x) { return Math::sq(x) + 1; } } } int r = Math::sq(3) + Math.Trig.sq(1);");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+
+		// Members are plain Globals & Functions under their qualified Names, called directly
+		ASSERT_NE(module->GetFunction("Math::sq"), nullptr);
+		ASSERT_NE(module->GetFunction("Math::Trig::sq"), nullptr);
+		IR::IRPrinter irPrinter;
+		std::string ir = irPrinter.Print(module.get());
+		ASSERT_NE(ir.find("call int @Math::sq(int 3)"), std::string::npos);
+		ASSERT_NE(ir.find("call int @Math::Trig::sq(int 1)"), std::string::npos);
+	}
+
+	TEST(IRBuilderTest, Verifier)
+	{
+		IR::Module module;
+		IR::Function* function = module.CreateFunction("broken", Type::Integer);
+		IR::BasicBlock* entry = function->CreateBlock("entry");
+		entry->Append(std::make_unique<IR::Instruction>(IR::Opcode::Add, Type::Integer, std::vector<IR::Value*>{ function->GetConstant((IntegerType)1), function->GetConstant((FloatType)1) }));
+
+		IR::IRVerifier irVerifier;
+		auto res = irVerifier.Verify(&module);
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::IRVerifierInvalid);
+
+		entry->Append(std::make_unique<IR::Instruction>(IR::Opcode::Return, Type::Void, std::vector<IR::Value*>{ entry->GetInstructions()[0].get() }));
+		res = irVerifier.Verify(&module);
+		ASSERT_EQ(res.has_value(), false);
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/IR/IRBuilder.h"
+
+namespace Eye
+{
+	// Unoptimized IR of a Source, nullptr if it does not build
+	inline std::unique_ptr<IR::Module> GenerateIR(const std::string& source, bool typeCheck = true)
+	{
+		ASTGenerator astGenerator;
+		auto ast = astGenerator.GenerateAST({ { source, EyeSourceType::String }, typeCheck, true, false, false });
+		if (!ast.has_value())
+			return nullptr;
+
+		IR::IRBuilder irBuilder;
+		auto module = irBuilder.Build(ast.value().get());
+		if (!module.has_value())
+			return nullptr;
+		return std::move(module.value());
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/IR/IRVerifier.h"
+#include "Eye/IR/Inliner.h"
+#include "EYETest/IR/IRTestUtility.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	static size_t CountCalls(const IR::Function* function, const std::string& callee = "")
+	{
+		size_t count = 0;
+		for (const auto& block : function->GetBlocks())
+		{
+			for (const auto& instruction : block->GetInstructions())
+			{
+				if (instruction->GetOpcode() == IR::Opcode::Call && (callee.empty() || instruction->GetSymbol() == callee))
+					count++;
+			}
+		}
+		return count;
+	}
+
+	TEST(IRInlinerTest, Accessors)
+	{
+		auto module = GenerateIR("function int square(int x) { return x * x; } function int abs(int x) { if (x < 0) { return -x; } return x; } function int norm(int a, int b) { return square(a) + square(abs(b)); }");
+		ASSERT_NE(module, nullptr);
+
+		IR::Inliner inliner;
+		inliner.Inline(module.get());
+		ASSERT_EQ(inliner.GetInlinedCallCount(), 3);
+		ASSERT_EQ(CountCalls(module->GetFunction("norm")), 0);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+
+	TEST(IRInlinerTest, Recursion)
+	{
+		auto module = GenerateIR("function int fact(int n) { if (n < 2) { return 1; } return n * fact(n - 1); } function int twice(int n) { return fact(n) * 2; } int r = twice(4);");
+		ASSERT_NE(module, nullptr);
+
+		IR::Inliner inliner;
+		inliner.Inline(module.get());
+		ASSERT_EQ(CountCalls(module->GetFunction("fact"), "fact"), 1);
+		ASSERT_EQ(CountCalls(module->GetFunction("twice"), "fact"), 1);
+		ASSERT_EQ(CountCalls(module->GetFunction(IR::Module::InitFunctionName), "twice"), 0);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+
+	TEST(IRInlinerTest, SizeBudget)
+	{
+		auto module = GenerateIR("function int poly(int x) { return x * x * x + 3 * x * x - 7 * x + 11; } int a = poly(2); int b = poly(3);");
+		ASSERT_NE(module, nullptr);
+
+		IR::Inliner inliner;
+		inliner.Inline(module.get(), { 4 });
+		ASSERT_EQ(inliner.GetInlinedCallCount(), 0);
+
+		inliner.Inline(module.get(), { 16 });
+		ASSERT_EQ(inliner.GetInlinedCallCount(), 2);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+
+	TEST(IRInlinerTest, DefaultParameters)
+	{
+		auto module = GenerateIR("function int offset(int x, int by = 10) { return x + by; } int r = offset(1); function int loop(int n) { int t = 0; while (n > 0) { t = offset(t); n--; } return t; }");
+		ASSERT_NE(module, nullptr);
+
+		IR::Inliner inliner;
+		inliner.Inline(module.get());
+		ASSERT_EQ(inliner.GetInlinedCallCount(), 2);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+}
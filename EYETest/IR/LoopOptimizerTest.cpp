@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/IR/IRVerifier.h"
+#include "Eye/IR/LoopOptimizer.h"
+#include "EYETest/IR/IRTestUtility.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	static size_t CountOpcode(const IR::BasicBlock* block, IR::Opcode opcode)
+	{
+		size_t count = 0;
+		for (const auto& instruction : block->GetInstructions())
+		{
+			if (instruction->GetOpcode() == opcode)
+				count++;
+		}
+		return count;
+	}
+
+	static size_t CountOpcode(const IR::Function* function, IR::Opcode opcode)
+	{
+		size_t count = 0;
+		for (const auto& block : function->GetBlocks())
+			count += CountOpcode(block.get(), opcode);
+		return count;
+	}
+
+	TEST(IRLoopOptimizerTest, HoistInvariants)
+	{
+		auto module = GenerateIR("function int sum(int a, int b, int n) { int s = 0; while (n > 0) { s = s + a * b + a / 4; n--; } return s; }");
+		ASSERT_NE(module, nullptr);
+
+		IR::LoopOptimizer loopOptimizer;
+		loopOptimizer.Optimize(module.get(), { .ReduceStrength = false, .Unroll = false });
+		ASSERT_EQ(loopOptimizer.GetStatistics().HoistedInstructions, 2);
+
+		const IR::Function* function = module->GetFunction("sum");
+		ASSERT_EQ(CountOpcode(function->GetEntryBlock(), IR::Opcode::Mul), 1);
+		ASSERT_EQ(CountOpcode(function->GetEntryBlock(), IR::Opcode::Div), 1);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+
+	TEST(IRLoopOptimizerTest, KeepTrappingDivision)
+	{
+		auto module = GenerateIR("function int quotient(int a, int b, int n) { int s = 0; while (n > 0) { s = s + a / b; n--; } return s; }");
+		ASSERT_NE(module, nullptr);
+
+		IR::LoopOptimizer loopOptimizer;
+		loopOptimizer.Optimize(module.get());
+		ASSERT_EQ(loopOptimizer.GetStatistics().HoistedInstructions, 0);
+		ASSERT_EQ(CountOpcode(module->GetFunction("quotient")->GetEntryBlock(), IR::Opcode::Div), 0);
+	}
+
+	TEST(IRLoopOptimizerTest, ReduceStrength)
+	{
+		auto module = GenerateIR("function int scaled(int k, int n) { int s = 0; int i = 0; while (i < n) { s = s + i * k + (i << 3); i++; } return s; }");
+		ASSERT_NE(module, nullptr);
+
+		IR::LoopOptimizer loopOptimizer;
+		loopOptimizer.Optimize(module.get());
+		ASSERT_EQ(loopOptimizer.GetStatistics().ReducedInductions, 2);
+
+		const IR::Function* function = module->GetFunction("scaled");
+		ASSERT_EQ(CountOpcode(function, IR::Opcode::Mul), 0);
+		ASSERT_EQ(CountOpcode(function, IR::Opcode::Shl), 0);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+
+	TEST(IRLoopOptimizerTest, Unroll)
+	{
+		auto module = GenerateIR("function int triangle() { int s = 0; for (int i = 0; i < 4; i++) { s = s + i; } return s; } function int open(int n) { int s = 0; for (int i = 0; i < n; i++) { s = s + i; } return s; } function int large() { int s = 0; for (int i = 0; i < 100; i++) { s = s + i; } return s; }");
+		ASSERT_NE(module, nullptr);
+
+		IR::LoopOptimizer loopOptimizer;
+		loopOptimizer.Optimize(module.get());
+		ASSERT_EQ(loopOptimizer.GetStatistics().UnrolledLoops, 1);
+		ASSERT_EQ(CountOpcode(module->GetFunction("triangle"), IR::Opcode::Phi), 0);
+		ASSERT_EQ(CountOpcode(module->GetFunction("triangle"), IR::Opcode::Branch), 0);
+		ASSERT_NE(CountOpcode(module->GetFunction("open"), IR::Opcode::Branch), 0);
+		ASSERT_NE(CountOpcode(module->GetFunction("large"), IR::Opcode::Branch), 0);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+
+	TEST(IRLoopOptimizerTest, EliminateBoundsChecks)
+	{
+		auto module = GenerateIR("int[16] g; function int fill(int n) { int[16] a; for (int i = 0; i < 16; i++) a[i] = i * n; for (int i = 15; i >= 1; i--) a[i - 1] += a[i]; return a[0] + g[3]; } function int scan(int n) { int s = 0; for (int i = 0; i <= 16; i++) s += g[i]; for (int i = 0; i < n; i++) s += g[i]; return s; }");
+		ASSERT_NE(module, nullptr);
+		ASSERT_EQ(CountOpcode(module->GetFunction("fill"), IR::Opcode::BoundsCheck), 5);
+
+		IR::LoopOptimizer loopOptimizer;
+		loopOptimizer.Optimize(module.get(), { .Unroll = false });
+		ASSERT_EQ(loopOptimizer.GetStatistics().EliminatedBoundsChecks, 5);
+		ASSERT_EQ(CountOpcode(module->GetFunction("fill"), IR::Opcode::BoundsCheck), 0);
+
+		// 'i <= 16' reaches past the last Element, 'i < n' has no Constant Bound
+		ASSERT_EQ(CountOpcode(module->GetFunction("scan"), IR::Opcode::BoundsCheck), 2);
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+
+	TEST(IRLoopOptimizerTest, Vectorize)
+	{
+		std::string arrays = "int[32] a; int[32] b; int[32] c; float[16] x; float[16] y; ";
+		auto module = GenerateIR(arrays + "function void add(int n) { for (int i = 0; i < n; i++) c[i] = a[i] + b[i]; } function void scale(float k) { for (int i = 0; i < 16; i++) y[i] = k * x[i]; } function void shift(int n) { for (int i = 1; i < n; i++) c[i] -= 3; }"
+			+ "function void reverse(int n) { for (int i = 0; i < n; i++) c[i] = 3 - a[i]; } function int sum(int n) { int s = 0; for (int i = 0; i < n; i++) s += a[i]; return s; } function void offset(int n) { for (int i = 0; i < n; i++) c[i] = a[i + 1] + b[i]; } function void divide(int n) { for (int i = 0; i < n; i++) c[i] = a[i] / b[i]; }");
+		ASSERT_NE(module, nullptr);
+
+		IR::LoopOptimizer loopOptimizer;
+		loopOptimizer.Optimize(module.get());
+		ASSERT_EQ(loopOptimizer.GetStatistics().VectorizedLoops, 3);
+		for (const char* name : { "add", "scale", "shift" })
+		{
+			ASSERT_EQ(CountOpcode(module->GetFunction(name), IR::Opcode::ArrayKernel), 1);
+			ASSERT_EQ(CountOpcode(module->GetFunction(name), IR::Opcode::Branch), 0);
+		}
+
+		const IR::ArrayKernel& add = module->GetFunction("add")->GetKernels()[0];
+		ASSERT_EQ(add.Operation, IR::Opcode::Add);
+		ASSERT_EQ(add.ElementType, Type::Integer);
+		ASSERT_EQ(add.Target, "c");
+		ASSERT_EQ(add.Left, "a");
+		ASSERT_EQ(add.Right, "b");
+
+		// 'k * x[i]' commutes, the Invariant Operand is broadcast
+		const IR::ArrayKernel& scale = module->GetFunction("scale")->GetKernels()[0];
+		ASSERT_EQ(scale.Operation, IR::Opcode::Mul);
+		ASSERT_EQ(scale.Left, "x");
+		ASSERT_EQ(scale.Right, "");
+
+		// Scalar left Operand of a Sub, Reduction, shifted Index & trapping int Division stay scalar
+		for (const char* name : { "reverse", "sum", "offset", "divide" })
+		{
+			ASSERT_EQ(CountOpcode(module->GetFunction(name), IR::Opcode::ArrayKernel), 0);
+			ASSERT_NE(CountOpcode(module->GetFunction(name), IR::Opcode::Branch), 0);
+		}
+		ASSERT_EQ(IR::IRVerifier().Verify(module.get()).has_value(), true);
+	}
+}
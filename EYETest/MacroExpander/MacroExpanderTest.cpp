@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/Lexer/Lexer.h"
+#include "Eye/MacroExpander/MacroExpander.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/ASTSerializer/StringSerializer.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	static std::string SerializeMacroSource(const std::string& source)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { source, EyeSourceType::String }, false, true });
+		if (!res.has_value())
+			return std::string(res.error().GetMessage());
+
+		ASTSerializer::StringSerializer astSerializer;
+		return astSerializer.Serialize(res.value().get());
+	}
+
+	TEST(MacroExpanderTest, Expand)
+	{
+		ASSERT_EQ(SerializeMacroSource("macro square(x) { ((x) * (x)) } int y = square!(3 + 1);"), SerializeMacroSource("int y = ((3 + 1) * (3 + 1));"));
+		ASSERT_EQ(SerializeMacroSource("macro square(x) { ((x) * (x)) }\nmacro twice(f, x) { f!(x) + f!(x) }\nint y = twice!(square, 2);"), SerializeMacroSource("int y = ((2) * (2)) + ((2) * (2));"));
+		ASSERT_EQ(SerializeMacroSource("macro call(f, a, b) { f(a, b) } function int add(int a, int b) { return a + b; } int y = call!(add, add(1, 2), (3 * 4));"), SerializeMacroSource("function int add(int a, int b) { return a + b; } int y = add(add(1, 2), (3 * 4));"));
+		ASSERT_EQ(SerializeMacroSource("macro zero() { 0 } int y = zero!();"), SerializeMacroSource("int y = 0;"));
+	}
+
+	TEST(MacroExpanderTest, Hygiene)
+	{
+		ASTGenerator astGenerator;
+
+		// The Macro's tmp neither clashes with the Caller's tmp nor with the tmp of another Expansion in the same Scope
+		auto res = astGenerator.GenerateAST({ { "macro swap(a, b) { int tmp = a; a = b; b = tmp; } int tmp = 1; int x = 2; swap!(tmp, x); swap!(x, tmp);", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+
+		res = astGenerator.GenerateAST({ { "macro declare() { int hidden = 1; } declare!(); int y = hidden;", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticNotDeclared);
+		// Arrays & Structs declared in the Body are Locals too
+		res = astGenerator.GenerateAST({ { "macro declare() { int[4] hidden; } declare!(); int y = hidden[0];", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticNotDeclared);
+
+		res = astGenerator.GenerateAST({ { "struct V { int x; } macro declare() { V hidden; } declare!(); int y = hidden.x;", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticNotDeclared);
+
+		res = astGenerator.GenerateAST({ { "struct V { int x; } macro copy(a) { V v; v.x = a.x; int[2] buf; buf[0] = v.x; } V v; int[2] buf; copy!(v); copy!(v);", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+	}
+
+	TEST(MacroExpanderTest, Cache)
+	{
+		Lexer lexer;
+		MacroExpander macroExpander;
+
+		auto tokens = lexer.Tokenize({ "macro square(x) { ((x) * (x)) } int a = square!(3); int b = square!(3); int c = square!(3); int d = square!(3.5);", EyeSourceType::String });
+		ASSERT_EQ(tokens.has_value(), true);
+		auto res = macroExpander.Expand(std::move(tokens.value()));
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(macroExpander.GetExpansionCount(), 4);
+		ASSERT_EQ(macroExpander.GetCacheHitCount(), 2);
+		ASSERT_EQ(macroExpander.GetCacheSize(), 2);
+
+		// Equal Definitions in another Source reuse the cached Expansions
+		tokens = lexer.Tokenize({ "macro square(x) { ((x) * (x)) } int e = square!(3);", EyeSourceType::String });
+		ASSERT_EQ(tokens.has_value(), true);
+		res = macroExpander.Expand(std::move(tokens.value()));
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(macroExpander.GetCacheHitCount(), 3);
+
+		tokens = lexer.Tokenize({ "macro square(x) { (x) * (x) } int e = square!(3);", EyeSourceType::String });
+		ASSERT_EQ(tokens.has_value(), true);
+		res = macroExpander.Expand(std::move(tokens.value()));
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(macroExpander.GetCacheHitCount(), 3);
+		ASSERT_EQ(macroExpander.GetCacheSize(), 3);
+		// Expanders handed the same Cache share it, as every Source an ASTGenerator or ModuleLoader expands does
+		auto cache = std::make_shared<MacroExpansionCache>();
+		MacroExpander first(cache), second(cache);
+		tokens = lexer.Tokenize({ "macro square(x) { ((x) * (x)) } int a = square!(3);", EyeSourceType::String });
+		ASSERT_EQ(first.Expand(std::move(tokens.value())).has_value(), true);
+		tokens = lexer.Tokenize({ "macro square(x) { ((x) * (x)) } int b = square!(3);", EyeSourceType::String });
+		ASSERT_EQ(second.Expand(std::move(tokens.value())).has_value(), true);
+		ASSERT_EQ(second.GetCacheHitCount(), 1);
+		ASSERT_EQ(cache->GetSize(), 1);
+
+		ASTGenerator astGenerator;
+		auto results = astGenerator.GenerateBatchAST({ { { "macro square(x) { ((x) * (x)) } int a = square!(3);", EyeSourceType::String } }, { { "macro square(x) { ((x) * (x)) } int b = square!(3);", EyeSourceType::String } } }, 2);
+		ASSERT_EQ(results[0].has_value() && results[1].has_value(), true);
+		ASSERT_EQ(astGenerator.GetMacroExpansionCache()->GetSize(), 1);
+	}
+
+	TEST(MacroExpanderTest, Errors)
+	{
+		ASTGenerator astGenerator;
+
+		auto res = astGenerator.GenerateAST({ { "int y = square!(3);", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::MacroExpanderNotDefined);
+
+		res = astGenerator.GenerateAST({ { "macro square(x) { x * x } int y = square!(3, 4);", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::MacroExpanderBadArgumentCount);
+
+		res = astGenerator.GenerateAST({ { "macro square(x) { x * x } macro square(y) { y }", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::MacroExpanderReDefinition);
+
+		res = astGenerator.GenerateAST({ { "macro loop(x) { loop!(x) } loop!(1);", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::MacroExpanderRecursionLimit);
+
+		res = astGenerator.GenerateAST({ { "macro square(x) { x * x ", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::MacroExpanderSyntaxError);
+
+		res = astGenerator.GenerateAST({ { "macro square(x) { x * x } int y = square!(3;", EyeSourceType::String } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::MacroExpanderSyntaxError);
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ModuleLoader/InterfaceSummary.h"
+#include "Eye/ModuleLoader/ModuleLoader.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+namespace Eye
+{
+	TEST(InterfaceSummaryTest, RoundTrip)
+	{
+		ASTGenerator astGenerator;
+		auto ast = astGenerator.GenerateMemoryAST({ { "function int square(int x) { return x * x; } function str join(str a, str b = \"\") { return a + b; } int y = 2;", EyeSourceType::String }, false, false });
+
+		InterfaceSummary summary;
+		summary.SourceHash = InterfaceSummary::Hash("source");
+		summary.Interface = InterfaceSummary::Extract(ast.get());
+		ASSERT_EQ(summary.Interface->Functions.size(), 2);
+
+		std::string data = summary.Serialize();
+		auto res = InterfaceSummary::Deserialize(data);
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(res->SourceHash, summary.SourceHash);
+		ASSERT_EQ(res->ImportsHash, 0);
+		ASSERT_EQ(res->Interface->GetSignature(), summary.Interface->GetSignature());
+
+		const ModuleFunction* join = res->Interface->GetFunction("join");
+		ASSERT_NE(join, nullptr);
+		ASSERT_EQ(join->Type, (FunctionType{ Type::String, { Type::String, Type::String }, 1 }));
+		ASSERT_EQ(join->Declaration.RequiredParameterCount, 1);
+		ASSERT_EQ(join->Declaration.DefaultParameterCount, 1);
+
+		res = InterfaceSummary::Deserialize(data.substr(0, data.size() - 1));
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ModuleLoaderBadSummary);
+
+		res = InterfaceSummary::Deserialize("EYEX" + data.substr(4));
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ModuleLoaderBadSummary);
+	}
+
+	TEST(InterfaceSummaryTest, SeedImports)
+	{
+		std::string filepath = (std::filesystem::temp_directory_path() / "InterfaceSummaryTest.eyei").string();
+
+		ASTGenerator astGenerator;
+		InterfaceSummary summary;
+		summary.Interface = InterfaceSummary::Extract(astGenerator.GenerateMemoryAST({ { "function int square(int x) { return x * x; }", EyeSourceType::String } }).get());
+		ASSERT_EQ(summary.Write(filepath).has_value(), true);
+
+		auto stored = InterfaceSummary::Read(filepath);
+		ASSERT_EQ(stored.has_value(), true);
+
+		auto res = astGenerator.GenerateAST({ { "import \"math.eye\"; int y = square(2);", EyeSourceType::String }, true, true, true, true, false, { { "math.eye", stored->Interface } } });
+		ASSERT_EQ(res.has_value(), true);
+
+		res = astGenerator.GenerateAST({ { "import \"math.eye\"; int y = square(\"2\");", EyeSourceType::String }, true, true, true, true, false, { { "math.eye", stored->Interface } } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = astGenerator.GenerateAST({ { "import \"math.eye\"; int y = square(2, 3);", EyeSourceType::String }, true, true, true, true, false, { { "math.eye", stored->Interface } } });
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticTooManyArguments);
+
+		std::filesystem::remove(filepath);
+	}
+
+	TEST(InterfaceSummaryTest, ModuleLoader)
+	{
+		std::filesystem::path directory = std::filesystem::temp_directory_path() / "InterfaceSummaryTestLoader";
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+		std::ofstream(directory / "math.eye") << "function int square(int x) { return x * x; }";
+		std::ofstream(directory / "main.eye") << "import \"math.eye\"; int y = square(2);";
+
+		{
+			ModuleLoader loader(2, true);
+			ASSERT_EQ(loader.Load((directory / "main.eye").string()).has_value(), true);
+			ASSERT_EQ(loader.GetCheckedCount(), 2);
+			ASSERT_EQ(std::filesystem::exists(directory / "math.eye.eyei"), true);
+		}
+
+		// A fresh Loader re-checks only what changed since the Summaries were written
+		std::ofstream(directory / "main.eye") << "import \"math.eye\"; int y = square(3);";
+		{
+			ModuleLoader loader(2, true);
+			ASSERT_EQ(loader.Load((directory / "main.eye").string()).has_value(), true);
+			ASSERT_EQ(loader.GetParsedCount(), 2);
+			ASSERT_EQ(loader.GetCheckedCount(), 1);
+		}
+
+		std::filesystem::remove_all(directory);
+	}
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ModuleLoader/ModuleLoader.h"
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+
+namespace Eye
+{
+	static std::filesystem::path CreateModuleDirectory(const std::string& name)
+	{
+		std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory / "lib");
+		return directory;
+	}
+
+	TEST(ModuleLoaderTest, Diamond)
+	{
+		std::filesystem::path directory = CreateModuleDirectory("ModuleLoaderTestDiamond");
+		std::ofstream(directory / "lib" / "math.eye") << "function int square(int x) { return x * x; }";
+		std::ofstream(directory / "lib" / "left.eye") << "import \"math.eye\"; function int left(int x) { return square(x) + 1; }";
+		std::ofstream(directory / "right.eye") << "import \"lib/math.eye\"; function int right(int x) { return square(x) - 1; }";
+		std::ofstream(directory / "main.eye") << "import \"lib/left.eye\"; import \"right.eye\"; int y = left(2) + right(3);";
+
+		ModuleLoader loader(4);
+		auto res = loader.Load((directory / "main.eye").string());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(loader.GetParsedCount(), 4);
+		ASSERT_EQ(loader.GetCheckedCount(), 4);
+
+		auto main = res.value();
+		ASSERT_EQ(main->Imports.size(), 2);
+		ASSERT_EQ(main->Imports.at("lib/left.eye")->Imports.at("math.eye").get(), main->Imports.at("right.eye")->Imports.at("lib/math.eye").get());
+		ASSERT_NE(main->Imports.at("right.eye")->Interface->GetFunction("right"), nullptr);
+		ASSERT_EQ(main->Imports.at("right.eye")->Interface->GetFunction("square"), nullptr);
+
+		auto reloaded = loader.Load((directory / "main.eye").string());
+		ASSERT_EQ(reloaded.has_value(), true);
+		ASSERT_EQ(loader.GetParsedCount(), 4);
+		ASSERT_EQ(loader.GetCheckedCount(), 4);
+
+		// Same Signature, only math is re-checked
+		std::ofstream(directory / "lib" / "math.eye") << "function int square(int x) { int y = x; return y * x; }";
+		reloaded = loader.Load((directory / "main.eye").string());
+		ASSERT_EQ(reloaded.has_value(), true);
+		ASSERT_EQ(loader.GetParsedCount(), 5);
+		ASSERT_EQ(loader.GetCheckedCount(), 5);
+
+		// Changed Signature, its Importers are re-checked
+		std::ofstream(directory / "lib" / "math.eye") << "function int square(int x) { return x * x; } function int cube(int x) { return x * x * x; }";
+		reloaded = loader.Load((directory / "main.eye").string());
+		ASSERT_EQ(reloaded.has_value(), true);
+		ASSERT_EQ(loader.GetParsedCount(), 6);
+		ASSERT_EQ(loader.GetCheckedCount(), 8);
+
+		std::filesystem::remove_all(directory);
+	}
+
+	TEST(ModuleLoaderTest, Namespaces)
+	{
+		std::filesystem::path directory = CreateModuleDirectory("ModuleLoaderTestNamespaces");
+		std::ofstream(directory / "lib" / "geo.eye") << "namespace Geo { function int area(int w, int h) { return w * h; } }";
+		std::ofstream(directory / "main.eye") << "import \"lib/geo.eye\"; namespace Geo { function int square(int w) { return area(w, w); } } int y = Geo.area(2, 3) + Geo::square(4);";
+
+		// Namespace Members are exported & imported by their qualified Names
+		ModuleLoader loader;
+		auto res = loader.Load((directory / "main.eye").string());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_NE(res.value()->Imports.at("lib/geo.eye")->Interface->GetFunction("Geo::area"), nullptr);
+		ASSERT_NE(res.value()->Interface->GetFunction("Geo::square"), nullptr);
+
+		std::filesystem::remove_all(directory);
+	}
+
+	TEST(ModuleLoaderTest, Errors)
+	{
+		std::filesystem::path directory = CreateModuleDirectory("ModuleLoaderTestErrors");
+		std::ofstream(directory / "a.eye") << "import \"b.eye\"; function int a() { return 1; }";
+		std::ofstream(directory / "b.eye") << "import \"a.eye\"; function int b() { return 2; }";
+		std::ofstream(directory / "lib.eye") << "function int get(int x) { return x; }";
+		std::ofstream(directory / "call.eye") << "import \"lib.eye\"; get(\"text\");";
+		std::ofstream(directory / "redeclare.eye") << "import \"lib.eye\"; function int get(int x) { return x; }";
+		std::ofstream(directory / "missing.eye") << "import \"none.eye\";";
+		std::ofstream(directory / "nested.eye") << "{ import \"lib.eye\"; }";
+
+		ModuleLoader loader;
+		auto res = loader.Load((directory / "a.eye").string());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ModuleLoaderCyclicImport);
+
+		res = loader.Load((directory / "call.eye").string());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = loader.Load((directory / "redeclare.eye").string());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticReDeclaration);
+
+		res = loader.Load((directory / "missing.eye").string());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ModuleLoaderBadSource);
+
+		res = loader.Load((directory / "nested.eye").string());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticBadImport);
+
+		std::filesystem::remove_all(directory);
+	}
+}
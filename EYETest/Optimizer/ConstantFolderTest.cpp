@@ -0,0 +1,146 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/Optimizer/ConstantFolder.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	static const AST::Expression* GetFirstInitializer(const AST::Program* program, size_t index)
+	{
+		return static_cast<const AST::VariableStatement*>(program->GetStatementList()[index].get())->GetVariableDeclarationList()[0]->GetInitializer();
+	}
+
+	static const AST::LiteralExpression* GetLiteralInitializer(const AST::Program* program, size_t index)
+	{
+		const AST::Expression* initializer = GetFirstInitializer(program, index);
+		if (initializer->GetType() != AST::ExpressionType::LiteralExpression)
+			return nullptr;
+		return static_cast<const AST::LiteralExpression*>(initializer);
+	}
+
+	TEST(OptimizerConstantFolderTest, Fold)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "int a = 1 << 4 | 0xFF; float b = 1 / 2 + 0.5; str c = \"eye\" + \"lang\"; bool d = 2 > 1.5 && !false; int e = !5; int f = ~0 & 7 % 4;", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+		const AST::Program* program = res.value().get();
+
+		ASSERT_NE(GetLiteralInitializer(program, 0), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 0)->GetValue<AST::LiteralIntegerType>(), 255);
+		ASSERT_NE(GetLiteralInitializer(program, 1), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 1)->GetValue<AST::LiteralFloatType>(), 0.5);
+		ASSERT_NE(GetLiteralInitializer(program, 2), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 2)->GetValue<AST::LiteralStringType>(), "eyelang");
+		ASSERT_NE(GetLiteralInitializer(program, 3), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 3)->GetValue<AST::LiteralBooleanType>(), true);
+		ASSERT_NE(GetLiteralInitializer(program, 4), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 4)->GetValue<AST::LiteralIntegerType>(), 0);
+		ASSERT_NE(GetLiteralInitializer(program, 5), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 5)->GetValue<AST::LiteralIntegerType>(), 3);
+	}
+
+	TEST(OptimizerConstantFolderTest, Negative)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "int a = 3 - 5; int b = -(-4); int c = -7; float d = 0.5 - 2;", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+		const AST::Program* program = res.value().get();
+
+		// Negative Constants are written as '-' Literal
+		const AST::Expression* a = GetFirstInitializer(program, 0);
+		ASSERT_EQ(a->GetType(), AST::ExpressionType::UnaryExpression);
+		ASSERT_EQ(static_cast<const AST::LiteralExpression*>(static_cast<const AST::UnaryExpression*>(a)->GetExpression())->GetValue<AST::LiteralIntegerType>(), 2);
+
+		ASSERT_NE(GetLiteralInitializer(program, 1), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 1)->GetValue<AST::LiteralIntegerType>(), 4);
+		ASSERT_EQ(GetFirstInitializer(program, 2)->GetType(), AST::ExpressionType::UnaryExpression);
+
+		const AST::Expression* d = GetFirstInitializer(program, 3);
+		ASSERT_EQ(d->GetType(), AST::ExpressionType::UnaryExpression);
+		ASSERT_EQ(static_cast<const AST::LiteralExpression*>(static_cast<const AST::UnaryExpression*>(d)->GetExpression())->GetValue<AST::LiteralFloatType>(), 1.5);
+	}
+
+	TEST(OptimizerConstantFolderTest, Runtime)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "int a = 1 / 0; int b = 5 % 0; int c = 1 << 64; float d = 1.0 / 0;", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+		const AST::Program* program = res.value().get();
+
+		for (size_t i = 0; i < program->GetStatementList().size(); i++)
+			ASSERT_EQ(GetFirstInitializer(program, i)->GetType(), AST::ExpressionType::BinaryExpression);
+	}
+
+	TEST(OptimizerConstantFolderTest, Propagate)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "const int N = 10; int a = N * 4; const float F = 3; float b = F / 2; int c = 5; const int M = c; int d = M + 1;", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+		const AST::Program* program = res.value().get();
+
+		ASSERT_NE(GetLiteralInitializer(program, 1), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 1)->GetValue<AST::LiteralIntegerType>(), 40);
+		ASSERT_NE(GetLiteralInitializer(program, 3), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 3)->GetValue<AST::LiteralFloatType>(), 1.5);
+		ASSERT_EQ(GetFirstInitializer(program, 6)->GetType(), AST::ExpressionType::BinaryExpression);
+	}
+
+	TEST(OptimizerConstantFolderTest, Shadow)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "const int N = 10; function int scale(int N) { return N * 2; } function int area() { int x = N; if (x > 1) { int N = 3; x = N; } return x + N; }", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+		const AST::Program* program = res.value().get();
+
+		const AST::FunctionStatement* scale = static_cast<const AST::FunctionStatement*>(program->GetStatementList()[1].get());
+		const AST::ReturnStatement* scaleReturn = static_cast<const AST::ReturnStatement*>(scale->GetBody()->GetStatementList()[0].get());
+		ASSERT_EQ(scaleReturn->GetExpression()->GetType(), AST::ExpressionType::BinaryExpression);
+
+		const AST::FunctionStatement* area = static_cast<const AST::FunctionStatement*>(program->GetStatementList()[2].get());
+		const AST::VariableStatement* x = static_cast<const AST::VariableStatement*>(area->GetBody()->GetStatementList()[0].get());
+		ASSERT_EQ(x->GetVariableDeclarationList()[0]->GetInitializer()->GetType(), AST::ExpressionType::LiteralExpression);
+
+		const AST::ControlStatement* control = static_cast<const AST::ControlStatement*>(area->GetBody()->GetStatementList()[1].get());
+		const AST::BlockStatement* block = static_cast<const AST::BlockStatement*>(control->GetConsequent());
+		const AST::AssignmentExpression* assign = static_cast<const AST::AssignmentExpression*>(static_cast<const AST::ExpressionStatement*>(block->GetStatementList()[1].get())->GetExpression());
+		ASSERT_EQ(assign->GetExpression()->GetType(), AST::ExpressionType::IdentifierExpression);
+
+		const AST::ReturnStatement* areaReturn = static_cast<const AST::ReturnStatement*>(area->GetBody()->GetStatementList()[2].get());
+		const AST::BinaryExpression* sum = static_cast<const AST::BinaryExpression*>(areaReturn->GetExpression());
+		ASSERT_EQ(sum->GetLeft()->GetType(), AST::ExpressionType::IdentifierExpression);
+		ASSERT_EQ(sum->GetRight()->GetType(), AST::ExpressionType::LiteralExpression);
+	}
+
+	TEST(OptimizerConstantFolderTest, ShortCircuit)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "function bool check() { return true; } bool a = false && check(); bool b = 1 || check(); bool c = true && check();", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+		const AST::Program* program = res.value().get();
+
+		ASSERT_NE(GetLiteralInitializer(program, 1), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 1)->GetValue<AST::LiteralBooleanType>(), false);
+		ASSERT_NE(GetLiteralInitializer(program, 2), nullptr);
+		ASSERT_EQ(GetLiteralInitializer(program, 2)->GetValue<AST::LiteralBooleanType>(), true);
+		ASSERT_EQ(GetFirstInitializer(program, 3)->GetType(), AST::ExpressionType::BinaryExpression);
+	}
+
+	TEST(OptimizerConstantFolderTest, Count)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "const int N = 2 * 3; int a = N + N; int b = -1;", EyeSourceType::String }, true, true, false });
+		ASSERT_EQ(res.has_value(), true);
+
+		ConstantFolder constantFolder;
+		constantFolder.Fold(res.value().get());
+		ASSERT_EQ(constantFolder.GetFoldedExpressionCount(), 2);
+		ASSERT_EQ(constantFolder.GetPropagatedConstantCount(), 2);
+
+		constantFolder.Fold(res.value().get());
+		ASSERT_EQ(constantFolder.GetFoldedExpressionCount(), 0);
+		ASSERT_EQ(constantFolder.GetPropagatedConstantCount(), 0);
+	}
+}
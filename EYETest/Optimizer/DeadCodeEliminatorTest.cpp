@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/Optimizer/DeadCodeEliminator.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	static std::unique_ptr<AST::Program> GenerateUneliminatedAST(const std::string& source, bool typeCheck = true)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { source, EyeSourceType::String }, typeCheck, true, true, false });
+		if (!res.has_value())
+			return nullptr;
+		return std::move(res.value());
+	}
+
+	static const AST::FunctionStatement* GetFunction(const AST::Program* program, size_t index)
+	{
+		return static_cast<const AST::FunctionStatement*>(program->GetStatementList()[index].get());
+	}
+
+	TEST(OptimizerDeadCodeEliminatorTest, Branches)
+	{
+		auto program = GenerateUneliminatedAST("int a = 0; if (true) { a = 1; } else { a = 2; } if (false) a = 3; if (0) { a = 4; } else a = 5; if (a > 1) a = 6;");
+		ASSERT_NE(program, nullptr);
+
+		DeadCodeEliminator deadCodeEliminator;
+		deadCodeEliminator.Eliminate(program.get());
+		ASSERT_EQ(deadCodeEliminator.GetStatistics().PrunedBranches, 3);
+		ASSERT_EQ(program->GetStatementList().size(), 4);
+		ASSERT_EQ(program->GetStatementList()[1]->GetType(), AST::StatementType::ExpressionStatement);
+		ASSERT_EQ(program->GetStatementList()[2]->GetType(), AST::StatementType::ExpressionStatement);
+		ASSERT_EQ(program->GetStatementList()[3]->GetType(), AST::StatementType::ControlStatement);
+	}
+
+	TEST(OptimizerDeadCodeEliminatorTest, FoldedBranches)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "const bool DEBUG = false; int level = 1; if (DEBUG && level > 0) { level = 2; } if (!DEBUG) level = 3;", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(res.value()->GetStatementList().size(), 3);
+		ASSERT_EQ(res.value()->GetStatementList()[2]->GetType(), AST::StatementType::ExpressionStatement);
+	}
+
+	TEST(OptimizerDeadCodeEliminatorTest, Unreachable)
+	{
+		auto program = GenerateUneliminatedAST("function int first(int x) { return x; x = 2; x = 3; } function void spin(int x) { while (x > 0) { if (x > 5) { break; } else { continue; } x = x - 1; } }", false);
+		ASSERT_NE(program, nullptr);
+
+		DeadCodeEliminator deadCodeEliminator;
+		deadCodeEliminator.Eliminate(program.get());
+		ASSERT_EQ(deadCodeEliminator.GetStatistics().UnreachableStatements, 3);
+		ASSERT_EQ(GetFunction(program.get(), 0)->GetBody()->GetStatementList().size(), 1);
+
+		const AST::WhileStatement* whileStmt = static_cast<const AST::WhileStatement*>(GetFunction(program.get(), 1)->GetBody()->GetStatementList()[0].get());
+		ASSERT_EQ(static_cast<const AST::BlockStatement*>(whileStmt->GetBody())->GetStatementList().size(), 1);
+	}
+
+	TEST(OptimizerDeadCodeEliminatorTest, UnusedVariables)
+	{
+		auto program = GenerateUneliminatedAST("int global = 1; function int compute(int x) { int unused = x * 2; int chained = 3, kept = 4; int used = chained; int called = compute(1); const int limit = 4; return x + kept; }");
+		ASSERT_NE(program, nullptr);
+
+		DeadCodeEliminator deadCodeEliminator;
+		deadCodeEliminator.Eliminate(program.get());
+		ASSERT_EQ(deadCodeEliminator.GetStatistics().UnusedVariables, 3);
+		ASSERT_EQ(program->GetStatementList().size(), 2);
+
+		// kept, called, limit & the return
+		const auto& body = GetFunction(program.get(), 1)->GetBody()->GetStatementList();
+		ASSERT_EQ(body.size(), 4);
+		const AST::VariableStatement* kept = static_cast<const AST::VariableStatement*>(body[0].get());
+		ASSERT_EQ(kept->GetVariableDeclarationList().size(), 1);
+		ASSERT_EQ(kept->GetVariableDeclarationList()[0]->GetIdentifier()->GetValue(), "kept");
+
+		// Increments keep their Declaration, prefix or postfix
+		program = GenerateUneliminatedAST("int counter = 0; function void f() { int prefix = ++counter; int postfix = counter--; int negated = -counter; }");
+		ASSERT_NE(program, nullptr);
+		deadCodeEliminator.Eliminate(program.get());
+		const auto& incrementBody = GetFunction(program.get(), 1)->GetBody()->GetStatementList();
+		ASSERT_EQ(incrementBody.size(), 2);
+		ASSERT_EQ(static_cast<const AST::VariableStatement*>(incrementBody[0].get())->GetVariableDeclarationList()[0]->GetIdentifier()->GetValue(), "prefix");
+	}
+
+	TEST(OptimizerDeadCodeEliminatorTest, UncalledFunctions)
+	{
+		std::string source = "function int b() { return 1; } function int a() { return b(); } function int c() { return c(); } function int d() { return c(); } int x = a();";
+
+		auto program = GenerateUneliminatedAST(source);
+		ASSERT_NE(program, nullptr);
+		DeadCodeEliminator deadCodeEliminator;
+		deadCodeEliminator.Eliminate(program.get());
+		ASSERT_EQ(deadCodeEliminator.GetStatistics().UncalledFunctions, 0);
+		ASSERT_EQ(program->GetStatementList().size(), 5);
+
+		deadCodeEliminator.Eliminate(program.get(), true);
+		ASSERT_EQ(deadCodeEliminator.GetStatistics().UncalledFunctions, 2);
+		ASSERT_EQ(program->GetStatementList().size(), 3);
+		ASSERT_EQ(GetFunction(program.get(), 0)->GetIdentifier()->GetValue(), "b");
+		ASSERT_EQ(GetFunction(program.get(), 1)->GetIdentifier()->GetValue(), "a");
+	}
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "Eye/Lexer/Lexer.h"
+#include "Eye/Parser/Parser.h"
+#include "Eye/Parser/IncrementalParser.h"
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTSerializer/StringSerializer.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <tuple>
+
+namespace Eye
+{
+	static std::string SerializeFreshParse(const std::string& text)
+	{
+		Lexer lexer;
+		auto lexerRes = lexer.Tokenize(EyeSource(text, EyeSourceType::String));
+		if (!lexerRes.has_value())
+			EYE_LOG_CRITICAL("EyeTest->Parser->IncrementalParserTest Failed to Tokenize()");
+
+		Parser parser;
+		auto parserRes = parser.Parse(std::move(lexerRes.value()));
+		if (!parserRes.has_value())
+			EYE_LOG_CRITICAL("EyeTest->Parser->IncrementalParserTest Failed to Parse()");
+
+		ASTSerializer::StringSerializer astSerializer;
+		return astSerializer.Serialize(parserRes.value().get());
+	}
+
+	// Line, Col, Start & End of a Statement & the Nodes below it that carry a Position
+	static void CollectPositions(const AST::Statement* stmt, std::vector<std::array<size_t, 4>>& positions)
+	{
+		auto add = [&positions](const EyeSource& source) { positions.push_back({ source.Line, source.Col, source.Start, source.End }); };
+		if (!stmt)
+			return;
+
+		add(stmt->GetSource());
+		if (stmt->GetType() == AST::StatementType::ExpressionStatement)
+		{
+			add(static_cast<const AST::ExpressionStatement*>(stmt)->GetExpression()->GetSource());
+		}
+		else if (stmt->GetType() == AST::StatementType::BlockStatement)
+		{
+			for (const auto& child : static_cast<const AST::BlockStatement*>(stmt)->GetStatementList())
+				CollectPositions(child.get(), positions);
+		}
+		else if (stmt->GetType() == AST::StatementType::VariableStatement)
+		{
+			const AST::VariableStatement* varStmt = static_cast<const AST::VariableStatement*>(stmt);
+			add(varStmt->GetDataType().GetSource());
+			for (const auto& declaration : varStmt->GetVariableDeclarationList())
+			{
+				add(declaration->GetIdentifier()->GetSource());
+				if (declaration->GetInitializer())
+					add(declaration->GetInitializer()->GetSource());
+			}
+		}
+		else if (stmt->GetType() == AST::StatementType::FunctionStatement)
+		{
+			const AST::FunctionStatement* functionStmt = static_cast<const AST::FunctionStatement*>(stmt);
+			add(functionStmt->GetIdentifier()->GetSource());
+			CollectPositions(functionStmt->GetBody(), positions);
+		}
+	}
+
+	// Every Position & Range matches a fresh Parse of the current Text
+	static void AssertFreshPositions(IncrementalParser& parser)
+	{
+		IncrementalParser fresh;
+		ASSERT_EQ(fresh.Parse(EyeSource(parser.GetText(), EyeSourceType::String)).has_value(), true);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList().size(), fresh.GetProgram()->GetStatementList().size());
+
+		for (size_t i = 0; i < fresh.GetProgram()->GetStatementList().size(); i++)
+		{
+			std::vector<std::array<size_t, 4>> positions, freshPositions;
+			CollectPositions(parser.GetProgram()->GetStatementList()[i].get(), positions);
+			CollectPositions(fresh.GetProgram()->GetStatementList()[i].get(), freshPositions);
+			ASSERT_EQ(positions, freshPositions);
+
+			const ParserStatementRange& range = parser.GetStatementRanges()[i];
+			const ParserStatementRange& freshRange = fresh.GetStatementRanges()[i];
+			ASSERT_EQ(std::tie(range.Begin, range.End, range.BeginLine, range.BeginCol, range.EndLine, range.EndCol), std::tie(freshRange.Begin, freshRange.End, freshRange.BeginLine, freshRange.BeginCol, freshRange.EndLine, freshRange.EndCol));
+		}
+	}
+
+	TEST(ParserIncrementalTest, ReuseUntouchedStatements)
+	{
+		std::string text = "int a = 1;\nfunction int add(int x, int y) { return x + y; }\nint b = add(a, 2);\n";
+		IncrementalParser parser;
+		auto res = parser.Parse(EyeSource(text, EyeSourceType::String));
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList().size(), 3);
+
+		const AST::Statement* first = parser.GetProgram()->GetStatementList()[0].get();
+		const AST::Statement* last = parser.GetProgram()->GetStatementList()[2].get();
+
+		ASSERT_EQ(parser.Edit(text.find("x + y"), 5, "x * y - 1").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 1);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList()[0].get(), first);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList()[2].get(), last);
+
+		ASTSerializer::StringSerializer astSerializer;
+		ASSERT_EQ(astSerializer.Serialize(parser.GetProgram()), SerializeFreshParse(parser.GetText()));
+	}
+
+	TEST(ParserIncrementalTest, InsertStatements)
+	{
+		std::string text = "int a = 1;\nint b = 2;\n";
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+
+		auto res = parser.Edit(text.find("int b"), 0, "int c = a;\nc = c + 1;\n");
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList().size(), 4);
+		ASSERT_EQ(parser.GetText(), "int a = 1;\nint c = a;\nc = c + 1;\nint b = 2;\n");
+
+		ASTSerializer::StringSerializer astSerializer;
+		ASSERT_EQ(astSerializer.Serialize(parser.GetProgram()), SerializeFreshParse(parser.GetText()));
+	}
+
+	TEST(ParserIncrementalTest, ShiftLines)
+	{
+		std::string text = "int a = 1;\nint b = 2;\nif (a) { b = a + b; }\n";
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+
+		const AST::Statement* control = parser.GetProgram()->GetStatementList()[2].get();
+		ASSERT_EQ(control->GetSource().Line, 3);
+
+		auto res = parser.Edit(text.find("int b"), 0, "\n\n");
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList()[2].get(), control);
+		ASSERT_EQ(control->GetSource().Line, 5);
+		ASSERT_EQ(parser.GetStatementRanges()[2].BeginLine, 5);
+		ASSERT_EQ(parser.GetStatementRanges()[2].Begin, parser.GetText().find("if"));
+
+		const AST::BlockStatement* block = static_cast<const AST::BlockStatement*>(static_cast<const AST::ControlStatement*>(control)->GetConsequent());
+		const AST::ExpressionStatement* exprStmt = static_cast<const AST::ExpressionStatement*>(block->GetStatementList()[0].get());
+		ASSERT_EQ(static_cast<const AST::AssignmentExpression*>(exprStmt->GetExpression())->GetSource().Line, 5);
+
+		// Statements Sharing the Line with the Edit move Columns and are Re-Parsed
+		res = parser.Edit(parser.GetText().find("int a"), 0, "int z = 0; ");
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList()[1]->GetSource().Col, 12);
+	}
+
+	TEST(ParserIncrementalTest, ShiftTypeSpecifiers)
+	{
+		std::string text = "int a = 1;\nconst\nfloat b = 2;\nfunction str f(const bool c) { return \"\"; }\n";
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+
+		auto res = parser.Edit(0, 0, "\n");
+		ASSERT_EQ(res.has_value(), true);
+
+		// The Token Shims rebuild the Keywords from the relocated compact Payload
+		const AST::VariableStatement* varStmt = static_cast<const AST::VariableStatement*>(parser.GetProgram()->GetStatementList()[1].get());
+		ASSERT_EQ(varStmt->GetTypeSpecifier().IsConst(), true);
+		ASSERT_EQ(varStmt->GetTypeSpecifier().Type, AST::DataType::Float);
+		ASSERT_EQ(varStmt->GetTypeQualifier().GetType(), TokenType::KeywordTypeQualifierConst);
+		ASSERT_EQ(varStmt->GetTypeQualifier().GetSource().Line, 3);
+		ASSERT_EQ(varStmt->GetDataType().GetType(), TokenType::KeywordDataTypeFloat);
+		ASSERT_EQ(varStmt->GetDataType().GetSource().Line, 4);
+
+		const AST::FunctionStatement* functionStmt = static_cast<const AST::FunctionStatement*>(parser.GetProgram()->GetStatementList()[2].get());
+		ASSERT_EQ(functionStmt->GetReturnType().GetType(), TokenType::KeywordDataTypeStr);
+		ASSERT_EQ(functionStmt->GetReturnType().GetSource().Line, 5);
+		ASSERT_EQ(functionStmt->GetParameters()[0]->GetTypeSpecifier().IsConst(), true);
+		ASSERT_EQ(functionStmt->GetParameters()[0]->GetDataType().GetSource().Col, 22);
+		ASSERT_EQ(!functionStmt->GetParameters()[0]->GetTypeQualifier(), false);
+		ASSERT_EQ(!static_cast<const AST::VariableStatement*>(parser.GetProgram()->GetStatementList()[0].get())->GetTypeQualifier(), true);
+	}
+
+	TEST(ParserIncrementalTest, StructuralEdit)
+	{
+		std::string text = "function void f() { int a = 1; }\nint b = 2;\nint c = 3;\n";
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+
+		// Removing the Closing Brace swallows the following Statements
+		auto res = parser.Edit(text.find('}'), 1, "");
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ParserSyntaxError);
+		ASSERT_EQ(parser.GetProgram(), nullptr);
+
+		res = parser.Edit(parser.GetText().size(), 0, "}");
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList().size(), 1);
+
+		ASTSerializer::StringSerializer astSerializer;
+		ASSERT_EQ(astSerializer.Serialize(parser.GetProgram()), SerializeFreshParse(parser.GetText()));
+	}
+
+	TEST(ParserIncrementalTest, ShiftPositions)
+	{
+		std::string text;
+		for (size_t i = 0; i < 200; i++)
+			text += "int v" + std::to_string(i) + " = " + std::to_string(i) + ";\nfunction int f" + std::to_string(i) + "(int x) {\n\treturn x + v" + std::to_string(i) + ";\n}\n";
+
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+
+		// Edits before, after & inside the pending Shift, with & without Positions read in between
+		ASSERT_EQ(parser.Edit(parser.GetText().find("int v10 "), 0, "int a = 1;\n\n").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 2);
+		AssertFreshPositions(parser);
+
+		ASSERT_EQ(parser.Edit(parser.GetText().find("x + v150"), 1, "x * 2").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("x + v20"), 0, "\n").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("int v30 = 30;"), 13, "").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("int v199"), 0, "int b = 2;\n").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("int v5 = 5"), 10, "int v5 = 500").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 1);
+		AssertFreshPositions(parser);
+
+		ASSERT_EQ(parser.Edit(0, 0, "\n\n\n").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().size(), 0, "int c = 3;\n").has_value(), true);
+		AssertFreshPositions(parser);
+
+		ASTSerializer::StringSerializer astSerializer;
+		ASSERT_EQ(astSerializer.Serialize(parser.GetProgram()), SerializeFreshParse(parser.GetText()));
+	}
+
+	TEST(ParserIncrementalTest, DocumentSource)
+	{
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource("int a = 1;\nint b = a;", EyeSourceType::String)).has_value(), true);
+		ASSERT_EQ(parser.Edit(0, 0, "\n").has_value(), true);
+
+		// Tokens name the Document instead of holding a Copy of its Text
+		const AST::VariableStatement* varStmt = static_cast<const AST::VariableStatement*>(parser.GetProgram()->GetStatementList()[1].get());
+		ASSERT_EQ(varStmt->GetSource().Source, "<document>");
+		ASSERT_EQ(varStmt->GetVariableDeclarationList()[0]->GetInitializer()->GetSource().Source, "<document>");
+		ASSERT_EQ(varStmt->GetSource().Line, 3);
+	}
+
+	TEST(ParserIncrementalTest, Macros)
+	{
+		std::string text = "macro SQ(x) { x * x }\nint a = SQ!(3);\nint b = 2;\n";
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+		ASSERT_EQ(parser.GetProgram()->GetStatementList().size(), 2);
+
+		// Regions expand with the Definitions before them
+		ASTSerializer::StringSerializer astSerializer;
+		ASSERT_EQ(parser.Edit(parser.GetText().find("2;"), 1, "SQ!(a)").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 1);
+		ASSERT_EQ(astSerializer.Serialize(parser.GetProgram()), SerializeFreshParse("int a = 3 * 3;\nint b = a * a;\n"));
+		AssertFreshPositions(parser);
+
+		// Changing a Definition re-parses every Statement
+		ASSERT_EQ(parser.Edit(parser.GetText().find("x * x"), 5, "x + x").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 2);
+		ASSERT_EQ(astSerializer.Serialize(parser.GetProgram()), SerializeFreshParse("int a = 3 + 3;\nint b = a + a;\n"));
+
+		// So does adding one, Definitions after the Edit keep their Place
+		ASSERT_EQ(parser.Edit(parser.GetText().size(), 0, "macro ID(x) { x }\nint c = ID!(b);\n").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 3);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("int a"), 0, "int z = 0;\n").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 2);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("ID!(b)"), 6, "ID!(SQ!(z))").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 1);
+		ASSERT_EQ(astSerializer.Serialize(parser.GetProgram()), SerializeFreshParse("int z = 0;\nint a = 3 + 3;\nint b = a + a;\nint c = z + z;\n"));
+		AssertFreshPositions(parser);
+
+		// Invocations must follow their Definition, as in a fresh Parse
+		auto res = parser.Edit(parser.GetText().find("int a"), 0, "int y = ID!(1);\n");
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::MacroExpanderNotDefined);
+	}
+
+	TEST(ParserIncrementalTest, BadEdit)
+	{
+		IncrementalParser parser;
+		ASSERT_EQ(parser.Parse(EyeSource("int a = 1;", EyeSourceType::String)).has_value(), true);
+
+		auto res = parser.Edit(8, 5, "");
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ParserBadEdit);
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Eye/Runtime/ArrayKernel.h"
+
+#include <gtest/gtest.h>
+#include <bit>
+#include <limits>
+#include <vector>
+
+namespace Eye
+{
+	TEST(RuntimeArrayKernelTest, Integer)
+	{
+		std::vector<Runtime::KernelOperation> operations = { Runtime::KernelOperation::Add, Runtime::KernelOperation::Sub, Runtime::KernelOperation::Mul, Runtime::KernelOperation::And, Runtime::KernelOperation::Or, Runtime::KernelOperation::Xor };
+
+		// Counts around the Vector Widths leave every Remainder, Products overflow 64 Bits
+		for (size_t count = 0; count <= 19; count++)
+		{
+			std::vector<IntegerType> left(count), right(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				left[i] = 0x9E3779B97F4A7C15ull * (i + 1);
+				right[i] = (i % 3 ? std::numeric_limits<IntegerType>::max() - i * 977 : i * 31);
+			}
+
+			for (Runtime::KernelOperation operation : operations)
+			{
+				std::vector<IntegerType> expected(count);
+				ASSERT_EQ(Runtime::RunKernel(operation, expected.data(), left.data(), right.data(), count, Runtime::KernelISA::Scalar), true);
+				for (size_t i = 0; i < count; i++)
+				{
+					IntegerType value = (operation == Runtime::KernelOperation::Add ? left[i] + right[i] : operation == Runtime::KernelOperation::Sub ? left[i] - right[i] : operation == Runtime::KernelOperation::Mul ? left[i] * right[i] : operation == Runtime::KernelOperation::And ? (left[i] & right[i]) : operation == Runtime::KernelOperation::Or ? (left[i] | right[i]) : (left[i] ^ right[i]));
+					ASSERT_EQ(expected[i], value);
+				}
+
+				for (Runtime::KernelISA isa : { Runtime::KernelISA::SSE2, Runtime::KernelISA::AVX2 })
+				{
+					std::vector<IntegerType> target(count);
+					ASSERT_EQ(Runtime::RunKernel(operation, target.data(), left.data(), right.data(), count, isa), true);
+					ASSERT_EQ(target, expected);
+
+					// In Place & broadcast
+					std::vector<IntegerType> inPlace = left, broadcast(count), broadcastExpected(count);
+					Runtime::RunKernel(operation, inPlace.data(), inPlace.data(), right.data(), count, isa);
+					ASSERT_EQ(inPlace, expected);
+					Runtime::RunKernel(operation, broadcast.data(), left.data(), (IntegerType)0xFFFFFFFF00000003ull, count, isa);
+					Runtime::RunKernel(operation, broadcastExpected.data(), left.data(), (IntegerType)0xFFFFFFFF00000003ull, count, Runtime::KernelISA::Scalar);
+					ASSERT_EQ(broadcast, broadcastExpected);
+				}
+			}
+		}
+
+		IntegerType value = 1;
+		ASSERT_EQ(Runtime::RunKernel(Runtime::KernelOperation::Div, &value, &value, &value, 1), false);
+		ASSERT_EQ(value, 1);
+	}
+
+	TEST(RuntimeArrayKernelTest, Float)
+	{
+		std::vector<Runtime::KernelOperation> operations = { Runtime::KernelOperation::Add, Runtime::KernelOperation::Sub, Runtime::KernelOperation::Mul, Runtime::KernelOperation::Div };
+
+		for (size_t count = 0; count <= 19; count++)
+		{
+			std::vector<FloatType> left(count), right(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				left[i] = 1.0 / 3.0 * (FloatType)i - 2.5;
+				right[i] = (i % 5 ? 0.1 * (FloatType)i : 0.0);
+			}
+
+			for (Runtime::KernelOperation operation : operations)
+			{
+				std::vector<FloatType> expected(count);
+				ASSERT_EQ(Runtime::RunKernel(operation, expected.data(), left.data(), right.data(), count, Runtime::KernelISA::Scalar), true);
+
+				// Every Element rounds exactly like scalar Code, including Divisions by Zero
+				for (Runtime::KernelISA isa : { Runtime::KernelISA::SSE2, Runtime::KernelISA::AVX2 })
+				{
+					std::vector<FloatType> target(count), broadcast(count), broadcastExpected(count);
+					ASSERT_EQ(Runtime::RunKernel(operation, target.data(), left.data(), right.data(), count, isa), true);
+					Runtime::RunKernel(operation, broadcast.data(), left.data(), 0.3, count, isa);
+					Runtime::RunKernel(operation, broadcastExpected.data(), left.data(), 0.3, count, Runtime::KernelISA::Scalar);
+					for (size_t i = 0; i < count; i++)
+					{
+						ASSERT_EQ(std::bit_cast<uint64_t>(target[i]), std::bit_cast<uint64_t>(expected[i]));
+						ASSERT_EQ(std::bit_cast<uint64_t>(broadcast[i]), std::bit_cast<uint64_t>(broadcastExpected[i]));
+					}
+				}
+			}
+		}
+
+		FloatType value = 1.0;
+		ASSERT_EQ(Runtime::RunKernel(Runtime::KernelOperation::Xor, &value, &value, &value, 1), false);
+		ASSERT_EQ(Runtime::IsKernelSupported(Runtime::KernelOperation::And, true), false);
+		ASSERT_EQ(Runtime::IsKernelSupported(Runtime::KernelOperation::Div, false), false);
+		ASSERT_NE(Runtime::KernelISAToString(Runtime::GetKernelISA()), "Unknown");
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Eye/Runtime/Heap.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	TEST(RuntimeStringTest, Representation)
+	{
+		Runtime::String empty;
+		ASSERT_EQ(empty.IsEmpty(), true);
+		ASSERT_EQ(empty.GetView(), "");
+
+		Runtime::String small("inline");
+		ASSERT_EQ(small.IsInline(), true);
+		ASSERT_EQ(small.GetView(), "inline");
+
+		Runtime::String large("longer than the inline capacity");
+		Runtime::String copy = large;
+		ASSERT_EQ(large.IsInline(), false);
+		ASSERT_EQ(copy.GetView().data(), large.GetView().data());
+
+		Runtime::String joined = small + Runtime::String("123");
+		ASSERT_EQ(joined.IsInline(), true);
+		ASSERT_EQ(joined.GetView(), "inline123");
+		ASSERT_EQ(joined.At(6), '1');
+	}
+
+	TEST(RuntimeStringTest, Rope)
+	{
+		Runtime::String report;
+		Runtime::String line("row;");
+		for (size_t i = 0; i < 100000; i++)
+			report = report + line;
+
+		ASSERT_EQ(report.GetLength(), 400000);
+		ASSERT_EQ(report.IsRope(), true);
+		ASSERT_EQ(report.GetView().substr(0, 8), "row;row;");
+		ASSERT_EQ(report.IsRope(), false);
+
+		Runtime::String prefix = report;
+		Runtime::String extended = prefix + Runtime::String("!");
+		ASSERT_EQ(extended.GetView().back(), '!');
+		ASSERT_EQ(prefix.GetLength(), 400000);
+		ASSERT_EQ(extended == report, false);
+		ASSERT_EQ(Runtime::String(report.GetView()) == report, true);
+	}
+
+	TEST(RuntimeStringTest, DeepRopeRelease)
+	{
+		// Never read, released Node by Node without Recursion
+		Runtime::String deep;
+		for (size_t i = 0; i < 1000000; i++)
+			deep = deep + Runtime::String("0123456789abcdef");
+		ASSERT_EQ(deep.GetLength(), 16000000);
+	}
+
+	TEST(RuntimeStringTest, Builder)
+	{
+		Runtime::StringBuilder builder;
+		for (size_t i = 0; i < 1000; i++)
+			builder.Append("ab").Append(Runtime::String("c"));
+
+		Runtime::String built = builder.Build();
+		ASSERT_EQ(built.GetLength(), 3000);
+		ASSERT_EQ(built.GetView().substr(0, 6), "abcabc");
+		ASSERT_EQ(builder.GetLength(), 0);
+	}
+
+	TEST(RuntimeStringTest, HeapConcat)
+	{
+		Runtime::Heap heap;
+		Runtime::Value greeting = heap.InternString("Hello, ");
+		Runtime::Value name = heap.MakeString("World of Eye");
+		Runtime::Value message = heap.Concat(greeting, name);
+
+		ASSERT_EQ(message.AsString()->GetString().IsRope(), true);
+		ASSERT_EQ(heap.ToString(message), "Hello, World of Eye");
+		ASSERT_EQ(heap.Equals(message, heap.InternString("Hello, World of Eye")), true);
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Eye/Runtime/Heap.h"
+
+#include <gtest/gtest.h>
+#include <limits>
+
+namespace Eye
+{
+	TEST(RuntimeValueTest, Scalars)
+	{
+		ASSERT_EQ(sizeof(Runtime::Value), 8);
+		ASSERT_EQ(Runtime::Value().IsVoid(), true);
+
+		Runtime::Value boolean = Runtime::Value::Boolean(true);
+		ASSERT_EQ(boolean.GetType(), Runtime::ValueType::Boolean);
+		ASSERT_EQ(boolean.AsBoolean(), true);
+		ASSERT_EQ(Runtime::Value::Boolean(false).AsBoolean(), false);
+
+		for (FloatType value : { 0.0, -0.0, 3.25, -1e300, std::numeric_limits<FloatType>::infinity(), -std::numeric_limits<FloatType>::infinity(), std::numeric_limits<FloatType>::denorm_min() })
+		{
+			Runtime::Value number = Runtime::Value::Float(value);
+			ASSERT_EQ(number.GetType(), Runtime::ValueType::Float);
+			ASSERT_EQ(std::bit_cast<uint64_t>(number.AsFloat()), std::bit_cast<uint64_t>(value));
+		}
+
+		// Every NaN, including negative ones overlapping the Box Mask, stays a Float
+		Runtime::Value nan = Runtime::Value::Float(-std::numeric_limits<FloatType>::quiet_NaN());
+		ASSERT_EQ(nan.IsFloat(), true);
+		ASSERT_NE(nan.AsFloat(), nan.AsFloat());
+
+		// Heap Equality follows IEEE, like the ConstantFolder
+		Runtime::Heap heap;
+		ASSERT_EQ(heap.Equals(nan, nan), false);
+		ASSERT_EQ(heap.Equals(Runtime::Value::Float(0.0), Runtime::Value::Float(-0.0)), true);
+		ASSERT_EQ(heap.Equals(Runtime::Value::Float(3.25), Runtime::Value::Float(3.25)), true);
+	}
+
+	TEST(RuntimeValueTest, Integers)
+	{
+		Runtime::Heap heap;
+		for (IntegerType value : { 0ull, 1ull, (IntegerType)-1, (IntegerType)Runtime::Value::s_InlineIntegerMax, (IntegerType)Runtime::Value::s_InlineIntegerMin })
+		{
+			Runtime::Value integer = heap.MakeInteger(value);
+			ASSERT_EQ(integer.IsInlineInteger(), true);
+			ASSERT_EQ(integer.AsInteger(), value);
+		}
+		ASSERT_EQ(heap.GetObjectCount(), 0);
+
+		for (IntegerType value : { (IntegerType)Runtime::Value::s_InlineIntegerMax + 1, std::numeric_limits<IntegerType>::max() / 2, (IntegerType)std::numeric_limits<long long>::min() })
+		{
+			Runtime::Value integer = heap.MakeInteger(value);
+			ASSERT_EQ(integer.IsInlineInteger(), false);
+			ASSERT_EQ(integer.IsInteger(), true);
+			ASSERT_EQ(integer.AsInteger(), value);
+			ASSERT_EQ(heap.Equals(integer, heap.MakeInteger(value)), true);
+		}
+		ASSERT_EQ(heap.GetObjectCount(), 6);
+		ASSERT_EQ(heap.ToString(heap.MakeInteger(12345678901234567890ull)), "12345678901234567890");
+	}
+
+	TEST(RuntimeValueTest, Strings)
+	{
+		Runtime::Heap heap;
+		Runtime::Value hello = heap.InternString("hello");
+		ASSERT_EQ(hello.IsString(), true);
+		ASSERT_EQ(hello.AsString()->GetValue(), "hello");
+		ASSERT_EQ(heap.InternString(std::string("hel") + "lo"), hello);
+		ASSERT_EQ(heap.GetInternedCount(), 1);
+
+		Runtime::Value built = heap.MakeString("hello");
+		ASSERT_NE(built, hello);
+		ASSERT_EQ(heap.Equals(built, hello), true);
+		ASSERT_EQ(heap.Equals(heap.InternString("world"), hello), false);
+		ASSERT_EQ(heap.Equals(heap.MakeString(""), heap.MakeInteger(0)), false);
+		ASSERT_EQ(heap.ToString(built), "hello");
+	}
+}
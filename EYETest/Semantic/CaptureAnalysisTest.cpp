@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/Semantic/CaptureAnalysis.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	static const AST::FunctionStatement* FindFunction(const std::vector<std::unique_ptr<AST::Statement>>& statements, const std::string& name)
+	{
+		for (const auto& stmt : statements)
+		{
+			if (stmt->GetType() == AST::StatementType::BlockStatement)
+			{
+				if (const AST::FunctionStatement* functionStmt = FindFunction(static_cast<const AST::BlockStatement*>(stmt.get())->GetStatementList(), name))
+					return functionStmt;
+			}
+			else if (stmt->GetType() == AST::StatementType::FunctionStatement)
+			{
+				const AST::FunctionStatement* functionStmt = static_cast<const AST::FunctionStatement*>(stmt.get());
+				if (functionStmt->GetIdentifier()->GetValue() == name)
+					return functionStmt;
+				if (const AST::FunctionStatement* nested = FindFunction(functionStmt->GetBody()->GetStatementList(), name))
+					return nested;
+			}
+		}
+		return nullptr;
+	}
+
+	static std::vector<std::string> GetCaptureNames(const CaptureAnalysis& captureAnalysis, const AST::FunctionStatement* functionStmt)
+	{
+		std::vector<std::string> names;
+		for (const AST::IdentifierExpression* declaration : captureAnalysis.GetCaptures(functionStmt))
+			names.push_back(declaration->GetValue());
+		return names;
+	}
+
+	TEST(SemanticCaptureAnalysisTest, Captures)
+	{
+		ASTGenerator astGenerator;
+		auto ast = astGenerator.GenerateMemoryAST({ { "int g = 1; function int f(int n) { int k = 2; int unused = 3; function int h(int v) { function int inner() { return v + k + g; } return inner(); } function int u() { return h(n); } return u(); }", EyeSourceType::String }, false, false });
+		ASSERT_NE(ast, nullptr);
+
+		CaptureAnalysis captureAnalysis;
+		captureAnalysis.Analyze(ast.get());
+		const AST::FunctionStatement* f = FindFunction(ast->GetStatementList(), "f");
+		const AST::FunctionStatement* h = FindFunction(ast->GetStatementList(), "h");
+		const AST::FunctionStatement* inner = FindFunction(ast->GetStatementList(), "inner");
+		const AST::FunctionStatement* u = FindFunction(ast->GetStatementList(), "u");
+
+		// Globals are never captured, Callers capture what their Callees capture
+		ASSERT_EQ(captureAnalysis.IsClosure(f), false);
+		ASSERT_EQ(captureAnalysis.GetCaptures(f).empty(), true);
+		ASSERT_EQ(GetCaptureNames(captureAnalysis, inner), (std::vector<std::string>{ "v", "k" }));
+		ASSERT_EQ(GetCaptureNames(captureAnalysis, h), (std::vector<std::string>{ "k" }));
+		ASSERT_EQ(GetCaptureNames(captureAnalysis, u), (std::vector<std::string>{ "n", "k" }));
+		ASSERT_EQ(captureAnalysis.IsCaptured(f->GetParameters()[0]->GetIdentifier()), true);
+		ASSERT_EQ(captureAnalysis.IsCaptured(h->GetParameters()[0]->GetIdentifier()), true);
+
+		// Read-only Captures of Closures that only get called stay unboxed
+		for (const AST::FunctionStatement* closure : { h, inner, u })
+		{
+			ASSERT_EQ(captureAnalysis.IsClosure(closure), true);
+			ASSERT_EQ(captureAnalysis.Escapes(closure), false);
+			for (const AST::IdentifierExpression* declaration : captureAnalysis.GetCaptures(closure))
+				ASSERT_EQ(captureAnalysis.IsBoxed(declaration), false);
+		}
+	}
+
+	TEST(SemanticCaptureAnalysisTest, Boxing)
+	{
+		ASTGenerator astGenerator;
+		auto ast = astGenerator.GenerateMemoryAST({ { "function int f(int n) { int total = 0; int step = 1; int local = 0; int seen = 0; function void add(int n) { total += n * step; local = n; } function int get() { return seen; } int copy = get; add(n); step = 2; return total; }", EyeSourceType::String }, false, false });
+		ASSERT_NE(ast, nullptr);
+
+		CaptureAnalysis captureAnalysis;
+		captureAnalysis.Analyze(ast.get());
+		const AST::FunctionStatement* add = FindFunction(ast->GetStatementList(), "add");
+		const AST::FunctionStatement* get = FindFunction(ast->GetStatementList(), "get");
+
+		// Parameters shadow, Writes by the enclosing Function alone do not box
+		ASSERT_EQ(GetCaptureNames(captureAnalysis, add), (std::vector<std::string>{ "total", "step", "local" }));
+		ASSERT_EQ(captureAnalysis.IsBoxed(captureAnalysis.GetCaptures(add)[0]), true);
+		ASSERT_EQ(captureAnalysis.IsBoxed(captureAnalysis.GetCaptures(add)[1]), false);
+		ASSERT_EQ(captureAnalysis.IsBoxed(captureAnalysis.GetCaptures(add)[2]), true);
+		ASSERT_EQ(captureAnalysis.Escapes(add), false);
+
+		// Used as a Value, the Closure may outlive f so even read-only Captures are boxed
+		ASSERT_EQ(captureAnalysis.Escapes(get), true);
+		ASSERT_EQ(captureAnalysis.IsBoxed(captureAnalysis.GetCaptures(get)[0]), true);
+	}
+}
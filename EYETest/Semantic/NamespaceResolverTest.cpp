@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/Semantic/NamespaceResolver.h"
+
+#include <gtest/gtest.h>
+#include <optional>
+
+namespace Eye
+{
+	static const AST::Expression* GetInitializer(const AST::Program* ast, size_t index)
+	{
+		return static_cast<const AST::VariableStatement*>(ast->GetStatementList()[index].get())->GetVariableDeclarationList()[0]->GetInitializer();
+	}
+
+	static const AST::IdentifierExpression* GetCallee(const AST::Expression* expr)
+	{
+		return static_cast<const AST::IdentifierExpression*>(static_cast<const AST::CallExpression*>(expr)->GetCallee());
+	}
+
+	TEST(SemanticNamespaceResolverTest, Resolve)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "function int sq(int x) { return x; } namespace Math { int k = 2; function int sq(int x) { return x * x * k; } namespace Trig { function int sq(int k) { return ::sq(k) + Math::sq(k); } } function int cube(int x) { return sq(x) * x; } } namespace Math { function int twice(int x) { return Trig.sq(x) * 2; } } int a = Math::sq(3); int b = Math.sq(1); int c = Math.Trig.sq(2); int d = sq(4);", EyeSourceType::String }, true, true, false, false });
+		ASSERT_EQ(res.has_value(), true);
+		const AST::Program* ast = res.value().get();
+
+		// Both Forms become one Identifier, Namespace Members are Globals under their qualified Names
+		ASSERT_EQ(GetCallee(GetInitializer(ast, 3))->GetValue(), "Math::sq");
+		ASSERT_EQ(GetCallee(GetInitializer(ast, 4))->GetValue(), "Math::sq");
+		ASSERT_EQ(GetCallee(GetInitializer(ast, 4))->GetName(), "Math::sq");
+		ASSERT_EQ(GetCallee(GetInitializer(ast, 5))->GetValue(), "Math::Trig::sq");
+		ASSERT_EQ(GetCallee(GetInitializer(ast, 6))->GetValue(), "sq");
+
+		const AST::NamespaceStatement* math = static_cast<const AST::NamespaceStatement*>(ast->GetStatementList()[1].get());
+		const AST::FunctionStatement* cube = static_cast<const AST::FunctionStatement*>(math->GetStatementList()[3].get());
+		ASSERT_EQ(cube->GetIdentifier()->GetValue(), "Math::cube");
+		ASSERT_EQ(cube->GetIdentifier()->GetName(), "cube");
+
+		// Unqualified Names search outwards, Locals first
+		const AST::Expression* cubeReturn = static_cast<const AST::ReturnStatement*>(cube->GetBody()->GetStatementList()[0].get())->GetExpression();
+		const AST::BinaryExpression* cubeProduct = static_cast<const AST::BinaryExpression*>(cubeReturn);
+		ASSERT_EQ(GetCallee(cubeProduct->GetLeft())->GetValue(), "Math::sq");
+		ASSERT_EQ(static_cast<const AST::IdentifierExpression*>(cubeProduct->GetRight())->GetValue(), "x");
+
+		const SymbolIndex* symbolIndex = ast->GetSymbolIndex().get();
+		ASSERT_NE(symbolIndex, nullptr);
+		ASSERT_EQ(symbolIndex->GetNamespaceCount(), 3);
+		uint32_t mathId = symbolIndex->FindNamespace(SymbolIndex::RootNamespace, "Math");
+		ASSERT_EQ(symbolIndex->GetNamespaceName(symbolIndex->FindNamespace(mathId, "Trig")), "Math::Trig");
+		ASSERT_EQ(symbolIndex->GetSymbol(symbolIndex->FindSymbol(mathId, "twice")).Kind, SymbolKind::Function);
+		ASSERT_EQ(symbolIndex->GetSymbol(symbolIndex->FindSymbol(mathId, "k")).Kind, SymbolKind::Variable);
+		ASSERT_EQ(symbolIndex->FindSymbol(SymbolIndex::RootNamespace, "twice"), SymbolIndex::InvalidId);
+
+		// Resolving again gives the same Result
+		NamespaceResolver namespaceResolver;
+		ASSERT_EQ(namespaceResolver.Resolve(res.value().get()).has_value(), true);
+		ASSERT_EQ(GetCallee(GetInitializer(ast, 4))->GetValue(), "Math::sq");
+		ASSERT_EQ(cube->GetIdentifier()->GetValue(), "Math::cube");
+	}
+
+	TEST(SemanticNamespaceResolverTest, Errors)
+	{
+		ASTGenerator astGenerator;
+		auto errorOf = [&astGenerator](const std::string& source)
+			{
+				auto res = astGenerator.GenerateAST({ { source, EyeSourceType::String }, true, true, false, false });
+				return (res.has_value() ? std::nullopt : std::optional<Error::ErrorType>(res.error().GetType()));
+			};
+
+		ASSERT_EQ(errorOf("namespace A { int x = 1; } namespace A { int y = x; } int z = A::y + A.x;"), std::nullopt);
+		ASSERT_EQ(errorOf("function void f() { namespace A { int x = 1; } }"), Error::ErrorType::SemanticBadNamespace);
+		ASSERT_EQ(errorOf("namespace A { int x = 1; } int y = A;"), Error::ErrorType::SemanticBadNamespace);
+		ASSERT_EQ(errorOf("namespace A { namespace B { int x = 1; } } int y = A.B;"), Error::ErrorType::SemanticBadNamespace);
+		ASSERT_EQ(errorOf("namespace A { int x = 1; } int A = 1;"), Error::ErrorType::SemanticReDeclaration);
+		ASSERT_EQ(errorOf("int A = 1; namespace A { int x = 1; }"), Error::ErrorType::SemanticReDeclaration);
+		ASSERT_EQ(errorOf("namespace A { int x = 1; } int y = A.z;"), Error::ErrorType::SemanticNotDeclared);
+		ASSERT_EQ(errorOf("namespace A { int x = 1; } int y = A::z;"), Error::ErrorType::SemanticNotDeclared);
+		ASSERT_EQ(errorOf("namespace A { int x = 1; } int y = x;"), Error::ErrorType::SemanticNotDeclared);
+		ASSERT_EQ(errorOf("namespace A { int x = 1; int x = 2; }"), Error::ErrorType::SemanticReDeclaration);
+		ASSERT_EQ(errorOf("namespace A { x = 1; }"), Error::ErrorType::ParserSyntaxError);
+	}
+
+	TEST(SemanticNamespaceResolverTest, SymbolIndex)
+	{
+		SymbolIndex symbolIndex;
+		uint32_t ns = SymbolIndex::RootNamespace;
+		for (size_t depth = 0; depth < 8; depth++)
+			ns = symbolIndex.AddNamespace(ns, "N" + std::to_string(depth));
+		for (size_t i = 0; i < 20000; i++)
+			symbolIndex.AddSymbol(ns, "f" + std::to_string(i), SymbolKind::Function);
+
+		ASSERT_EQ(symbolIndex.GetSymbolCount(), 20000);
+		ASSERT_EQ(symbolIndex.AddSymbol(ns, "f17", SymbolKind::Function), symbolIndex.FindSymbol(ns, "f17"));
+		ASSERT_EQ(symbolIndex.GetSymbol(symbolIndex.FindSymbol(ns, "f19999")).Name, "N0::N1::N2::N3::N4::N5::N6::N7::f19999");
+		ASSERT_EQ(symbolIndex.FindSymbol(SymbolIndex::RootNamespace, "f0"), SymbolIndex::InvalidId);
+		ASSERT_EQ(symbolIndex.AddNamespace(SymbolIndex::RootNamespace, "N0"), symbolIndex.FindNamespace(SymbolIndex::RootNamespace, "N0"));
+		ASSERT_EQ(symbolIndex.GetParentNamespace(symbolIndex.FindNamespace(SymbolIndex::RootNamespace, "N0")), SymbolIndex::RootNamespace);
+		ASSERT_EQ(symbolIndex.GetNamespaceCount(), 9);
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/TypeChecker/TypeChecker.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	TEST(ArrayTypeTest, Elements)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "float[4] a; int i = 2; float x = a[i - 1] * 2;", EyeSourceType::String }, true, true, false, false });
+		ASSERT_EQ(res.has_value(), true);
+
+		// float x = a[i - 1] * 2;
+		const AST::Expression* initializer = static_cast<const AST::VariableStatement*>(res.value()->GetStatementList()[2].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		const AST::Expression* element = static_cast<const AST::BinaryExpression*>(initializer)->GetLeft();
+		const TypeTable* typeTable = res.value()->GetTypeTable().get();
+		ASSERT_EQ(typeTable->GetType(element), Type::Float);
+		ASSERT_EQ(typeTable->GetType(static_cast<const AST::MemberExpression*>(element)->GetObject()), Type::Array);
+		ASSERT_EQ(typeTable->GetType(static_cast<const AST::MemberExpression*>(element)->GetProperty()), Type::Integer);
+	}
+
+	TEST(ArrayTypeTest, TypeCheck)
+	{
+		ASTGenerator astGenerator;
+		auto generate = [&astGenerator](const std::string& source) { return astGenerator.GenerateAST({ { source, EyeSourceType::String }, true, true, false, false }); };
+
+		ASSERT_EQ(generate("int[8] a; str[2] s; for (int i = 0; i < 8; i++) a[i] = a[7 - i] + i; s[1] += s[0]; a[0] <<= 2;").has_value(), true);
+		ASSERT_EQ(generate("function int sum() { bool[3] seen; seen[2] = true; int[3] a; a[0] += 1; return a[0]; }").has_value(), true);
+
+		auto res = generate("int[4] a; a[4] = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadMember);
+
+		res = generate("int i; i[0] = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadMember);
+
+		res = generate("int[4] a; a[1.5] = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = generate("int[4] a; a[0] = \"x\";");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = generate("int[4] a = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = generate("int[4] a; int[4] b; a = b;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadOperandType);
+
+		res = generate("int[4] a; bool same = a == a;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadOperandType);
+
+		res = generate("int[0] a;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::ParserSyntaxError);
+
+		res = generate("const int[4] a; a[0] = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticWriteReadOnly);
+	}
+}
@@ -46,5 +46,24 @@ namespace Eye
 
 		res = typeChecker.TypeCheck(astGenerator.GenerateMemoryAST({ { "function int add(int x, int y) { return add(x, y); } add(10, 20);", EyeSourceType::String }, false, false }).get());
 		ASSERT_EQ(res.has_value(), true);
+
+		// Arguments left out take their Default
+		res = typeChecker.TypeCheck(astGenerator.GenerateMemoryAST({ { "function int offset(int x, int by = 10) { return x + by; } offset(1); offset(1, 2);", EyeSourceType::String }, false, false }).get());
+		ASSERT_EQ(res.has_value(), true);
+
+		res = typeChecker.TypeCheck(astGenerator.GenerateMemoryAST({ { "function int offset(int x, int by = 10) { return x + by; } offset(1, 2.5);", EyeSourceType::String }, false, false }).get());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = typeChecker.TypeCheck(astGenerator.GenerateMemoryAST({ { "function int offset(int x, int by = 10) { return x + by; } offset();", EyeSourceType::String }, false, false }).get());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticTooFewArguments);
+
+		res = typeChecker.TypeCheck(astGenerator.GenerateMemoryAST({ { "function int offset(int x, int by = 10) { return x + by; } offset(1, 2, 3);", EyeSourceType::String }, false, false }).get());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticTooManyArguments);
+
+		auto program = astGenerator.GenerateAST({ { "function int offset(int x, int by = 10) { return x + by; } int r = offset(1);", EyeSourceType::String } });
+		ASSERT_EQ(program.has_value(), true);
 	}
 }
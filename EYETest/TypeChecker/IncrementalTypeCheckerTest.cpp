@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/Parser/IncrementalParser.h"
+#include "Eye/TypeChecker/TypeChecker.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	TEST(TypeCheckerIncrementalTest, ChangedFunction)
+	{
+		std::string text = "function int square(int x) { return x * x; }\nfunction int cube(int x) { return x * square(x); }\nfunction str name() { return \"eye\"; }\n";
+		IncrementalParser parser;
+		TypeChecker typeChecker;
+
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+		auto res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 3);
+
+		res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 0);
+
+		// Body Edit, only the Edited Function is re-checked
+		ASSERT_EQ(parser.Edit(parser.GetText().find("\"eye\""), 5, "\"eye lang\"").has_value(), true);
+		res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 1);
+	}
+
+	TEST(TypeCheckerIncrementalTest, ChangedDependency)
+	{
+		std::string text = "function int square(int x) { return x * x; }\nfunction int cube(int x) { return x * square(x); }\nfunction str name() { return \"eye\"; }\n";
+		IncrementalParser parser;
+		TypeChecker typeChecker;
+
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+		ASSERT_EQ(typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions()).has_value(), true);
+
+		// Signature Edit, Callers are re-checked and see the new Return Type
+		ASSERT_EQ(parser.Edit(0, 12, "function str").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("x * x"), 5, "\"x\"").has_value(), true);
+		auto res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 2);
+
+		ASSERT_EQ(parser.Edit(0, 12, "function int").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("\"x\""), 3, "x * x").has_value(), true);
+		res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 2);
+	}
+
+	TEST(TypeCheckerIncrementalTest, ChangedGlobal)
+	{
+		std::string text = "int limit = 10;\nfunction int clamp(int x) { if (x > limit) return limit; return x; }\nfunction int twice(int x) { return x * 2; }\n";
+		IncrementalParser parser;
+		TypeChecker typeChecker;
+
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+		ASSERT_EQ(typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions()).has_value(), true);
+
+		ASSERT_EQ(parser.Edit(0, 14, "str limit = \"10\"").has_value(), true);
+		auto res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(!res.has_value(), true);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeCompare);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 1);
+	}
+
+	TEST(TypeCheckerIncrementalTest, Namespaces)
+	{
+		std::string text = "namespace M { function int sq(int x) { return x * x; } }\nint a = M.sq(2);\nfunction int twice(int x) { return M::sq(x) * 2; }\n";
+		IncrementalParser parser;
+		TypeChecker typeChecker;
+
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+		ASSERT_EQ(typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions()).has_value(), true);
+
+		// Re-parsed Statements are resolved as well
+		ASSERT_EQ(parser.Edit(parser.GetText().find("M.sq(2)"), 7, "M.sq(M::sq(2)) + 1").has_value(), true);
+		auto res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 0);
+
+		// Changing a Member re-checks its Users
+		ASSERT_EQ(parser.Edit(parser.GetText().find("int sq"), 3, "str").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("x * x"), 5, "\"x\"").has_value(), true);
+		res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(!res.has_value(), true);
+
+		ASSERT_EQ(parser.Edit(parser.GetText().find("str sq"), 3, "int").has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("\"x\""), 3, "x * x").has_value(), true);
+		ASSERT_EQ(typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions()).has_value(), true);
+
+		// Namespace Errors keep the Program for the next Edit
+		auto editRes = parser.Edit(parser.GetText().find("M.sq(M::sq(2))"), 4, "M.nope");
+		ASSERT_EQ(!editRes.has_value(), true);
+		ASSERT_EQ(editRes.error().GetType(), Error::ErrorType::SemanticNotDeclared);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("M.nope"), 6, "M.sq").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 1);
+
+		// A new Member may change what reused Statements resolve to, every Statement gets a new Revision
+		std::vector<size_t> revisions = parser.GetStatementRevisions();
+		ASSERT_EQ(parser.Edit(parser.GetText().find("function int sq"), 0, "function int cube(int x) { return x * x * x; } ").has_value(), true);
+		ASSERT_EQ(parser.GetReparsedStatementCount(), 1);
+		ASSERT_NE(parser.GetStatementRevisions()[2], revisions[2]);
+		res = typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions());
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 1);
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/TypeChecker/TypeChecker.h"
+#include "Eye/Semantic/Semantic.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	TEST(StructLayoutTest, Offsets)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "struct Vec { float x; float y; } struct Body { int id; Vec position; Vec velocity; bool alive; } Body b; float vy = b.velocity.y;", EyeSourceType::String }, true, true, false, false });
+		ASSERT_EQ(res.has_value(), true);
+
+		const TypeTable* typeTable = res.value()->GetTypeTable().get();
+		const StructLayout* vec = typeTable->GetStructLayout("Vec");
+		const StructLayout* body = typeTable->GetStructLayout("Body");
+		ASSERT_NE(vec, nullptr);
+		ASSERT_NE(body, nullptr);
+		ASSERT_EQ(vec->GetSize(), 2);
+
+		// Nested Structs are stored inline
+		ASSERT_EQ(body->GetSize(), 6);
+		ASSERT_EQ(body->GetSlots(), (std::vector<Type>{ Type::Integer, Type::Float, Type::Float, Type::Float, Type::Float, Type::Boolean }));
+		ASSERT_EQ(body->GetField("id")->Offset, 0);
+		ASSERT_EQ(body->GetField("position")->Offset, 1);
+		ASSERT_EQ(body->GetField("position")->Layout, vec);
+		ASSERT_EQ(body->GetField("velocity")->Offset, 3);
+		ASSERT_EQ(body->GetField("alive")->Offset, 5);
+		ASSERT_EQ(body->GetField("mass"), nullptr);
+
+		// float vy = b.velocity.y;
+		const AST::Expression* initializer = static_cast<const AST::VariableStatement*>(res.value()->GetStatementList()[3].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		ASSERT_EQ(typeTable->GetType(initializer), Type::Float);
+		ASSERT_EQ(typeTable->GetMemberField(initializer), vec->GetField("y"));
+		const AST::Expression* velocity = static_cast<const AST::MemberExpression*>(initializer)->GetObject();
+		ASSERT_EQ(typeTable->GetType(velocity), Type::Struct);
+		ASSERT_EQ(typeTable->GetMemberField(velocity), body->GetField("velocity"));
+	}
+
+	TEST(StructLayoutTest, TypeCheck)
+	{
+		ASTGenerator astGenerator;
+		auto generate = [&astGenerator](const std::string& source) { return astGenerator.GenerateAST({ { source, EyeSourceType::String }, true, true, false, false }); };
+		std::string structs = "struct Vec { float x; float y; } struct Pair { float x; float y; } ";
+
+		ASSERT_EQ(generate(structs + "Vec a; Vec b = a; a = b; a.x = 2; a.y += a.x * 3; b.x -= 1;").has_value(), true);
+		ASSERT_EQ(generate(structs + "function float length(float x, float y) { Vec v; v.x = x; v.y = y; return v.x * v.x + v.y * v.y; }").has_value(), true);
+
+		// Equal Fields do not make Layouts interchangeable
+		auto res = generate(structs + "Vec a; Pair b = a;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = generate(structs + "Vec a; int i = a;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadTypeConversion);
+
+		res = generate(structs + "Vec a; a.z = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadMember);
+
+		res = generate("int i; i.x = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadMember);
+
+		res = generate(structs + "Vec a; Vec b; bool same = a == b;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadOperandType);
+
+		res = generate(structs + "Vec a; Vec b; a += b;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::TypeCheckerBadOperandType);
+	}
+
+	TEST(StructLayoutTest, Semantic)
+	{
+		ASTGenerator astGenerator;
+		auto generate = [&astGenerator](const std::string& source) { return astGenerator.GenerateAST({ { source, EyeSourceType::String }, true, true, false, false }); };
+
+		auto res = generate("Vec a;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticNotDeclared);
+
+		res = generate("struct Vec { float x; float x; }");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticReDeclaration);
+
+		res = generate("struct Vec { float x; } struct Vec { float y; }");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticReDeclaration);
+
+		// Fields can only refer to Structs declared before, a Struct can not hold itself
+		res = generate("struct Node { int value; Node next; }");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticNotDeclared);
+
+		res = generate("struct Vec { void x; }");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticBadDataType);
+
+		res = generate("int Vec; Vec a;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticBadDataType);
+
+		res = generate("struct Vec { float x; } int i = Vec;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticBadDataType);
+
+		res = generate("function void f() { struct Vec { float x; } }");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticBadDataType);
+
+		res = generate("struct Vec { float x; } const Vec a; a.x = 1;");
+		ASSERT_EQ(res.has_value(), false);
+		ASSERT_EQ(res.error().GetType(), Error::ErrorType::SemanticWriteReadOnly);
+	}
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+#include "Eye/ASTGenerator/ASTGenerator.h"
+#include "Eye/Parser/IncrementalParser.h"
+#include "Eye/TypeChecker/TypeChecker.h"
+
+#include <gtest/gtest.h>
+
+namespace Eye
+{
+	TEST(TypeTableTest, Annotations)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "function float half(int x) { return x / 2.0; } float y = half(3) + 1; bool z = y > 1;", EyeSourceType::String }, true, true, false, false });
+		ASSERT_EQ(res.has_value(), true);
+
+		const AST::Program* program = res.value().get();
+		const TypeTable* typeTable = program->GetTypeTable().get();
+		ASSERT_NE(typeTable, nullptr);
+		// Every Expression except the declared Names half, x, y & z
+		ASSERT_EQ(typeTable->GetAnnotatedCount(), program->GetExpressionIdCount() - 4);
+
+		// float y = half(3) + 1;
+		const AST::Expression* initializer = static_cast<const AST::VariableStatement*>(program->GetStatementList()[1].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		ASSERT_EQ(typeTable->GetType(initializer), Type::Float);
+		const AST::Expression* call = static_cast<const AST::BinaryExpression*>(initializer)->GetLeft();
+		ASSERT_EQ(typeTable->GetType(call), Type::Float);
+		ASSERT_EQ(typeTable->GetType(static_cast<const AST::CallExpression*>(call)->GetCallee()), Type::Function);
+		ASSERT_NE(typeTable->GetCallType(call), nullptr);
+		ASSERT_EQ(*typeTable->GetCallType(call), (FunctionType{ Type::Float, { Type::Integer }, 1 }));
+		ASSERT_EQ(typeTable->GetCallType(initializer), nullptr);
+		ASSERT_EQ(typeTable->GetType(static_cast<const AST::BinaryExpression*>(initializer)->GetRight()), Type::Integer);
+
+		// bool z = y > 1;
+		initializer = static_cast<const AST::VariableStatement*>(program->GetStatementList()[2].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		ASSERT_EQ(typeTable->GetType(initializer), Type::Boolean);
+
+		res = astGenerator.GenerateAST({ { "int y = 1;", EyeSourceType::String }, false, true });
+		ASSERT_EQ(res.has_value(), true);
+		ASSERT_EQ(res.value()->GetTypeTable(), nullptr);
+	}
+
+	TEST(TypeTableTest, FoldedConstants)
+	{
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST({ { "const float x = 1; float y = x * 2;", EyeSourceType::String } });
+		ASSERT_EQ(res.has_value(), true);
+
+		// The Folded Literal takes over the Id of the Expression it replaced
+		const AST::Expression* initializer = static_cast<const AST::VariableStatement*>(res.value()->GetStatementList()[1].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		ASSERT_EQ(initializer->GetType(), AST::ExpressionType::LiteralExpression);
+		ASSERT_EQ(res.value()->GetTypeTable()->GetType(initializer), Type::Float);
+	}
+
+	TEST(TypeTableTest, Incremental)
+	{
+		std::string text = "function int square(int x) { return x * x; }\nint y = square(2);\n";
+		IncrementalParser parser;
+		TypeChecker typeChecker;
+
+		ASSERT_EQ(parser.Parse(EyeSource(text, EyeSourceType::String)).has_value(), true);
+		ASSERT_EQ(typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions()).has_value(), true);
+		uint32_t expressionIdCount = parser.GetProgram()->GetExpressionIdCount();
+
+		// Re-Parsed Statements get fresh Ids, the unchanged Function keeps its Annotations
+		ASSERT_EQ(parser.Edit(parser.GetText().find("2)"), 1, "3.5").has_value(), true);
+		ASSERT_EQ(!typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions()).has_value(), true);
+		ASSERT_EQ(parser.Edit(parser.GetText().find("3.5"), 3, "4").has_value(), true);
+		ASSERT_EQ(typeChecker.TypeCheck(parser.GetProgram(), parser.GetStatementRevisions()).has_value(), true);
+		ASSERT_EQ(typeChecker.GetCheckedFunctionCount(), 0);
+		ASSERT_GT(parser.GetProgram()->GetExpressionIdCount(), expressionIdCount);
+
+		const AST::FunctionStatement* functionStmt = static_cast<const AST::FunctionStatement*>(parser.GetProgram()->GetStatementList()[0].get());
+		const AST::Expression* body = static_cast<const AST::ReturnStatement*>(functionStmt->GetBody()->GetStatementList()[0].get())->GetExpression();
+		ASSERT_EQ(typeChecker.GetTypeTable()->GetType(body), Type::Integer);
+
+		const AST::Expression* call = static_cast<const AST::VariableStatement*>(parser.GetProgram()->GetStatementList()[1].get())->GetVariableDeclarationList()[0]->GetInitializer();
+		ASSERT_GE(call->GetId(), expressionIdCount);
+		ASSERT_EQ(typeChecker.GetTypeTable()->GetType(call), Type::Integer);
+	}
+}
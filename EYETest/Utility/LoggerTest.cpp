@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Eye/Utility/Logger.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace Eye
+{
+	TEST(UtilityLoggerTest, Capture)
+	{
+		Logger::Clear();
+		EYE_LOG_WARN("First {}", 1);
+		EYE_LOG_ERROR("Second {}", 2);
+
+		auto logs = Logger::GetLogs();
+		ASSERT_EQ(logs.size(), 2);
+		ASSERT_EQ(logs[0], "First 1");
+		ASSERT_EQ(logs[1], "Second 2");
+
+		Logger::Clear();
+		ASSERT_EQ(Logger::GetLogs().empty(), true);
+	}
+
+	TEST(UtilityLoggerTest, Bounded)
+	{
+		Logger::Clear();
+		for (size_t i = 0; i < Logger::CaptureCapacity * 3; i++)
+			EYE_LOG_WARN("Log {}", i);
+
+		auto logs = Logger::GetLogs();
+		ASSERT_EQ(logs.size(), Logger::CaptureCapacity);
+		ASSERT_EQ(logs.front(), "Log " + std::to_string(Logger::CaptureCapacity * 2));
+		ASSERT_EQ(logs.back(), "Log " + std::to_string(Logger::CaptureCapacity * 3 - 1));
+
+		Logger::Clear();
+		EYE_LOG_WARN("{}", std::string(Logger::CaptureMessageSize * 2, 'x'));
+		ASSERT_EQ(Logger::GetLogs()[0].size(), Logger::CaptureMessageSize);
+		Logger::Clear();
+	}
+
+	TEST(UtilityLoggerTest, Critical)
+	{
+		Logger::Clear();
+		try
+		{
+			EYE_LOG_CRITICAL("Fatal {}", 3);
+			FAIL();
+		}
+		catch (const CriticalError& ex)
+		{
+			ASSERT_EQ(std::string(ex.what()), "Fatal 3");
+		}
+		ASSERT_EQ(Logger::GetLogs().back(), "Fatal 3");
+		Logger::Clear();
+	}
+
+	TEST(UtilityLoggerTest, PerThread)
+	{
+		Logger::Clear();
+		EYE_LOG_WARN("Main");
+
+		std::vector<std::string> threadLogs;
+		std::thread thread([&threadLogs]()
+			{
+				EYE_LOG_WARN("Worker");
+				threadLogs = Logger::GetLogs();
+			});
+		thread.join();
+
+		ASSERT_EQ(threadLogs.size(), 1);
+		ASSERT_EQ(threadLogs[0], "Worker");
+		ASSERT_EQ(Logger::GetLogs().size(), 1);
+		ASSERT_EQ(Logger::GetLogs()[0], "Main");
+		Logger::Clear();
+	}
+}
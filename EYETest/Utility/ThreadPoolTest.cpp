@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Eye/Utility/ThreadPool.h"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace Eye
+{
+	TEST(UtilityThreadPoolTest, Submit)
+	{
+		ThreadPool threadPool(4);
+		std::atomic<size_t> count = 0;
+		for (size_t i = 0; i < 1000; i++)
+			threadPool.Submit([&threadPool, &count]()
+				{
+					threadPool.Submit([&count]() { count++; });
+					count++;
+				});
+		threadPool.Wait();
+		ASSERT_EQ(count, 2000);
+	}
+
+	TEST(UtilityThreadPoolTest, Exception)
+	{
+		ThreadPool threadPool(2);
+		std::atomic<size_t> count = 0;
+		for (size_t i = 0; i < 100; i++)
+			threadPool.Submit([&count, i]()
+				{
+					if (i % 10 == 0)
+						throw std::runtime_error("Task " + std::to_string(i));
+					count++;
+				});
+		ASSERT_THROW(threadPool.Wait(), std::runtime_error);
+		ASSERT_EQ(count, 90);
+
+		// The Exception is reported once, the Pool keeps working
+		threadPool.Submit([&count]() { count++; });
+		threadPool.Wait();
+		ASSERT_EQ(count, 91);
+	}
+}
@@ -12,23 +12,29 @@ namespace Eye
 	{
 		/*
 			AssignmentExpression
-				: LogicalORExpression
+				: BinaryExpression
 				| LHSExpression AssignmentOperator AssignmentExpression
 		*/
 		class AssignmentExpression : public Expression
 		{
 		public:
-			AssignmentExpression(const EyeSource& source, std::unique_ptr<Token> op, std::unique_ptr<Expression> lhsExpression, std::unique_ptr<Expression> expression)
-				: Expression(ExpressionType::AssignmentExpression, source), m_Operator(std::move(op)), m_LHSExpression(std::move(lhsExpression)), m_Expression(std::move(expression))
+			AssignmentExpression(const EyeSource& source, TokenType op, std::unique_ptr<Expression> lhsExpression, std::unique_ptr<Expression> expression)
+				: Expression(ExpressionType::AssignmentExpression, source), m_Operator(op), m_LHSExpression(std::move(lhsExpression)), m_Expression(std::move(expression))
 			{
 			}
 
-			inline const Token* GetOperator() const { return m_Operator.get(); }
+			inline TokenType GetOperatorType() const { return m_Operator; }
+			// Token Shim, the Operator shares the Expression's Source
+			inline Token GetOperator() const { return Token(m_Operator, GetSource()); }
 			inline const Expression* GetLHSExpression() const { return m_LHSExpression.get(); }
+			inline Expression* GetLHSExpression() { return m_LHSExpression.get(); }
+			inline void SetLHSExpression(std::unique_ptr<Expression> lhsExpression) { m_LHSExpression = std::move(lhsExpression); }
 			inline const Expression* GetExpression() const { return m_Expression.get(); }
+			inline Expression* GetExpression() { return m_Expression.get(); }
+			inline void SetExpression(std::unique_ptr<Expression> expression) { m_Expression = std::move(expression); }
 
 		private:
-			std::unique_ptr<Token> m_Operator;
+			TokenType m_Operator;
 			std::unique_ptr<Expression> m_LHSExpression;
 			std::unique_ptr<Expression> m_Expression;
 		};
@@ -4,6 +4,7 @@
 #include "Eye/Lexer/Token.h"
 
 #include <memory>
+#include <vector>
 
 namespace Eye
 {
@@ -17,17 +18,51 @@ namespace Eye
 		class BinaryExpression : public Expression
 		{
 		public:
-			BinaryExpression(const EyeSource& source, std::unique_ptr<Token> op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right)
-				: Expression(ExpressionType::BinaryExpression, source), m_Operator(std::move(op)), m_Left(std::move(left)), m_Right(std::move(right))
+			BinaryExpression(const EyeSource& source, TokenType op, std::unique_ptr<Expression> left, std::unique_ptr<Expression> right)
+				: Expression(ExpressionType::BinaryExpression, source), m_Operator(op), m_Left(std::move(left)), m_Right(std::move(right))
 			{
 			}
 
-			inline const Token* GetOperator() const { return m_Operator.get(); }
+			// Left-Deep Chains (Generated Code emits 100k Terms) are released in a Loop instead of one Frame per Term
+			~BinaryExpression()
+			{
+				std::unique_ptr<Expression> left = std::move(m_Left);
+				while (left && left->GetType() == ExpressionType::BinaryExpression)
+				{
+					std::unique_ptr<Expression> next = std::move(static_cast<BinaryExpression*>(left.get())->m_Left);
+					left = std::move(next);
+				}
+			}
+
+			inline TokenType GetOperatorType() const { return m_Operator; }
+			// Token Shim, the Operator shares the Expression's Source
+			inline Token GetOperator() const { return Token(m_Operator, GetSource()); }
 			inline const Expression* GetLeft() const { return m_Left.get(); }
+			inline Expression* GetLeft() { return m_Left.get(); }
 			inline const Expression* GetRight() const { return m_Right.get(); }
+			inline Expression* GetRight() { return m_Right.get(); }
+			inline void SetLeft(std::unique_ptr<Expression> left) { m_Left = std::move(left); }
+			inline void SetRight(std::unique_ptr<Expression> right) { m_Right = std::move(right); }
+
+			// This Expression followed by every BinaryExpression down its Left Operands, the Leftmost Operand is GetLeftSpine().back()->GetLeft()
+			std::vector<const BinaryExpression*> GetLeftSpine() const
+			{
+				std::vector<const BinaryExpression*> spine = { this };
+				while (spine.back()->GetLeft()->GetType() == ExpressionType::BinaryExpression)
+					spine.push_back(static_cast<const BinaryExpression*>(spine.back()->GetLeft()));
+				return spine;
+			}
+
+			std::vector<BinaryExpression*> GetLeftSpine()
+			{
+				std::vector<BinaryExpression*> spine = { this };
+				while (spine.back()->GetLeft()->GetType() == ExpressionType::BinaryExpression)
+					spine.push_back(static_cast<BinaryExpression*>(spine.back()->GetLeft()));
+				return spine;
+			}
 
 		private:
-			std::unique_ptr<Token> m_Operator;
+			TokenType m_Operator;
 			std::unique_ptr<Expression> m_Left;
 			std::unique_ptr<Expression> m_Right;
 		};
@@ -38,7 +38,10 @@ namespace Eye
 			}
 
 			inline const Expression* GetCallee() const { return m_Callee.get(); }
+			inline Expression* GetCallee() { return m_Callee.get(); }
+			inline void SetCallee(std::unique_ptr<Expression> callee) { m_Callee = std::move(callee); }
 			inline const std::vector<std::unique_ptr<Expression>>& GetArguments() const { return m_Arguments; }
+			inline std::vector<std::unique_ptr<Expression>>& GetArguments() { return m_Arguments; }
 
 		private:
 			std::unique_ptr<Expression> m_Callee;
@@ -2,6 +2,8 @@
 
 #include "Eye/Utility/EyeSource.h"
 
+#include <cstdint>
+
 namespace Eye
 {
 	namespace AST
@@ -26,8 +28,16 @@ namespace Eye
 		class Expression
 		{
 		public:
+			static constexpr uint32_t InvalidId = UINT32_MAX;
+
+			virtual ~Expression() = default;
+
 			inline ExpressionType GetType() const { return m_Type; }
 			inline const EyeSource& GetSource() const { return m_Source; }
+			inline EyeSource& GetSource() { return m_Source; }
+			// Dense Index given by the Parser, unique within a Program (see Program::GetExpressionIdCount)
+			inline uint32_t GetId() const { return m_Id; }
+			inline void SetId(uint32_t id) { m_Id = id; }
 
 		protected:
 			Expression(ExpressionType type, const EyeSource& source)
@@ -37,6 +47,7 @@ namespace Eye
 
 		private:
 			ExpressionType m_Type;
+			uint32_t m_Id = InvalidId;
 			EyeSource m_Source;
 		};
 	}
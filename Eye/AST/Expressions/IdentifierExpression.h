@@ -3,6 +3,8 @@
 #include "Eye/AST/Expressions/Expression.h"
 #include "Eye/Lexer/Token.h"
 
+#include <string>
+
 namespace Eye
 {
 	namespace AST
@@ -15,15 +17,23 @@ namespace Eye
 		class IdentifierExpression : public Expression
 		{
 		public:
-			IdentifierExpression(const EyeSource& source, std::unique_ptr<Token> identifier)
-				: Expression(ExpressionType::IdentifierExpression, source), m_Identifier(std::move(identifier))
+			IdentifierExpression(const EyeSource& source, const std::string& name)
+				: Expression(ExpressionType::IdentifierExpression, source), m_Name(name)
 			{
 			}
 
-			inline std::string GetValue() const { return m_Identifier->GetValue<StringType>(); }
+			// Name every Pass after the NamespaceResolver looks the Identifier up by, qualified for Namespace Members
+			inline const std::string& GetValue() const { return (m_Symbol.empty() ? m_Name : m_Symbol); }
+			// Name as written, i.e 'square', 'Math::square' or '::square'
+			inline const std::string& GetName() const { return m_Name; }
+			// Qualified Name the NamespaceResolver resolved the Identifier to, empty for Locals & unresolved Names
+			inline void SetSymbol(const std::string& symbol) { m_Symbol = symbol; }
+			// Token Shim, the Identifier shares the Expression's Source
+			inline Token GetIdentifier() const { return Token(TokenType::Identifier, GetValue(), GetSource()); }
 
 		private:
-			std::unique_ptr<Token> m_Identifier;
+			std::string m_Name;
+			std::string m_Symbol;
 		};
 	}
 }
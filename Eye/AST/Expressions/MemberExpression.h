@@ -25,7 +25,11 @@ namespace Eye
 			}
 
 			inline const Expression* GetObject() const { return m_Object.get(); }
+			inline Expression* GetObject() { return m_Object.get(); }
+			inline void SetObject(std::unique_ptr<Expression> object) { m_Object = std::move(object); }
 			inline const Expression* GetProperty() const { return m_Property.get(); }
+			inline Expression* GetProperty() { return m_Property.get(); }
+			inline void SetProperty(std::unique_ptr<Expression> property) { m_Property = std::move(property); }
 			inline bool IsComputed() const { return m_Computed; }
 
 		private:
@@ -21,16 +21,20 @@ namespace Eye
 		class PostfixExpression : public Expression
 		{
 		public:
-			PostfixExpression(const EyeSource& source, std::unique_ptr<Token> op, std::unique_ptr<Expression> expression)
-				: Expression(ExpressionType::PostfixExpression, source), m_Operator(std::move(op)), m_Expression(std::move(expression))
+			PostfixExpression(const EyeSource& source, TokenType op, std::unique_ptr<Expression> expression)
+				: Expression(ExpressionType::PostfixExpression, source), m_Operator(op), m_Expression(std::move(expression))
 			{
 			}
 
-			inline const Token* GetOperator() const { return m_Operator.get(); }
+			inline TokenType GetOperatorType() const { return m_Operator; }
+			// Token Shim, the Operator shares the Expression's Source
+			inline Token GetOperator() const { return Token(m_Operator, GetSource()); }
 			inline const Expression* GetExpression() const { return m_Expression.get(); }
+			inline Expression* GetExpression() { return m_Expression.get(); }
+			inline void SetExpression(std::unique_ptr<Expression> expression) { m_Expression = std::move(expression); }
 
 		private:
-			std::unique_ptr<Token> m_Operator;
+			TokenType m_Operator;
 			std::unique_ptr<Expression> m_Expression;
 		};
 	}
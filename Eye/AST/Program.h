@@ -4,6 +4,13 @@
 
 #include <vector>
 #include <memory>
+#include <cstdint>
+
+namespace Eye
+{
+	class TypeTable;
+	class SymbolIndex;
+}
 
 namespace Eye
 {
@@ -28,9 +35,22 @@ namespace Eye
 			}
 
 			inline const std::vector<std::unique_ptr<Statement>>& GetStatementList() const { return m_StatementList; }
+			inline std::vector<std::unique_ptr<Statement>>& GetStatementList() { return m_StatementList; }
+			// Every Expression Id of the Program is below the Count
+			inline uint32_t GetExpressionIdCount() const { return m_ExpressionIdCount; }
+			inline void SetExpressionIdCount(uint32_t count) { m_ExpressionIdCount = count; }
+			// Types the TypeChecker inferred, null unless the Program was Type Checked
+			inline const std::shared_ptr<const TypeTable>& GetTypeTable() const { return m_TypeTable; }
+			inline void SetTypeTable(std::shared_ptr<const TypeTable> typeTable) { m_TypeTable = std::move(typeTable); }
+			// Globals by Namespace, null unless the Program was resolved (see NamespaceResolver)
+			inline const std::shared_ptr<const SymbolIndex>& GetSymbolIndex() const { return m_SymbolIndex; }
+			inline void SetSymbolIndex(std::shared_ptr<const SymbolIndex> symbolIndex) { m_SymbolIndex = std::move(symbolIndex); }
 
 		private:
 			std::vector<std::unique_ptr<Statement>> m_StatementList;
+			uint32_t m_ExpressionIdCount = 0;
+			std::shared_ptr<const TypeTable> m_TypeTable;
+			std::shared_ptr<const SymbolIndex> m_SymbolIndex;
 		};
 	}
 }
@@ -22,7 +22,26 @@ namespace Eye
 			{
 			}
 
+			// Nested Blocks are flattened into one Worklist instead of one Frame per Level
+			~BlockStatement()
+			{
+				std::vector<std::unique_ptr<Statement>> pending = std::move(m_StatementList);
+				while (!pending.empty())
+				{
+					std::unique_ptr<Statement> statement = std::move(pending.back());
+					pending.pop_back();
+					if (statement && statement->GetType() == StatementType::BlockStatement)
+					{
+						std::vector<std::unique_ptr<Statement>>& nested = static_cast<BlockStatement*>(statement.get())->m_StatementList;
+						for (auto& nestedStatement : nested)
+							pending.push_back(std::move(nestedStatement));
+						nested.clear();
+					}
+				}
+			}
+
 			inline const std::vector<std::unique_ptr<Statement>>& GetStatementList() const { return m_StatementList; }
+			inline std::vector<std::unique_ptr<Statement>>& GetStatementList() { return m_StatementList; }
 
 		private:
 			std::vector<std::unique_ptr<Statement>> m_StatementList;
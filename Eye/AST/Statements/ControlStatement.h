@@ -24,8 +24,16 @@ namespace Eye
 			}
 		
 			inline const Expression* GetCondition() const { return m_Condition.get(); }
+			inline Expression* GetCondition() { return m_Condition.get(); }
+			inline void SetCondition(std::unique_ptr<Expression> condition) { m_Condition = std::move(condition); }
 			inline const Statement* GetConsequent() const { return m_Consequent.get(); }
+			inline Statement* GetConsequent() { return m_Consequent.get(); }
 			inline const Statement* GetAlternate() const { return m_Alternate.get(); }
+			inline Statement* GetAlternate() { return m_Alternate.get(); }
+			inline void SetConsequent(std::unique_ptr<Statement> consequent) { m_Consequent = std::move(consequent); }
+			inline void SetAlternate(std::unique_ptr<Statement> alternate) { m_Alternate = std::move(alternate); }
+			inline std::unique_ptr<Statement> ReleaseConsequent() { return std::move(m_Consequent); }
+			inline std::unique_ptr<Statement> ReleaseAlternate() { return std::move(m_Alternate); }
 
 		private:
 			std::unique_ptr<Expression> m_Condition;
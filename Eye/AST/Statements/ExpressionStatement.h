@@ -21,6 +21,8 @@ namespace Eye
 			}
 
 			inline const Expression* GetExpression() const { return m_Expression.get(); }
+			inline Expression* GetExpression() { return m_Expression.get(); }
+			inline void SetExpression(std::unique_ptr<Expression> expression) { m_Expression = std::move(expression); }
 
 		private:
 			std::unique_ptr<Expression> m_Expression;
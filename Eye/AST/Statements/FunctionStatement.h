@@ -3,6 +3,7 @@
 #include "Eye/AST/Statements/Statement.h"
 #include "Eye/AST/Statements/BlockStatement.h"
 #include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/TypeSpecifier.h"
 
 #include <memory>
 #include <vector>
@@ -24,19 +25,23 @@ namespace Eye
 		class FunctionParameter
 		{
 		public:
-			FunctionParameter(std::unique_ptr<Token> typeQualifier, std::unique_ptr<Token> dataType, std::unique_ptr<IdentifierExpression> identifier, std::unique_ptr<Expression> initializer)
-				: m_TypeQualifier(std::move(typeQualifier)), m_DataType(std::move(dataType)), m_Identifier(std::move(identifier)), m_Initializer(std::move(initializer))
+			FunctionParameter(const TypeSpecifier& typeSpecifier, std::unique_ptr<IdentifierExpression> identifier, std::unique_ptr<Expression> initializer)
+				: m_TypeSpecifier(typeSpecifier), m_Identifier(std::move(identifier)), m_Initializer(std::move(initializer))
 			{
 			}
 
-			inline const Token* GetTypeQualifier() const { return m_TypeQualifier.get(); }
-			inline const Token* GetDataType() const { return m_DataType.get(); }
+			inline const TypeSpecifier& GetTypeSpecifier() const { return m_TypeSpecifier; }
+			inline TypeSpecifier& GetTypeSpecifier() { return m_TypeSpecifier; }
+			inline Token GetTypeQualifier() const { return m_TypeSpecifier.GetTypeQualifierToken(m_Identifier->GetSource()); }
+			inline Token GetDataType() const { return m_TypeSpecifier.GetDataTypeToken(m_Identifier->GetSource()); }
 			inline const IdentifierExpression* GetIdentifier() const { return m_Identifier.get(); }
+			inline IdentifierExpression* GetIdentifier() { return m_Identifier.get(); }
 			inline const Expression* GetInitializer() const { return m_Initializer.get(); }
+			inline Expression* GetInitializer() { return m_Initializer.get(); }
+			inline void SetInitializer(std::unique_ptr<Expression> initializer) { m_Initializer = std::move(initializer); }
 
 		private:
-			std::unique_ptr<Token> m_TypeQualifier;
-			std::unique_ptr<Token> m_DataType;
+			TypeSpecifier m_TypeSpecifier;
 			std::unique_ptr<IdentifierExpression> m_Identifier;
 			std::unique_ptr<Expression> m_Initializer;
 		};
@@ -49,18 +54,23 @@ namespace Eye
 		class FunctionStatement : public Statement
 		{
 		public:
-			FunctionStatement(const EyeSource& source, std::unique_ptr<Token> returnType, std::unique_ptr<IdentifierExpression> identifier, std::vector<std::unique_ptr<FunctionParameter>>&& parameters, std::unique_ptr<BlockStatement> body)
-				: Statement(StatementType::FunctionStatement, source), m_ReturnType(std::move(returnType)), m_Identifier(std::move(identifier)), m_Parameters(std::move(parameters)), m_Body(std::move(body))
+			FunctionStatement(const EyeSource& source, const TypeSpecifier& returnType, std::unique_ptr<IdentifierExpression> identifier, std::vector<std::unique_ptr<FunctionParameter>>&& parameters, std::unique_ptr<BlockStatement> body)
+				: Statement(StatementType::FunctionStatement, source), m_ReturnType(returnType), m_Identifier(std::move(identifier)), m_Parameters(std::move(parameters)), m_Body(std::move(body))
 			{
 			}
 
-			inline const Token* GetReturnType() const { return m_ReturnType.get(); }
+			inline const TypeSpecifier& GetReturnTypeSpecifier() const { return m_ReturnType; }
+			inline TypeSpecifier& GetReturnTypeSpecifier() { return m_ReturnType; }
+			inline Token GetReturnType() const { return m_ReturnType.GetDataTypeToken(GetSource()); }
 			inline const IdentifierExpression* GetIdentifier() const { return m_Identifier.get(); }
+			inline IdentifierExpression* GetIdentifier() { return m_Identifier.get(); }
 			inline const std::vector<std::unique_ptr<FunctionParameter>>& GetParameters() const { return m_Parameters; }
+			inline std::vector<std::unique_ptr<FunctionParameter>>& GetParameters() { return m_Parameters; }
 			inline const BlockStatement* GetBody() const { return m_Body.get(); }
+			inline BlockStatement* GetBody() { return m_Body.get(); }
 
 		private:
-			std::unique_ptr<Token> m_ReturnType;
+			TypeSpecifier m_ReturnType;
 			std::unique_ptr<IdentifierExpression> m_Identifier;
 			std::vector<std::unique_ptr<FunctionParameter>> m_Parameters;
 			std::unique_ptr<BlockStatement> m_Body;
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Expressions/LiteralExpression.h"
+
+#include <memory>
+
+namespace Eye
+{
+	namespace AST
+	{
+		/*
+			ImportStatement
+				: 'import' StringLiteral ';'
+				;
+
+			The Path is relative to the importing File, the imported Module's Functions become Globals at the Import.
+		*/
+		class ImportStatement : public Statement
+		{
+		public:
+			ImportStatement(const EyeSource& source, std::unique_ptr<LiteralExpression> path)
+				: Statement(StatementType::ImportStatement, source), m_Path(std::move(path))
+			{
+			}
+
+			inline const LiteralExpression* GetPath() const { return m_Path.get(); }
+			inline LiteralExpression* GetPath() { return m_Path.get(); }
+
+		private:
+			std::unique_ptr<LiteralExpression> m_Path;
+		};
+	}
+}
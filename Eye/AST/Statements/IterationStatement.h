@@ -52,7 +52,11 @@ namespace Eye
 			}
 
 			inline const Expression* GetCondition() const { return m_Condition.get(); }
+			inline Expression* GetCondition() { return m_Condition.get(); }
+			inline void SetCondition(std::unique_ptr<Expression> condition) { m_Condition = std::move(condition); }
 			inline const Statement* GetBody() const { return m_Body.get(); }
+			inline Statement* GetBody() { return m_Body.get(); }
+			inline void SetBody(std::unique_ptr<Statement> body) { m_Body = std::move(body); }
 
 		private:
 			std::unique_ptr<Expression> m_Condition;
@@ -73,7 +77,11 @@ namespace Eye
 			}
 
 			inline const Expression* GetCondition() const { return m_Condition.get(); }
+			inline Expression* GetCondition() { return m_Condition.get(); }
+			inline void SetCondition(std::unique_ptr<Expression> condition) { m_Condition = std::move(condition); }
 			inline const Statement* GetBody() const { return m_Body.get(); }
+			inline Statement* GetBody() { return m_Body.get(); }
+			inline void SetBody(std::unique_ptr<Statement> body) { m_Body = std::move(body); }
 
 		private:
 			std::unique_ptr<Expression> m_Condition;
@@ -123,10 +131,25 @@ namespace Eye
 				return (std::get<std::unique_ptr<T>>(m_Initializer)).get();
 			}
 
+			template<typename T>
+			inline T* GetInitializer()
+			{
+				static_assert(std::is_same_v<T, VariableStatement> || std::is_same_v<T, Expression>, "Eye->AST->IterationStatement->ForStatement->Error GetInitializer() Invalid Typename");
+				return (std::get<std::unique_ptr<T>>(m_Initializer)).get();
+			}
+
+			// Only for Expression Initializers
+			inline void SetInitializer(std::unique_ptr<Expression> initializer) { m_Initializer = std::move(initializer); }
 			inline ForInitializerType GetInitializerType() const { return m_InitializerType; }
 			inline const Expression* GetCondition() const { return m_Condition.get(); }
+			inline Expression* GetCondition() { return m_Condition.get(); }
+			inline void SetCondition(std::unique_ptr<Expression> condition) { m_Condition = std::move(condition); }
 			inline const Expression* GetUpdate() const { return m_Update.get(); }
+			inline Expression* GetUpdate() { return m_Update.get(); }
+			inline void SetUpdate(std::unique_ptr<Expression> update) { m_Update = std::move(update); }
 			inline const Statement* GetBody() const { return m_Body.get(); }
+			inline Statement* GetBody() { return m_Body.get(); }
+			inline void SetBody(std::unique_ptr<Statement> body) { m_Body = std::move(body); }
 
 		private:
 			std::variant<std::unique_ptr<VariableStatement>, std::unique_ptr<Expression>, std::monostate> m_Initializer;
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Expressions/IdentifierExpression.h"
+
+#include <memory>
+#include <vector>
+
+namespace Eye
+{
+	namespace AST
+	{
+		/*
+			NamespaceStatement
+				: 'namespace' IdentifierExpression '{' OptionalNamespaceMemberList '}'
+				;
+
+			NamespaceMember
+				: VariableStatement
+				| FunctionStatement
+				| NamespaceStatement
+				;
+
+			Opens no Scope, its Members are Globals named 'Namespace::Member' once resolved (see NamespaceResolver).
+			Reopening a Namespace adds to it.
+		*/
+		class NamespaceStatement : public Statement
+		{
+		public:
+			NamespaceStatement(const EyeSource& source, std::unique_ptr<IdentifierExpression> identifier, std::vector<std::unique_ptr<Statement>>&& statementList)
+				: Statement(StatementType::NamespaceStatement, source), m_Identifier(std::move(identifier)), m_StatementList(std::move(statementList))
+			{
+			}
+
+			inline const IdentifierExpression* GetIdentifier() const { return m_Identifier.get(); }
+			inline IdentifierExpression* GetIdentifier() { return m_Identifier.get(); }
+			inline const std::vector<std::unique_ptr<Statement>>& GetStatementList() const { return m_StatementList; }
+			inline std::vector<std::unique_ptr<Statement>>& GetStatementList() { return m_StatementList; }
+
+		private:
+			std::unique_ptr<IdentifierExpression> m_Identifier;
+			std::vector<std::unique_ptr<Statement>> m_StatementList;
+		};
+	}
+}
@@ -17,6 +17,9 @@ namespace Eye
 			BreakStatement,
 			FunctionStatement,
 			ReturnStatement,
+			ImportStatement,
+			StructStatement,
+			NamespaceStatement,
 		};
 
 		/*
@@ -30,13 +33,19 @@ namespace Eye
 				| BreakStatement
 				| FunctionStatement
 				| ReturnStatement
+				| ImportStatement
+				| StructStatement
+				| NamespaceStatement
 				;
 		*/
 		class Statement
 		{
 		public:
+			virtual ~Statement() = default;
+
 			inline StatementType GetType() const { return m_Type; }
 			inline const EyeSource& GetSource() const { return m_Source; }
+			inline EyeSource& GetSource() { return m_Source; }
 
 		protected:
 			Statement(StatementType type, const EyeSource& source)
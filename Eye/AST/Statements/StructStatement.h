@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/TypeSpecifier.h"
+
+#include <memory>
+#include <vector>
+
+namespace Eye
+{
+	namespace AST
+	{
+		/*
+			StructFieldList
+				: StructField
+				| StructFieldList StructField
+				;
+
+			StructField
+				: DataTypeKeyword IdentifierExpression ';'
+				| Identifier IdentifierExpression ';'
+				;
+		*/
+		class StructField
+		{
+		public:
+			StructField(const TypeSpecifier& typeSpecifier, std::unique_ptr<IdentifierExpression> identifier)
+				: m_TypeSpecifier(typeSpecifier), m_Identifier(std::move(identifier))
+			{
+			}
+
+			inline const TypeSpecifier& GetTypeSpecifier() const { return m_TypeSpecifier; }
+			inline TypeSpecifier& GetTypeSpecifier() { return m_TypeSpecifier; }
+			inline Token GetDataType() const { return m_TypeSpecifier.GetDataTypeToken(m_Identifier->GetSource()); }
+			inline const IdentifierExpression* GetIdentifier() const { return m_Identifier.get(); }
+			inline IdentifierExpression* GetIdentifier() { return m_Identifier.get(); }
+
+		private:
+			TypeSpecifier m_TypeSpecifier;
+			std::unique_ptr<IdentifierExpression> m_Identifier;
+		};
+
+		/*
+			StructStatement
+				: 'struct' Identifier '{' StructFieldList '}'
+				;
+
+			Declares a Type, the TypeChecker lays its Fields out at fixed Offsets (see StructLayout).
+		*/
+		class StructStatement : public Statement
+		{
+		public:
+			StructStatement(const EyeSource& source, std::unique_ptr<IdentifierExpression> identifier, std::vector<std::unique_ptr<StructField>>&& fields)
+				: Statement(StatementType::StructStatement, source), m_Identifier(std::move(identifier)), m_Fields(std::move(fields))
+			{
+			}
+
+			inline const IdentifierExpression* GetIdentifier() const { return m_Identifier.get(); }
+			inline IdentifierExpression* GetIdentifier() { return m_Identifier.get(); }
+			inline const std::vector<std::unique_ptr<StructField>>& GetFields() const { return m_Fields; }
+			inline std::vector<std::unique_ptr<StructField>>& GetFields() { return m_Fields; }
+
+		private:
+			std::unique_ptr<IdentifierExpression> m_Identifier;
+			std::vector<std::unique_ptr<StructField>> m_Fields;
+		};
+	}
+}
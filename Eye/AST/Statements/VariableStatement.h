@@ -3,6 +3,7 @@
 #include "Eye/AST/Statements/Statement.h"
 #include "Eye/AST/Expressions/Expression.h"
 #include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/TypeSpecifier.h"
 
 #include <memory>
 #include <vector>
@@ -29,7 +30,9 @@ namespace Eye
 			}
 
 			inline const IdentifierExpression* GetIdentifier() const { return m_Identifier.get(); }
+			inline IdentifierExpression* GetIdentifier() { return m_Identifier.get(); }
 			inline Expression* GetInitializer() const { return m_Initializer.get(); }
+			inline void SetInitializer(std::unique_ptr<Expression> initializer) { m_Initializer = std::move(initializer); }
 
 		private:
 			std::unique_ptr<IdentifierExpression> m_Identifier;
@@ -60,18 +63,20 @@ namespace Eye
 		class VariableStatement : public Statement
 		{
 		public:
-			VariableStatement(const EyeSource& source, std::unique_ptr<Token> typeQualifier, std::unique_ptr<Token> dataType, std::vector<std::unique_ptr<VariableDeclaration>>&& variableDeclarationList)
-				: Statement(StatementType::VariableStatement, source), m_TypeQualifier(std::move(typeQualifier)), m_DataType(std::move(dataType)), m_VariableDeclarationList(std::move(variableDeclarationList))
+			VariableStatement(const EyeSource& source, const TypeSpecifier& typeSpecifier, std::vector<std::unique_ptr<VariableDeclaration>>&& variableDeclarationList)
+				: Statement(StatementType::VariableStatement, source), m_TypeSpecifier(typeSpecifier), m_VariableDeclarationList(std::move(variableDeclarationList))
 			{
 			}
 
-			inline const Token* GetTypeQualifier() const { return m_TypeQualifier.get(); }
-			inline const Token* GetDataType() const { return m_DataType.get(); }
+			inline const TypeSpecifier& GetTypeSpecifier() const { return m_TypeSpecifier; }
+			inline TypeSpecifier& GetTypeSpecifier() { return m_TypeSpecifier; }
+			inline Token GetTypeQualifier() const { return m_TypeSpecifier.GetTypeQualifierToken(GetSource()); }
+			inline Token GetDataType() const { return m_TypeSpecifier.GetDataTypeToken(GetSource()); }
 			inline const std::vector<std::unique_ptr<VariableDeclaration>>& GetVariableDeclarationList() const { return m_VariableDeclarationList; }
+			inline std::vector<std::unique_ptr<VariableDeclaration>>& GetVariableDeclarationList() { return m_VariableDeclarationList; }
 
 		private:
-			std::unique_ptr<Token> m_TypeQualifier;
-			std::unique_ptr<Token> m_DataType;
+			TypeSpecifier m_TypeSpecifier;
 			std::vector<std::unique_ptr<VariableDeclaration>> m_VariableDeclarationList;
 		};
 	}
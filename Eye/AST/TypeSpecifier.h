@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Eye/Lexer/Token.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace Eye
+{
+	namespace AST
+	{
+		/*
+			SourceLocation
+				Position of a Token folded into a Node, the Source Name is shared with the Node itself.
+		*/
+		struct SourceLocation
+		{
+			uint32_t Line = 1;
+			uint32_t Col = 1;
+			uint32_t Start = 1;
+			uint32_t End = std::numeric_limits<uint32_t>::max();
+
+			static SourceLocation FromSource(const EyeSource& source)
+			{
+				return { (uint32_t)source.Line, (uint32_t)source.Col, (uint32_t)source.Start, (source.End > std::numeric_limits<uint32_t>::max() ? std::numeric_limits<uint32_t>::max() : (uint32_t)source.End) };
+			}
+
+			EyeSource ToSource(const EyeSource& owner) const
+			{
+				return EyeSource(owner.Source, owner.Type, Line, Col, Start, (End == std::numeric_limits<uint32_t>::max() ? (size_t)-1 : End));
+			}
+		};
+
+		enum class DataType : uint8_t
+		{
+			Invalid,
+			Int,
+			Float,
+			Str,
+			Bool,
+			Void,
+			// Named by TypeSpecifier::StructName
+			Struct,
+		};
+
+		inline DataType TokenToDataType(TokenType type)
+		{
+			switch (type)
+			{
+			case TokenType::KeywordDataTypeInt:
+				return DataType::Int;
+			case TokenType::KeywordDataTypeFloat:
+				return DataType::Float;
+			case TokenType::KeywordDataTypeStr:
+				return DataType::Str;
+			case TokenType::KeywordDataTypeBool:
+				return DataType::Bool;
+			case TokenType::KeywordDataTypeVoid:
+				return DataType::Void;
+			case TokenType::Identifier:
+				return DataType::Struct;
+			default:
+				return DataType::Invalid;
+			}
+		}
+
+		inline TokenType DataTypeToToken(DataType type)
+		{
+			switch (type)
+			{
+			case DataType::Int:
+				return TokenType::KeywordDataTypeInt;
+			case DataType::Float:
+				return TokenType::KeywordDataTypeFloat;
+			case DataType::Str:
+				return TokenType::KeywordDataTypeStr;
+			case DataType::Bool:
+				return TokenType::KeywordDataTypeBool;
+			case DataType::Void:
+				return TokenType::KeywordDataTypeVoid;
+			case DataType::Struct:
+				return TokenType::Identifier;
+			default:
+				return TokenType::Invalid;
+			}
+		}
+
+		// Flags, a Declaration carries at most one of each
+		enum class TypeQualifier : uint8_t
+		{
+			None = 0,
+			Const = 1 << 0,
+		};
+
+		inline TypeQualifier operator|(TypeQualifier lhs, TypeQualifier rhs) { return (TypeQualifier)((uint8_t)lhs | (uint8_t)rhs); }
+		inline bool HasTypeQualifier(TypeQualifier qualifiers, TypeQualifier qualifier) { return ((uint8_t)qualifiers & (uint8_t)qualifier) != 0; }
+
+		inline TypeQualifier TokenToTypeQualifier(TokenType type)
+		{
+			return (type == TokenType::KeywordTypeQualifierConst ? TypeQualifier::Const : TypeQualifier::None);
+		}
+
+		/*
+			TypeSpecifier
+				: OptionalTypeQualifierKeyword DataTypeKeyword OptionalArrayLength
+			| OptionalTypeQualifierKeyword Identifier
+			;
+
+			Keeps the Keywords as Enums & Locations instead of owned Tokens, a Struct Type keeps its Name.
+			An Array holds ArrayLength contiguous Elements of Type, a Length of 0 is no Array.
+		*/
+		struct TypeSpecifier
+		{
+			DataType Type = DataType::Invalid;
+			TypeQualifier Qualifiers = TypeQualifier::None;
+			std::string StructName;
+			uint32_t ArrayLength = 0;
+			SourceLocation TypeLocation;
+			SourceLocation QualifierLocation;
+
+			TypeSpecifier() = default;
+
+			TypeSpecifier(const Token* typeQualifier, const Token* dataType)
+				: Type(TokenToDataType(dataType->GetType())), TypeLocation(SourceLocation::FromSource(dataType->GetSource()))
+			{
+				if (Type == DataType::Struct)
+					StructName = dataType->GetValue<StringType>();
+				if (typeQualifier)
+				{
+					Qualifiers = TokenToTypeQualifier(typeQualifier->GetType());
+					QualifierLocation = SourceLocation::FromSource(typeQualifier->GetSource());
+				}
+			}
+
+			inline bool IsConst() const { return HasTypeQualifier(Qualifiers, TypeQualifier::Const); }
+			inline bool IsStruct() const { return Type == DataType::Struct; }
+			inline bool IsArray() const { return ArrayLength != 0; }
+
+			// Token Shims, rebuilt on Demand with the Source Name of the owning Node
+			inline Token GetDataTypeToken(const EyeSource& owner) const { return (Type == DataType::Struct ? Token(TokenType::Identifier, StructName, TypeLocation.ToSource(owner)) : Token(DataTypeToToken(Type), TypeLocation.ToSource(owner))); }
+			inline Token GetTypeQualifierToken(const EyeSource& owner) const { return (IsConst() ? Token(TokenType::KeywordTypeQualifierConst, QualifierLocation.ToSource(owner)) : Token()); }
+		};
+	}
+}
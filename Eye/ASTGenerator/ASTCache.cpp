@@ -0,0 +1,153 @@
+#include "Eye/ASTGenerator/ASTCache.h"
+#include "Eye/ASTSerializer/StringSerializer.h"
+
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+
+namespace Eye
+{
+	const std::string& ASTCacheEntry::GetSerializedAST() const
+	{
+		std::call_once(m_SerializeFlag, [this]()
+			{
+				if (Program)
+				{
+					ASTSerializer::StringSerializer astSerializer;
+					m_SerializedAST = astSerializer.Serialize(Program.get());
+				}
+			});
+		return m_SerializedAST;
+	}
+
+	ASTCache::ASTCache(size_t byteBudget)
+		: m_ByteBudget(byteBudget)
+	{
+	}
+
+	std::shared_ptr<const ASTCacheEntry> ASTCache::Get(const ASTGeneratorProperties& properties)
+	{
+		std::string key = std::string(properties.TypeCheck ? "T" : "-") + (properties.ValidateSemantics ? "S" : "-") + (properties.FoldConstants ? "F" : "-") + (properties.EliminateDeadCode ? (properties.RemoveUncalledFunctions ? "U" : "D") : "-") + "N" + std::to_string(properties.MaxNestingDepth);
+		if (!properties.Imports.empty())
+		{
+			std::vector<std::string> imports;
+			for (const auto& [path, moduleInterface] : properties.Imports)
+				imports.push_back(path + "{" + (moduleInterface ? moduleInterface->GetSignature() : "") + "}");
+			std::sort(imports.begin(), imports.end());
+			for (const auto& import : imports)
+				key += "Import:" + import;
+		}
+
+		std::string content;
+		if (properties.Source.Type == EyeSourceType::File)
+		{
+			if (!ReadSource(properties.Source.Source, content))
+			{
+				auto entry = std::make_shared<ASTCacheEntry>();
+				entry->Diagnostic = Error::Error(Error::ErrorType::ASTGeneratorBadSource, "Failed to Open Source '" + properties.Source.Source + "'");
+				return entry;
+			}
+
+			std::error_code ec;
+			std::filesystem::path path = std::filesystem::weakly_canonical(properties.Source.Source, ec);
+			key += "File:" + (ec ? properties.Source.Source : path.string());
+		}
+		else
+		{
+			key += "String:" + std::to_string(std::hash<std::string>()(properties.Source.Source));
+			content = properties.Source.Source;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			auto it = m_Entries.find(key);
+			if (it != m_Entries.end() && it->second->Entry->Content == content)
+			{
+				m_HitCount++;
+				m_Slots.splice(m_Slots.begin(), m_Slots, it->second);
+				return it->second->Entry;
+			}
+		}
+
+		m_MissCount++;
+		auto entry = std::make_shared<ASTCacheEntry>();
+		ASTGenerator astGenerator;
+		auto res = astGenerator.GenerateAST(properties);
+		if (res.has_value())
+			entry->Program = std::move(res.value());
+		else
+			entry->Diagnostic = res.error();
+
+		// The Generator reads Files itself, only cache when it saw the Content the Key was built from
+		std::string generatedContent;
+		if (properties.Source.Type == EyeSourceType::File && (!ReadSource(properties.Source.Source, generatedContent) || generatedContent != content))
+			return entry;
+
+		entry->Content = std::move(content);
+		Insert(key, entry);
+		return entry;
+	}
+
+	void ASTCache::Insert(const std::string& key, const std::shared_ptr<const ASTCacheEntry>& entry)
+	{
+		size_t bytes = key.size() + entry->Content.size();
+		std::lock_guard<std::mutex> lock(m_Mutex);
+
+		auto it = m_Entries.find(key);
+		if (it != m_Entries.end())
+		{
+			m_ByteCount -= it->second->Bytes;
+			m_Slots.erase(it->second);
+			m_Entries.erase(it);
+		}
+
+		// An Entry larger than the whole Budget is handed out but never kept
+		if (bytes > m_ByteBudget)
+			return;
+
+		while (m_ByteCount + bytes > m_ByteBudget)
+		{
+			m_ByteCount -= m_Slots.back().Bytes;
+			m_Entries.erase(m_Slots.back().Key);
+			m_Slots.pop_back();
+			m_EvictionCount++;
+		}
+
+		m_Slots.push_front({ key, entry, bytes });
+		m_Entries[key] = m_Slots.begin();
+		m_ByteCount += bytes;
+	}
+
+	void ASTCache::Clear()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Entries.clear();
+		m_Slots.clear();
+		m_ByteCount = 0;
+	}
+
+	bool ASTCache::ReadSource(const std::string& filepath, std::string& content)
+	{
+		std::ifstream stream(filepath, std::ios::binary);
+		if (!stream.good())
+			return false;
+
+		std::ostringstream ss;
+		ss << stream.rdbuf();
+		content = ss.str();
+		return true;
+	}
+
+	size_t ASTCache::GetEntryCount()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Entries.size();
+	}
+
+	size_t ASTCache::GetByteCount()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_ByteCount;
+	}
+}
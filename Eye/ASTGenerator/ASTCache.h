@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Eye/ASTGenerator/ASTGenerator.h"
+
+#include <unordered_map>
+#include <list>
+#include <optional>
+#include <mutex>
+#include <atomic>
+
+namespace Eye
+{
+	struct ASTCacheEntry
+	{
+		std::string Content;
+		std::unique_ptr<AST::Program> Program;
+		std::optional<Error::Error> Diagnostic;
+
+		const std::string& GetSerializedAST() const;
+
+	private:
+		mutable std::once_flag m_SerializeFlag;
+		mutable std::string m_SerializedAST;
+	};
+
+	/*
+		ASTCache
+			Keeps Generated ASTs keyed by Source & ASTGeneratorProperties flags, an Entry is reused while the Source Content is unchanged.
+			String Sources are keyed by the Hash of their Content, a Hit still compares the whole Content.
+			Least recently used Entries are evicted once the cached Source Bytes exceed the Byte Budget, an AST grows with its Source.
+			Thread-Safe, Entries stay valid for as long as they are held even if the Cache replaces or evicts them.
+	*/
+	class ASTCache
+	{
+	public:
+		static constexpr size_t DefaultByteBudget = 16 * 1024 * 1024;
+
+	public:
+		ASTCache(size_t byteBudget = DefaultByteBudget);
+
+		std::shared_ptr<const ASTCacheEntry> Get(const ASTGeneratorProperties& properties);
+		void Clear();
+
+		size_t GetEntryCount();
+		size_t GetByteCount();
+		inline size_t GetHitCount() const { return m_HitCount; }
+		inline size_t GetMissCount() const { return m_MissCount; }
+		inline size_t GetEvictionCount() const { return m_EvictionCount; }
+
+	private:
+		struct Slot
+		{
+			std::string Key;
+			std::shared_ptr<const ASTCacheEntry> Entry;
+			size_t Bytes;
+		};
+
+	private:
+		static bool ReadSource(const std::string& filepath, std::string& content);
+		void Insert(const std::string& key, const std::shared_ptr<const ASTCacheEntry>& entry);
+
+	private:
+		std::mutex m_Mutex;
+		// Most recently used first
+		std::list<Slot> m_Slots;
+		std::unordered_map<std::string, std::list<Slot>::iterator> m_Entries;
+		size_t m_ByteBudget;
+		size_t m_ByteCount = 0;
+		std::atomic<size_t> m_HitCount = 0;
+		std::atomic<size_t> m_MissCount = 0;
+		std::atomic<size_t> m_EvictionCount = 0;
+	};
+}
@@ -1,56 +1,120 @@
 #include "Eye/ASTGenerator/ASTGenerator.h"
 #include "Eye/Utility/Logger.h"
+#include "Eye/Utility/ThreadPool.h"
 #include "Eye/Lexer/Lexer.h"
+#include "Eye/MacroExpander/MacroExpander.h"
 #include "Eye/Parser/Parser.h"
+#include "Eye/Semantic/NamespaceResolver.h"
 #include "Eye/Semantic/Semantic.h"
 #include "Eye/TypeChecker/TypeChecker.h"
+#include "Eye/Optimizer/ConstantFolder.h"
+#include "Eye/Optimizer/DeadCodeEliminator.h"
 #include "Eye/ASTSerializer/StringSerializer.h"
 
+#include <fstream>
+#include <algorithm>
+
 namespace Eye
 {
-	std::unique_ptr<AST::Program> ASTGenerator::GenerateMemoryAST(const ASTGeneratorProperties& properties)
+	ASTGeneratorResult ASTGenerator::GenerateAST(const ASTGeneratorProperties& properties)
 	{
+		if (properties.Source.Type == EyeSourceType::File && !std::ifstream(properties.Source.Source).good())
+			return std::unexpected(Error::Error(Error::ErrorType::ASTGeneratorBadSource, "Failed to Open Source '" + properties.Source.Source + "'"));
+
 		Lexer lexer;
 		auto lexerRes = lexer.Tokenize(properties.Source);
 		if (!lexerRes.has_value())
-		{
-			EYE_LOG_ERROR(lexerRes.error().GetMessage());
-			EYE_LOG_CRITICAL("EYEASTGenerator->GenerateMemoryAST Lexer Failed to Tokenize!");
-		}
+			return std::unexpected(lexerRes.error());
+
+		MacroExpander macroExpander(m_MacroExpansionCache);
+		auto macroExpanderRes = macroExpander.Expand(std::move(lexerRes.value()));
+		if (!macroExpanderRes.has_value())
+			return std::unexpected(macroExpanderRes.error());
 
-		Parser parser;
-		auto parserRes = parser.Parse(std::move(lexerRes.value()));
+		Parser parser(properties.MaxNestingDepth);
+		auto parserRes = parser.Parse(std::move(macroExpanderRes.value()));
 		if (!parserRes.has_value())
-		{
-			EYE_LOG_ERROR(parserRes.error().GetMessage());
-			EYE_LOG_CRITICAL("EYEASTGenerator->GenerateMemoryAST Parser Failed to Parse!");
-		}
+			return std::unexpected(parserRes.error());
+
+		// Every later Pass sees Namespace Members under their qualified Names
+		NamespaceResolver namespaceResolver;
+		auto namespaceResolverRes = namespaceResolver.Resolve(parserRes.value().get(), properties.Imports);
+		if (!namespaceResolverRes)
+			return std::unexpected(namespaceResolverRes.error());
 
 		if (properties.ValidateSemantics)
 		{
-			Eye::Semantic semanticValidator;
-			auto semanticRes = semanticValidator.Validate(parserRes.value().get());
+			Semantic semanticValidator;
+			auto semanticRes = semanticValidator.Validate(parserRes.value().get(), properties.Imports);
 			if (!semanticRes)
-			{
-				EYE_LOG_ERROR(semanticRes.error().GetMessage());
-				EYE_LOG_CRITICAL("EYEASTGenerator->GenerateMemoryAST Semantic Failed to Validate!");
-			}
+				return std::unexpected(semanticRes.error());
 		}
 
 		if (properties.TypeCheck)
 		{
 			TypeChecker typeChecker;
-			auto typeCheckerRes = typeChecker.TypeCheck(parserRes.value().get());
+			auto typeCheckerRes = typeChecker.TypeCheck(parserRes.value().get(), properties.Imports);
 			if (!typeCheckerRes.has_value())
+				return std::unexpected(typeCheckerRes.error());
+			parserRes.value()->SetTypeTable(typeChecker.GetTypeTable());
+
+			if (properties.FoldConstants)
+			{
+				ConstantFolder constantFolder;
+				constantFolder.Fold(parserRes.value().get());
+			}
+
+			if (properties.EliminateDeadCode)
 			{
-				EYE_LOG_ERROR(typeCheckerRes.error().GetMessage());
-				EYE_LOG_CRITICAL("EYEASTGenerator->GenerateMemoryAST TypeChecker Failed to TypeCheck!");
+				DeadCodeEliminator deadCodeEliminator;
+				deadCodeEliminator.Eliminate(parserRes.value().get(), properties.RemoveUncalledFunctions);
 			}
 		}
 
 		return std::move(parserRes.value());
 	}
 
+	std::vector<ASTGeneratorResult> ASTGenerator::GenerateBatchAST(const std::vector<ASTGeneratorProperties>& properties, size_t threadCount)
+	{
+		std::vector<ASTGeneratorResult> results(properties.size());
+		if (properties.empty())
+			return results;
+
+		if (!threadCount)
+			threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		ThreadPool threadPool(std::min(threadCount, properties.size()));
+		for (size_t i = 0; i < properties.size(); i++)
+		{
+			threadPool.Submit([this, &properties, &results, i]()
+				{
+					try
+					{
+						results[i] = GenerateAST(properties[i]);
+					}
+					catch (...)
+					{
+						results[i] = std::unexpected(Error::Error(Error::ErrorType::ASTGeneratorUnknownException, "Unknown Exception while Generating AST for " + properties[i].Source.Source));
+					}
+				});
+		}
+		threadPool.Wait();
+
+		return results;
+	}
+
+	std::unique_ptr<AST::Program> ASTGenerator::GenerateMemoryAST(const ASTGeneratorProperties& properties)
+	{
+		auto res = GenerateAST(properties);
+		if (!res.has_value())
+		{
+			EYE_LOG_ERROR(res.error().GetMessage());
+			EYE_LOG_CRITICAL("EYEASTGenerator->GenerateMemoryAST Failed to Generate AST!");
+		}
+
+		return std::move(res.value());
+	}
+
 	std::string ASTGenerator::GenerateStringAST(const ASTGeneratorProperties& properties)
 	{
 		ASTSerializer::StringSerializer astSerializer;
@@ -1,7 +1,14 @@
 #pragma once
 
 #include "Eye/Utility/EyeSource.h"
+#include "Eye/Error/Error.h"
 #include "Eye/AST/Program.h"
+#include "Eye/ModuleLoader/ModuleInterface.h"
+#include "Eye/Parser/Parser.h"
+#include "Eye/MacroExpander/MacroExpander.h"
+
+#include <expected>
+#include <vector>
 
 namespace Eye
 {
@@ -10,12 +17,30 @@ namespace Eye
 		EyeSource Source;
 		bool TypeCheck = true;
 		bool ValidateSemantics = true;
+		// Optimizations, run only with TypeCheck
+		bool FoldConstants = true;
+		bool EliminateDeadCode = true;
+		bool RemoveUncalledFunctions = false;
+		// Interfaces the Source's ImportStatements resolve to, see ModuleLoader
+		ModuleImports Imports = {};
+		// Deeper Statements & Expressions fail with ParserNestingLimit
+		size_t MaxNestingDepth = Parser::DefaultMaxNestingDepth;
 	};
 
+	using ASTGeneratorResult = std::expected<std::unique_ptr<AST::Program>, Error::Error>;
+
 	class ASTGenerator
 	{
 	public:
+		ASTGeneratorResult GenerateAST(const ASTGeneratorProperties& properties);
+		std::vector<ASTGeneratorResult> GenerateBatchAST(const std::vector<ASTGeneratorProperties>& properties, size_t threadCount = 0);
 		std::unique_ptr<AST::Program> GenerateMemoryAST(const ASTGeneratorProperties& properties);
 		std::string GenerateStringAST(const ASTGeneratorProperties& properties);
+
+		// Shared by every Source this Generator expands, Batches included
+		inline const std::shared_ptr<MacroExpansionCache>& GetMacroExpansionCache() const { return m_MacroExpansionCache; }
+
+	private:
+		std::shared_ptr<MacroExpansionCache> m_MacroExpansionCache = std::make_shared<MacroExpansionCache>();
 	};
 }
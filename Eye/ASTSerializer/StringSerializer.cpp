@@ -7,6 +7,12 @@ namespace Eye
 {
 	namespace ASTSerializer
 	{
+		// Struct Types are written by Name
+		static std::string_view DataTypeToString(const AST::TypeSpecifier& typeSpecifier)
+		{
+			return (typeSpecifier.IsStruct() ? std::string_view(typeSpecifier.StructName) : TokenTypeToString(AST::DataTypeToToken(typeSpecifier.Type)));
+		}
+
 		std::string StringSerializer::Serialize(const AST::Program* ast)
 		{
 			std::ostringstream oss;
@@ -52,6 +58,12 @@ namespace Eye
 				return SerializeFunctionStatement(static_cast<const AST::FunctionStatement*>(stmt));
 			case AST::StatementType::ReturnStatement:
 				return SerializeReturnStatement(static_cast<const AST::ReturnStatement*>(stmt));
+			case AST::StatementType::ImportStatement:
+				return SerializeImportStatement(static_cast<const AST::ImportStatement*>(stmt));
+			case AST::StatementType::StructStatement:
+				return SerializeStructStatement(static_cast<const AST::StructStatement*>(stmt));
+			case AST::StatementType::NamespaceStatement:
+				return SerializeNamespaceStatement(static_cast<const AST::NamespaceStatement*>(stmt));
 			default:
 				EYE_LOG_CRITICAL("ASTSerializer Unknown Statement Type!");
 				break;
@@ -70,22 +82,48 @@ namespace Eye
 
 		std::string StringSerializer::SerializeBlockStatement(const AST::BlockStatement* blockStmt)
 		{
+			// Directly Nested Blocks are written into one Stream with an explicit Stack instead of one Call per Level
+			struct Frame
+			{
+				const AST::BlockStatement* Block;
+				size_t Index;
+			};
+
 			std::ostringstream oss;
-			oss << "{\"BlockStatement\": {\n";
-			oss << "\"type\": \"BlockStatement\",\n";
-			oss << "\"StatementListSize\": " << blockStmt->GetStatementList().size() << ",\n";
-			oss << "\"StatementList\": [\n";
-			size_t i = 0;
-			for (const auto& stmt : blockStmt->GetStatementList())
+			auto serializeBlockBegin = [&oss](const AST::BlockStatement* block)
+				{
+					oss << "{\"BlockStatement\": {\n";
+					oss << "\"type\": \"BlockStatement\",\n";
+					oss << "\"StatementListSize\": " << block->GetStatementList().size() << ",\n";
+					oss << "\"StatementList\": [\n";
+				};
+
+			serializeBlockBegin(blockStmt);
+			std::vector<Frame> frames = { { blockStmt, 0 } };
+			while (!frames.empty())
 			{
-				oss << "" << SerializeStatement(stmt.get());
+				Frame& frame = frames.back();
+				if (frame.Index == frame.Block->GetStatementList().size())
+				{
+					oss << "]\n";
+					oss << "}\n}\n";
+					frames.pop_back();
+					continue;
+				}
 
-				i++;
-				if ((i + 1) <= blockStmt->GetStatementList().size())
+				if (frame.Index > 0)
 					oss << ",";
+				const AST::Statement* stmt = frame.Block->GetStatementList()[frame.Index++].get();
+				if (stmt && stmt->GetType() == AST::StatementType::BlockStatement)
+				{
+					serializeBlockBegin(static_cast<const AST::BlockStatement*>(stmt));
+					frames.push_back({ static_cast<const AST::BlockStatement*>(stmt), 0 });
+				}
+				else
+				{
+					oss << SerializeStatement(stmt);
+				}
 			}
-			oss << "]\n";
-			oss << "}\n}\n";
 			return oss.str();
 		}
 
@@ -94,11 +132,13 @@ namespace Eye
 			std::ostringstream oss;
 			oss << "{\"VariableStatement\": {\n";
 			oss << "\"type\": \"VariableStatement\",\n";
-			if (variableStmt->GetTypeQualifier())
-				oss << "\"typeQualifier\": \"" << variableStmt->GetTypeQualifier()->GetTypeString() << "\",\n";
+			if (variableStmt->GetTypeSpecifier().IsConst())
+				oss << "\"typeQualifier\": \"" << TokenTypeToString(TokenType::KeywordTypeQualifierConst) << "\",\n";
 			else
 				oss << "\"typeQualifier\":" << "null" << ",\n";
-			oss << "\"dataType\": \"" << variableStmt->GetDataType()->GetTypeString() << "\",\n";
+			oss << "\"dataType\": \"" << DataTypeToString(variableStmt->GetTypeSpecifier()) << "\",\n";
+			if (variableStmt->GetTypeSpecifier().IsArray())
+				oss << "\"arrayLength\": " << variableStmt->GetTypeSpecifier().ArrayLength << ",\n";
 			oss << "\"declarationSize\": " << variableStmt->GetVariableDeclarationList().size() << ",\n";
 			oss << "\"declarations\": [\n";
 			size_t i = 0;
@@ -215,7 +255,7 @@ namespace Eye
 			std::ostringstream oss;
 			oss << "{\"FunctionStatement\": {\n";
 			oss << "\"type\": \"FunctionStatement\",\n";
-			oss << "\"returnType\": \"" << functionStmt->GetReturnType()->GetTypeString() << "\",\n";
+			oss << "\"returnType\": \"" << TokenTypeToString(AST::DataTypeToToken(functionStmt->GetReturnTypeSpecifier().Type)) << "\",\n";
 			oss << "\"identifier\": " << SerializeIdentifierExpression(functionStmt->GetIdentifier()) << ",\n";
 			oss << "\"parameters\": [\n";
 			size_t i = 0;
@@ -237,11 +277,11 @@ namespace Eye
 			std::ostringstream oss;
 			oss << "{\"FunctionParameter\": {\n";
 			oss << "\"type\": \"FunctionParameter\",\n";
-			if (functionParam->GetTypeQualifier())
-				oss << "\"typeQualifier\": \"" << functionParam->GetTypeQualifier()->GetTypeString() << "\",\n";
+			if (functionParam->GetTypeSpecifier().IsConst())
+				oss << "\"typeQualifier\": \"" << TokenTypeToString(TokenType::KeywordTypeQualifierConst) << "\",\n";
 			else
 				oss << "\"typeQualifier\":" << "null" << ",\n";
-			oss << "\"dataType\": \"" << functionParam->GetDataType()->GetTypeString() << "\",\n";
+			oss << "\"dataType\": \"" << DataTypeToString(functionParam->GetTypeSpecifier()) << "\",\n";
 			oss << "\"identifier\":" << SerializeIdentifierExpression(functionParam->GetIdentifier()) << ",\n";
 			oss << "\"initializer\":" << SerializeExpression(functionParam->GetInitializer()) << "\n";
 			oss << "}\n}";
@@ -258,6 +298,68 @@ namespace Eye
 			return oss.str();
 		}
 
+		std::string StringSerializer::SerializeImportStatement(const AST::ImportStatement* importStmt)
+		{
+			std::ostringstream oss;
+			oss << "{\"ImportStatement\": {\n";
+			oss << "\"type\": \"ImportStatement\",\n";
+			oss << "\"path\": " << SerializeExpression(importStmt->GetPath()) << "\n";
+			oss << "}\n}\n";
+			return oss.str();
+		}
+
+		std::string StringSerializer::SerializeStructStatement(const AST::StructStatement* structStmt)
+		{
+			std::ostringstream oss;
+			oss << "{\"StructStatement\": {\n";
+			oss << "\"type\": \"StructStatement\",\n";
+			oss << "\"identifier\": " << SerializeIdentifierExpression(structStmt->GetIdentifier()) << ",\n";
+			oss << "\"fields\": [\n";
+			size_t i = 0;
+			for (const auto& field : structStmt->GetFields())
+			{
+				oss << SerializeStructField(field.get());
+				i++;
+				if ((i + 1) <= structStmt->GetFields().size())
+					oss << ",";
+			}
+			oss << "]\n";
+			oss << "}\n}\n";
+			return oss.str();
+		}
+
+		std::string StringSerializer::SerializeNamespaceStatement(const AST::NamespaceStatement* namespaceStmt)
+		{
+			std::ostringstream oss;
+			oss << "{\"NamespaceStatement\": {\n";
+			oss << "\"type\": \"NamespaceStatement\",\n";
+			oss << "\"identifier\": " << SerializeIdentifierExpression(namespaceStmt->GetIdentifier()) << ",\n";
+			oss << "\"StatementListSize\": " << namespaceStmt->GetStatementList().size() << ",\n";
+			oss << "\"StatementList\": [\n";
+			size_t i = 0;
+			for (const auto& stmt : namespaceStmt->GetStatementList())
+			{
+				oss << SerializeStatement(stmt.get());
+				i++;
+				if ((i + 1) <= namespaceStmt->GetStatementList().size())
+					oss << ",";
+			}
+			oss << "]\n";
+			oss << "}\n}\n";
+			return oss.str();
+		}
+
+		std::string StringSerializer::SerializeStructField(const AST::StructField* structField)
+		{
+			std::ostringstream oss;
+			oss << "{\"StructField\": {\n";
+			oss << "\"type\": \"StructField\",\n";
+			oss << "\"dataType\": \"" << DataTypeToString(structField->GetTypeSpecifier()) << "\",\n";
+			oss << "\"identifier\":" << SerializeIdentifierExpression(structField->GetIdentifier()) << "\n";
+			oss << "}\n}";
+			return oss.str();
+		}
+
 		std::string StringSerializer::SerializeExpression(const AST::Expression* expr)
 		{
 			if (!expr)
@@ -322,13 +424,23 @@ namespace Eye
 
 		std::string StringSerializer::SerializeBinaryExpression(const AST::BinaryExpression* binaryExpr)
 		{
+			// Left-Deep Chains open every Node top-down, then close them bottom-up with their Right Operands
+			std::vector<const AST::BinaryExpression*> spine = binaryExpr->GetLeftSpine();
 			std::ostringstream oss;
-			oss << "{\"BinaryExpression\": {\n";
-			oss << "\"type\": \"BinaryExpression\",\n";
-			oss << "\"operator\": \"" << binaryExpr->GetOperator()->GetTypeString() << "\",\n";
-			oss << "\"left\": " << SerializeExpression(binaryExpr->GetLeft()) << ",\n";
-			oss << "\"right\": " << SerializeExpression(binaryExpr->GetRight()) << "\n";
-			oss << "}\n}";
+			for (const AST::BinaryExpression* node : spine)
+			{
+				oss << "{\"BinaryExpression\": {\n";
+				oss << "\"type\": \"BinaryExpression\",\n";
+				oss << "\"operator\": \"" << TokenTypeToString(node->GetOperatorType()) << "\",\n";
+				oss << "\"left\": ";
+			}
+			oss << SerializeExpression(spine.back()->GetLeft());
+			for (auto it = spine.rbegin(); it != spine.rend(); it++)
+			{
+				oss << ",\n";
+				oss << "\"right\": " << SerializeExpression((*it)->GetRight()) << "\n";
+				oss << "}\n}";
+			}
 			return oss.str();
 		}
 
@@ -347,7 +459,7 @@ namespace Eye
 			std::ostringstream oss;
 			oss << "{\"AssignmentExpression\": {\n";
 			oss << "\"type\": \"AssignmentExpression\",\n";
-			oss << "\"operator\": \"" << assignmentExpr->GetOperator()->GetTypeString() << "\",\n";
+			oss << "\"operator\": \"" << TokenTypeToString(assignmentExpr->GetOperatorType()) << "\",\n";
 			oss << "\"lhsExpression\": " << SerializeExpression(assignmentExpr->GetLHSExpression()) << ",\n";
 			oss << "\"expression\": " << SerializeExpression(assignmentExpr->GetExpression()) << "\n";
 			oss << "}\n}";
@@ -359,7 +471,7 @@ namespace Eye
 			std::ostringstream oss;
 			oss << "{\"UnaryExpression\": {\n";
 			oss << "\"type\": \"UnaryExpression\",\n";
-			oss << "\"operator\": \"" << unaryExpr->GetOperator()->GetTypeString() << "\",\n";
+			oss << "\"operator\": \"" << TokenTypeToString(unaryExpr->GetOperatorType()) << "\",\n";
 			oss << "\"expression\": " << SerializeExpression(unaryExpr->GetExpression()) << "\n";
 			oss << "}\n}";
 			return oss.str();
@@ -402,7 +514,7 @@ namespace Eye
 			std::ostringstream oss;
 			oss << "{\"PostfixExpression\": {\n";
 			oss << "\"type\": \"PostfixExpression\",\n";
-			oss << "\"operator\": \"" << postfixExpr->GetOperator()->GetTypeString() << "\",\n";
+			oss << "\"operator\": \"" << TokenTypeToString(postfixExpr->GetOperatorType()) << "\",\n";
 			oss << "\"expression\": " << SerializeExpression(postfixExpr->GetExpression()) << "\n";
 			oss << "}\n}";
 			return oss.str();
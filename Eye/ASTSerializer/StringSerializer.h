@@ -12,6 +12,9 @@
 #include "Eye/AST/Statements/BreakStatement.h"
 #include "Eye/AST/Statements/FunctionStatement.h"
 #include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/ImportStatement.h"
+#include "Eye/AST/Statements/StructStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
 
 #include "Eye/AST/Expressions/Expression.h"
 #include "Eye/AST/Expressions/LiteralExpression.h"
@@ -48,6 +51,10 @@ namespace Eye
 			std::string SerializeFunctionStatement(const AST::FunctionStatement* functionStmt);
 			std::string SerializeFunctionParameter(const AST::FunctionParameter* functionParam);
 			std::string SerializeReturnStatement(const AST::ReturnStatement* returnStmt);
+			std::string SerializeImportStatement(const AST::ImportStatement* importStmt);
+			std::string SerializeStructStatement(const AST::StructStatement* structStmt);
+			std::string SerializeNamespaceStatement(const AST::NamespaceStatement* namespaceStmt);
+			std::string SerializeStructField(const AST::StructField* structField);
 
 			std::string SerializeExpression(const AST::Expression* expr);
 			std::string SerializeLiteralExpression(const AST::LiteralExpression* literalExpr);
@@ -10,9 +10,14 @@ namespace Eye
 		{
 			LexerUnexpectedToken,
 			ParserSyntaxError,
+			ParserBadSource,
+			ParserBadEdit,
+			ParserNestingLimit,
 			TypeCheckerBadTypeConversion,
 			TypeCheckerBadTypeCompare,
 			TypeCheckerBadOperandType,
+			TypeCheckerBadImport,
+			TypeCheckerBadMember,
 			SemanticNotDeclared,
 			SemanticReDeclaration,
 			SemanticBadDataType,
@@ -24,6 +29,20 @@ namespace Eye
 			SemanticTooFewArguments,
 			SemanticTooManyArguments,
 			SemanticMissingArgument,
+			SemanticBadImport,
+			SemanticBadNamespace,
+			ASTGeneratorBadSource,
+			ASTGeneratorUnknownException,
+			IRBuilderUnsupported,
+			IRVerifierInvalid,
+			ModuleLoaderBadSource,
+			ModuleLoaderCyclicImport,
+			ModuleLoaderBadSummary,
+			MacroExpanderSyntaxError,
+			MacroExpanderNotDefined,
+			MacroExpanderReDefinition,
+			MacroExpanderBadArgumentCount,
+			MacroExpanderRecursionLimit,
 		};
 
 		class Error
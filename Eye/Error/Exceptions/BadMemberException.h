@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Eye/Error/Exceptions/EyeException.h"
+
+namespace Eye
+{
+	namespace Error
+	{
+		namespace Exceptions
+		{
+			class BadMemberException : public EyeException
+			{
+			public:
+				BadMemberException(const std::string& error, ErrorType errorType, const EyeSource& source)
+					: EyeException("BadMemberException: " + error, errorType, source)
+				{
+				}
+			};
+		}
+	}
+}
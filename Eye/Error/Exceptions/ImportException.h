@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Eye/Error/Exceptions/EyeException.h"
+
+namespace Eye
+{
+	namespace Error
+	{
+		namespace Exceptions
+		{
+			class ImportException : public EyeException
+			{
+			public:
+				ImportException(const std::string& error, ErrorType errorType, const EyeSource& source)
+					: EyeException("ImportException: " + error, errorType, source)
+				{
+				}
+			};
+		}
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Eye/Error/Exceptions/EyeException.h"
+
+namespace Eye
+{
+	namespace Error
+	{
+		namespace Exceptions
+		{
+			class InvalidIRException : public EyeException
+			{
+			public:
+				InvalidIRException(const std::string& error, ErrorType errorType, const EyeSource& source)
+					: EyeException("InvalidIRException: " + error, errorType, source)
+				{
+				}
+			};
+		}
+	}
+}
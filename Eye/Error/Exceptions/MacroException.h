@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Eye/Error/Exceptions/EyeException.h"
+
+namespace Eye
+{
+	namespace Error
+	{
+		namespace Exceptions
+		{
+			class MacroException : public EyeException
+			{
+			public:
+				MacroException(const std::string& error, ErrorType errorType, const EyeSource& source)
+					: EyeException("MacroException: " + error, errorType, source)
+				{
+				}
+			};
+		}
+	}
+}
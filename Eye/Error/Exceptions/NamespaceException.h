@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Eye/Error/Exceptions/EyeException.h"
+
+namespace Eye
+{
+	namespace Error
+	{
+		namespace Exceptions
+		{
+			class NamespaceException : public EyeException
+			{
+			public:
+				NamespaceException(const std::string& error, ErrorType errorType, const EyeSource& source)
+					: EyeException("NamespaceException: " + error, errorType, source)
+				{
+				}
+			};
+		}
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Eye/Error/Exceptions/EyeException.h"
+
+namespace Eye
+{
+	namespace Error
+	{
+		namespace Exceptions
+		{
+			class UnsupportedException : public EyeException
+			{
+			public:
+				UnsupportedException(const std::string& error, ErrorType errorType, const EyeSource& source)
+					: EyeException("UnsupportedException: " + error, errorType, source)
+				{
+				}
+			};
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#include "Eye/IR/BasicBlock.h"
+
+#include <algorithm>
+
+namespace Eye
+{
+	namespace IR
+	{
+		const Instruction* BasicBlock::GetTerminator() const
+		{
+			if (m_Instructions.empty() || !m_Instructions.back()->IsTerminator())
+				return nullptr;
+			return m_Instructions.back().get();
+		}
+
+		std::vector<BasicBlock*> BasicBlock::GetSuccessors() const
+		{
+			const Instruction* terminator = GetTerminator();
+			if (!terminator)
+				return {};
+			return terminator->GetBlocks();
+		}
+
+		Instruction* BasicBlock::Append(std::unique_ptr<Instruction> instruction)
+		{
+			instruction->SetParent(this);
+			m_Instructions.push_back(std::move(instruction));
+			return m_Instructions.back().get();
+		}
+
+		Instruction* BasicBlock::InsertPhi(std::unique_ptr<Instruction> phi)
+		{
+			auto position = std::find_if(m_Instructions.begin(), m_Instructions.end(), [](const auto& instruction) { return instruction->GetOpcode() != Opcode::Phi; });
+			phi->SetParent(this);
+			return m_Instructions.insert(position, std::move(phi))->get();
+		}
+
+		Instruction* BasicBlock::InsertAfter(Instruction* position, std::unique_ptr<Instruction> instruction)
+		{
+			auto it = std::find_if(m_Instructions.begin(), m_Instructions.end(), [position](const auto& current) { return current.get() == position; });
+			instruction->SetParent(this);
+			return m_Instructions.insert((it == m_Instructions.end() ? it : std::next(it)), std::move(instruction))->get();
+		}
+
+		Instruction* BasicBlock::InsertBeforeTerminator(std::unique_ptr<Instruction> instruction)
+		{
+			auto position = ((!m_Instructions.empty() && m_Instructions.back()->IsTerminator()) ? std::prev(m_Instructions.end()) : m_Instructions.end());
+			instruction->SetParent(this);
+			return m_Instructions.insert(position, std::move(instruction))->get();
+		}
+
+		std::unique_ptr<Instruction> BasicBlock::Remove(Instruction* instruction)
+		{
+			auto position = std::find_if(m_Instructions.begin(), m_Instructions.end(), [instruction](const auto& current) { return current.get() == instruction; });
+			if (position == m_Instructions.end())
+				return nullptr;
+
+			std::unique_ptr<Instruction> removed = std::move(*position);
+			m_Instructions.erase(position);
+			removed->SetParent(nullptr);
+			return removed;
+		}
+
+		void BasicBlock::MoveInstructionsAfter(Instruction* position, BasicBlock* target)
+		{
+			auto it = std::find_if(m_Instructions.begin(), m_Instructions.end(), [position](const auto& current) { return current.get() == position; });
+			if (it == m_Instructions.end())
+				return;
+
+			for (auto moved = std::next(it); moved != m_Instructions.end(); moved++)
+				target->Append(std::move(*moved));
+			m_Instructions.erase(std::next(it), m_Instructions.end());
+		}
+
+		void BasicBlock::AddPredecessor(BasicBlock* block)
+		{
+			m_Predecessors.push_back(block);
+		}
+
+		void BasicBlock::RemovePredecessor(BasicBlock* block)
+		{
+			auto position = std::find(m_Predecessors.begin(), m_Predecessors.end(), block);
+			if (position != m_Predecessors.end())
+				m_Predecessors.erase(position);
+		}
+
+		void BasicBlock::ReplacePredecessor(BasicBlock* block, BasicBlock* replacement)
+		{
+			std::replace(m_Predecessors.begin(), m_Predecessors.end(), block, replacement);
+			for (const auto& instruction : m_Instructions)
+			{
+				if (instruction->GetOpcode() != Opcode::Phi)
+					break;
+				std::replace(instruction->GetBlocks().begin(), instruction->GetBlocks().end(), block, replacement);
+			}
+		}
+	}
+}
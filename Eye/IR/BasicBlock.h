@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Eye/IR/Instruction.h"
+
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace Eye
+{
+	namespace IR
+	{
+		class Function;
+
+		/*
+			BasicBlock
+				: PhiList InstructionList Terminator
+				;
+		*/
+		class BasicBlock
+		{
+		public:
+			BasicBlock(const std::string& name, Function* parent)
+				: m_Name(name), m_Parent(parent)
+			{
+			}
+
+			inline const std::string& GetName() const { return m_Name; }
+			inline Function* GetParent() const { return m_Parent; }
+			inline const std::vector<std::unique_ptr<Instruction>>& GetInstructions() const { return m_Instructions; }
+			inline const std::vector<BasicBlock*>& GetPredecessors() const { return m_Predecessors; }
+
+			const Instruction* GetTerminator() const;
+			std::vector<BasicBlock*> GetSuccessors() const;
+
+			Instruction* Append(std::unique_ptr<Instruction> instruction);
+			// Inserts after the Phis already at the Start of the Block
+			Instruction* InsertPhi(std::unique_ptr<Instruction> phi);
+			Instruction* InsertAfter(Instruction* position, std::unique_ptr<Instruction> instruction);
+			Instruction* InsertBeforeTerminator(std::unique_ptr<Instruction> instruction);
+			std::unique_ptr<Instruction> Remove(Instruction* instruction);
+			// Moves every Instruction after position to the End of target
+			void MoveInstructionsAfter(Instruction* position, BasicBlock* target);
+
+			void AddPredecessor(BasicBlock* block);
+			void RemovePredecessor(BasicBlock* block);
+			// Also renames the Incoming Block of this Block's Phis
+			void ReplacePredecessor(BasicBlock* block, BasicBlock* replacement);
+
+		private:
+			std::string m_Name;
+			Function* m_Parent;
+			std::vector<std::unique_ptr<Instruction>> m_Instructions;
+			std::vector<BasicBlock*> m_Predecessors;
+		};
+	}
+}
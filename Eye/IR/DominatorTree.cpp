@@ -0,0 +1,112 @@
+#include "Eye/IR/DominatorTree.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace Eye
+{
+	namespace IR
+	{
+		DominatorTree::DominatorTree(const Function* function)
+		{
+			const BasicBlock* entry = function->GetEntryBlock();
+			if (!entry)
+				return;
+
+			std::vector<const BasicBlock*> postOrder;
+			std::unordered_set<const BasicBlock*> visited = { entry };
+			std::vector<std::pair<const BasicBlock*, size_t>> stack = { { entry, 0 } };
+			while (!stack.empty())
+			{
+				auto& [block, next] = stack.back();
+				std::vector<BasicBlock*> successors = block->GetSuccessors();
+				if (next < successors.size())
+				{
+					const BasicBlock* successor = successors[next++];
+					if (visited.insert(successor).second)
+						stack.push_back({ successor, 0 });
+				}
+				else
+				{
+					postOrder.push_back(block);
+					stack.pop_back();
+				}
+			}
+
+			std::unordered_map<const BasicBlock*, size_t> postOrderIndex;
+			for (size_t i = 0; i < postOrder.size(); i++)
+				postOrderIndex[postOrder[i]] = i;
+			m_ReversePostOrder.assign(postOrder.rbegin(), postOrder.rend());
+
+			m_ImmediateDominators[entry] = entry;
+
+			auto intersect = [&](const BasicBlock* left, const BasicBlock* right)
+				{
+					while (left != right)
+					{
+						while (postOrderIndex[left] < postOrderIndex[right])
+							left = m_ImmediateDominators[left];
+						while (postOrderIndex[right] < postOrderIndex[left])
+							right = m_ImmediateDominators[right];
+					}
+					return left;
+				};
+
+			bool changed = true;
+			while (changed)
+			{
+				changed = false;
+				for (const BasicBlock* block : m_ReversePostOrder)
+				{
+					if (block == entry)
+						continue;
+
+					const BasicBlock* dominator = nullptr;
+					for (const BasicBlock* predecessor : block->GetPredecessors())
+					{
+						if (!m_ImmediateDominators.contains(predecessor))
+							continue;
+						dominator = (dominator ? intersect(predecessor, dominator) : predecessor);
+					}
+
+					auto it = m_ImmediateDominators.find(block);
+					if (dominator && (it == m_ImmediateDominators.end() || it->second != dominator))
+					{
+						m_ImmediateDominators[block] = dominator;
+						changed = true;
+					}
+				}
+			}
+		}
+
+		bool DominatorTree::IsReachable(const BasicBlock* block) const
+		{
+			return m_ImmediateDominators.contains(block);
+		}
+
+		bool DominatorTree::Dominates(const BasicBlock* dominator, const BasicBlock* block) const
+		{
+			if (!IsReachable(block))
+				return false;
+
+			while (true)
+			{
+				if (block == dominator)
+					return true;
+
+				const BasicBlock* parent = m_ImmediateDominators.at(block);
+				if (parent == block)
+					return false;
+				block = parent;
+			}
+		}
+
+		const BasicBlock* DominatorTree::GetImmediateDominator(const BasicBlock* block) const
+		{
+			auto it = m_ImmediateDominators.find(block);
+			if (it == m_ImmediateDominators.end() || it->second == block)
+				return nullptr;
+			return it->second;
+		}
+	}
+}
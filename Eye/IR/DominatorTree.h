@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Eye/IR/Function.h"
+
+#include <unordered_map>
+
+namespace Eye
+{
+	namespace IR
+	{
+		/*
+			DominatorTree
+				Immediate Dominators of the Blocks reachable from the Entry (Cooper, Harvey & Kennedy, "A Simple, Fast Dominance Algorithm").
+				Snapshot of the CFG at Construction, rebuild after changing Edges.
+		*/
+		class DominatorTree
+		{
+		public:
+			DominatorTree(const Function* function);
+
+			bool IsReachable(const BasicBlock* block) const;
+			bool Dominates(const BasicBlock* dominator, const BasicBlock* block) const;
+			const BasicBlock* GetImmediateDominator(const BasicBlock* block) const;
+			inline const std::vector<const BasicBlock*>& GetReversePostOrder() const { return m_ReversePostOrder; }
+
+		private:
+			std::vector<const BasicBlock*> m_ReversePostOrder;
+			std::unordered_map<const BasicBlock*, const BasicBlock*> m_ImmediateDominators;
+		};
+	}
+}
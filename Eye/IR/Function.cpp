@@ -0,0 +1,91 @@
+#include "Eye/IR/Function.h"
+
+#include <algorithm>
+
+namespace Eye
+{
+	namespace IR
+	{
+		Argument* Function::AddArgument(Type type, const std::string& name)
+		{
+			m_Arguments.push_back(std::make_unique<Argument>(type, name, m_Arguments.size()));
+			return m_Arguments.back().get();
+		}
+
+		BasicBlock* Function::CreateBlock(const std::string& name)
+		{
+			size_t& count = m_BlockNames[name];
+			std::string uniqueName = (count ? name + std::to_string(count) : name);
+			count++;
+
+			m_Blocks.push_back(std::make_unique<BasicBlock>(uniqueName, this));
+			return m_Blocks.back().get();
+		}
+
+		void Function::EraseBlock(BasicBlock* block)
+		{
+			std::erase_if(m_Blocks, [block](const auto& current) { return current.get() == block; });
+		}
+
+		std::string Function::AddArray(const std::string& name, Type elementType, uint32_t length)
+		{
+			size_t& count = m_ArrayNames[name];
+			std::string uniqueName = name + "." + std::to_string(count);
+			count++;
+
+			m_Arrays.push_back({ uniqueName, elementType, length });
+			return uniqueName;
+		}
+
+		const ArrayVariable* Function::GetArray(const std::string& name) const
+		{
+			auto it = std::find_if(m_Arrays.begin(), m_Arrays.end(), [&name](const ArrayVariable& array) { return array.Name == name; });
+			return (it != m_Arrays.end() ? &*it : nullptr);
+		}
+
+		uint32_t Function::AddKernel(const ArrayKernel& kernel)
+		{
+			m_Kernels.push_back(kernel);
+			return (uint32_t)(m_Kernels.size() - 1);
+		}
+
+		void Function::ReplaceAllUses(Value* value, Value* replacement)
+		{
+			for (const auto& block : m_Blocks)
+			{
+				for (const auto& instruction : block->GetInstructions())
+					std::replace(instruction->GetOperands().begin(), instruction->GetOperands().end(), value, replacement);
+			}
+		}
+
+		Constant* Function::GetDefaultConstant(Type type)
+		{
+			switch (type)
+			{
+			case Type::Integer:
+				return GetConstant((IntegerType)0);
+			case Type::Float:
+				return GetConstant((FloatType)0);
+			case Type::String:
+				return GetConstant((StringType)"");
+			default:
+				return GetConstant((BooleanType)false);
+			}
+		}
+
+		Constant* Function::CloneConstant(const Constant* constant)
+		{
+			switch (constant->GetType())
+			{
+			case Type::Integer:
+				return GetConstant(constant->GetValue<IntegerType>());
+			case Type::Float:
+				return GetConstant(constant->GetValue<FloatType>());
+			case Type::String:
+				return GetConstant(constant->GetValue<StringType>());
+			default:
+				return GetConstant(constant->GetValue<BooleanType>());
+			}
+		}
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Eye/IR/BasicBlock.h"
+
+#include <unordered_map>
+
+namespace Eye
+{
+	namespace IR
+	{
+		// Length contiguous Elements of one Type, all Defaults until written
+		struct ArrayVariable
+		{
+			std::string Name;
+			Type ElementType;
+			uint32_t Length;
+		};
+
+		// 'Target[i] = Left[i] Operation Right[i]' over the Index Range of an arraykernel Instruction
+		struct ArrayKernel
+		{
+			Opcode Operation;
+			Type ElementType;
+			std::string Target;
+			std::string Left;
+			// Empty if the Instruction's Operand 2 is broadcast instead
+			std::string Right;
+		};
+
+		/*
+			Function
+				: Arguments BasicBlockList
+				;
+
+			The first BasicBlock is the Entry, it has no Predecessors.
+			Arrays live for one Call of the Function.
+		*/
+		class Function
+		{
+		public:
+			Function(const std::string& name, Type returnType)
+				: m_Name(name), m_ReturnType(returnType)
+			{
+			}
+
+			inline const std::string& GetName() const { return m_Name; }
+			inline Type GetReturnType() const { return m_ReturnType; }
+			inline const std::vector<std::unique_ptr<Argument>>& GetArguments() const { return m_Arguments; }
+			inline const std::vector<std::unique_ptr<BasicBlock>>& GetBlocks() const { return m_Blocks; }
+			inline BasicBlock* GetEntryBlock() const { return (m_Blocks.empty() ? nullptr : m_Blocks.front().get()); }
+			inline const std::vector<ArrayVariable>& GetArrays() const { return m_Arrays; }
+			inline const std::vector<ArrayKernel>& GetKernels() const { return m_Kernels; }
+
+			Argument* AddArgument(Type type, const std::string& name);
+			// Names are made unique with a numeric Suffix
+			BasicBlock* CreateBlock(const std::string& name);
+			void EraseBlock(BasicBlock* block);
+			// Names always get a numeric Suffix, they never clash with Module Arrays
+			std::string AddArray(const std::string& name, Type elementType, uint32_t length);
+			const ArrayVariable* GetArray(const std::string& name) const;
+			// Index for the Offset of an arraykernel Instruction
+			uint32_t AddKernel(const ArrayKernel& kernel);
+			void ReplaceAllUses(Value* value, Value* replacement);
+
+			template<typename T>
+			Constant* GetConstant(T value)
+			{
+				m_Constants.push_back(std::make_unique<Constant>(value));
+				return m_Constants.back().get();
+			}
+
+			// Zero, Empty or false
+			Constant* GetDefaultConstant(Type type);
+			// Copies a Constant owned by another Function
+			Constant* CloneConstant(const Constant* constant);
+
+		private:
+			std::string m_Name;
+			Type m_ReturnType;
+			std::vector<std::unique_ptr<Argument>> m_Arguments;
+			std::vector<std::unique_ptr<BasicBlock>> m_Blocks;
+			std::vector<std::unique_ptr<Constant>> m_Constants;
+			std::unordered_map<std::string, size_t> m_BlockNames;
+			std::vector<ArrayVariable> m_Arrays;
+			std::unordered_map<std::string, size_t> m_ArrayNames;
+			std::vector<ArrayKernel> m_Kernels;
+		};
+	}
+}
@@ -0,0 +1,1148 @@
+#include "Eye/IR/IRBuilder.h"
+#include "Eye/Utility/Logger.h"
+#include "Eye/Error/Exceptions/UnsupportedException.h"
+
+#include <algorithm>
+#include <optional>
+
+namespace Eye
+{
+	namespace IR
+	{
+		std::expected<std::unique_ptr<Module>, Error::Error> IRBuilder::Build(const AST::Program* ast)
+		{
+			m_Module = std::make_unique<Module>();
+			m_TypeTable = ast->GetTypeTable().get();
+			m_Loops.clear();
+			m_VariableEnvironment = std::make_shared<Environment<Variable>>();
+			m_FunctionEnvironment = std::make_shared<Environment<FunctionSignature>>();
+			m_ScopeDepth = 0;
+			m_CaptureAnalysis.Analyze(ast);
+			m_CapturedVariables.clear();
+			m_ClosureNames.clear();
+			m_VariableTypes.clear();
+			m_CurrentDefinitions.clear();
+			m_IncompletePhis.clear();
+			m_SealedBlocks.clear();
+			m_RemovedPhis.clear();
+
+			try
+			{
+				m_Function = m_Module->CreateFunction(Module::InitFunctionName, Type::Void);
+				m_Block = m_Function->CreateBlock("entry");
+				SealBlock(m_Block);
+
+				for (const auto& stmt : ast->GetStatementList())
+					BuildStatement(stmt.get());
+
+				FinishFunction();
+			}
+			catch (const Error::Exceptions::EyeException& ex)
+			{
+				return std::unexpected(ex.GetError());
+			}
+			catch (...)
+			{
+				EYE_LOG_CRITICAL("EYEIRBuilder->Build Unsupported Exception!");
+			}
+
+			m_Function = nullptr;
+			m_Block = nullptr;
+			return std::move(m_Module);
+		}
+
+		void IRBuilder::BuildStatement(const AST::Statement* stmt)
+		{
+			if (!stmt)
+				return;
+
+			switch (stmt->GetType())
+			{
+			case AST::StatementType::ExpressionStatement:
+				BuildExpressionStatement(static_cast<const AST::ExpressionStatement*>(stmt));
+				break;
+			case AST::StatementType::BlockStatement:
+				BuildBlockStatement(static_cast<const AST::BlockStatement*>(stmt));
+				break;
+			case AST::StatementType::VariableStatement:
+				BuildVariableStatement(static_cast<const AST::VariableStatement*>(stmt));
+				break;
+			case AST::StatementType::ControlStatement:
+				BuildControlStatement(static_cast<const AST::ControlStatement*>(stmt));
+				break;
+			case AST::StatementType::IterationStatement:
+			{
+				const AST::IterationStatement* iterStmt = static_cast<const AST::IterationStatement*>(stmt);
+				if (iterStmt->GetIterationType() == AST::IterationStatementType::WhileStatement)
+					BuildWhileStatement(static_cast<const AST::WhileStatement*>(iterStmt));
+				else if (iterStmt->GetIterationType() == AST::IterationStatementType::DoWhileStatement)
+					BuildDoWhileStatement(static_cast<const AST::DoWhileStatement*>(iterStmt));
+				else if (iterStmt->GetIterationType() == AST::IterationStatementType::ForStatement)
+					BuildForStatement(static_cast<const AST::ForStatement*>(iterStmt));
+				break;
+			}
+			case AST::StatementType::ContinueStatement:
+			case AST::StatementType::BreakStatement:
+				BuildJumpStatement(stmt);
+				break;
+			case AST::StatementType::FunctionStatement:
+				BuildFunctionStatement(static_cast<const AST::FunctionStatement*>(stmt));
+				break;
+			case AST::StatementType::ReturnStatement:
+				BuildReturnStatement(static_cast<const AST::ReturnStatement*>(stmt));
+				break;
+			case AST::StatementType::ImportStatement:
+				throw Error::Exceptions::UnsupportedException("Imported Modules are not linked into the IR", Error::ErrorType::IRBuilderUnsupported, stmt->GetSource());
+			case AST::StatementType::StructStatement:
+				// Layouts are taken from the TypeTable, Structs emit no Code
+				break;
+			case AST::StatementType::NamespaceStatement:
+				// Members are Globals under their qualified Names
+				for (const auto& member : static_cast<const AST::NamespaceStatement*>(stmt)->GetStatementList())
+					BuildStatement(member.get());
+				break;
+			default:
+				EYE_LOG_CRITICAL("EYEIRBuilder BuildStatement Unknown Statement Type!");
+			}
+		}
+
+		void IRBuilder::BuildExpressionStatement(const AST::ExpressionStatement* exprStmt)
+		{
+			if (GetStructLayout(exprStmt->GetExpression()))
+				BuildStructExpression(exprStmt->GetExpression());
+			else
+				BuildExpression(exprStmt->GetExpression());
+		}
+
+		void IRBuilder::BuildBlockStatement(const AST::BlockStatement* blockStmt, bool createScope)
+		{
+			if (createScope)
+				BeginBlockScope();
+
+			for (const auto& stmt : blockStmt->GetStatementList())
+				BuildStatement(stmt.get());
+
+			if (createScope)
+				EndBlockScope();
+		}
+
+		void IRBuilder::BuildVariableStatement(const AST::VariableStatement* varStmt)
+		{
+			bool global = (m_ScopeDepth == 0 && m_Function->GetName() == Module::InitFunctionName);
+			if (varStmt->GetTypeSpecifier().IsArray())
+			{
+				Type elementType = GetDataType(varStmt->GetTypeSpecifier().Type, varStmt->GetSource());
+				uint32_t length = varStmt->GetTypeSpecifier().ArrayLength;
+				for (const auto& var : varStmt->GetVariableDeclarationList())
+				{
+					if (var->GetInitializer())
+						throw Error::Exceptions::UnsupportedException("Arrays can not be initialized", Error::ErrorType::IRBuilderUnsupported, var->GetInitializer()->GetSource());
+
+					// Global Elements start out as Defaults, Local ones are reset whenever their Declaration runs
+					std::string identifier = var->GetIdentifier()->GetValue();
+					if (global)
+					{
+						m_Module->AddArray(identifier, elementType, length);
+						m_VariableEnvironment->Define(identifier, { elementType, true, 0, nullptr, identifier });
+					}
+					else
+					{
+						std::string symbol = m_Function->AddArray(identifier, elementType, length);
+						Emit(Opcode::ClearArray, Type::Void, {}, {}, symbol);
+						m_VariableEnvironment->Define(identifier, { elementType, false, 0, nullptr, symbol });
+					}
+				}
+				return;
+			}
+
+			if (varStmt->GetTypeSpecifier().IsStruct())
+			{
+				const StructLayout* layout = GetStructLayout(varStmt->GetTypeSpecifier().StructName, varStmt->GetSource());
+				for (const auto& var : varStmt->GetVariableDeclarationList())
+				{
+					// The Initializer is evaluated before the Variable is in Scope
+					std::optional<Place> source;
+					if (var->GetInitializer())
+						source = BuildStructExpression(var->GetInitializer());
+
+					std::string identifier = var->GetIdentifier()->GetValue();
+					if (global)
+					{
+						m_Module->AddGlobal(identifier, layout->GetSlots());
+						m_VariableEnvironment->Define(identifier, { Type::Struct, true, 0, layout });
+					}
+					else
+					{
+						m_VariableEnvironment->Define(identifier, { Type::Struct, false, m_VariableTypes.size(), layout });
+						m_VariableTypes.insert(m_VariableTypes.end(), layout->GetSlots().begin(), layout->GetSlots().end());
+					}
+
+					Place target = GetPlace(var->GetIdentifier());
+					if (source)
+						CopyStruct(target, *source);
+					else
+						for (uint32_t slot = 0; slot < layout->GetSize(); slot++)
+							StorePlace(target, m_Function->GetDefaultConstant(layout->GetSlots()[slot]), slot);
+				}
+				return;
+			}
+
+			Type variableType = GetDataType(varStmt->GetTypeSpecifier().Type, varStmt->GetSource());
+			for (const auto& var : varStmt->GetVariableDeclarationList())
+			{
+				Value* value = (var->GetInitializer() ? Convert(BuildExpression(var->GetInitializer()), variableType) : m_Function->GetDefaultConstant(variableType));
+				std::string identifier = var->GetIdentifier()->GetValue();
+
+				if (global)
+				{
+					m_Module->AddGlobal(identifier, variableType);
+					m_VariableEnvironment->Define(identifier, { variableType, true, 0, nullptr });
+					Emit(Opcode::Store, Type::Void, { value }, {}, identifier);
+				}
+				else
+				{
+					DefineLocal(var->GetIdentifier(), variableType, value);
+				}
+			}
+		}
+
+		void IRBuilder::BuildControlStatement(const AST::ControlStatement* ctrlStmt)
+		{
+			Value* condition = ToBoolean(BuildExpression(ctrlStmt->GetCondition()));
+
+			BasicBlock* consequentBlock = m_Function->CreateBlock("if.then");
+			BasicBlock* alternateBlock = (ctrlStmt->GetAlternate() ? m_Function->CreateBlock("if.else") : nullptr);
+			BasicBlock* endBlock = m_Function->CreateBlock("if.end");
+
+			EmitBranch(condition, consequentBlock, (alternateBlock ? alternateBlock : endBlock));
+			SealBlock(consequentBlock);
+
+			m_Block = consequentBlock;
+			BuildStatement(ctrlStmt->GetConsequent());
+			EmitJump(endBlock);
+
+			if (alternateBlock)
+			{
+				SealBlock(alternateBlock);
+				m_Block = alternateBlock;
+				BuildStatement(ctrlStmt->GetAlternate());
+				EmitJump(endBlock);
+			}
+
+			SealBlock(endBlock);
+			m_Block = endBlock;
+		}
+
+		void IRBuilder::BuildWhileStatement(const AST::WhileStatement* whileStmt)
+		{
+			BasicBlock* conditionBlock = m_Function->CreateBlock("while.cond");
+			BasicBlock* bodyBlock = m_Function->CreateBlock("while.body");
+			BasicBlock* endBlock = m_Function->CreateBlock("while.end");
+
+			// The Back Edge is not known yet, conditionBlock stays unsealed until the Body is built
+			EmitJump(conditionBlock);
+			m_Block = conditionBlock;
+			EmitBranch(ToBoolean(BuildExpression(whileStmt->GetCondition())), bodyBlock, endBlock);
+			SealBlock(bodyBlock);
+
+			m_Block = bodyBlock;
+			m_Loops.push_back({ conditionBlock, endBlock });
+			BuildStatement(whileStmt->GetBody());
+			m_Loops.pop_back();
+			EmitJump(conditionBlock);
+
+			SealBlock(conditionBlock);
+			SealBlock(endBlock);
+			m_Block = endBlock;
+		}
+
+		void IRBuilder::BuildDoWhileStatement(const AST::DoWhileStatement* doStmt)
+		{
+			BasicBlock* bodyBlock = m_Function->CreateBlock("do.body");
+			BasicBlock* conditionBlock = m_Function->CreateBlock("do.cond");
+			BasicBlock* endBlock = m_Function->CreateBlock("do.end");
+
+			EmitJump(bodyBlock);
+			m_Block = bodyBlock;
+			m_Loops.push_back({ conditionBlock, endBlock });
+			BuildStatement(doStmt->GetBody());
+			m_Loops.pop_back();
+			EmitJump(conditionBlock);
+
+			SealBlock(conditionBlock);
+			m_Block = conditionBlock;
+			EmitBranch(ToBoolean(BuildExpression(doStmt->GetCondition())), bodyBlock, endBlock);
+
+			SealBlock(bodyBlock);
+			SealBlock(endBlock);
+			m_Block = endBlock;
+		}
+
+		void IRBuilder::BuildForStatement(const AST::ForStatement* forStmt)
+		{
+			BeginBlockScope();
+
+			if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+				BuildVariableStatement(forStmt->GetInitializer<AST::VariableStatement>());
+			else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+				BuildExpression(forStmt->GetInitializer<AST::Expression>());
+
+			BasicBlock* conditionBlock = m_Function->CreateBlock("for.cond");
+			BasicBlock* bodyBlock = m_Function->CreateBlock("for.body");
+			BasicBlock* updateBlock = m_Function->CreateBlock("for.update");
+			BasicBlock* endBlock = m_Function->CreateBlock("for.end");
+
+			EmitJump(conditionBlock);
+			m_Block = conditionBlock;
+			if (forStmt->GetCondition())
+				EmitBranch(ToBoolean(BuildExpression(forStmt->GetCondition())), bodyBlock, endBlock);
+			else
+				EmitJump(bodyBlock);
+			SealBlock(bodyBlock);
+
+			m_Block = bodyBlock;
+			m_Loops.push_back({ updateBlock, endBlock });
+			BuildStatement(forStmt->GetBody());
+			m_Loops.pop_back();
+			EmitJump(updateBlock);
+
+			SealBlock(updateBlock);
+			m_Block = updateBlock;
+			if (forStmt->GetUpdate())
+				BuildExpression(forStmt->GetUpdate());
+			EmitJump(conditionBlock);
+
+			SealBlock(conditionBlock);
+			SealBlock(endBlock);
+			m_Block = endBlock;
+
+			EndBlockScope();
+		}
+
+		void IRBuilder::BuildFunctionStatement(const AST::FunctionStatement* functionStmt)
+		{
+			std::string identifier = functionStmt->GetIdentifier()->GetValue();
+			if (m_CaptureAnalysis.Escapes(functionStmt))
+				throw Error::Exceptions::UnsupportedException("Closure '" + identifier + "' is used as a Value, Closures can only be called", Error::ErrorType::IRBuilderUnsupported, functionStmt->GetSource());
+
+			FunctionType signature = { GetDataType(functionStmt->GetReturnTypeSpecifier().Type, functionStmt->GetSource()), {} };
+			for (const auto& param : functionStmt->GetParameters())
+				signature.Parameters.push_back(GetDataType(param->GetTypeSpecifier().Type, param->GetIdentifier()->GetSource()));
+
+			std::string symbol = identifier;
+			if (m_CaptureAnalysis.IsClosure(functionStmt))
+			{
+				symbol = m_Function->GetName() + "." + identifier;
+				size_t& count = m_ClosureNames[symbol];
+				if (count++)
+					symbol += "." + std::to_string(count - 1);
+			}
+
+			// Defined before the Body is built, Functions may call themselves
+			m_FunctionEnvironment->Define(identifier, { signature, functionStmt, symbol });
+
+			// The enclosing Function continues once the Closure is built
+			Function* previousFunction = m_Function;
+			BasicBlock* previousBlock = m_Block;
+			std::vector<Loop> previousLoops = std::move(m_Loops);
+			std::unordered_map<const AST::IdentifierExpression*, Variable> previousCapturedVariables = std::move(m_CapturedVariables);
+			std::vector<std::unique_ptr<Instruction>> previousRemovedPhis = std::move(m_RemovedPhis);
+			m_Loops.clear();
+			m_CapturedVariables.clear();
+			m_RemovedPhis.clear();
+
+			m_Function = m_Module->CreateFunction(symbol, signature.Return);
+			m_Block = m_Function->CreateBlock("entry");
+			SealBlock(m_Block);
+
+			std::vector<Argument*> arguments;
+			for (size_t i = 0; i < functionStmt->GetParameters().size(); i++)
+				arguments.push_back(m_Function->AddArgument(signature.Parameters[i], functionStmt->GetParameters()[i]->GetIdentifier()->GetValue()));
+
+			BeginBlockScope();
+			for (const AST::IdentifierExpression* declaration : m_CaptureAnalysis.GetCaptures(functionStmt))
+			{
+				auto captured = previousCapturedVariables.find(declaration);
+				if (captured == previousCapturedVariables.end())
+					throw Error::Exceptions::UnsupportedException("Closure '" + identifier + "' can only capture scalar Locals, '" + declaration->GetValue() + "' is not one", Error::ErrorType::IRBuilderUnsupported, functionStmt->GetSource());
+
+				// Parameters are defined after the Captures & shadow them, the Argument is renamed so the IR stays readable
+				std::string argumentName = declaration->GetValue();
+				for (const auto& param : functionStmt->GetParameters())
+				{
+					if (param->GetIdentifier()->GetValue() == argumentName)
+						argumentName += ".capture";
+				}
+
+				Variable variable = captured->second;
+				variable.Id = m_VariableTypes.size();
+				m_VariableTypes.push_back(variable.Boxed ? Type::Integer : variable.VariableType);
+				m_VariableEnvironment->Define(declaration->GetValue(), variable);
+				m_CapturedVariables[declaration] = variable;
+				WriteVariable(variable.Id, m_Block, m_Function->AddArgument(m_VariableTypes[variable.Id], argumentName));
+			}
+			for (size_t i = 0; i < functionStmt->GetParameters().size(); i++)
+				DefineLocal(functionStmt->GetParameters()[i]->GetIdentifier(), signature.Parameters[i], arguments[i]);
+			BuildBlockStatement(functionStmt->GetBody(), false);
+			EndBlockScope();
+
+			FinishFunction();
+			m_Function = previousFunction;
+			m_Block = previousBlock;
+			m_Loops = std::move(previousLoops);
+			m_CapturedVariables = std::move(previousCapturedVariables);
+			m_RemovedPhis = std::move(previousRemovedPhis);
+		}
+
+		void IRBuilder::BuildReturnStatement(const AST::ReturnStatement* returnStmt)
+		{
+			if (returnStmt->GetExpression())
+				Emit(Opcode::Return, Type::Void, { Convert(BuildExpression(returnStmt->GetExpression()), m_Function->GetReturnType()) });
+			else
+				Emit(Opcode::Return, Type::Void);
+			StartDeadBlock();
+		}
+
+		void IRBuilder::BuildJumpStatement(const AST::Statement* stmt)
+		{
+			if (m_Loops.empty())
+				throw Error::Exceptions::UnsupportedException("Jump Statement outside of a Loop", Error::ErrorType::IRBuilderUnsupported, stmt->GetSource());
+
+			EmitJump(stmt->GetType() == AST::StatementType::BreakStatement ? m_Loops.back().Break : m_Loops.back().Continue);
+			StartDeadBlock();
+		}
+
+		Value* IRBuilder::BuildExpression(const AST::Expression* expr)
+		{
+			switch (expr->GetType())
+			{
+			case AST::ExpressionType::LiteralExpression:
+				return BuildLiteralExpression(static_cast<const AST::LiteralExpression*>(expr));
+			case AST::ExpressionType::IdentifierExpression:
+				return BuildIdentifierExpression(static_cast<const AST::IdentifierExpression*>(expr));
+			case AST::ExpressionType::AssignmentExpression:
+				return BuildAssignmentExpression(static_cast<const AST::AssignmentExpression*>(expr));
+			case AST::ExpressionType::BinaryExpression:
+				return BuildBinaryExpression(static_cast<const AST::BinaryExpression*>(expr));
+			case AST::ExpressionType::CallExpression:
+				return BuildCallExpression(static_cast<const AST::CallExpression*>(expr));
+			case AST::ExpressionType::UnaryExpression:
+				return BuildUnaryExpression(static_cast<const AST::UnaryExpression*>(expr));
+			case AST::ExpressionType::PostfixExpression:
+				return BuildPostfixExpression(static_cast<const AST::PostfixExpression*>(expr));
+			case AST::ExpressionType::MemberExpression:
+				return LoadVariable(expr);
+			default:
+				EYE_LOG_CRITICAL("EYEIRBuilder BuildExpression Unknown Expression Type!");
+			}
+		}
+
+		Value* IRBuilder::BuildLiteralExpression(const AST::LiteralExpression* literalExpr)
+		{
+			switch (literalExpr->GetLiteralType())
+			{
+			case AST::LiteralType::Integer:
+				return m_Function->GetConstant((IntegerType)literalExpr->GetValue<AST::LiteralIntegerType>());
+			case AST::LiteralType::Float:
+				return m_Function->GetConstant((FloatType)literalExpr->GetValue<AST::LiteralFloatType>());
+			case AST::LiteralType::String:
+				return m_Function->GetConstant((StringType)literalExpr->GetValue<AST::LiteralStringType>());
+			case AST::LiteralType::Boolean:
+				return m_Function->GetConstant((BooleanType)literalExpr->GetValue<AST::LiteralBooleanType>());
+			default:
+				throw Error::Exceptions::UnsupportedException("Null Literals are not supported", Error::ErrorType::IRBuilderUnsupported, literalExpr->GetSource());
+			}
+		}
+
+		Value* IRBuilder::BuildIdentifierExpression(const AST::IdentifierExpression* identifierExpr)
+		{
+			return LoadVariable(identifierExpr);
+		}
+
+		Value* IRBuilder::BuildAssignmentExpression(const AST::AssignmentExpression* assignExpr)
+		{
+			Place place = GetPlace(assignExpr->GetLHSExpression());
+			// The TypeChecker only allows '=' between Structs of one Layout
+			if (place.Layout)
+			{
+				CopyStruct(place, BuildStructExpression(assignExpr->GetExpression()));
+				return nullptr;
+			}
+
+			Type variableType = place.PlaceType;
+
+			TokenType op;
+			switch (assignExpr->GetOperatorType())
+			{
+			case TokenType::OperatorAssignment:
+			{
+				Value* value = Convert(BuildExpression(assignExpr->GetExpression()), variableType);
+				StorePlace(place, value);
+				return value;
+			}
+			case TokenType::OperatorAssignmentPlus:
+				op = TokenType::OperatorBinaryPlus;
+				break;
+			case TokenType::OperatorAssignmentMinus:
+				op = TokenType::OperatorBinaryMinus;
+				break;
+			case TokenType::OperatorAssignmentStar:
+				op = TokenType::OperatorBinaryStar;
+				break;
+			case TokenType::OperatorAssignmentSlash:
+				op = TokenType::OperatorBinarySlash;
+				break;
+			case TokenType::OperatorAssignmentModulo:
+				op = TokenType::OperatorBinaryModulo;
+				break;
+			case TokenType::OperatorAssignmentBitwiseAND:
+				op = TokenType::OperatorBitwiseBinaryAND;
+				break;
+			case TokenType::OperatorAssignmentBitwiseOR:
+				op = TokenType::OperatorBitwiseBinaryOR;
+				break;
+			case TokenType::OperatorAssignmentBitwiseXOR:
+				op = TokenType::OperatorBitwiseBinaryXOR;
+				break;
+			case TokenType::OperatorAssignmentBitwiseLeftShift:
+				op = TokenType::OperatorBitwiseLeftShift;
+				break;
+			case TokenType::OperatorAssignmentBitwiseRightShift:
+				op = TokenType::OperatorBitwiseRightShift;
+				break;
+			default:
+				EYE_LOG_CRITICAL("EYEIRBuilder BuildAssignmentExpression Unknown Operator {}", TokenTypeToString(assignExpr->GetOperatorType()));
+			}
+
+			Value* current = LoadPlace(place);
+			Value* value = Convert(BuildArithmetic(op, current, BuildExpression(assignExpr->GetExpression()), assignExpr->GetSource()), variableType);
+			StorePlace(place, value);
+			return value;
+		}
+
+		Value* IRBuilder::BuildBinaryExpression(const AST::BinaryExpression* binaryExpr)
+		{
+			// Left-Deep Chains are built bottom-up in a Loop, only Right Operands recurse
+			std::vector<const AST::BinaryExpression*> spine = binaryExpr->GetLeftSpine();
+			Value* left = BuildExpression(spine.back()->GetLeft());
+			for (auto it = spine.rbegin(); it != spine.rend(); it++)
+			{
+				TokenType op = (*it)->GetOperatorType();
+				if (op == TokenType::OperatorLogicalAND || op == TokenType::OperatorLogicalOR)
+					left = BuildLogicalExpression(*it, left);
+				else
+					left = BuildArithmetic(op, left, BuildExpression((*it)->GetRight()), (*it)->GetSource());
+			}
+			return left;
+		}
+
+		Value* IRBuilder::BuildLogicalExpression(const AST::BinaryExpression* binaryExpr, Value* left)
+		{
+			bool logicalAND = (binaryExpr->GetOperatorType() == TokenType::OperatorLogicalAND);
+			left = ToBoolean(left);
+			BasicBlock* leftBlock = m_Block;
+
+			BasicBlock* rightBlock = m_Function->CreateBlock(logicalAND ? "and.rhs" : "or.rhs");
+			BasicBlock* endBlock = m_Function->CreateBlock(logicalAND ? "and.end" : "or.end");
+
+			// Short-Circuit: the Right Operand only runs if the Left one does not decide the Result
+			if (logicalAND)
+				EmitBranch(left, rightBlock, endBlock);
+			else
+				EmitBranch(left, endBlock, rightBlock);
+			SealBlock(rightBlock);
+
+			m_Block = rightBlock;
+			Value* right = ToBoolean(BuildExpression(binaryExpr->GetRight()));
+			BasicBlock* rightEndBlock = m_Block;
+			EmitJump(endBlock);
+
+			SealBlock(endBlock);
+			m_Block = endBlock;
+
+			Instruction* phi = m_Block->InsertPhi(std::make_unique<Instruction>(Opcode::Phi, Type::Boolean));
+			phi->AddIncoming(m_Function->GetConstant((BooleanType)!logicalAND), leftBlock);
+			phi->AddIncoming(right, rightEndBlock);
+			return phi;
+		}
+
+		Value* IRBuilder::BuildCallExpression(const AST::CallExpression* callExpr)
+		{
+			if (callExpr->GetCallee()->GetType() != AST::ExpressionType::IdentifierExpression)
+				throw Error::Exceptions::UnsupportedException("Callee must be an Identifier", Error::ErrorType::IRBuilderUnsupported, callExpr->GetSource());
+
+			std::string identifier = static_cast<const AST::IdentifierExpression*>(callExpr->GetCallee())->GetValue();
+			if (!m_FunctionEnvironment->IsDefined(identifier))
+				throw Error::Exceptions::UnsupportedException("Callee '" + identifier + "' is not a Function", Error::ErrorType::IRBuilderUnsupported, callExpr->GetSource());
+
+			const FunctionSignature& function = m_FunctionEnvironment->Get(identifier);
+			std::vector<Value*> arguments;
+			for (size_t i = 0; i < function.Signature.Parameters.size(); i++)
+			{
+				// Missing Arguments take the Parameter's Default, evaluated at the Call Site
+				const AST::Expression* argument = (i < callExpr->GetArguments().size() ? callExpr->GetArguments()[i].get() : function.Declaration->GetParameters()[i]->GetInitializer());
+				if (!argument)
+					throw Error::Exceptions::UnsupportedException("Missing Argument for Parameter '" + function.Declaration->GetParameters()[i]->GetIdentifier()->GetValue() + "'", Error::ErrorType::IRBuilderUnsupported, callExpr->GetSource());
+				arguments.push_back(Convert(BuildExpression(argument), function.Signature.Parameters[i]));
+			}
+
+			// Captures follow, a boxed one passes its Handle
+			for (const AST::IdentifierExpression* declaration : m_CaptureAnalysis.GetCaptures(function.Declaration))
+			{
+				auto captured = m_CapturedVariables.find(declaration);
+				if (captured == m_CapturedVariables.end())
+					throw Error::Exceptions::UnsupportedException("'" + declaration->GetValue() + "' captured by '" + identifier + "' is not a scalar Local", Error::ErrorType::IRBuilderUnsupported, callExpr->GetSource());
+				arguments.push_back(ReadVariable(captured->second.Id, m_Block));
+			}
+
+			return Emit(Opcode::Call, function.Signature.Return, std::move(arguments), {}, function.Symbol);
+		}
+
+		Value* IRBuilder::BuildUnaryExpression(const AST::UnaryExpression* unaryExpr)
+		{
+			Value* value = BuildExpression(unaryExpr->GetExpression());
+
+			switch (unaryExpr->GetOperatorType())
+			{
+			case TokenType::OperatorBinaryPlus:
+				return value;
+			case TokenType::OperatorBinaryMinus:
+				return Emit(Opcode::Neg, value->GetType(), { value });
+			case TokenType::OperatorLogicalNOT:
+				// '!' keeps the Operand Type, see TypeChecker::TypeCheckUnaryExpression
+				if (value->GetType() == Type::Integer)
+					return Emit(Opcode::BoolToInt, Type::Integer, { Emit(Opcode::Eq, Type::Boolean, { value, m_Function->GetConstant((IntegerType)0) }) });
+				return Emit(Opcode::LogicalNot, Type::Boolean, { value });
+			case TokenType::OperatorBitwiseNOT:
+				return Emit(Opcode::Not, Type::Integer, { value });
+			default:
+				EYE_LOG_CRITICAL("EYEIRBuilder BuildUnaryExpression Unknown Operator {}", TokenTypeToString(unaryExpr->GetOperatorType()));
+			}
+		}
+
+		Value* IRBuilder::BuildPostfixExpression(const AST::PostfixExpression* postfixExpr)
+		{
+			Place place = GetPlace(postfixExpr->GetExpression());
+			Value* current = LoadPlace(place);
+			Value* one = (current->GetType() == Type::Float ? (Value*)m_Function->GetConstant((FloatType)1) : (Value*)m_Function->GetConstant((IntegerType)1));
+			Opcode opcode = (postfixExpr->GetOperatorType() == TokenType::OperatorArithmeticIncrement ? Opcode::Add : Opcode::Sub);
+
+			StorePlace(place, Emit(opcode, current->GetType(), { current, one }));
+			return current;
+		}
+
+		IRBuilder::Place IRBuilder::BuildStructExpression(const AST::Expression* expr)
+		{
+			if (expr->GetType() != AST::ExpressionType::AssignmentExpression)
+				return GetPlace(expr);
+
+			// 'a = b = c' copies into b first & then b into a
+			BuildAssignmentExpression(static_cast<const AST::AssignmentExpression*>(expr));
+			return GetPlace(static_cast<const AST::AssignmentExpression*>(expr)->GetLHSExpression());
+		}
+
+		Value* IRBuilder::BuildArithmetic(TokenType op, Value* left, Value* right, const EyeSource& source)
+		{
+			Type leftType = left->GetType();
+			Type rightType = right->GetType();
+
+			if (leftType == Type::String && rightType == Type::String)
+			{
+				switch (op)
+				{
+				case TokenType::OperatorBinaryPlus:
+					return Emit(Opcode::Concat, Type::String, { left, right });
+				case TokenType::OperatorRelationalEquals:
+					return Emit(Opcode::Eq, Type::Boolean, { left, right });
+				case TokenType::OperatorRelationalNotEquals:
+					return Emit(Opcode::Ne, Type::Boolean, { left, right });
+				case TokenType::OperatorRelationalSmaller:
+					return Emit(Opcode::Lt, Type::Boolean, { left, right });
+				case TokenType::OperatorRelationalGreater:
+					return Emit(Opcode::Gt, Type::Boolean, { left, right });
+				case TokenType::OperatorRelationalSmallerEquals:
+					return Emit(Opcode::Le, Type::Boolean, { left, right });
+				case TokenType::OperatorRelationalGreaterEquals:
+					return Emit(Opcode::Ge, Type::Boolean, { left, right });
+				default:
+					throw Error::Exceptions::UnsupportedException("Unsupported String Operator", Error::ErrorType::IRBuilderUnsupported, source);
+				}
+			}
+
+			// Mixed int/float Operands are computed as float
+			if ((leftType == Type::Float && rightType == Type::Integer) || (leftType == Type::Integer && rightType == Type::Float))
+			{
+				left = Convert(left, Type::Float);
+				right = Convert(right, Type::Float);
+			}
+
+			if (left->GetType() != right->GetType())
+				throw Error::Exceptions::UnsupportedException("Operand Types " + IRTypeToString(leftType) + " and " + IRTypeToString(rightType) + " do not match", Error::ErrorType::IRBuilderUnsupported, source);
+
+			Type type = left->GetType();
+			switch (op)
+			{
+			case TokenType::OperatorBinaryPlus:
+				return Emit(Opcode::Add, type, { left, right });
+			case TokenType::OperatorBinaryMinus:
+				return Emit(Opcode::Sub, type, { left, right });
+			case TokenType::OperatorBinaryStar:
+				return Emit(Opcode::Mul, type, { left, right });
+			case TokenType::OperatorBinarySlash:
+				return Emit(Opcode::Div, type, { left, right });
+			case TokenType::OperatorBinaryModulo:
+				return Emit(Opcode::Mod, type, { left, right });
+			case TokenType::OperatorRelationalEquals:
+				return Emit(Opcode::Eq, Type::Boolean, { left, right });
+			case TokenType::OperatorRelationalNotEquals:
+				return Emit(Opcode::Ne, Type::Boolean, { left, right });
+			case TokenType::OperatorRelationalSmaller:
+				return Emit(Opcode::Lt, Type::Boolean, { left, right });
+			case TokenType::OperatorRelationalGreater:
+				return Emit(Opcode::Gt, Type::Boolean, { left, right });
+			case TokenType::OperatorRelationalSmallerEquals:
+				return Emit(Opcode::Le, Type::Boolean, { left, right });
+			case TokenType::OperatorRelationalGreaterEquals:
+				return Emit(Opcode::Ge, Type::Boolean, { left, right });
+			case TokenType::OperatorBitwiseBinaryAND:
+				return Emit(Opcode::And, type, { left, right });
+			case TokenType::OperatorBitwiseBinaryOR:
+				return Emit(Opcode::Or, type, { left, right });
+			case TokenType::OperatorBitwiseBinaryXOR:
+				return Emit(Opcode::Xor, type, { left, right });
+			case TokenType::OperatorBitwiseLeftShift:
+				return Emit(Opcode::Shl, type, { left, right });
+			case TokenType::OperatorBitwiseRightShift:
+				return Emit(Opcode::Shr, type, { left, right });
+			default:
+				EYE_LOG_CRITICAL("EYEIRBuilder BuildArithmetic Unknown Operator {}", TokenTypeToString(op));
+			}
+		}
+
+		Value* IRBuilder::Convert(Value* value, Type type)
+		{
+			if (value->GetType() == type || type == Type::Void)
+				return value;
+
+			if (value->GetType() == Type::Integer && type == Type::Float)
+			{
+				if (value->GetValueKind() == ValueKind::Constant)
+					return m_Function->GetConstant((FloatType)(long long)static_cast<Constant*>(value)->GetValue<IntegerType>());
+				return Emit(Opcode::IntToFloat, Type::Float, { value });
+			}
+
+			EYE_LOG_CRITICAL("EYEIRBuilder Convert Invalid Conversion from {} to {}", IRTypeToString(value->GetType()), IRTypeToString(type));
+		}
+
+		Value* IRBuilder::ToBoolean(Value* value)
+		{
+			if (value->GetType() == Type::Boolean)
+				return value;
+			if (value->GetType() == Type::Integer)
+				return Emit(Opcode::Ne, Type::Boolean, { value, m_Function->GetConstant((IntegerType)0) });
+
+			EYE_LOG_CRITICAL("EYEIRBuilder ToBoolean Invalid Conversion from {}", IRTypeToString(value->GetType()));
+		}
+
+		const IRBuilder::Variable& IRBuilder::GetVariable(const AST::IdentifierExpression* identifierExpr)
+		{
+			std::string identifier = identifierExpr->GetValue();
+			if (!m_VariableEnvironment->IsDefined(identifier))
+				throw Error::Exceptions::UnsupportedException("'" + identifier + "' is not a Variable", Error::ErrorType::IRBuilderUnsupported, identifierExpr->GetSource());
+			return m_VariableEnvironment->Get(identifier);
+		}
+
+		IRBuilder::Place IRBuilder::GetPlace(const AST::Expression* expr)
+		{
+			if (expr->GetType() == AST::ExpressionType::IdentifierExpression)
+			{
+				const AST::IdentifierExpression* identifierExpr = static_cast<const AST::IdentifierExpression*>(expr);
+				const Variable& variable = GetVariable(identifierExpr);
+				if (!variable.Array.empty())
+					throw Error::Exceptions::UnsupportedException("Array '" + identifierExpr->GetValue() + "' can only be accessed by Element", Error::ErrorType::IRBuilderUnsupported, expr->GetSource());
+				return { identifierExpr, &variable, 0, variable.VariableType, variable.Layout, nullptr };
+			}
+
+			if (expr->GetType() != AST::ExpressionType::MemberExpression)
+				throw Error::Exceptions::UnsupportedException("Expression does not name a Variable or Field", Error::ErrorType::IRBuilderUnsupported, expr->GetSource());
+			if (static_cast<const AST::MemberExpression*>(expr)->IsComputed())
+				return GetElementPlace(static_cast<const AST::MemberExpression*>(expr));
+
+			const FieldLayout* field = (m_TypeTable ? m_TypeTable->GetMemberField(expr) : nullptr);
+			if (!field)
+				throw Error::Exceptions::UnsupportedException("Member Expressions require a Type-Checked Program", Error::ErrorType::IRBuilderUnsupported, expr->GetSource());
+
+			// 'a.b.c' folds into one Offset from 'a'
+			Place place = GetPlace(static_cast<const AST::MemberExpression*>(expr)->GetObject());
+			place.Offset += field->Offset;
+			place.PlaceType = field->FieldType;
+			place.Layout = field->Layout;
+			return place;
+		}
+
+		IRBuilder::Place IRBuilder::GetElementPlace(const AST::MemberExpression* memberExpr)
+		{
+			if (memberExpr->GetObject()->GetType() != AST::ExpressionType::IdentifierExpression)
+				throw Error::Exceptions::UnsupportedException("Only named Arrays can be indexed", Error::ErrorType::IRBuilderUnsupported, memberExpr->GetSource());
+
+			const AST::IdentifierExpression* identifierExpr = static_cast<const AST::IdentifierExpression*>(memberExpr->GetObject());
+			const Variable& variable = GetVariable(identifierExpr);
+			if (variable.Array.empty())
+				throw Error::Exceptions::UnsupportedException("'" + identifierExpr->GetValue() + "' is not an Array", Error::ErrorType::IRBuilderUnsupported, memberExpr->GetSource());
+
+			// Compound Assignments check the Index once for both Accesses
+			Value* index = BuildExpression(memberExpr->GetProperty());
+			Emit(Opcode::BoundsCheck, Type::Void, { index }, {}, variable.Array);
+			return { identifierExpr, &variable, 0, variable.VariableType, nullptr, index };
+		}
+
+		Value* IRBuilder::LoadVariable(const AST::Expression* expr)
+		{
+			Place place = GetPlace(expr);
+			if (place.Layout)
+				throw Error::Exceptions::UnsupportedException("Struct '" + place.Layout->GetName() + "' can only be copied as a Whole", Error::ErrorType::IRBuilderUnsupported, expr->GetSource());
+			return LoadPlace(place);
+		}
+
+		Value* IRBuilder::LoadPlace(const Place& place, uint32_t slot)
+		{
+			Type type = (place.Layout ? place.Layout->GetSlots()[slot] : place.PlaceType);
+			if (place.Index)
+				return Emit(Opcode::LoadElement, type, { place.Index }, {}, place.Root->Array);
+			if (place.Root->Global)
+				return Emit(Opcode::Load, type, {}, {}, place.Identifier->GetValue(), place.Offset + slot);
+			if (place.Root->Boxed)
+				return Emit(Opcode::LoadBox, type, { ReadVariable(place.Root->Id, m_Block) });
+			return ReadVariable(place.Root->Id + place.Offset + slot, m_Block);
+		}
+
+		void IRBuilder::StorePlace(const Place& place, Value* value, uint32_t slot)
+		{
+			if (place.Index)
+				Emit(Opcode::StoreElement, Type::Void, { place.Index, value }, {}, place.Root->Array);
+			else if (place.Root->Global)
+				Emit(Opcode::Store, Type::Void, { value }, {}, place.Identifier->GetValue(), place.Offset + slot);
+			else if (place.Root->Boxed)
+				Emit(Opcode::StoreBox, Type::Void, { ReadVariable(place.Root->Id, m_Block), value });
+			else
+				WriteVariable(place.Root->Id + place.Offset + slot, m_Block, value);
+		}
+
+		void IRBuilder::CopyStruct(const Place& target, const Place& source)
+		{
+			// All Slots are read before any is written, Target & Source may overlap
+			std::vector<Value*> values;
+			for (uint32_t slot = 0; slot < source.Layout->GetSize(); slot++)
+				values.push_back(LoadPlace(source, slot));
+			for (uint32_t slot = 0; slot < target.Layout->GetSize(); slot++)
+				StorePlace(target, values[slot], slot);
+		}
+
+		const StructLayout* IRBuilder::GetStructLayout(const AST::Expression* expr)
+		{
+			switch (expr->GetType())
+			{
+			case AST::ExpressionType::IdentifierExpression:
+			{
+				const std::string& identifier = static_cast<const AST::IdentifierExpression*>(expr)->GetValue();
+				return (m_VariableEnvironment->IsDefined(identifier) ? m_VariableEnvironment->Get(identifier).Layout : nullptr);
+			}
+			case AST::ExpressionType::MemberExpression:
+			{
+				const FieldLayout* field = (m_TypeTable ? m_TypeTable->GetMemberField(expr) : nullptr);
+				return (field ? field->Layout : nullptr);
+			}
+			case AST::ExpressionType::AssignmentExpression:
+				return GetStructLayout(static_cast<const AST::AssignmentExpression*>(expr)->GetLHSExpression());
+			default:
+				return nullptr;
+			}
+		}
+
+		const StructLayout* IRBuilder::GetStructLayout(const std::string& name, const EyeSource& source) const
+		{
+			const StructLayout* layout = (m_TypeTable ? m_TypeTable->GetStructLayout(name) : nullptr);
+			if (!layout)
+				throw Error::Exceptions::UnsupportedException("Struct '" + name + "' requires a Type-Checked Program", Error::ErrorType::IRBuilderUnsupported, source);
+			return layout;
+		}
+
+		Type IRBuilder::GetDataType(AST::DataType dataType, const EyeSource& source) const
+		{
+			switch (dataType)
+			{
+			case AST::DataType::Int:
+				return Type::Integer;
+			case AST::DataType::Float:
+				return Type::Float;
+			case AST::DataType::Str:
+				return Type::String;
+			case AST::DataType::Bool:
+				return Type::Boolean;
+			case AST::DataType::Void:
+				return Type::Void;
+			default:
+				throw Error::Exceptions::UnsupportedException("Unsupported Data Type '" + std::string(TokenTypeToString(AST::DataTypeToToken(dataType))) + "'", Error::ErrorType::IRBuilderUnsupported, source);
+			}
+		}
+
+		Instruction* IRBuilder::Emit(Opcode opcode, Type type, std::vector<Value*>&& operands, std::vector<BasicBlock*>&& blocks, const std::string& symbol, uint32_t offset)
+		{
+			return m_Block->Append(std::make_unique<Instruction>(opcode, type, std::move(operands), std::move(blocks), symbol, offset));
+		}
+
+		void IRBuilder::EmitJump(BasicBlock* target)
+		{
+			if (IsTerminated() || !IsReachable())
+				return;
+
+			Emit(Opcode::Jump, Type::Void, {}, { target });
+			target->AddPredecessor(m_Block);
+		}
+
+		void IRBuilder::EmitBranch(Value* condition, BasicBlock* consequent, BasicBlock* alternate)
+		{
+			if (!IsReachable())
+				return;
+
+			Emit(Opcode::Branch, Type::Void, { condition }, { consequent, alternate });
+			consequent->AddPredecessor(m_Block);
+			alternate->AddPredecessor(m_Block);
+		}
+
+		bool IRBuilder::IsTerminated() const
+		{
+			return m_Block->GetTerminator() != nullptr;
+		}
+
+		bool IRBuilder::IsReachable() const
+		{
+			// Forward Edges are added before a Block is entered, only Back Edges come later
+			return (m_Block == m_Function->GetEntryBlock() || !m_Block->GetPredecessors().empty());
+		}
+
+		void IRBuilder::StartDeadBlock()
+		{
+			m_Block = m_Function->CreateBlock("dead");
+			SealBlock(m_Block);
+		}
+
+		void IRBuilder::FinishFunction()
+		{
+			for (const auto& block : m_Function->GetBlocks())
+			{
+				if (block->GetTerminator())
+					continue;
+
+				// Semantic guarantees non-void Functions return on every Path
+				if (m_Function->GetReturnType() == Type::Void)
+					block->Append(std::make_unique<Instruction>(Opcode::Return, Type::Void));
+				else
+					block->Append(std::make_unique<Instruction>(Opcode::Unreachable, Type::Void));
+			}
+
+			std::unordered_set<BasicBlock*> reachable;
+			std::vector<BasicBlock*> worklist = { m_Function->GetEntryBlock() };
+			while (!worklist.empty())
+			{
+				BasicBlock* block = worklist.back();
+				worklist.pop_back();
+				if (!reachable.insert(block).second)
+					continue;
+				for (BasicBlock* successor : block->GetSuccessors())
+					worklist.push_back(successor);
+			}
+
+			std::vector<BasicBlock*> unreachable;
+			for (const auto& block : m_Function->GetBlocks())
+			{
+				if (!reachable.contains(block.get()))
+					unreachable.push_back(block.get());
+			}
+
+			std::vector<Instruction*> phis;
+			for (BasicBlock* block : unreachable)
+			{
+				for (BasicBlock* successor : block->GetSuccessors())
+				{
+					if (!reachable.contains(successor))
+						continue;
+
+					successor->RemovePredecessor(block);
+					for (const auto& instruction : successor->GetInstructions())
+					{
+						if (instruction->GetOpcode() != Opcode::Phi)
+							break;
+						instruction->RemoveIncoming(block);
+						phis.push_back(instruction.get());
+					}
+				}
+			}
+
+			// Blocks of the enclosing Function may reuse the Addresses of erased ones
+			for (BasicBlock* block : unreachable)
+			{
+				m_CurrentDefinitions.erase(block);
+				m_IncompletePhis.erase(block);
+				m_SealedBlocks.erase(block);
+				m_Function->EraseBlock(block);
+			}
+
+			// Dropping Incomings can leave Phis that merge a single Value
+			for (Instruction* phi : phis)
+			{
+				if (phi->GetParent())
+					TryRemoveTrivialPhi(phi);
+			}
+
+			m_RemovedPhis.clear();
+		}
+
+		void IRBuilder::DefineLocal(const AST::IdentifierExpression* declaration, Type type, Value* value)
+		{
+			Variable variable = { type, false, m_VariableTypes.size(), nullptr, "", m_CaptureAnalysis.IsBoxed(declaration) };
+			m_VariableTypes.push_back(variable.Boxed ? Type::Integer : type);
+			m_VariableEnvironment->Define(declaration->GetValue(), variable);
+			if (m_CaptureAnalysis.IsCaptured(declaration))
+				m_CapturedVariables[declaration] = variable;
+			WriteVariable(variable.Id, m_Block, (variable.Boxed ? Emit(Opcode::Box, Type::Integer, { value }) : value));
+		}
+
+		void IRBuilder::BeginBlockScope()
+		{
+			m_VariableEnvironment = std::make_shared<Environment<Variable>>(m_VariableEnvironment);
+			m_FunctionEnvironment = std::make_shared<Environment<FunctionSignature>>(m_FunctionEnvironment);
+			m_ScopeDepth++;
+		}
+
+		void IRBuilder::EndBlockScope()
+		{
+			m_VariableEnvironment = m_VariableEnvironment->GetParent();
+			m_FunctionEnvironment = m_FunctionEnvironment->GetParent();
+			m_ScopeDepth--;
+		}
+
+		void IRBuilder::WriteVariable(size_t id, BasicBlock* block, Value* value)
+		{
+			m_CurrentDefinitions[block][id] = value;
+		}
+
+		Value* IRBuilder::ReadVariable(size_t id, BasicBlock* block)
+		{
+			auto blockDefinitions = m_CurrentDefinitions.find(block);
+			if (blockDefinitions != m_CurrentDefinitions.end())
+			{
+				auto definition = blockDefinitions->second.find(id);
+				if (definition != blockDefinitions->second.end())
+					return definition->second;
+			}
+
+			return ReadVariableRecursive(id, block);
+		}
+
+		Value* IRBuilder::ReadVariableRecursive(size_t id, BasicBlock* block)
+		{
+			Value* value;
+			if (!m_SealedBlocks.contains(block))
+			{
+				// Not all Predecessors are known yet, the Operands are added once the Block is sealed
+				Instruction* phi = block->InsertPhi(std::make_unique<Instruction>(Opcode::Phi, m_VariableTypes[id]));
+				m_IncompletePhis[block].push_back({ id, phi });
+				value = phi;
+			}
+			else if (block->GetPredecessors().empty())
+			{
+				// Only reached from Code after return/break/continue
+				value = m_Function->GetDefaultConstant(m_VariableTypes[id]);
+			}
+			else if (block->GetPredecessors().size() == 1)
+			{
+				value = ReadVariable(id, block->GetPredecessors().front());
+			}
+			else
+			{
+				// Break potential Cycles with an Operandless Phi
+				Instruction* phi = block->InsertPhi(std::make_unique<Instruction>(Opcode::Phi, m_VariableTypes[id]));
+				WriteVariable(id, block, phi);
+				value = AddPhiOperands(id, phi);
+			}
+
+			WriteVariable(id, block, value);
+			return value;
+		}
+
+		Value* IRBuilder::AddPhiOperands(size_t id, Instruction* phi)
+		{
+			for (BasicBlock* predecessor : phi->GetParent()->GetPredecessors())
+				phi->AddIncoming(ReadVariable(id, predecessor), predecessor);
+			return TryRemoveTrivialPhi(phi);
+		}
+
+		Value* IRBuilder::TryRemoveTrivialPhi(Instruction* phi)
+		{
+			Value* same = nullptr;
+			for (Value* operand : phi->GetOperands())
+			{
+				if (operand == same || operand == phi)
+					continue;
+				if (same)
+					return phi;
+				same = operand;
+			}
+
+			// Unreachable or only self-referencing
+			if (!same)
+				same = m_Function->GetDefaultConstant(phi->GetType());
+
+			std::vector<Instruction*> users;
+			for (const auto& block : m_Function->GetBlocks())
+			{
+				for (const auto& instruction : block->GetInstructions())
+				{
+					if (instruction.get() != phi && std::find(instruction->GetOperands().begin(), instruction->GetOperands().end(), phi) != instruction->GetOperands().end())
+						users.push_back(instruction.get());
+				}
+			}
+
+			ReplaceUses(phi, same);
+			m_RemovedPhis.push_back(phi->GetParent()->Remove(phi));
+
+			// Users that were Phis may have become trivial
+			for (Instruction* user : users)
+			{
+				if (user->GetOpcode() == Opcode::Phi && user->GetParent())
+					TryRemoveTrivialPhi(user);
+			}
+
+			return same;
+		}
+
+		void IRBuilder::ReplaceUses(Value* from, Value* to)
+		{
+			m_Function->ReplaceAllUses(from, to);
+
+			for (auto& [block, definitions] : m_CurrentDefinitions)
+			{
+				for (auto& [id, value] : definitions)
+				{
+					if (value == from)
+						value = to;
+				}
+			}
+		}
+
+		void IRBuilder::SealBlock(BasicBlock* block)
+		{
+			auto incompletePhis = m_IncompletePhis.find(block);
+			if (incompletePhis != m_IncompletePhis.end())
+			{
+				std::vector<std::pair<size_t, Instruction*>> phis = std::move(incompletePhis->second);
+				m_IncompletePhis.erase(incompletePhis);
+				for (const auto& [id, phi] : phis)
+					AddPhiOperands(id, phi);
+			}
+
+			m_SealedBlocks.insert(block);
+		}
+	}
+}
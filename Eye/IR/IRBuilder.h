@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Eye/IR/Module.h"
+#include "Eye/Error/Error.h"
+#include "Eye/TypeChecker/Environment.h"
+#include "Eye/TypeChecker/TypeTable.h"
+#include "Eye/Semantic/CaptureAnalysis.h"
+
+#include "Eye/AST/Program.h"
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Statements/ExpressionStatement.h"
+#include "Eye/AST/Statements/BlockStatement.h"
+#include "Eye/AST/Statements/VariableStatement.h"
+#include "Eye/AST/Statements/ControlStatement.h"
+#include "Eye/AST/Statements/IterationStatement.h"
+#include "Eye/AST/Statements/FunctionStatement.h"
+#include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/ContinueStatement.h"
+#include "Eye/AST/Statements/BreakStatement.h"
+#include "Eye/AST/Statements/StructStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
+
+#include "Eye/AST/Expressions/Expression.h"
+#include "Eye/AST/Expressions/LiteralExpression.h"
+#include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/Expressions/AssignmentExpression.h"
+#include "Eye/AST/Expressions/BinaryExpression.h"
+#include "Eye/AST/Expressions/CallExpression.h"
+#include "Eye/AST/Expressions/MemberExpression.h"
+#include "Eye/AST/Expressions/UnaryExpression.h"
+#include "Eye/AST/Expressions/PostfixExpression.h"
+
+#include <expected>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Eye
+{
+	namespace IR
+	{
+		/*
+			IRBuilder
+				Lowers a Type-Checked AST into SSA Form (Braun et al., "Simple and Efficient Construction of Static Single Assignment Form").
+				Top-Level Statements become Module::InitFunctionName & their Variables Globals, Function Locals never leave SSA Values.
+				Struct Fields are resolved to Offsets by the TypeChecker, Struct Locals become one SSA Variable per Slot & Struct Globals are accessed at constant Offsets.
+				Arrays stay in Memory, every Element Access is preceded by a BoundsCheck the LoopOptimizer may prove redundant.
+				Closures become Functions of their own taking their Captures as trailing Arguments, read at every Call.
+				Captures the CaptureAnalysis boxes live in a Box, the Function & its Closures pass its Handle instead.
+		*/
+		class IRBuilder
+		{
+		public:
+			std::expected<std::unique_ptr<Module>, Error::Error> Build(const AST::Program* ast);
+
+		private:
+			struct Variable
+			{
+				Type VariableType;
+				bool Global;
+				// Struct Locals take Layout->GetSize() consecutive Ids
+				size_t Id;
+				const StructLayout* Layout;
+				// Symbol of the Array Storage, VariableType is the Element Type
+				std::string Array = {};
+				// The SSA Variable holds the Handle of a Box holding the Value
+				bool Boxed = false;
+			};
+
+			// A Variable or a Field within it, Offset counts Slots from the Start of the Variable
+			struct Place
+			{
+				const AST::IdentifierExpression* Identifier;
+				const Variable* Root;
+				uint32_t Offset;
+				Type PlaceType;
+				const StructLayout* Layout;
+				// Checked Index of an Array Element, nullptr otherwise
+				Value* Index;
+			};
+
+			struct FunctionSignature
+			{
+				FunctionType Signature;
+				const AST::FunctionStatement* Declaration;
+				// Name of the IR Function, Closures are prefixed with their enclosing Function
+				std::string Symbol;
+			};
+
+			struct Loop
+			{
+				BasicBlock* Continue;
+				BasicBlock* Break;
+			};
+
+		private:
+			void BuildStatement(const AST::Statement* stmt);
+			void BuildExpressionStatement(const AST::ExpressionStatement* exprStmt);
+			void BuildBlockStatement(const AST::BlockStatement* blockStmt, bool createScope = true);
+			void BuildVariableStatement(const AST::VariableStatement* varStmt);
+			void BuildControlStatement(const AST::ControlStatement* ctrlStmt);
+			void BuildWhileStatement(const AST::WhileStatement* whileStmt);
+			void BuildDoWhileStatement(const AST::DoWhileStatement* doStmt);
+			void BuildForStatement(const AST::ForStatement* forStmt);
+			void BuildFunctionStatement(const AST::FunctionStatement* functionStmt);
+			void BuildReturnStatement(const AST::ReturnStatement* returnStmt);
+			void BuildJumpStatement(const AST::Statement* stmt);
+
+			Value* BuildExpression(const AST::Expression* expr);
+			Value* BuildLiteralExpression(const AST::LiteralExpression* literalExpr);
+			Value* BuildIdentifierExpression(const AST::IdentifierExpression* identifierExpr);
+			Value* BuildAssignmentExpression(const AST::AssignmentExpression* assignExpr);
+			Value* BuildBinaryExpression(const AST::BinaryExpression* binaryExpr);
+			// The Left Operand is already built into the current Block
+			Value* BuildLogicalExpression(const AST::BinaryExpression* binaryExpr, Value* left);
+			Value* BuildCallExpression(const AST::CallExpression* callExpr);
+			Value* BuildUnaryExpression(const AST::UnaryExpression* unaryExpr);
+			Value* BuildPostfixExpression(const AST::PostfixExpression* postfixExpr);
+			// Struct Expressions have no single Value, they evaluate to the Place holding them
+			Place BuildStructExpression(const AST::Expression* expr);
+
+		private:
+			Value* BuildArithmetic(TokenType op, Value* left, Value* right, const EyeSource& source);
+			Value* Convert(Value* value, Type type);
+			Value* ToBoolean(Value* value);
+			const Variable& GetVariable(const AST::IdentifierExpression* identifierExpr);
+			Place GetPlace(const AST::Expression* expr);
+			Place GetElementPlace(const AST::MemberExpression* memberExpr);
+			// Value of a scalar Variable or Field
+			Value* LoadVariable(const AST::Expression* expr);
+			Value* LoadPlace(const Place& place, uint32_t slot = 0);
+			void StorePlace(const Place& place, Value* value, uint32_t slot = 0);
+			void CopyStruct(const Place& target, const Place& source);
+			const StructLayout* GetStructLayout(const AST::Expression* expr);
+			const StructLayout* GetStructLayout(const std::string& name, const EyeSource& source) const;
+			Type GetDataType(AST::DataType dataType, const EyeSource& source) const;
+			// Scalar Local, boxed if the CaptureAnalysis says so
+			void DefineLocal(const AST::IdentifierExpression* declaration, Type type, Value* value);
+
+			Instruction* Emit(Opcode opcode, Type type, std::vector<Value*>&& operands = {}, std::vector<BasicBlock*>&& blocks = {}, const std::string& symbol = "", uint32_t offset = 0);
+			void EmitJump(BasicBlock* target);
+			void EmitBranch(Value* condition, BasicBlock* consequent, BasicBlock* alternate);
+			bool IsTerminated() const;
+			bool IsReachable() const;
+			// Code after return/break/continue goes into a Block without Predecessors, FinishFunction drops it
+			void StartDeadBlock();
+			void FinishFunction();
+
+			void BeginBlockScope();
+			void EndBlockScope();
+
+		private:
+			// SSA Construction
+			void WriteVariable(size_t id, BasicBlock* block, Value* value);
+			Value* ReadVariable(size_t id, BasicBlock* block);
+			Value* ReadVariableRecursive(size_t id, BasicBlock* block);
+			Value* AddPhiOperands(size_t id, Instruction* phi);
+			Value* TryRemoveTrivialPhi(Instruction* phi);
+			void ReplaceUses(Value* from, Value* to);
+			void SealBlock(BasicBlock* block);
+
+		private:
+			std::unique_ptr<Module> m_Module;
+			const TypeTable* m_TypeTable = nullptr;
+			Function* m_Function = nullptr;
+			BasicBlock* m_Block = nullptr;
+			std::vector<Loop> m_Loops;
+			std::shared_ptr<Environment<Variable>> m_VariableEnvironment;
+			std::shared_ptr<Environment<FunctionSignature>> m_FunctionEnvironment;
+			size_t m_ScopeDepth = 0;
+			CaptureAnalysis m_CaptureAnalysis;
+			// Captured Locals of the current Function by Declaration, Call Sites pass them to Closures even where their Names are shadowed
+			std::unordered_map<const AST::IdentifierExpression*, Variable> m_CapturedVariables;
+			std::unordered_map<std::string, size_t> m_ClosureNames;
+
+			std::vector<Type> m_VariableTypes;
+			std::unordered_map<BasicBlock*, std::unordered_map<size_t, Value*>> m_CurrentDefinitions;
+			std::unordered_map<BasicBlock*, std::vector<std::pair<size_t, Instruction*>>> m_IncompletePhis;
+			std::unordered_set<BasicBlock*> m_SealedBlocks;
+			// Trivial Phis are kept alive until the Function is finished, Builder State may still point at them
+			std::vector<std::unique_ptr<Instruction>> m_RemovedPhis;
+		};
+	}
+}
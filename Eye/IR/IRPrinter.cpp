@@ -0,0 +1,232 @@
+#include "Eye/IR/IRPrinter.h"
+
+#include <charconv>
+
+namespace Eye
+{
+	namespace IR
+	{
+		std::string IRPrinter::Print(const Module* module)
+		{
+			m_Output.str("");
+			m_Output.clear();
+
+			for (const GlobalVariable& global : module->GetGlobals())
+			{
+				if (global.VariableType != Type::Struct)
+				{
+					m_Output << "global " << IRTypeToString(global.VariableType) << " @" << global.Name << "\n";
+					continue;
+				}
+
+				m_Output << "global {";
+				for (size_t i = 0; i < global.Slots.size(); i++)
+					m_Output << (i ? ", " : " ") << IRTypeToString(global.Slots[i]);
+				m_Output << " } @" << global.Name << "\n";
+			}
+
+			for (const ArrayVariable& array : module->GetArrays())
+				m_Output << "array " << IRTypeToString(array.ElementType) << "[" << array.Length << "] @" << array.Name << "\n";
+
+			for (const auto& function : module->GetFunctions())
+			{
+				if (m_Output.tellp() > 0)
+					m_Output << "\n";
+				PrintFunction(function.get());
+			}
+
+			return m_Output.str();
+		}
+
+		void IRPrinter::PrintFunction(const Function* function)
+		{
+			// Phis may use Values defined further down, number everything first
+			m_ValueNumbers.clear();
+			m_Function = function;
+			for (const auto& block : function->GetBlocks())
+			{
+				for (const auto& instruction : block->GetInstructions())
+				{
+					if (instruction->GetType() != Type::Void)
+						m_ValueNumbers.insert({ instruction.get(), m_ValueNumbers.size() });
+				}
+			}
+
+			m_Output << "function " << IRTypeToString(function->GetReturnType()) << " @" << function->GetName() << "(";
+			for (size_t i = 0; i < function->GetArguments().size(); i++)
+				m_Output << (i ? ", " : "") << IRTypeToString(function->GetArguments()[i]->GetType()) << " %" << function->GetArguments()[i]->GetName();
+			m_Output << ")\n{\n";
+			for (const ArrayVariable& array : function->GetArrays())
+				m_Output << "\tarray " << IRTypeToString(array.ElementType) << "[" << array.Length << "] %" << array.Name << "\n";
+
+			for (const auto& block : function->GetBlocks())
+			{
+				m_Output << block->GetName() << ":\n";
+				for (const auto& instruction : block->GetInstructions())
+					PrintInstruction(instruction.get());
+			}
+
+			m_Output << "}\n";
+		}
+
+		void IRPrinter::PrintInstruction(const Instruction* instruction)
+		{
+			const std::vector<Value*>& operands = instruction->GetOperands();
+			const std::vector<BasicBlock*>& blocks = instruction->GetBlocks();
+
+			m_Output << "\t";
+			if (instruction->GetType() != Type::Void)
+				m_Output << ValueToString(instruction) << " = ";
+			m_Output << OpcodeToString(instruction->GetOpcode());
+
+			switch (instruction->GetOpcode())
+			{
+			case Opcode::Eq:
+			case Opcode::Ne:
+			case Opcode::Lt:
+			case Opcode::Gt:
+			case Opcode::Le:
+			case Opcode::Ge:
+				// Compared Type, the Result is always bool
+				m_Output << " " << IRTypeToString(operands[0]->GetType()) << " " << ValueToString(operands[0]) << ", " << ValueToString(operands[1]);
+				break;
+			case Opcode::IntToFloat:
+			case Opcode::BoolToInt:
+				m_Output << " " << IRTypeToString(operands[0]->GetType()) << " " << ValueToString(operands[0]) << " to " << IRTypeToString(instruction->GetType());
+				break;
+			case Opcode::Load:
+				m_Output << " " << IRTypeToString(instruction->GetType()) << " @" << instruction->GetSymbol();
+				if (instruction->GetOffset())
+					m_Output << "+" << instruction->GetOffset();
+				break;
+			case Opcode::Store:
+				m_Output << " " << IRTypeToString(operands[0]->GetType()) << " " << ValueToString(operands[0]) << ", @" << instruction->GetSymbol();
+				if (instruction->GetOffset())
+					m_Output << "+" << instruction->GetOffset();
+				break;
+			case Opcode::LoadElement:
+				m_Output << " " << IRTypeToString(instruction->GetType()) << " " << ArrayToString(instruction->GetSymbol()) << "[" << ValueToString(operands[0]) << "]";
+				break;
+			case Opcode::StoreElement:
+				m_Output << " " << IRTypeToString(operands[1]->GetType()) << " " << ValueToString(operands[1]) << ", " << ArrayToString(instruction->GetSymbol()) << "[" << ValueToString(operands[0]) << "]";
+				break;
+			case Opcode::BoundsCheck:
+				m_Output << " " << ArrayToString(instruction->GetSymbol()) << "[" << ValueToString(operands[0]) << "]";
+				break;
+			case Opcode::ClearArray:
+				m_Output << " " << ArrayToString(instruction->GetSymbol());
+				break;
+			case Opcode::ArrayKernel:
+			{
+				const ArrayKernel& kernel = m_Function->GetKernels()[instruction->GetOffset()];
+				m_Output << " " << OpcodeToString(kernel.Operation) << " " << IRTypeToString(kernel.ElementType) << " " << ArrayToString(kernel.Target) << ", " << ArrayToString(kernel.Left) << ", " << (kernel.Right.empty() ? ValueToString(operands[2]) : ArrayToString(kernel.Right));
+				m_Output << " [" << ValueToString(operands[0]) << ", " << ValueToString(operands[1]) << ")";
+				break;
+			}
+			case Opcode::Box:
+				m_Output << " " << IRTypeToString(operands[0]->GetType()) << " " << ValueToString(operands[0]);
+				break;
+			case Opcode::LoadBox:
+				m_Output << " " << IRTypeToString(instruction->GetType()) << " " << ValueToString(operands[0]);
+				break;
+			case Opcode::StoreBox:
+				m_Output << " " << IRTypeToString(operands[1]->GetType()) << " " << ValueToString(operands[1]) << ", " << ValueToString(operands[0]);
+				break;
+			case Opcode::Phi:
+				m_Output << " " << IRTypeToString(instruction->GetType());
+				for (size_t i = 0; i < operands.size(); i++)
+					m_Output << (i ? ", [ " : " [ ") << ValueToString(operands[i]) << ", %" << blocks[i]->GetName() << " ]";
+				break;
+			case Opcode::Call:
+				m_Output << " " << IRTypeToString(instruction->GetType()) << " @" << instruction->GetSymbol() << "(";
+				for (size_t i = 0; i < operands.size(); i++)
+					m_Output << (i ? ", " : "") << IRTypeToString(operands[i]->GetType()) << " " << ValueToString(operands[i]);
+				m_Output << ")";
+				break;
+			case Opcode::Jump:
+				m_Output << " label %" << blocks[0]->GetName();
+				break;
+			case Opcode::Branch:
+				m_Output << " bool " << ValueToString(operands[0]) << ", label %" << blocks[0]->GetName() << ", label %" << blocks[1]->GetName();
+				break;
+			case Opcode::Return:
+				if (operands.empty())
+					m_Output << " void";
+				else
+					m_Output << " " << IRTypeToString(operands[0]->GetType()) << " " << ValueToString(operands[0]);
+				break;
+			case Opcode::Unreachable:
+				break;
+			default:
+				m_Output << " " << IRTypeToString(instruction->GetType());
+				for (size_t i = 0; i < operands.size(); i++)
+					m_Output << (i ? ", " : " ") << ValueToString(operands[i]);
+				break;
+			}
+
+			m_Output << "\n";
+		}
+
+		std::string IRPrinter::ValueToString(const Value* value) const
+		{
+			switch (value->GetValueKind())
+			{
+			case ValueKind::Constant:
+				return ConstantToString(static_cast<const Constant*>(value));
+			case ValueKind::Argument:
+				return "%" + static_cast<const Argument*>(value)->GetName();
+			case ValueKind::Instruction:
+			{
+				auto it = m_ValueNumbers.find(value);
+				return (it != m_ValueNumbers.end() ? "%" + std::to_string(it->second) : "%<invalid>");
+			}
+			default:
+				return "<unknown>";
+			}
+		}
+
+		std::string IRPrinter::ArrayToString(const std::string& symbol) const
+		{
+			return (m_Function && m_Function->GetArray(symbol) ? "%" : "@") + symbol;
+		}
+
+		std::string IRPrinter::ConstantToString(const Constant* constant) const
+		{
+			switch (constant->GetType())
+			{
+			case Type::Integer:
+				return std::to_string((long long)constant->GetValue<IntegerType>());
+			case Type::Float:
+			{
+				char buffer[32];
+				auto result = std::to_chars(buffer, buffer + sizeof(buffer), constant->GetValue<FloatType>());
+				std::string text(buffer, result.ptr);
+				// Keep Floats distinguishable from Integers
+				if (text.find_first_of(".eEn") == std::string::npos)
+					text += ".0";
+				return text;
+			}
+			case Type::String:
+			{
+				std::string text = "\"";
+				for (char c : constant->GetValue<StringType>())
+				{
+					if (c == '"' || c == '\\')
+						text += '\\';
+					if (c == '\n')
+						text += "\\n";
+					else if (c == '\t')
+						text += "\\t";
+					else
+						text += c;
+				}
+				return text + "\"";
+			}
+			case Type::Boolean:
+				return (constant->GetValue<BooleanType>() ? "true" : "false");
+			default:
+				return "<unknown>";
+			}
+		}
+	}
+}
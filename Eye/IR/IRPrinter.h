@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Eye/IR/Module.h"
+
+#include <sstream>
+#include <unordered_map>
+
+namespace Eye
+{
+	namespace IR
+	{
+		/*
+			IRPrinter
+				Textual Dump of a Module, Values are numbered %0, %1, ... per Function & Arguments keep their Names.
+
+				function int @add(int %x, int %y)
+				{
+				entry:
+					%0 = add int %x, %y
+					ret int %0
+				}
+		*/
+		class IRPrinter
+		{
+		public:
+			std::string Print(const Module* module);
+
+		private:
+			void PrintFunction(const Function* function);
+			void PrintInstruction(const Instruction* instruction);
+			std::string ValueToString(const Value* value) const;
+			// Function Arrays print as %Name, Module Arrays as @Name
+			std::string ArrayToString(const std::string& symbol) const;
+			std::string ConstantToString(const Constant* constant) const;
+
+		private:
+			std::ostringstream m_Output;
+			std::unordered_map<const Value*, size_t> m_ValueNumbers;
+			const Function* m_Function = nullptr;
+		};
+	}
+}
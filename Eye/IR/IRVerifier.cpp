@@ -0,0 +1,337 @@
+#include "Eye/IR/IRVerifier.h"
+#include "Eye/Utility/Logger.h"
+#include "Eye/Error/Exceptions/InvalidIRException.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace Eye
+{
+	namespace IR
+	{
+		std::expected<bool, Error::Error> IRVerifier::Verify(const Module* module)
+		{
+			m_Module = module;
+
+			try
+			{
+				for (const auto& function : module->GetFunctions())
+					VerifyFunction(function.get());
+			}
+			catch (const Error::Exceptions::EyeException& ex)
+			{
+				return std::unexpected(ex.GetError());
+			}
+			catch (...)
+			{
+				EYE_LOG_CRITICAL("EYEIRVerifier->Verify Unsupported Exception!");
+			}
+
+			m_Function = nullptr;
+			return true;
+		}
+
+		void IRVerifier::VerifyFunction(const Function* function)
+		{
+			m_Function = function;
+
+			if (function->GetBlocks().empty())
+				Fail("Function has no Blocks");
+			if (!function->GetEntryBlock()->GetPredecessors().empty())
+				Fail("Entry Block '" + function->GetEntryBlock()->GetName() + "' has Predecessors");
+
+			std::unordered_set<const BasicBlock*> blocks;
+			for (const auto& block : function->GetBlocks())
+				blocks.insert(block.get());
+
+			// Every Edge shows up once in the Successor's Predecessor List
+			std::unordered_map<const BasicBlock*, std::vector<const BasicBlock*>> edges;
+			for (const auto& block : function->GetBlocks())
+			{
+				VerifyBlock(block.get());
+				for (const BasicBlock* successor : block->GetSuccessors())
+				{
+					if (!blocks.contains(successor))
+						Fail("Block '" + block->GetName() + "' branches out of its Function");
+					edges[successor].push_back(block.get());
+				}
+			}
+
+			for (const auto& block : function->GetBlocks())
+			{
+				std::vector<const BasicBlock*> expected = edges[block.get()];
+				std::vector<const BasicBlock*> actual(block->GetPredecessors().begin(), block->GetPredecessors().end());
+				std::sort(expected.begin(), expected.end());
+				std::sort(actual.begin(), actual.end());
+				if (expected != actual)
+					Fail("Predecessors of Block '" + block->GetName() + "' do not match its incoming Edges");
+			}
+
+			VerifyDominance(function, DominatorTree(function));
+		}
+
+		void IRVerifier::VerifyBlock(const BasicBlock* block)
+		{
+			if (block->GetParent() != m_Function)
+				Fail("Block '" + block->GetName() + "' belongs to another Function");
+			if (!block->GetTerminator())
+				Fail("Block '" + block->GetName() + "' does not end with a Terminator");
+
+			bool phis = true;
+			for (const auto& instruction : block->GetInstructions())
+			{
+				if (instruction->GetParent() != block)
+					Fail("Instruction '" + std::string(OpcodeToString(instruction->GetOpcode())) + "' in Block '" + block->GetName() + "' has a wrong Parent");
+				if (instruction->IsTerminator() && instruction.get() != block->GetTerminator())
+					Fail("Terminator in the Middle of Block '" + block->GetName() + "'");
+
+				if (instruction->GetOpcode() == Opcode::Phi)
+				{
+					if (!phis)
+						Fail("Phi after non-Phi Instruction in Block '" + block->GetName() + "'");
+
+					std::vector<const BasicBlock*> incoming(instruction->GetBlocks().begin(), instruction->GetBlocks().end());
+					std::vector<const BasicBlock*> predecessors(block->GetPredecessors().begin(), block->GetPredecessors().end());
+					std::sort(incoming.begin(), incoming.end());
+					std::sort(predecessors.begin(), predecessors.end());
+					if (incoming != predecessors)
+						Fail("Phi Incoming Blocks do not match the Predecessors of Block '" + block->GetName() + "'");
+				}
+				else
+				{
+					phis = false;
+				}
+
+				VerifyInstruction(instruction.get());
+			}
+		}
+
+		void IRVerifier::VerifyInstruction(const Instruction* instruction)
+		{
+			const std::vector<Value*>& operands = instruction->GetOperands();
+			const std::vector<BasicBlock*>& blocks = instruction->GetBlocks();
+			std::string name(OpcodeToString(instruction->GetOpcode()));
+			Type type = instruction->GetType();
+
+			for (const Value* operand : operands)
+				VerifyOperand(instruction, operand);
+
+			auto expect = [&](bool condition)
+				{
+					if (!condition)
+						Fail("Invalid '" + name + "' Instruction of Type " + IRTypeToString(type) + " in Block '" + instruction->GetParent()->GetName() + "'");
+				};
+
+			auto operandsOfType = [&](size_t count, Type operandType)
+				{
+					return operands.size() == count && std::all_of(operands.begin(), operands.end(), [operandType](const Value* operand) { return operand->GetType() == operandType; });
+				};
+
+			if (instruction->GetOpcode() != Opcode::Phi && !instruction->IsTerminator())
+				expect(blocks.empty());
+
+			switch (instruction->GetOpcode())
+			{
+			case Opcode::Add:
+			case Opcode::Sub:
+			case Opcode::Mul:
+			case Opcode::Div:
+			case Opcode::Mod:
+				expect((type == Type::Integer || type == Type::Float) && operandsOfType(2, type));
+				break;
+			case Opcode::Neg:
+				expect((type == Type::Integer || type == Type::Float) && operandsOfType(1, type));
+				break;
+			case Opcode::And:
+			case Opcode::Or:
+			case Opcode::Xor:
+			case Opcode::Shl:
+			case Opcode::Shr:
+				expect(type == Type::Integer && operandsOfType(2, Type::Integer));
+				break;
+			case Opcode::Not:
+				expect(type == Type::Integer && operandsOfType(1, Type::Integer));
+				break;
+			case Opcode::LogicalNot:
+				expect(type == Type::Boolean && operandsOfType(1, Type::Boolean));
+				break;
+			case Opcode::Eq:
+			case Opcode::Ne:
+				expect(type == Type::Boolean && operands.size() == 2 && operandsOfType(2, operands[0]->GetType()));
+				break;
+			case Opcode::Lt:
+			case Opcode::Gt:
+			case Opcode::Le:
+			case Opcode::Ge:
+				expect(type == Type::Boolean && operands.size() == 2 && operands[0]->GetType() != Type::Boolean && operandsOfType(2, operands[0]->GetType()));
+				break;
+			case Opcode::Concat:
+				expect(type == Type::String && operandsOfType(2, Type::String));
+				break;
+			case Opcode::IntToFloat:
+				expect(type == Type::Float && operandsOfType(1, Type::Integer));
+				break;
+			case Opcode::BoolToInt:
+				expect(type == Type::Integer && operandsOfType(1, Type::Boolean));
+				break;
+			case Opcode::Load:
+			{
+				const GlobalVariable* global = m_Module->GetGlobal(instruction->GetSymbol());
+				expect(global && operands.empty() && instruction->GetOffset() < global->Slots.size() && type == global->Slots[instruction->GetOffset()]);
+				break;
+			}
+			case Opcode::Store:
+			{
+				const GlobalVariable* global = m_Module->GetGlobal(instruction->GetSymbol());
+				expect(global && type == Type::Void && instruction->GetOffset() < global->Slots.size() && operandsOfType(1, global->Slots[instruction->GetOffset()]));
+				break;
+			}
+			case Opcode::LoadElement:
+			{
+				const ArrayVariable* array = m_Module->GetArray(m_Function, instruction->GetSymbol());
+				expect(array && type == array->ElementType && operandsOfType(1, Type::Integer));
+				break;
+			}
+			case Opcode::StoreElement:
+			{
+				const ArrayVariable* array = m_Module->GetArray(m_Function, instruction->GetSymbol());
+				expect(array && type == Type::Void && operands.size() == 2 && operands[0]->GetType() == Type::Integer && operands[1]->GetType() == array->ElementType);
+				break;
+			}
+			case Opcode::BoundsCheck:
+				expect(m_Module->GetArray(m_Function, instruction->GetSymbol()) && type == Type::Void && operandsOfType(1, Type::Integer));
+				break;
+			case Opcode::ClearArray:
+				expect(m_Module->GetArray(m_Function, instruction->GetSymbol()) && type == Type::Void && operands.empty());
+				break;
+			case Opcode::ArrayKernel:
+			{
+				expect(type == Type::Void && instruction->GetOffset() < m_Function->GetKernels().size());
+				const ArrayKernel& kernel = m_Function->GetKernels()[instruction->GetOffset()];
+				auto isElementArray = [&](const std::string& name)
+					{
+						const ArrayVariable* array = m_Module->GetArray(m_Function, name);
+						return array && array->ElementType == kernel.ElementType;
+					};
+
+				bool broadcast = kernel.Right.empty();
+				bool operation = (kernel.ElementType == Type::Float ? (kernel.Operation == Opcode::Add || kernel.Operation == Opcode::Sub || kernel.Operation == Opcode::Mul || kernel.Operation == Opcode::Div)
+					: kernel.ElementType == Type::Integer && (kernel.Operation == Opcode::Add || kernel.Operation == Opcode::Sub || kernel.Operation == Opcode::Mul || kernel.Operation == Opcode::And || kernel.Operation == Opcode::Or || kernel.Operation == Opcode::Xor));
+				expect(operation && instruction->GetSymbol() == kernel.Target && isElementArray(kernel.Target) && isElementArray(kernel.Left) && (broadcast || isElementArray(kernel.Right)));
+				expect(operands.size() == (broadcast ? 3 : 2) && operands[0]->GetType() == Type::Integer && operands[1]->GetType() == Type::Integer && (!broadcast || operands[2]->GetType() == kernel.ElementType));
+				break;
+			}
+			case Opcode::Box:
+				expect(type == Type::Integer && operands.size() == 1 && operands[0]->GetType() != Type::Void);
+				break;
+			case Opcode::LoadBox:
+				expect(type != Type::Void && operandsOfType(1, Type::Integer));
+				break;
+			case Opcode::StoreBox:
+				expect(type == Type::Void && operands.size() == 2 && operands[0]->GetType() == Type::Integer && operands[1]->GetType() != Type::Void);
+				break;
+			case Opcode::Phi:
+				expect(type != Type::Void && operands.size() == blocks.size() && operandsOfType(operands.size(), type));
+				break;
+			case Opcode::Call:
+			{
+				const Function* callee = m_Module->GetFunction(instruction->GetSymbol());
+				expect(callee && type == callee->GetReturnType() && operands.size() == callee->GetArguments().size());
+				for (size_t i = 0; i < operands.size(); i++)
+					expect(operands[i]->GetType() == callee->GetArguments()[i]->GetType());
+				break;
+			}
+			case Opcode::Jump:
+				expect(type == Type::Void && operands.empty() && blocks.size() == 1);
+				break;
+			case Opcode::Branch:
+				expect(type == Type::Void && operandsOfType(1, Type::Boolean) && blocks.size() == 2);
+				break;
+			case Opcode::Return:
+				if (m_Function->GetReturnType() == Type::Void)
+					expect(type == Type::Void && operands.empty() && blocks.empty());
+				else
+					expect(type == Type::Void && operandsOfType(1, m_Function->GetReturnType()) && blocks.empty());
+				break;
+			case Opcode::Unreachable:
+				expect(type == Type::Void && operands.empty() && blocks.empty());
+				break;
+			default:
+				Fail("Unknown Opcode in Block '" + instruction->GetParent()->GetName() + "'");
+			}
+		}
+
+		void IRVerifier::VerifyOperand(const Instruction* instruction, const Value* operand)
+		{
+			if (!operand)
+				Fail("Null Operand in Block '" + instruction->GetParent()->GetName() + "'");
+
+			if (operand->GetValueKind() == ValueKind::Argument)
+			{
+				const Argument* argument = static_cast<const Argument*>(operand);
+				if (argument->GetIndex() >= m_Function->GetArguments().size() || m_Function->GetArguments()[argument->GetIndex()].get() != argument)
+					Fail("Argument '" + argument->GetName() + "' used outside of its Function");
+			}
+			else if (operand->GetValueKind() == ValueKind::Instruction)
+			{
+				const Instruction* definition = static_cast<const Instruction*>(operand);
+				if (!definition->GetParent() || definition->GetParent()->GetParent() != m_Function)
+					Fail("Operand in Block '" + instruction->GetParent()->GetName() + "' is not defined in this Function");
+				if (definition->GetType() == Type::Void)
+					Fail("Operand in Block '" + instruction->GetParent()->GetName() + "' does not produce a Value");
+			}
+		}
+
+		void IRVerifier::VerifyDominance(const Function* function, const DominatorTree& dominatorTree)
+		{
+			std::unordered_map<const Instruction*, size_t> positions;
+			for (const auto& block : function->GetBlocks())
+			{
+				for (size_t i = 0; i < block->GetInstructions().size(); i++)
+					positions[block->GetInstructions()[i].get()] = i;
+			}
+
+			for (const auto& block : function->GetBlocks())
+			{
+				// Anything dominates unreachable Code
+				if (!dominatorTree.IsReachable(block.get()))
+					continue;
+
+				for (const auto& instruction : block->GetInstructions())
+				{
+					for (size_t i = 0; i < instruction->GetOperands().size(); i++)
+					{
+						const Value* operand = instruction->GetOperands()[i];
+						if (operand->GetValueKind() != ValueKind::Instruction)
+							continue;
+
+						const Instruction* definition = static_cast<const Instruction*>(operand);
+						bool dominates;
+						if (instruction->GetOpcode() == Opcode::Phi)
+						{
+							// Incoming Values are used at the End of their Predecessor
+							const BasicBlock* predecessor = instruction->GetBlocks()[i];
+							dominates = (!dominatorTree.IsReachable(predecessor) || dominatorTree.Dominates(definition->GetParent(), predecessor));
+						}
+						else if (definition->GetParent() == block.get())
+						{
+							dominates = (positions[definition] < positions[instruction.get()]);
+						}
+						else
+						{
+							dominates = dominatorTree.Dominates(definition->GetParent(), block.get());
+						}
+
+						if (!dominates)
+							Fail("Definition of '" + std::string(OpcodeToString(definition->GetOpcode())) + "' in Block '" + definition->GetParent()->GetName() + "' does not dominate its Use in Block '" + block->GetName() + "'");
+					}
+				}
+			}
+		}
+
+		void IRVerifier::Fail(const std::string& message) const
+		{
+			throw Error::Exceptions::InvalidIRException("@" + (m_Function ? m_Function->GetName() : std::string()) + ": " + message, Error::ErrorType::IRVerifierInvalid, EyeSource());
+		}
+	}
+}
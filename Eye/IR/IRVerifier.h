@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Eye/IR/Module.h"
+#include "Eye/IR/DominatorTree.h"
+#include "Eye/Error/Error.h"
+
+#include <expected>
+#include <unordered_map>
+
+namespace Eye
+{
+	namespace IR
+	{
+		/*
+			IRVerifier
+				Checks the Invariants every Pass may rely on:
+				Blocks end in exactly one Terminator & start with their Phis, Predecessor Lists match the Terminators,
+				Phis have one Incoming per Predecessor, Operand Types match their Opcode & every Definition dominates its Uses.
+		*/
+		class IRVerifier
+		{
+		public:
+			std::expected<bool, Error::Error> Verify(const Module* module);
+
+		private:
+			void VerifyFunction(const Function* function);
+			void VerifyBlock(const BasicBlock* block);
+			void VerifyInstruction(const Instruction* instruction);
+			void VerifyDominance(const Function* function, const DominatorTree& dominatorTree);
+			void VerifyOperand(const Instruction* instruction, const Value* operand);
+
+			[[noreturn]] void Fail(const std::string& message) const;
+
+		private:
+			const Module* m_Module = nullptr;
+			const Function* m_Function = nullptr;
+		};
+	}
+}
@@ -0,0 +1,219 @@
+#include "Eye/IR/Inliner.h"
+
+#include <algorithm>
+
+namespace Eye
+{
+	namespace IR
+	{
+		void Inliner::Inline(Module* module, const InlinerProperties& properties)
+		{
+			m_Module = module;
+			m_Properties = properties;
+			m_InlinedCallCount = 0;
+
+			m_CallGraph.clear();
+			for (const auto& function : module->GetFunctions())
+			{
+				auto& callees = m_CallGraph[function.get()];
+				for (const auto& block : function->GetBlocks())
+				{
+					for (const auto& instruction : block->GetInstructions())
+					{
+						if (instruction->GetOpcode() == Opcode::Call)
+						{
+							const Function* callee = module->GetFunction(instruction->GetSymbol());
+							if (callee && std::find(callees.begin(), callees.end(), callee) == callees.end())
+								callees.push_back(callee);
+						}
+					}
+				}
+			}
+
+			for (Function* function : GetBottomUpOrder())
+				InlineFunction(function);
+
+			m_Module = nullptr;
+		}
+
+		void Inliner::InlineFunction(Function* function)
+		{
+			std::vector<std::pair<Instruction*, const Function*>> calls;
+			for (const auto& block : function->GetBlocks())
+			{
+				for (const auto& instruction : block->GetInstructions())
+				{
+					if (instruction->GetOpcode() != Opcode::Call)
+						continue;
+
+					const Function* callee = m_Module->GetFunction(instruction->GetSymbol());
+					// Arrays belong to one Call & Kernels to one Function, Callees holding some stay out of line
+					if (callee && callee != function && callee->GetArrays().empty() && callee->GetKernels().empty() && !IsRecursive(callee) && GetCost(callee) <= m_Properties.SizeBudget)
+						calls.push_back({ instruction.get(), callee });
+				}
+			}
+
+			for (const auto& [call, callee] : calls)
+				InlineCall(function, call, callee);
+		}
+
+		void Inliner::InlineCall(Function* caller, Instruction* call, const Function* callee)
+		{
+			BasicBlock* block = call->GetParent();
+
+			std::unordered_map<const BasicBlock*, BasicBlock*> blocks;
+			for (const auto& calleeBlock : callee->GetBlocks())
+				blocks[calleeBlock.get()] = caller->CreateBlock(callee->GetName() + "." + calleeBlock->GetName());
+			BasicBlock* continuation = caller->CreateBlock(callee->GetName() + ".cont");
+
+			// Everything after the Call, including the Terminator, continues once the inlined Body returns
+			for (BasicBlock* successor : block->GetSuccessors())
+				successor->ReplacePredecessor(block, continuation);
+			block->MoveInstructionsAfter(call, continuation);
+
+			std::unordered_map<const Value*, Value*> values;
+			for (size_t i = 0; i < callee->GetArguments().size(); i++)
+				values[callee->GetArguments()[i].get()] = call->GetOperands()[i];
+
+			std::vector<Instruction*> clones;
+			std::vector<std::pair<Value*, BasicBlock*>> returns;
+			for (const auto& calleeBlock : callee->GetBlocks())
+			{
+				BasicBlock* clonedBlock = blocks[calleeBlock.get()];
+				for (const BasicBlock* predecessor : calleeBlock->GetPredecessors())
+					clonedBlock->AddPredecessor(blocks[predecessor]);
+
+				for (const auto& instruction : calleeBlock->GetInstructions())
+				{
+					if (instruction->GetOpcode() == Opcode::Return)
+					{
+						if (!instruction->GetOperands().empty())
+							returns.push_back({ instruction->GetOperands()[0], clonedBlock });
+						clonedBlock->Append(std::make_unique<Instruction>(Opcode::Jump, Type::Void, std::vector<Value*>{}, std::vector<BasicBlock*>{ continuation }));
+						continuation->AddPredecessor(clonedBlock);
+						continue;
+					}
+
+					std::vector<BasicBlock*> targets;
+					for (const BasicBlock* target : instruction->GetBlocks())
+						targets.push_back(blocks[target]);
+
+					// Operands are remapped once every Instruction exists, Phis may refer to later ones
+					std::vector<Value*> operands = instruction->GetOperands();
+					Instruction* clone = clonedBlock->Append(std::make_unique<Instruction>(instruction->GetOpcode(), instruction->GetType(), std::move(operands), std::move(targets), instruction->GetSymbol(), instruction->GetOffset()));
+					values[instruction.get()] = clone;
+					clones.push_back(clone);
+				}
+			}
+
+			auto remap = [&](Value* value) -> Value*
+				{
+					auto it = values.find(value);
+					if (it != values.end())
+						return it->second;
+					Value* clone = caller->CloneConstant(static_cast<const Constant*>(value));
+					values[value] = clone;
+					return clone;
+				};
+
+			for (Instruction* clone : clones)
+			{
+				for (Value*& operand : clone->GetOperands())
+					operand = remap(operand);
+			}
+
+			std::unique_ptr<Instruction> removedCall = block->Remove(call);
+			BasicBlock* entry = blocks[callee->GetEntryBlock()];
+			block->Append(std::make_unique<Instruction>(Opcode::Jump, Type::Void, std::vector<Value*>{}, std::vector<BasicBlock*>{ entry }));
+			entry->AddPredecessor(block);
+
+			if (callee->GetReturnType() != Type::Void)
+			{
+				Value* result;
+				if (returns.size() == 1)
+				{
+					result = remap(returns.front().first);
+				}
+				else if (returns.empty())
+				{
+					// The Callee never returns, the Continuation is unreachable & only needs a Value of the right Type
+					result = caller->GetDefaultConstant(callee->GetReturnType());
+				}
+				else
+				{
+					Instruction* phi = continuation->InsertPhi(std::make_unique<Instruction>(Opcode::Phi, callee->GetReturnType()));
+					for (const auto& [value, returnBlock] : returns)
+						phi->AddIncoming(remap(value), returnBlock);
+					result = phi;
+				}
+
+				caller->ReplaceAllUses(removedCall.get(), result);
+			}
+
+			m_InlinedCallCount++;
+		}
+
+		size_t Inliner::GetCost(const Function* function) const
+		{
+			size_t cost = 0;
+			for (const auto& block : function->GetBlocks())
+			{
+				for (const auto& instruction : block->GetInstructions())
+				{
+					switch (instruction->GetOpcode())
+					{
+					case Opcode::Phi:
+					case Opcode::Jump:
+					case Opcode::Return:
+					case Opcode::Unreachable:
+						break;
+					case Opcode::Call:
+						cost += m_Properties.CallCost;
+						break;
+					default:
+						cost++;
+						break;
+					}
+				}
+			}
+			return cost;
+		}
+
+		bool Inliner::IsRecursive(const Function* function) const
+		{
+			std::unordered_set<const Function*> visited;
+			std::vector<const Function*> worklist(m_CallGraph.at(function).begin(), m_CallGraph.at(function).end());
+			while (!worklist.empty())
+			{
+				const Function* current = worklist.back();
+				worklist.pop_back();
+				if (current == function)
+					return true;
+				if (!visited.insert(current).second)
+					continue;
+				worklist.insert(worklist.end(), m_CallGraph.at(current).begin(), m_CallGraph.at(current).end());
+			}
+			return false;
+		}
+
+		std::vector<Function*> Inliner::GetBottomUpOrder() const
+		{
+			std::vector<Function*> order;
+			std::unordered_set<const Function*> visited;
+
+			// Post-Order over the Call Graph, Cycles are cut where they are first revisited
+			auto visit = [&](auto& self, Function* function) -> void
+				{
+					if (!visited.insert(function).second)
+						return;
+					for (const Function* callee : m_CallGraph.at(function))
+						self(self, m_Module->GetFunction(callee->GetName()));
+					order.push_back(function);
+				};
+
+			for (const auto& function : m_Module->GetFunctions())
+				visit(visit, function.get());
+			return order;
+		}
+	}
+}
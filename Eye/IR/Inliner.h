@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Eye/IR/Module.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Eye
+{
+	namespace IR
+	{
+		struct InlinerProperties
+		{
+			// Largest Callee Cost substituted at a Call Site
+			size_t SizeBudget = 24;
+			// Calls keep their Overhead in the inlined Body & count more than plain Instructions
+			size_t CallCost = 4;
+		};
+
+		/*
+			Inliner
+				Replaces Calls to small non-recursive Functions with a Copy of their Body.
+				Callees are handled before their Callers so Cost reflects already inlined Bodies.
+				Default Parameters are materialized at the Call Site by IRBuilder, inlined Bodies receive them as plain Arguments.
+		*/
+		class Inliner
+		{
+		public:
+			void Inline(Module* module, const InlinerProperties& properties = {});
+			inline size_t GetInlinedCallCount() const { return m_InlinedCallCount; }
+
+		private:
+			void InlineFunction(Function* function);
+			void InlineCall(Function* caller, Instruction* call, const Function* callee);
+			size_t GetCost(const Function* function) const;
+			bool IsRecursive(const Function* function) const;
+			std::vector<Function*> GetBottomUpOrder() const;
+
+		private:
+			Module* m_Module = nullptr;
+			InlinerProperties m_Properties;
+			std::unordered_map<const Function*, std::vector<const Function*>> m_CallGraph;
+			size_t m_InlinedCallCount = 0;
+		};
+	}
+}
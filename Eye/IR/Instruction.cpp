@@ -0,0 +1,108 @@
+#include "Eye/IR/Instruction.h"
+#include "Eye/Utility/Logger.h"
+
+namespace Eye
+{
+	namespace IR
+	{
+		std::string_view OpcodeToString(Opcode opcode)
+		{
+			switch (opcode)
+			{
+			case Opcode::Add:
+				return "add";
+			case Opcode::Sub:
+				return "sub";
+			case Opcode::Mul:
+				return "mul";
+			case Opcode::Div:
+				return "div";
+			case Opcode::Mod:
+				return "mod";
+			case Opcode::Neg:
+				return "neg";
+			case Opcode::And:
+				return "and";
+			case Opcode::Or:
+				return "or";
+			case Opcode::Xor:
+				return "xor";
+			case Opcode::Shl:
+				return "shl";
+			case Opcode::Shr:
+				return "shr";
+			case Opcode::Not:
+				return "not";
+			case Opcode::LogicalNot:
+				return "lnot";
+			case Opcode::Eq:
+				return "eq";
+			case Opcode::Ne:
+				return "ne";
+			case Opcode::Lt:
+				return "lt";
+			case Opcode::Gt:
+				return "gt";
+			case Opcode::Le:
+				return "le";
+			case Opcode::Ge:
+				return "ge";
+			case Opcode::Concat:
+				return "concat";
+			case Opcode::IntToFloat:
+				return "itof";
+			case Opcode::BoolToInt:
+				return "btoi";
+			case Opcode::Load:
+				return "load";
+			case Opcode::Store:
+				return "store";
+			case Opcode::LoadElement:
+				return "loadelem";
+			case Opcode::StoreElement:
+				return "storeelem";
+			case Opcode::BoundsCheck:
+				return "boundscheck";
+			case Opcode::ClearArray:
+				return "cleararray";
+			case Opcode::ArrayKernel:
+				return "arraykernel";
+			case Opcode::Box:
+				return "box";
+			case Opcode::LoadBox:
+				return "loadbox";
+			case Opcode::StoreBox:
+				return "storebox";
+			case Opcode::Phi:
+				return "phi";
+			case Opcode::Call:
+				return "call";
+			case Opcode::Jump:
+				return "jmp";
+			case Opcode::Branch:
+				return "br";
+			case Opcode::Return:
+				return "ret";
+			case Opcode::Unreachable:
+				return "unreachable";
+			default:
+				break;
+			}
+
+			EYE_LOG_CRITICAL("EYEIR OpcodeToString Unknown Opcode!");
+		}
+
+		void Instruction::RemoveIncoming(BasicBlock* block)
+		{
+			for (size_t i = 0; i < m_Blocks.size(); i++)
+			{
+				if (m_Blocks[i] == block)
+				{
+					m_Blocks.erase(m_Blocks.begin() + i);
+					m_Operands.erase(m_Operands.begin() + i);
+					return;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Eye/IR/Value.h"
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace Eye
+{
+	namespace IR
+	{
+		class BasicBlock;
+
+		enum class Opcode
+		{
+			// Arithmetic, Operands & Result share one Type (int or float)
+			Add,
+			Sub,
+			Mul,
+			Div,
+			Mod,
+			Neg,
+			// Bitwise, int only
+			And,
+			Or,
+			Xor,
+			Shl,
+			Shr,
+			Not,
+			// bool only
+			LogicalNot,
+			// Operands share one Type, Result is bool
+			Eq,
+			Ne,
+			Lt,
+			Gt,
+			Le,
+			Ge,
+			// str only
+			Concat,
+			// Conversions
+			IntToFloat,
+			BoolToInt,
+			// Globals, Symbol names the Global & Offset the Slot within it
+			Load,
+			Store,
+			// Arrays, Symbol names the Array & Operand 0 is the Element Index, StoreElement stores Operand 1
+			LoadElement,
+			StoreElement,
+			// Traps unless 0 <= Operand 0 < Length of the Array named by Symbol
+			BoundsCheck,
+			// Resets every Element of the Array named by Symbol to its Default
+			ClearArray,
+			// Runs the Function's GetKernels()[Offset] for Indices in [Operand 0, Operand 1), Operand 2 is the broadcast right Operand if any
+			// Symbol names the Target, traps before writing unless the Range is empty or lies within every Array
+			ArrayKernel,
+			// Cells shared by a Function & its Closures, Box allocates one holding Operand 0 & yields its int Handle
+			Box,
+			// Operand 0 is the Handle, StoreBox stores Operand 1
+			LoadBox,
+			StoreBox,
+			// Operands pair with GetBlocks(): the Value flowing in from each Predecessor
+			Phi,
+			// Symbol names the Callee
+			Call,
+			// Terminators, GetBlocks() are the Successors
+			Jump,
+			Branch,
+			Return,
+			Unreachable,
+		};
+
+		std::string_view OpcodeToString(Opcode opcode);
+
+		/*
+			Instruction
+				A Value computed by an Opcode over Operands, void-typed Instructions produce no Value.
+		*/
+		class Instruction : public Value
+		{
+		public:
+			Instruction(Opcode opcode, Type type, std::vector<Value*>&& operands = {}, std::vector<BasicBlock*>&& blocks = {}, const std::string& symbol = "", uint32_t offset = 0)
+				: Value(ValueKind::Instruction, type), m_Opcode(opcode), m_Operands(std::move(operands)), m_Blocks(std::move(blocks)), m_Symbol(symbol), m_Offset(offset)
+			{
+			}
+
+			inline Opcode GetOpcode() const { return m_Opcode; }
+			inline const std::vector<Value*>& GetOperands() const { return m_Operands; }
+			inline std::vector<Value*>& GetOperands() { return m_Operands; }
+			inline const std::vector<BasicBlock*>& GetBlocks() const { return m_Blocks; }
+			inline std::vector<BasicBlock*>& GetBlocks() { return m_Blocks; }
+			inline const std::string& GetSymbol() const { return m_Symbol; }
+			inline uint32_t GetOffset() const { return m_Offset; }
+			inline BasicBlock* GetParent() const { return m_Parent; }
+			inline void SetParent(BasicBlock* parent) { m_Parent = parent; }
+
+			inline bool IsTerminator() const { return m_Opcode == Opcode::Jump || m_Opcode == Opcode::Branch || m_Opcode == Opcode::Return || m_Opcode == Opcode::Unreachable; }
+			// Instructions without Side Effects may be moved or dropped once unused
+			inline bool HasSideEffects() const { return IsTerminator() || m_Opcode == Opcode::Store || m_Opcode == Opcode::Call || m_Opcode == Opcode::StoreElement || m_Opcode == Opcode::BoundsCheck || m_Opcode == Opcode::ClearArray || m_Opcode == Opcode::ArrayKernel || m_Opcode == Opcode::StoreBox; }
+
+			inline void AddIncoming(Value* value, BasicBlock* block)
+			{
+				m_Operands.push_back(value);
+				m_Blocks.push_back(block);
+			}
+
+			void RemoveIncoming(BasicBlock* block);
+
+		private:
+			Opcode m_Opcode;
+			std::vector<Value*> m_Operands;
+			std::vector<BasicBlock*> m_Blocks;
+			std::string m_Symbol;
+			uint32_t m_Offset;
+			BasicBlock* m_Parent = nullptr;
+		};
+	}
+}
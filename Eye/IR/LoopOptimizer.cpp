@@ -0,0 +1,846 @@
+#include "Eye/IR/LoopOptimizer.h"
+#include "Eye/IR/DominatorTree.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace Eye
+{
+	namespace IR
+	{
+		using SignedIntegerType = long long;
+
+		// Every Unroll or new Preheader restarts the Analysis, bounds Rounds for deeply nested Loops
+		static constexpr size_t s_MaxRounds = 32;
+		// Array Lengths fit 32 Bits, Bounds Arithmetic on Constants up to this Magnitude can not overflow
+		static constexpr SignedIntegerType s_MaxBoundsConstant = (SignedIntegerType)1 << 32;
+
+		void LoopOptimizer::Optimize(Module* module, const LoopOptimizerProperties& properties)
+		{
+			m_Module = module;
+			m_Properties = properties;
+			m_Statistics = {};
+
+			for (const auto& function : module->GetFunctions())
+				OptimizeFunction(function.get());
+
+			m_Module = nullptr;
+		}
+
+		void LoopOptimizer::OptimizeFunction(Function* function)
+		{
+			for (size_t round = 0; round < s_MaxRounds; round++)
+			{
+				bool restart = false;
+				for (Loop& loop : FindLoops(function))
+				{
+					if (!loop.Preheader)
+					{
+						CreatePreheader(function, loop);
+						restart = true;
+						break;
+					}
+
+					// Before Unrolling, each Copy would keep its own Check
+					if (m_Properties.EliminateBoundsChecks)
+						EliminateBoundsChecks(function, loop);
+					if (m_Properties.HoistInvariants)
+						HoistInvariants(loop);
+					// After Hoisting, Invariant Operands already sit outside the Loop
+					if (m_Properties.Vectorize && Vectorize(function, loop))
+					{
+						restart = true;
+						break;
+					}
+					if (m_Properties.ReduceStrength)
+						ReduceStrength(function, loop);
+					if (m_Properties.Unroll && Unroll(function, loop))
+					{
+						restart = true;
+						break;
+					}
+				}
+
+				if (!restart)
+					break;
+			}
+
+			if (m_Properties.EliminateBoundsChecks)
+				EliminateConstantBoundsChecks(function);
+			RemoveDeadInstructions(function);
+		}
+
+		std::vector<LoopOptimizer::Loop> LoopOptimizer::FindLoops(Function* function) const
+		{
+			DominatorTree dominatorTree(function);
+			std::vector<Loop> loops;
+			std::unordered_map<BasicBlock*, size_t> headers;
+			std::unordered_map<BasicBlock*, size_t> latchCount;
+
+			for (const auto& block : function->GetBlocks())
+			{
+				if (!dominatorTree.IsReachable(block.get()))
+					continue;
+
+				for (BasicBlock* header : block->GetSuccessors())
+				{
+					if (!dominatorTree.Dominates(header, block.get()))
+						continue;
+
+					// Back Edge, the Loop is everything reaching the Latch without passing the Header
+					auto [it, inserted] = headers.insert({ header, loops.size() });
+					if (inserted)
+						loops.push_back({ header, nullptr, block.get(), { header } });
+					Loop& loop = loops[it->second];
+					if (++latchCount[header] > 1)
+						loop.Latch = nullptr;
+
+					std::vector<BasicBlock*> worklist = { block.get() };
+					while (!worklist.empty())
+					{
+						BasicBlock* current = worklist.back();
+						worklist.pop_back();
+						if (!loop.Blocks.insert(current).second)
+							continue;
+						worklist.insert(worklist.end(), current->GetPredecessors().begin(), current->GetPredecessors().end());
+					}
+				}
+			}
+
+			for (Loop& loop : loops)
+			{
+				std::vector<BasicBlock*> outside;
+				for (BasicBlock* predecessor : loop.Header->GetPredecessors())
+				{
+					if (!loop.Blocks.contains(predecessor))
+						outside.push_back(predecessor);
+				}
+
+				if (outside.size() == 1 && outside.front()->GetSuccessors().size() == 1)
+					loop.Preheader = outside.front();
+			}
+
+			std::stable_sort(loops.begin(), loops.end(), [](const Loop& left, const Loop& right) { return left.Blocks.size() < right.Blocks.size(); });
+			return loops;
+		}
+
+		void LoopOptimizer::CreatePreheader(Function* function, Loop& loop)
+		{
+			BasicBlock* header = loop.Header;
+			BasicBlock* preheader = function->CreateBlock(header->GetName() + ".preheader");
+
+			std::vector<BasicBlock*> outside;
+			for (BasicBlock* predecessor : header->GetPredecessors())
+			{
+				if (!loop.Blocks.contains(predecessor))
+					outside.push_back(predecessor);
+			}
+
+			// Phis merge the outside Values in the Preheader & keep one Incoming from it
+			for (const auto& instruction : header->GetInstructions())
+			{
+				if (instruction->GetOpcode() != Opcode::Phi)
+					break;
+
+				std::vector<Value*> values;
+				for (BasicBlock* predecessor : outside)
+				{
+					auto position = std::find(instruction->GetBlocks().begin(), instruction->GetBlocks().end(), predecessor);
+					values.push_back(instruction->GetOperands()[position - instruction->GetBlocks().begin()]);
+					instruction->RemoveIncoming(predecessor);
+				}
+
+				Value* value = values.front();
+				if (std::any_of(values.begin(), values.end(), [value](Value* current) { return current != value; }))
+				{
+					Instruction* phi = preheader->InsertPhi(std::make_unique<Instruction>(Opcode::Phi, instruction->GetType()));
+					for (size_t i = 0; i < outside.size(); i++)
+						phi->AddIncoming(values[i], outside[i]);
+					value = phi;
+				}
+				instruction->AddIncoming(value, preheader);
+			}
+
+			for (BasicBlock* predecessor : outside)
+			{
+				std::vector<BasicBlock*>& targets = predecessor->GetInstructions().back()->GetBlocks();
+				auto position = std::find(targets.begin(), targets.end(), header);
+				*position = preheader;
+				header->RemovePredecessor(predecessor);
+				preheader->AddPredecessor(predecessor);
+			}
+
+			preheader->Append(std::make_unique<Instruction>(Opcode::Jump, Type::Void, std::vector<Value*>{}, std::vector<BasicBlock*>{ header }));
+			header->AddPredecessor(preheader);
+			loop.Preheader = preheader;
+		}
+
+		void LoopOptimizer::HoistInvariants(const Loop& loop)
+		{
+			bool loopHasCall = false;
+			std::unordered_set<std::string> storedGlobals;
+			for (BasicBlock* block : loop.Blocks)
+			{
+				for (const auto& instruction : block->GetInstructions())
+				{
+					if (instruction->GetOpcode() == Opcode::Call)
+						loopHasCall = true;
+					else if (instruction->GetOpcode() == Opcode::Store)
+						storedGlobals.insert(instruction->GetSymbol());
+				}
+			}
+
+			// Hoisting one Instruction can make its Users invariant
+			bool changed = true;
+			while (changed)
+			{
+				changed = false;
+				for (BasicBlock* block : loop.Blocks)
+				{
+					std::vector<Instruction*> hoisted;
+					for (const auto& instruction : block->GetInstructions())
+					{
+						if (!IsHoistable(instruction.get(), loopHasCall, storedGlobals))
+							continue;
+						if (std::all_of(instruction->GetOperands().begin(), instruction->GetOperands().end(), [&](const Value* operand) { return IsInvariant(loop, operand); }))
+							hoisted.push_back(instruction.get());
+					}
+
+					for (Instruction* instruction : hoisted)
+					{
+						loop.Preheader->InsertBeforeTerminator(block->Remove(instruction));
+						m_Statistics.HoistedInstructions++;
+						changed = true;
+					}
+				}
+			}
+		}
+
+		void LoopOptimizer::ReduceStrength(Function* function, const Loop& loop)
+		{
+			if (!loop.Latch || loop.Header->GetPredecessors().size() != 2)
+				return;
+
+			std::vector<InductionVariable> inductionVariables;
+			for (const auto& instruction : loop.Header->GetInstructions())
+			{
+				if (instruction->GetOpcode() != Opcode::Phi)
+					break;
+				if (auto inductionVariable = GetInductionVariable(loop, instruction.get()))
+					inductionVariables.push_back(*inductionVariable);
+			}
+
+			for (const InductionVariable& inductionVariable : inductionVariables)
+			{
+				// Collect 'iv * k', 'k * iv' & 'iv << c'
+				std::vector<std::pair<Instruction*, Value*>> products;
+				for (BasicBlock* block : loop.Blocks)
+				{
+					for (const auto& instruction : block->GetInstructions())
+					{
+						const std::vector<Value*>& operands = instruction->GetOperands();
+						if (instruction->GetOpcode() == Opcode::Mul && operands[0] == inductionVariable.Phi && IsInvariant(loop, operands[1]))
+							products.push_back({ instruction.get(), operands[1] });
+						else if (instruction->GetOpcode() == Opcode::Mul && operands[1] == inductionVariable.Phi && IsInvariant(loop, operands[0]))
+							products.push_back({ instruction.get(), operands[0] });
+						else if (instruction->GetOpcode() == Opcode::Shl && operands[0] == inductionVariable.Phi && operands[1]->GetValueKind() == ValueKind::Constant && static_cast<const Constant*>(operands[1])->GetValue<IntegerType>() < 64)
+							products.push_back({ instruction.get(), function->GetConstant((IntegerType)1 << static_cast<const Constant*>(operands[1])->GetValue<IntegerType>()) });
+					}
+				}
+
+				for (const auto& [product, factor] : products)
+				{
+					// Two's complement Multiplication distributes over the wrapping Add, the new Variable stays exact
+					Value* initial = EmitMultiply(function, loop.Preheader, inductionVariable.Initial, factor);
+					Value* stride = EmitMultiply(function, loop.Preheader, inductionVariable.Step, factor);
+
+					Instruction* phi = loop.Header->InsertPhi(std::make_unique<Instruction>(Opcode::Phi, Type::Integer));
+					Instruction* update = inductionVariable.Update->GetParent()->InsertAfter(inductionVariable.Update, std::make_unique<Instruction>(inductionVariable.Update->GetOpcode(), Type::Integer, std::vector<Value*>{ phi, stride }));
+					phi->AddIncoming(initial, loop.Preheader);
+					phi->AddIncoming(update, loop.Latch);
+
+					function->ReplaceAllUses(product, phi);
+					product->GetParent()->Remove(product);
+					m_Statistics.ReducedInductions++;
+				}
+			}
+		}
+
+		bool LoopOptimizer::Unroll(Function* function, const Loop& loop)
+		{
+			BasicBlock* header = loop.Header;
+			if (!loop.Latch || header->GetPredecessors().size() != 2)
+				return false;
+
+			// Exactly one Exit, taken by the Header's Branch
+			const Instruction* branch = header->GetTerminator();
+			if (branch->GetOpcode() != Opcode::Branch)
+				return false;
+			bool exitWhenTrue = !loop.Blocks.contains(branch->GetBlocks()[0]);
+			BasicBlock* bodyEntry = branch->GetBlocks()[exitWhenTrue ? 1 : 0];
+			BasicBlock* exit = branch->GetBlocks()[exitWhenTrue ? 0 : 1];
+			if (!loop.Blocks.contains(bodyEntry) || loop.Blocks.contains(exit))
+				return false;
+
+			size_t loopSize = 0;
+			for (BasicBlock* block : loop.Blocks)
+			{
+				loopSize += block->GetInstructions().size();
+				if (block == header)
+					continue;
+				for (BasicBlock* successor : block->GetSuccessors())
+				{
+					if (!loop.Blocks.contains(successor))
+						return false;
+				}
+			}
+
+			// The Condition compares a Constant-stepped Induction Variable against a Constant
+			if (branch->GetOperands()[0]->GetValueKind() != ValueKind::Instruction)
+				return false;
+			const Instruction* condition = static_cast<const Instruction*>(branch->GetOperands()[0]);
+			Opcode compare = condition->GetOpcode();
+			if (compare != Opcode::Lt && compare != Opcode::Gt && compare != Opcode::Le && compare != Opcode::Ge && compare != Opcode::Eq && compare != Opcode::Ne)
+				return false;
+
+			bool swapped = (condition->GetOperands()[1]->GetValueKind() == ValueKind::Instruction);
+			Value* variable = condition->GetOperands()[swapped ? 1 : 0];
+			Value* bound = condition->GetOperands()[swapped ? 0 : 1];
+			if (variable->GetValueKind() != ValueKind::Instruction || bound->GetValueKind() != ValueKind::Constant || bound->GetType() != Type::Integer)
+				return false;
+
+			Instruction* phi = static_cast<Instruction*>(variable);
+			if (phi->GetParent() != header || phi->GetOpcode() != Opcode::Phi)
+				return false;
+			std::optional<InductionVariable> inductionVariable = GetInductionVariable(loop, phi);
+			if (!inductionVariable || inductionVariable->Initial->GetValueKind() != ValueKind::Constant || inductionVariable->Step->GetValueKind() != ValueKind::Constant)
+				return false;
+
+			SignedIntegerType value = (SignedIntegerType)static_cast<const Constant*>(inductionVariable->Initial)->GetValue<IntegerType>();
+			SignedIntegerType step = (SignedIntegerType)static_cast<const Constant*>(inductionVariable->Step)->GetValue<IntegerType>();
+			SignedIntegerType limit = (SignedIntegerType)static_cast<const Constant*>(bound)->GetValue<IntegerType>();
+			if (inductionVariable->Update->GetOpcode() == Opcode::Sub)
+				step = (SignedIntegerType)((IntegerType)0 - (IntegerType)step);
+
+			auto evaluate = [&](SignedIntegerType current)
+				{
+					SignedIntegerType left = (swapped ? limit : current);
+					SignedIntegerType right = (swapped ? current : limit);
+					switch (compare)
+					{
+					case Opcode::Lt:
+						return left < right;
+					case Opcode::Gt:
+						return left > right;
+					case Opcode::Le:
+						return left <= right;
+					case Opcode::Ge:
+						return left >= right;
+					case Opcode::Eq:
+						return left == right;
+					default:
+						return left != right;
+					}
+				};
+
+			size_t tripCount = 0;
+			while (evaluate(value) != exitWhenTrue)
+			{
+				if (++tripCount > m_Properties.UnrollMaxTripCount)
+					return false;
+				value = (SignedIntegerType)((IntegerType)value + (IntegerType)step);
+			}
+
+			if (loopSize * (tripCount + 1) > m_Properties.UnrollBudget)
+				return false;
+
+			// Keep the Function's Block Order for the Copies
+			std::vector<BasicBlock*> blocks;
+			for (const auto& block : function->GetBlocks())
+			{
+				if (loop.Blocks.contains(block.get()))
+					blocks.push_back(block.get());
+			}
+
+			// Iteration t runs Copies of all Blocks, the final Copy of the Header only leaves the Loop
+			std::vector<std::unordered_map<const BasicBlock*, BasicBlock*>> copies(tripCount + 1);
+			for (size_t t = 0; t <= tripCount; t++)
+			{
+				for (BasicBlock* block : blocks)
+				{
+					if (t < tripCount || block == header)
+						copies[t][block] = function->CreateBlock(block->GetName());
+				}
+			}
+
+			std::unordered_map<const Value*, Value*> phiValues;
+			for (const auto& instruction : header->GetInstructions())
+			{
+				if (instruction->GetOpcode() != Opcode::Phi)
+					break;
+				auto position = std::find(instruction->GetBlocks().begin(), instruction->GetBlocks().end(), loop.Preheader);
+				phiValues[instruction.get()] = instruction->GetOperands()[position - instruction->GetBlocks().begin()];
+			}
+
+			std::unordered_map<const Value*, Value*> values;
+			auto remap = [&values](Value* value)
+				{
+					auto it = values.find(value);
+					return (it != values.end() ? it->second : value);
+				};
+
+			for (size_t t = 0; t <= tripCount; t++)
+			{
+				values = phiValues;
+				std::vector<Instruction*> clones;
+
+				for (BasicBlock* block : blocks)
+				{
+					if (!copies[t].contains(block))
+						continue;
+
+					BasicBlock* copy = copies[t][block];
+					if (block == header)
+						copy->AddPredecessor(t == 0 ? loop.Preheader : copies[t - 1][loop.Latch]);
+					else
+					{
+						for (BasicBlock* predecessor : block->GetPredecessors())
+							copy->AddPredecessor(copies[t][predecessor]);
+					}
+
+					for (const auto& instruction : block->GetInstructions())
+					{
+						if (block == header && instruction->GetOpcode() == Opcode::Phi)
+							continue;
+
+						if (block == header && instruction->IsTerminator())
+						{
+							copy->Append(std::make_unique<Instruction>(Opcode::Jump, Type::Void, std::vector<Value*>{}, std::vector<BasicBlock*>{ t < tripCount ? copies[t][bodyEntry] : exit }));
+							continue;
+						}
+
+						// Phi Incomings stay in this Iteration, only the Back Edge continues in the next
+						std::vector<BasicBlock*> targets;
+						for (BasicBlock* target : instruction->GetBlocks())
+							targets.push_back((target == header && instruction->IsTerminator()) ? copies[t + 1][header] : copies[t][target]);
+
+						std::vector<Value*> operands = instruction->GetOperands();
+						Instruction* clone = copy->Append(std::make_unique<Instruction>(instruction->GetOpcode(), instruction->GetType(), std::move(operands), std::move(targets), instruction->GetSymbol(), instruction->GetOffset()));
+						values[instruction.get()] = clone;
+						clones.push_back(clone);
+					}
+				}
+
+				for (Instruction* clone : clones)
+				{
+					for (Value*& operand : clone->GetOperands())
+						operand = remap(operand);
+				}
+
+				if (t < tripCount)
+				{
+					for (auto& [phiValue, incoming] : phiValues)
+					{
+						const Instruction* headerPhi = static_cast<const Instruction*>(phiValue);
+						auto position = std::find(headerPhi->GetBlocks().begin(), headerPhi->GetBlocks().end(), loop.Latch);
+						incoming = remap(headerPhi->GetOperands()[position - headerPhi->GetBlocks().begin()]);
+					}
+				}
+			}
+
+			// Values leave the Loop only through the Header, their final Copies replace them
+			std::vector<BasicBlock*>& targets = loop.Preheader->GetInstructions().back()->GetBlocks();
+			std::replace(targets.begin(), targets.end(), header, copies[0][header]);
+			exit->ReplacePredecessor(header, copies[tripCount][header]);
+			for (const auto& instruction : header->GetInstructions())
+			{
+				if (instruction->GetType() != Type::Void)
+					function->ReplaceAllUses(instruction.get(), remap(instruction.get()));
+			}
+
+			for (BasicBlock* block : blocks)
+				function->EraseBlock(block);
+
+			m_Statistics.UnrolledLoops++;
+			return true;
+		}
+
+		void LoopOptimizer::EliminateBoundsChecks(Function* function, const Loop& loop)
+		{
+			if (!loop.Latch || loop.Header->GetPredecessors().size() != 2)
+				return;
+
+			const Instruction* branch = loop.Header->GetTerminator();
+			if (branch->GetOpcode() != Opcode::Branch || branch->GetOperands()[0]->GetValueKind() != ValueKind::Instruction)
+				return;
+			bool exitWhenTrue = !loop.Blocks.contains(branch->GetBlocks()[0]);
+			BasicBlock* bodyEntry = branch->GetBlocks()[exitWhenTrue ? 1 : 0];
+			if (!loop.Blocks.contains(bodyEntry) || bodyEntry->GetPredecessors().size() != 1)
+				return;
+
+			// The Condition compares a Constant-stepped Induction Variable against a Constant
+			const Instruction* condition = static_cast<const Instruction*>(branch->GetOperands()[0]);
+			Opcode compare = condition->GetOpcode();
+			if (compare != Opcode::Lt && compare != Opcode::Gt && compare != Opcode::Le && compare != Opcode::Ge)
+				return;
+
+			bool swapped = (condition->GetOperands()[1]->GetValueKind() == ValueKind::Instruction);
+			Value* variable = condition->GetOperands()[swapped ? 1 : 0];
+			Value* bound = condition->GetOperands()[swapped ? 0 : 1];
+			if (variable->GetValueKind() != ValueKind::Instruction || bound->GetValueKind() != ValueKind::Constant || bound->GetType() != Type::Integer)
+				return;
+
+			Instruction* phi = static_cast<Instruction*>(variable);
+			if (phi->GetParent() != loop.Header || phi->GetOpcode() != Opcode::Phi)
+				return;
+			std::optional<InductionVariable> inductionVariable = GetInductionVariable(loop, phi);
+			if (!inductionVariable || inductionVariable->Initial->GetValueKind() != ValueKind::Constant || inductionVariable->Step->GetValueKind() != ValueKind::Constant)
+				return;
+
+			SignedIntegerType initial = (SignedIntegerType)static_cast<const Constant*>(inductionVariable->Initial)->GetValue<IntegerType>();
+			SignedIntegerType step = (SignedIntegerType)static_cast<const Constant*>(inductionVariable->Step)->GetValue<IntegerType>();
+			SignedIntegerType limit = (SignedIntegerType)static_cast<const Constant*>(bound)->GetValue<IntegerType>();
+			if (std::abs(initial) > s_MaxBoundsConstant || std::abs(step) > s_MaxBoundsConstant || std::abs(limit) > s_MaxBoundsConstant || step == 0)
+				return;
+			if (inductionVariable->Update->GetOpcode() == Opcode::Sub)
+				step = -step;
+
+			// Normalize to 'phi compare limit', holding wherever the Body Entry dominates
+			if (swapped)
+				compare = (compare == Opcode::Lt ? Opcode::Gt : compare == Opcode::Gt ? Opcode::Lt : compare == Opcode::Le ? Opcode::Ge : Opcode::Le);
+			if (exitWhenTrue)
+				compare = (compare == Opcode::Lt ? Opcode::Ge : compare == Opcode::Gt ? Opcode::Le : compare == Opcode::Le ? Opcode::Gt : Opcode::Lt);
+
+			// The Variable only moves away from its Initial Value, the Condition bounds the other Side
+			std::optional<SignedIntegerType> lower = (step > 0 ? std::optional<SignedIntegerType>(initial) : std::nullopt);
+			std::optional<SignedIntegerType> upper = (step < 0 ? std::optional<SignedIntegerType>(initial) : std::nullopt);
+			if (compare == Opcode::Lt || compare == Opcode::Le)
+				upper = std::min(upper.value_or(limit), (compare == Opcode::Lt ? limit - 1 : limit));
+			else
+				lower = std::max(lower.value_or(limit), (compare == Opcode::Gt ? limit + 1 : limit));
+			if (!lower || !upper)
+				return;
+
+			DominatorTree dominatorTree(function);
+			for (BasicBlock* block : loop.Blocks)
+			{
+				if (!dominatorTree.Dominates(bodyEntry, block))
+					continue;
+
+				std::vector<Instruction*> redundant;
+				for (const auto& instruction : block->GetInstructions())
+				{
+					if (instruction->GetOpcode() != Opcode::BoundsCheck)
+						continue;
+
+					// 'phi', 'phi + c', 'c + phi' or 'phi - c'
+					Value* index = instruction->GetOperands()[0];
+					SignedIntegerType offset = 0;
+					if (index->GetValueKind() == ValueKind::Instruction && index != phi)
+					{
+						const Instruction* arithmetic = static_cast<const Instruction*>(index);
+						const std::vector<Value*>& operands = arithmetic->GetOperands();
+						bool add = (arithmetic->GetOpcode() == Opcode::Add), sub = (arithmetic->GetOpcode() == Opcode::Sub);
+						if (!add && !sub)
+							continue;
+
+						size_t constantIndex = (add && operands[0]->GetValueKind() == ValueKind::Constant ? 0 : 1);
+						if (operands[1 - constantIndex] != phi || operands[constantIndex]->GetValueKind() != ValueKind::Constant)
+							continue;
+						offset = (SignedIntegerType)static_cast<const Constant*>(operands[constantIndex])->GetValue<IntegerType>();
+						if (std::abs(offset) > s_MaxBoundsConstant)
+							continue;
+						if (sub)
+							offset = -offset;
+						index = phi;
+					}
+
+					if (index == phi && IsWithinBounds(function, instruction.get(), *lower + offset, *upper + offset))
+						redundant.push_back(instruction.get());
+				}
+
+				for (Instruction* instruction : redundant)
+					block->Remove(instruction);
+				m_Statistics.EliminatedBoundsChecks += redundant.size();
+			}
+		}
+
+		void LoopOptimizer::EliminateConstantBoundsChecks(Function* function)
+		{
+			for (const auto& block : function->GetBlocks())
+			{
+				std::vector<Instruction*> redundant;
+				for (const auto& instruction : block->GetInstructions())
+				{
+					if (instruction->GetOpcode() != Opcode::BoundsCheck || instruction->GetOperands()[0]->GetValueKind() != ValueKind::Constant)
+						continue;
+
+					SignedIntegerType index = (SignedIntegerType)static_cast<const Constant*>(instruction->GetOperands()[0])->GetValue<IntegerType>();
+					if (IsWithinBounds(function, instruction.get(), index, index))
+						redundant.push_back(instruction.get());
+				}
+
+				for (Instruction* instruction : redundant)
+					block->Remove(instruction);
+				m_Statistics.EliminatedBoundsChecks += redundant.size();
+			}
+		}
+
+		bool LoopOptimizer::Vectorize(Function* function, const Loop& loop)
+		{
+			BasicBlock* header = loop.Header;
+			if (!loop.Latch || header->GetPredecessors().size() != 2)
+				return false;
+
+			// The Header holds only the Induction Variable, its Condition & the Branch into the Body
+			const Instruction* branch = header->GetTerminator();
+			if (header->GetInstructions().size() != 3 || branch->GetOpcode() != Opcode::Branch || branch->GetOperands()[0]->GetValueKind() != ValueKind::Instruction)
+				return false;
+			BasicBlock* bodyEntry = branch->GetBlocks()[0];
+			BasicBlock* exit = branch->GetBlocks()[1];
+			if (!loop.Blocks.contains(bodyEntry) || loop.Blocks.contains(exit))
+				return false;
+
+			// 'phi < end' or 'end > phi' with phi counting up by one
+			const Instruction* condition = static_cast<const Instruction*>(branch->GetOperands()[0]);
+			if (condition->GetOpcode() != Opcode::Lt && condition->GetOpcode() != Opcode::Gt)
+				return false;
+			bool swapped = (condition->GetOpcode() == Opcode::Gt);
+			Value* variable = condition->GetOperands()[swapped ? 1 : 0];
+			Value* end = condition->GetOperands()[swapped ? 0 : 1];
+			if (variable->GetValueKind() != ValueKind::Instruction || !IsInvariant(loop, end))
+				return false;
+
+			Instruction* phi = static_cast<Instruction*>(variable);
+			if (phi->GetParent() != header || phi->GetOpcode() != Opcode::Phi)
+				return false;
+			std::optional<InductionVariable> inductionVariable = GetInductionVariable(loop, phi);
+			if (!inductionVariable || inductionVariable->Update->GetOpcode() != Opcode::Add || inductionVariable->Step->GetValueKind() != ValueKind::Constant || static_cast<const Constant*>(inductionVariable->Step)->GetValue<IntegerType>() != 1)
+				return false;
+
+			// The Body runs straight through: Checks & Loads at phi, one Operation & one Store at phi
+			std::vector<const Instruction*> boundsChecks, loads;
+			Instruction* operation = nullptr;
+			Instruction* store = nullptr;
+			for (BasicBlock* block : loop.Blocks)
+			{
+				if (block == header)
+					continue;
+
+				for (const auto& instruction : block->GetInstructions())
+				{
+					switch (instruction->GetOpcode())
+					{
+					case Opcode::Jump:
+						if (!loop.Blocks.contains(instruction->GetBlocks()[0]))
+							return false;
+						break;
+					case Opcode::BoundsCheck:
+					case Opcode::LoadElement:
+						if (instruction->GetOperands()[0] != phi)
+							return false;
+						(instruction->GetOpcode() == Opcode::BoundsCheck ? boundsChecks : loads).push_back(instruction.get());
+						break;
+					case Opcode::StoreElement:
+						if (store || instruction->GetOperands()[0] != phi)
+							return false;
+						store = instruction.get();
+						break;
+					case Opcode::Add:
+					case Opcode::Sub:
+					case Opcode::Mul:
+					case Opcode::Div:
+					case Opcode::And:
+					case Opcode::Or:
+					case Opcode::Xor:
+						if (instruction.get() == inductionVariable->Update)
+							break;
+						if (operation)
+							return false;
+						operation = instruction.get();
+						break;
+					default:
+						return false;
+					}
+				}
+			}
+
+			// int Division traps on Zero, the Kernel would trap before earlier Elements are written
+			if (!store || !operation || store->GetOperands()[1] != operation || (operation->GetOpcode() == Opcode::Div && operation->GetType() != Type::Float))
+				return false;
+
+			auto isLoad = [&loads](const Value* value) { return std::find(loads.begin(), loads.end(), value) != loads.end(); };
+			Value* left = operation->GetOperands()[0];
+			Value* right = operation->GetOperands()[1];
+			if (!isLoad(left))
+			{
+				Opcode opcode = operation->GetOpcode();
+				if (opcode == Opcode::Sub || opcode == Opcode::Div)
+					return false;
+				std::swap(left, right);
+			}
+			if (!isLoad(left) || (!isLoad(right) && !IsInvariant(loop, right)))
+				return false;
+
+			ArrayKernel kernel = { operation->GetOpcode(), operation->GetType(), store->GetSymbol(), static_cast<const Instruction*>(left)->GetSymbol(), (isLoad(right) ? static_cast<const Instruction*>(right)->GetSymbol() : "") };
+			for (const Instruction* load : loads)
+			{
+				if (load != left && load != right)
+					return false;
+			}
+			for (const Instruction* boundsCheck : boundsChecks)
+			{
+				const std::string& array = boundsCheck->GetSymbol();
+				if (array != kernel.Target && array != kernel.Left && array != kernel.Right)
+					return false;
+			}
+
+			// Nothing computed in the Loop is used after it
+			for (const auto& block : function->GetBlocks())
+			{
+				if (loop.Blocks.contains(block.get()))
+					continue;
+				for (const auto& instruction : block->GetInstructions())
+				{
+					for (const Value* operand : instruction->GetOperands())
+					{
+						if (!IsInvariant(loop, operand))
+							return false;
+					}
+				}
+			}
+
+			std::vector<Value*> operands = { inductionVariable->Initial, end };
+			if (kernel.Right.empty())
+				operands.push_back(right);
+			uint32_t index = function->AddKernel(kernel);
+			loop.Preheader->InsertBeforeTerminator(std::make_unique<Instruction>(Opcode::ArrayKernel, Type::Void, std::move(operands), std::vector<BasicBlock*>{}, kernel.Target, index));
+
+			// The Preheader jumps past the Loop
+			std::vector<BasicBlock*>& targets = loop.Preheader->GetInstructions().back()->GetBlocks();
+			std::replace(targets.begin(), targets.end(), header, exit);
+			exit->ReplacePredecessor(header, loop.Preheader);
+			for (BasicBlock* block : loop.Blocks)
+				function->EraseBlock(block);
+
+			m_Statistics.VectorizedLoops++;
+			return true;
+		}
+
+		void LoopOptimizer::RemoveDeadInstructions(Function* function)
+		{
+			bool changed = true;
+			while (changed)
+			{
+				changed = false;
+
+				std::unordered_set<const Value*> used;
+				for (const auto& block : function->GetBlocks())
+				{
+					for (const auto& instruction : block->GetInstructions())
+						used.insert(instruction->GetOperands().begin(), instruction->GetOperands().end());
+				}
+
+				for (const auto& block : function->GetBlocks())
+				{
+					std::vector<Instruction*> dead;
+					for (const auto& instruction : block->GetInstructions())
+					{
+						if (!instruction->HasSideEffects() && !used.contains(instruction.get()))
+							dead.push_back(instruction.get());
+					}
+
+					for (Instruction* instruction : dead)
+						block->Remove(instruction);
+					changed |= !dead.empty();
+				}
+			}
+		}
+
+		std::optional<LoopOptimizer::InductionVariable> LoopOptimizer::GetInductionVariable(const Loop& loop, Instruction* phi) const
+		{
+			if (phi->GetType() != Type::Integer || phi->GetOperands().size() != 2 || !loop.Latch)
+				return std::nullopt;
+
+			size_t latchIndex = (phi->GetBlocks()[0] == loop.Latch ? 0 : 1);
+			if (phi->GetBlocks()[latchIndex] != loop.Latch || phi->GetBlocks()[1 - latchIndex] != loop.Preheader)
+				return std::nullopt;
+
+			Value* next = phi->GetOperands()[latchIndex];
+			if (next->GetValueKind() != ValueKind::Instruction)
+				return std::nullopt;
+
+			Instruction* update = static_cast<Instruction*>(next);
+			if (!loop.Blocks.contains(update->GetParent()))
+				return std::nullopt;
+
+			const std::vector<Value*>& operands = update->GetOperands();
+			if (update->GetOpcode() == Opcode::Add && operands[0] == phi && IsInvariant(loop, operands[1]))
+				return InductionVariable{ phi, phi->GetOperands()[1 - latchIndex], update, operands[1] };
+			if (update->GetOpcode() == Opcode::Add && operands[1] == phi && IsInvariant(loop, operands[0]))
+				return InductionVariable{ phi, phi->GetOperands()[1 - latchIndex], update, operands[0] };
+			if (update->GetOpcode() == Opcode::Sub && operands[0] == phi && IsInvariant(loop, operands[1]))
+				return InductionVariable{ phi, phi->GetOperands()[1 - latchIndex], update, operands[1] };
+			return std::nullopt;
+		}
+
+		bool LoopOptimizer::IsInvariant(const Loop& loop, const Value* value) const
+		{
+			if (value->GetValueKind() != ValueKind::Instruction)
+				return true;
+			return !loop.Blocks.contains(static_cast<const Instruction*>(value)->GetParent());
+		}
+
+		bool LoopOptimizer::IsHoistable(const Instruction* instruction, bool loopHasCall, const std::unordered_set<std::string>& storedGlobals) const
+		{
+			switch (instruction->GetOpcode())
+			{
+			case Opcode::Div:
+			case Opcode::Mod:
+			{
+				if (instruction->GetType() == Type::Float)
+					return true;
+
+				// Integer Division traps, only hoist it if it can not
+				const Value* divisor = instruction->GetOperands()[1];
+				if (divisor->GetValueKind() != ValueKind::Constant)
+					return false;
+				SignedIntegerType value = (SignedIntegerType)static_cast<const Constant*>(divisor)->GetValue<IntegerType>();
+				return value != 0 && value != -1;
+			}
+			case Opcode::Load:
+				return !loopHasCall && !storedGlobals.contains(instruction->GetSymbol());
+			// Elements are written through any Index & the Index is only checked inside the Loop, Boxes through any Handle
+			// Every Iteration boxes its own Value
+			case Opcode::LoadElement:
+			case Opcode::Box:
+			case Opcode::LoadBox:
+			case Opcode::Phi:
+				return false;
+			default:
+				return !instruction->HasSideEffects();
+			}
+		}
+
+		bool LoopOptimizer::IsWithinBounds(const Function* function, const Instruction* boundsCheck, SignedIntegerType lower, SignedIntegerType upper) const
+		{
+			const ArrayVariable* array = (m_Module ? m_Module->GetArray(function, boundsCheck->GetSymbol()) : nullptr);
+			return array && lower >= 0 && upper < (SignedIntegerType)array->Length;
+		}
+
+		Value* LoopOptimizer::EmitMultiply(Function* function, BasicBlock* block, Value* left, Value* right)
+		{
+			if (left->GetValueKind() == ValueKind::Constant && right->GetValueKind() == ValueKind::Constant)
+				return function->GetConstant(static_cast<const Constant*>(left)->GetValue<IntegerType>() * static_cast<const Constant*>(right)->GetValue<IntegerType>());
+
+			// Steps & Starts of 0 or 1 are the common Case
+			if (right->GetValueKind() == ValueKind::Constant)
+				std::swap(left, right);
+			if (left->GetValueKind() == ValueKind::Constant && static_cast<const Constant*>(left)->GetValue<IntegerType>() == 0)
+				return left;
+			if (left->GetValueKind() == ValueKind::Constant && static_cast<const Constant*>(left)->GetValue<IntegerType>() == 1)
+				return right;
+			return block->InsertBeforeTerminator(std::make_unique<Instruction>(Opcode::Mul, Type::Integer, std::vector<Value*>{ left, right }));
+		}
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Eye/IR/Module.h"
+
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Eye
+{
+	namespace IR
+	{
+		struct LoopOptimizerProperties
+		{
+			bool HoistInvariants = true;
+			bool ReduceStrength = true;
+			bool Unroll = true;
+			bool EliminateBoundsChecks = true;
+			bool Vectorize = true;
+			// Counted Loops running at most this many Iterations are fully unrolled
+			size_t UnrollMaxTripCount = 8;
+			// Largest Instruction Count of all unrolled Copies together
+			size_t UnrollBudget = 96;
+		};
+
+		struct LoopStatistics
+		{
+			size_t HoistedInstructions = 0;
+			size_t ReducedInductions = 0;
+			size_t UnrolledLoops = 0;
+			size_t EliminatedBoundsChecks = 0;
+			size_t VectorizedLoops = 0;
+		};
+
+		/*
+			LoopOptimizer
+				Loop-Invariant Code Motion: Side-Effect free Instructions over Loop-Invariant Operands move into the Preheader.
+				Strength Reduction: 'iv * k' with a Loop-Invariant k becomes its own Induction Variable stepped by 'step * k'.
+				Unrolling: Loops leaving only through their Header with a Constant Trip Count are fully unrolled.
+				Bounds-Check Elimination: Checks of a Constant Index or of 'iv +/- c', where the Header's Condition bounds a Constant-stepped iv, are dropped once the Index provably stays within the Array.
+				Vectorization: Counted Loops 'for (i = start; i < end; i++) c[i] = a[i] op b[i]' over int or float Arrays, b[i] possibly Loop-Invariant, become one arraykernel Instruction in the Preheader.
+				Loops are found as Natural Loops of Back Edges, innermost first.
+		*/
+		class LoopOptimizer
+		{
+		public:
+			void Optimize(Module* module, const LoopOptimizerProperties& properties = {});
+			inline const LoopStatistics& GetStatistics() const { return m_Statistics; }
+
+		private:
+			struct Loop
+			{
+				BasicBlock* Header;
+				// Only Predecessor outside the Loop, jumps straight to the Header
+				BasicBlock* Preheader;
+				// nullptr if several Back Edges reach the Header
+				BasicBlock* Latch;
+				std::unordered_set<BasicBlock*> Blocks;
+			};
+
+			// phi = [ Initial, Preheader ], [ Update, Latch ] with Update = phi +/- Step
+			struct InductionVariable
+			{
+				Instruction* Phi;
+				Value* Initial;
+				Instruction* Update;
+				Value* Step;
+			};
+
+		private:
+			void OptimizeFunction(Function* function);
+			std::vector<Loop> FindLoops(Function* function) const;
+			void CreatePreheader(Function* function, Loop& loop);
+			void HoistInvariants(const Loop& loop);
+			void ReduceStrength(Function* function, const Loop& loop);
+			bool Unroll(Function* function, const Loop& loop);
+			void EliminateBoundsChecks(Function* function, const Loop& loop);
+			void EliminateConstantBoundsChecks(Function* function);
+			bool Vectorize(Function* function, const Loop& loop);
+			void RemoveDeadInstructions(Function* function);
+
+			std::optional<InductionVariable> GetInductionVariable(const Loop& loop, Instruction* phi) const;
+			bool IsInvariant(const Loop& loop, const Value* value) const;
+			bool IsHoistable(const Instruction* instruction, bool loopHasCall, const std::unordered_set<std::string>& storedGlobals) const;
+			// Every Index in [lower, upper] addresses an Element of the checked Array
+			bool IsWithinBounds(const Function* function, const Instruction* boundsCheck, long long lower, long long upper) const;
+			Value* EmitMultiply(Function* function, BasicBlock* block, Value* left, Value* right);
+
+		private:
+			const Module* m_Module = nullptr;
+			LoopOptimizerProperties m_Properties;
+			LoopStatistics m_Statistics;
+		};
+	}
+}
@@ -0,0 +1,52 @@
+#include "Eye/IR/Module.h"
+
+namespace Eye
+{
+	namespace IR
+	{
+		Function* Module::CreateFunction(const std::string& name, Type returnType)
+		{
+			m_Functions.push_back(std::make_unique<Function>(name, returnType));
+			m_FunctionIndex[name] = m_Functions.back().get();
+			return m_Functions.back().get();
+		}
+
+		Function* Module::GetFunction(const std::string& name) const
+		{
+			auto it = m_FunctionIndex.find(name);
+			return (it != m_FunctionIndex.end() ? it->second : nullptr);
+		}
+
+		void Module::AddGlobal(const std::string& name, Type type)
+		{
+			m_GlobalIndex[name] = m_Globals.size();
+			m_Globals.push_back({ name, type, { type } });
+		}
+
+		void Module::AddGlobal(const std::string& name, const std::vector<Type>& slots)
+		{
+			m_GlobalIndex[name] = m_Globals.size();
+			m_Globals.push_back({ name, Type::Struct, slots });
+		}
+
+		const GlobalVariable* Module::GetGlobal(const std::string& name) const
+		{
+			auto it = m_GlobalIndex.find(name);
+			return (it != m_GlobalIndex.end() ? &m_Globals[it->second] : nullptr);
+		}
+
+		void Module::AddArray(const std::string& name, Type elementType, uint32_t length)
+		{
+			m_ArrayIndex[name] = m_Arrays.size();
+			m_Arrays.push_back({ name, elementType, length });
+		}
+
+		const ArrayVariable* Module::GetArray(const Function* function, const std::string& name) const
+		{
+			if (const ArrayVariable* array = (function ? function->GetArray(name) : nullptr))
+				return array;
+			auto it = m_ArrayIndex.find(name);
+			return (it != m_ArrayIndex.end() ? &m_Arrays[it->second] : nullptr);
+		}
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Eye/IR/Function.h"
+
+namespace Eye
+{
+	namespace IR
+	{
+		// Struct Globals hold one Slot per Field, Scalars a single one
+		struct GlobalVariable
+		{
+			std::string Name;
+			Type VariableType;
+			std::vector<Type> Slots;
+		};
+
+		/*
+			Module
+				: GlobalList FunctionList
+				;
+
+			Top-Level Statements make up the Function named InitFunctionName, Top-Level Variables are Globals.
+		*/
+		class Module
+		{
+		public:
+			static constexpr const char* InitFunctionName = ".init";
+
+		public:
+			inline const std::vector<std::unique_ptr<Function>>& GetFunctions() const { return m_Functions; }
+			inline const std::vector<GlobalVariable>& GetGlobals() const { return m_Globals; }
+			inline const std::vector<ArrayVariable>& GetArrays() const { return m_Arrays; }
+
+			Function* CreateFunction(const std::string& name, Type returnType);
+			Function* GetFunction(const std::string& name) const;
+			void AddGlobal(const std::string& name, Type type);
+			void AddGlobal(const std::string& name, const std::vector<Type>& slots);
+			const GlobalVariable* GetGlobal(const std::string& name) const;
+			void AddArray(const std::string& name, Type elementType, uint32_t length);
+			// Arrays of the Function or of the Module
+			const ArrayVariable* GetArray(const Function* function, const std::string& name) const;
+
+		private:
+			std::vector<std::unique_ptr<Function>> m_Functions;
+			std::vector<GlobalVariable> m_Globals;
+			std::unordered_map<std::string, Function*> m_FunctionIndex;
+			std::unordered_map<std::string, size_t> m_GlobalIndex;
+			std::vector<ArrayVariable> m_Arrays;
+			std::unordered_map<std::string, size_t> m_ArrayIndex;
+		};
+	}
+}
@@ -0,0 +1,29 @@
+#include "Eye/IR/Value.h"
+#include "Eye/Utility/Logger.h"
+
+namespace Eye
+{
+	namespace IR
+	{
+		std::string IRTypeToString(Type type)
+		{
+			switch (type)
+			{
+			case Type::Integer:
+				return "int";
+			case Type::Float:
+				return "float";
+			case Type::String:
+				return "str";
+			case Type::Boolean:
+				return "bool";
+			case Type::Void:
+				return "void";
+			default:
+				break;
+			}
+
+			EYE_LOG_CRITICAL("EYEIR IRTypeToString Unknown Type!");
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Eye/TypeChecker/Type.h"
+#include "Eye/Lexer/Token.h"
+
+#include <string>
+#include <variant>
+
+namespace Eye
+{
+	namespace IR
+	{
+		enum class ValueKind
+		{
+			Constant,
+			Argument,
+			Instruction,
+		};
+
+		std::string IRTypeToString(Type type);
+
+		/*
+			Value
+				: Constant
+				| Argument
+				| Instruction
+				;
+		*/
+		class Value
+		{
+		public:
+			virtual ~Value() = default;
+
+			inline ValueKind GetValueKind() const { return m_ValueKind; }
+			inline Type GetType() const { return m_Type; }
+
+		protected:
+			Value(ValueKind valueKind, Type type)
+				: m_ValueKind(valueKind), m_Type(type)
+			{
+			}
+
+		private:
+			ValueKind m_ValueKind;
+			Type m_Type;
+		};
+
+		class Constant : public Value
+		{
+		public:
+			Constant(IntegerType value)
+				: Value(ValueKind::Constant, Type::Integer), m_Value(value)
+			{
+			}
+
+			Constant(FloatType value)
+				: Value(ValueKind::Constant, Type::Float), m_Value(value)
+			{
+			}
+
+			Constant(StringType value)
+				: Value(ValueKind::Constant, Type::String), m_Value(value)
+			{
+			}
+
+			Constant(BooleanType value)
+				: Value(ValueKind::Constant, Type::Boolean), m_Value(value)
+			{
+			}
+
+			template<typename T>
+			T GetValue() const
+			{
+				static_assert(std::is_same_v<T, IntegerType> || std::is_same_v<T, FloatType> || std::is_same_v<T, StringType> || std::is_same_v<T, BooleanType>, "EYEIRConstant->Error GetValue() Invalid Typename");
+				return std::get<T>(m_Value);
+			}
+
+		private:
+			std::variant<IntegerType, FloatType, StringType, BooleanType> m_Value;
+		};
+
+		class Argument : public Value
+		{
+		public:
+			Argument(Type type, const std::string& name, size_t index)
+				: Value(ValueKind::Argument, type), m_Name(name), m_Index(index)
+			{
+			}
+
+			inline const std::string& GetName() const { return m_Name; }
+			inline size_t GetIndex() const { return m_Index; }
+
+		private:
+			std::string m_Name;
+			size_t m_Index;
+		};
+	}
+}
@@ -14,6 +14,20 @@ namespace Eye
 		else if (m_Source.Type == EyeSourceType::String)
 			m_BufferStream = std::istringstream(m_Source.Source);
 
+		return TokenizeBuffer();
+	}
+
+	std::expected<std::vector<std::unique_ptr<Token>>, Error::Error> Lexer::Tokenize(const EyeSource& source, const std::string& text)
+	{
+		m_Source = source;
+		m_BufferStream = std::istringstream(text);
+		return TokenizeBuffer();
+	}
+
+	std::expected<std::vector<std::unique_ptr<Token>>, Error::Error> Lexer::TokenizeBuffer()
+	{
+		m_Tokens.clear();
+
 		try
 		{
 			std::unique_ptr<Token> token = NextToken();
@@ -269,7 +283,11 @@ namespace Eye
 		if (!singleOperator && !IsValidOperator(opStr))
 		{
 			for (size_t i = opStr.size() - 1; i >= 1; i--)
+			{
 				PutBack(opStr[i]);
+				m_Source.Col--;
+				m_Source.End--;
+			}
 			opStr = opStr[0];
 		}
 
@@ -283,8 +301,11 @@ namespace Eye
 	std::unique_ptr<Token> Lexer::MakeSymbolToken()
 	{
 		EyeSource tokenSource(m_Source.Source, m_Source.Type, m_Source.Line, m_Source.Col, m_Source.End, m_Source.End);
-		char c = NextChar();
-		return std::make_unique<Token>(StringToTokenType(std::string{ c }), tokenSource);
+		std::string symbol{ NextChar() };
+		// Scope Resolution: i.e Math::square
+		if (symbol == ":" && PeekChar() == ':')
+			symbol += NextChar();
+		return std::make_unique<Token>(StringToTokenType(symbol), tokenSource);
 	}
 
 	std::unique_ptr<Token> Lexer::MakeSpecialToken()
@@ -440,6 +461,8 @@ namespace Eye
 			"if",	"else",
 			"while", "do", "for", "continue", "break",
 			"function", "return",
+			"import", "macro",
+			"struct", "namespace",
 		};
 
 		return (std::find(keywords.begin(), keywords.end(), str) != keywords.end());
@@ -6,6 +6,7 @@
 
 #include <sstream>
 #include <vector>
+#include <memory>
 #include <expected>
 
 namespace Eye
@@ -14,8 +15,11 @@ namespace Eye
 	{
 	public:
 		std::expected<std::vector<std::unique_ptr<Token>>, Error::Error> Tokenize(const EyeSource& source);
+		// Tokenizes text as a Region of source, Token Positions continue from source's Line, Col & End
+		std::expected<std::vector<std::unique_ptr<Token>>, Error::Error> Tokenize(const EyeSource& source, const std::string& text);
 
 	private:
+		std::expected<std::vector<std::unique_ptr<Token>>, Error::Error> TokenizeBuffer();
 		std::unique_ptr<Token> NextToken();
 		std::unique_ptr<Token> HandleWhitespace();
 		std::unique_ptr<Token> HandleNewline();
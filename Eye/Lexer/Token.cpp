@@ -28,6 +28,10 @@ namespace Eye
 		"break",
 		"function",
 		"return",
+		"import",
+		"macro",
+		"struct",
+		"namespace",
 		// Operators
 		"+",
 		"-",
@@ -73,6 +77,7 @@ namespace Eye
 		"{",
 		"}",
 		":",
+		"::",
 		";",
 		"\\",
 		// Others
@@ -174,6 +179,11 @@ namespace Eye
 		return m_Source;
 	}
 
+	EyeSource& Token::GetSource()
+	{
+		return m_Source;
+	}
+
 	std::string Token::ToString() const
 	{
 		std::string type = "Invalid";
@@ -219,6 +229,10 @@ namespace Eye
 		case TokenType::KeywordIterationBreak:
 		case TokenType::KeywordReturn:
 		case TokenType::KeywordFunction:
+		case TokenType::KeywordImport:
+		case TokenType::KeywordMacro:
+		case TokenType::KeywordStruct:
+		case TokenType::KeywordNamespace:
 			type = "Keyword";
 			value = TokenTypeStr[(int)m_Type];
 			break;
@@ -268,6 +282,7 @@ namespace Eye
 		case TokenType::SymbolLeftBrace:
 		case TokenType::SymbolRightBrace:
 		case TokenType::SymbolColon:
+		case TokenType::SymbolScope:
 		case TokenType::SymbolSemiColon:
 		case TokenType::SymbolBackslash:
 			type = "Symbol";
@@ -336,6 +351,10 @@ namespace Eye
 		case TokenType::KeywordIterationBreak:
 		case TokenType::KeywordReturn:
 		case TokenType::KeywordFunction:
+		case TokenType::KeywordImport:
+		case TokenType::KeywordMacro:
+		case TokenType::KeywordStruct:
+		case TokenType::KeywordNamespace:
 			value = TokenTypeStr[(int)m_Type];
 			break;
 		case TokenType::OperatorBinaryPlus:
@@ -383,6 +402,7 @@ namespace Eye
 		case TokenType::SymbolLeftBrace:
 		case TokenType::SymbolRightBrace:
 		case TokenType::SymbolColon:
+		case TokenType::SymbolScope:
 		case TokenType::SymbolSemiColon:
 		case TokenType::SymbolBackslash:
 			value = TokenTypeStr[(int)m_Type];
@@ -3,6 +3,7 @@
 #include "Eye/Utility/EyeSource.h"
 
 #include <string>
+#include <cstdint>
 #include <variant>
 #include <ostream>
 
@@ -13,7 +14,7 @@ namespace Eye
 	using StringType = std::string;
 	using BooleanType = bool;
 
-	enum class TokenType
+	enum class TokenType : uint8_t
 	{
 		Invalid = 0,
 		// Literals
@@ -39,6 +40,10 @@ namespace Eye
 		KeywordIterationBreak,
 		KeywordFunction,
 		KeywordReturn,
+		KeywordImport,
+		KeywordMacro,
+		KeywordStruct,
+		KeywordNamespace,
 		// Operators
 		OperatorBinaryPlus,
 		OperatorBinaryMinus,
@@ -84,6 +89,7 @@ namespace Eye
 		SymbolLeftBrace,
 		SymbolRightBrace,
 		SymbolColon,
+		SymbolScope,
 		SymbolSemiColon,
 		SymbolBackslash,
 		// Others
@@ -112,6 +118,7 @@ namespace Eye
 
 		TokenType GetType() const;
 		const EyeSource& GetSource() const;
+		EyeSource& GetSource();
 
 		template<typename T>
 		T GetValue() const
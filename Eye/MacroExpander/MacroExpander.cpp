@@ -0,0 +1,404 @@
+#include "Eye/MacroExpander/MacroExpander.h"
+#include "Eye/Utility/Logger.h"
+#include "Eye/Error/Exceptions/MacroException.h"
+
+#include <algorithm>
+#include <charconv>
+
+namespace Eye
+{
+	static bool IsTrivia(const Token* token)
+	{
+		return (token->GetType() == TokenType::Newline || token->GetType() == TokenType::Comment || token->GetType() == TokenType::SymbolBackslash);
+	}
+
+	static bool IsDataType(TokenType type)
+	{
+		return (type == TokenType::KeywordDataTypeInt || type == TokenType::KeywordDataTypeFloat || type == TokenType::KeywordDataTypeStr || type == TokenType::KeywordDataTypeBool || type == TokenType::KeywordDataTypeVoid);
+	}
+
+	// Exact, unlike GetValueString which rounds Floats
+	static std::string TokenText(const Token& token)
+	{
+		std::string text = std::to_string((int)token.GetType()) + ":";
+		if (token.GetType() == TokenType::LiteralFloat)
+		{
+			char buffer[32];
+			auto result = std::to_chars(buffer, buffer + sizeof(buffer), token.GetValue<FloatType>());
+			return text + std::string(buffer, result.ptr);
+		}
+		return text + token.GetValueString();
+	}
+
+	static void HashCombine(size_t& hash, size_t value)
+	{
+		hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+	}
+
+	std::shared_ptr<const MacroExpansion> MacroExpansionCache::Find(size_t key, const std::string& definitionText, const std::string& argumentText)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		auto bucket = m_Expansions.find(key);
+		if (bucket == m_Expansions.end())
+			return nullptr;
+
+		for (const auto& expansion : bucket->second)
+		{
+			if (expansion->ArgumentText == argumentText && expansion->DefinitionText == definitionText)
+				return expansion;
+		}
+		return nullptr;
+	}
+
+	std::shared_ptr<const MacroExpansion> MacroExpansionCache::Insert(size_t key, std::shared_ptr<const MacroExpansion> expansion)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (m_Size >= MaxSize)
+		{
+			m_Expansions.clear();
+			m_Size = 0;
+		}
+
+		auto& bucket = m_Expansions[key];
+		for (const auto& cached : bucket)
+		{
+			if (cached->ArgumentText == expansion->ArgumentText && cached->DefinitionText == expansion->DefinitionText)
+				return cached;
+		}
+
+		bucket.push_back(expansion);
+		m_Size++;
+		return expansion;
+	}
+
+	void MacroExpansionCache::Clear()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Expansions.clear();
+		m_Size = 0;
+	}
+
+	size_t MacroExpansionCache::GetSize()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Size;
+	}
+
+	MacroExpander::MacroExpander(std::shared_ptr<MacroExpansionCache> cache)
+		: m_Cache(std::move(cache))
+	{
+	}
+
+	std::expected<std::vector<std::unique_ptr<Token>>, Error::Error> MacroExpander::Expand(std::vector<std::unique_ptr<Token>>&& tokens, const std::vector<MacroDefinition>& definitions)
+	{
+		m_Macros.clear();
+		for (const auto& definition : definitions)
+			m_Macros.emplace(definition.Name, definition);
+
+		TokenView view;
+		view.reserve(tokens.size());
+		for (const auto& token : tokens)
+			view.push_back(token.get());
+
+		std::vector<std::unique_ptr<Token>> output;
+		output.reserve(tokens.size());
+
+		try
+		{
+			size_t index = 0;
+			while (index < view.size())
+			{
+				if (view[index]->GetType() == TokenType::KeywordMacro)
+					DefineMacro(view, index);
+				else if (IsInvocation(view, index))
+					ExpandInvocation(view, index, view[index]->GetSource(), output, 0);
+				else
+					output.push_back(std::move(tokens[index++]));
+			}
+		}
+		catch (const Error::Exceptions::EyeException& ex)
+		{
+			return std::unexpected(ex.GetError());
+		}
+		catch (...)
+		{
+			EYE_LOG_CRITICAL("EYEMacroExpander->Expand Unknown Exception!");
+		}
+
+		return output;
+	}
+
+	void MacroExpander::ClearCache()
+	{
+		m_Cache->Clear();
+	}
+
+	void MacroExpander::DefineMacro(const TokenView& tokens, size_t& index)
+	{
+		const Token* macroToken = tokens[index++];
+		const Token* nameToken = ExpectToken(tokens, index, TokenType::Identifier, "Macro Name");
+		ExpectToken(tokens, index, TokenType::OperatorLeftParenthesis, "'('");
+
+		MacroDefinition macro;
+		macro.Name = nameToken->GetValue<StringType>();
+		index = SkipTrivia(tokens, index);
+		if (index < tokens.size() && tokens[index]->GetType() != TokenType::SymbolRightParenthesis)
+		{
+			while (true)
+			{
+				const Token* parameter = ExpectToken(tokens, index, TokenType::Identifier, "Macro Parameter");
+				if (std::find(macro.Parameters.begin(), macro.Parameters.end(), parameter->GetValue<StringType>()) != macro.Parameters.end())
+					throw Error::Exceptions::MacroException("Duplicate Macro Parameter '" + parameter->GetValue<StringType>() + "'", Error::ErrorType::MacroExpanderSyntaxError, parameter->GetSource());
+				macro.Parameters.push_back(parameter->GetValue<StringType>());
+
+				index = SkipTrivia(tokens, index);
+				if (index >= tokens.size() || tokens[index]->GetType() != TokenType::OperatorComma)
+					break;
+				index++;
+			}
+		}
+		ExpectToken(tokens, index, TokenType::SymbolRightParenthesis, "')'");
+		const Token* bodyToken = ExpectToken(tokens, index, TokenType::SymbolLeftBrace, "'{'");
+
+		size_t depth = 0;
+		while (true)
+		{
+			if (index >= tokens.size() || tokens[index]->GetType() == TokenType::EndOfFile)
+				throw Error::Exceptions::MacroException("Unterminated Body of Macro '" + macro.Name + "'", Error::ErrorType::MacroExpanderSyntaxError, bodyToken->GetSource());
+
+			const Token* token = tokens[index++];
+			if (IsTrivia(token))
+				continue;
+
+			if (token->GetType() == TokenType::SymbolLeftBrace)
+				depth++;
+			else if (token->GetType() == TokenType::SymbolRightBrace)
+			{
+				if (!depth)
+				{
+					macro.Source = macroToken->GetSource();
+					macro.Source.End = token->GetSource().End;
+					break;
+				}
+				depth--;
+			}
+			macro.Body.push_back(*token);
+		}
+
+		macro.Text = macro.Name + "(";
+		for (const auto& parameter : macro.Parameters)
+			macro.Text += parameter + ",";
+		macro.Text += "){";
+		for (size_t i = 0; i < macro.Body.size(); i++)
+		{
+			macro.Text += TokenText(macro.Body[i]) + " ";
+			if (!IsDataType(macro.Body[i].GetType()) && macro.Body[i].GetType() != TokenType::Identifier)
+				continue;
+
+			// A Declaration is a DataType or Struct Name, optional Array Lengths, then the declared Identifier
+			size_t next = i + 1;
+			while (next < macro.Body.size() && macro.Body[next].GetType() == TokenType::OperatorLeftBracket)
+			{
+				while (next < macro.Body.size() && macro.Body[next].GetType() != TokenType::SymbolRightBracket)
+					next++;
+				next++;
+			}
+
+			if (next < macro.Body.size() && macro.Body[next].GetType() == TokenType::Identifier)
+			{
+				const std::string& local = macro.Body[next].GetValue<StringType>();
+				if (std::find(macro.Parameters.begin(), macro.Parameters.end(), local) == macro.Parameters.end())
+					macro.Locals.insert(local);
+			}
+		}
+		macro.Text += "}";
+		macro.Id = std::hash<std::string>()(macro.Text);
+
+		if (m_Macros.contains(macro.Name))
+			throw Error::Exceptions::MacroException("ReDefinition of Macro '" + macro.Name + "'", Error::ErrorType::MacroExpanderReDefinition, nameToken->GetSource());
+		m_Macros.emplace(macro.Name, std::move(macro));
+	}
+
+	bool MacroExpander::IsInvocation(const TokenView& tokens, size_t index) const
+	{
+		if (tokens[index]->GetType() != TokenType::Identifier)
+			return false;
+
+		index = SkipTrivia(tokens, index + 1);
+		if (index >= tokens.size() || tokens[index]->GetType() != TokenType::OperatorLogicalNOT)
+			return false;
+
+		index = SkipTrivia(tokens, index + 1);
+		return (index < tokens.size() && tokens[index]->GetType() == TokenType::OperatorLeftParenthesis);
+	}
+
+	std::vector<std::vector<Token>> MacroExpander::ParseArguments(const TokenView& tokens, size_t& index)
+	{
+		const Token* invocationToken = tokens[index];
+		index = SkipTrivia(tokens, index + 1) + 1;
+		index = SkipTrivia(tokens, index) + 1;
+
+		std::vector<std::vector<Token>> arguments;
+		std::vector<Token> argument;
+		size_t depth = 0;
+		while (true)
+		{
+			if (index >= tokens.size() || tokens[index]->GetType() == TokenType::EndOfFile)
+				throw Error::Exceptions::MacroException("Unterminated Invocation of Macro '" + invocationToken->GetValue<StringType>() + "'", Error::ErrorType::MacroExpanderSyntaxError, invocationToken->GetSource());
+
+			const Token* token = tokens[index++];
+			if (IsTrivia(token))
+				continue;
+
+			switch (token->GetType())
+			{
+			case TokenType::OperatorLeftParenthesis:
+			case TokenType::OperatorLeftBracket:
+			case TokenType::SymbolLeftBrace:
+				depth++;
+				break;
+			case TokenType::SymbolRightParenthesis:
+				if (!depth)
+				{
+					if (!arguments.empty() || !argument.empty())
+						arguments.push_back(std::move(argument));
+					return arguments;
+				}
+				depth--;
+				break;
+			case TokenType::SymbolRightBracket:
+			case TokenType::SymbolRightBrace:
+				if (!depth)
+					throw Error::Exceptions::MacroException("Unbalanced '" + std::string(token->GetTypeString()) + "' in Macro Argument", Error::ErrorType::MacroExpanderSyntaxError, token->GetSource());
+				depth--;
+				break;
+			case TokenType::OperatorComma:
+				if (!depth)
+				{
+					arguments.push_back(std::move(argument));
+					argument.clear();
+					continue;
+				}
+				break;
+			default:
+				break;
+			}
+			argument.push_back(*token);
+		}
+	}
+
+	void MacroExpander::ExpandInvocation(const TokenView& tokens, size_t& index, const EyeSource& source, std::vector<std::unique_ptr<Token>>& output, size_t depth)
+	{
+		const Token* nameToken = tokens[index];
+		if (depth >= MaxExpansionDepth)
+			throw Error::Exceptions::MacroException("Macro Expansion exceeds a Depth of " + std::to_string(MaxExpansionDepth) + " at '" + nameToken->GetValue<StringType>() + "'", Error::ErrorType::MacroExpanderRecursionLimit, source);
+
+		auto macro = m_Macros.find(nameToken->GetValue<StringType>());
+		if (macro == m_Macros.end())
+			throw Error::Exceptions::MacroException("Macro '" + nameToken->GetValue<StringType>() + "' is not defined", Error::ErrorType::MacroExpanderNotDefined, nameToken->GetSource());
+
+		auto arguments = ParseArguments(tokens, index);
+		if (arguments.size() != macro->second.Parameters.size())
+			throw Error::Exceptions::MacroException("Macro '" + macro->first + "' expects " + std::to_string(macro->second.Parameters.size()) + " Arguments, got " + std::to_string(arguments.size()), Error::ErrorType::MacroExpanderBadArgumentCount, nameToken->GetSource());
+
+		std::shared_ptr<const MacroExpansion> expansion = GetExpansion(macro->second, arguments);
+		m_ExpansionCount++;
+
+		std::vector<Token> expanded = expansion->Tokens;
+		for (auto& token : expanded)
+			token.GetSource() = source;
+
+		std::string suffix = "#" + std::to_string(m_NextHygieneId++);
+		for (size_t local : expansion->LocalTokens)
+			expanded[local] = Token(TokenType::Identifier, expanded[local].GetValue<StringType>() + suffix, source);
+
+		if (!expansion->HasInvocations)
+		{
+			for (auto& token : expanded)
+				output.push_back(std::make_unique<Token>(std::move(token)));
+			return;
+		}
+
+		TokenView view;
+		view.reserve(expanded.size());
+		for (const auto& token : expanded)
+			view.push_back(&token);
+
+		size_t expandedIndex = 0;
+		while (expandedIndex < view.size())
+		{
+			if (IsInvocation(view, expandedIndex))
+				ExpandInvocation(view, expandedIndex, source, output, depth + 1);
+			else
+				output.push_back(std::make_unique<Token>(std::move(expanded[expandedIndex++])));
+		}
+	}
+
+	std::shared_ptr<const MacroExpansion> MacroExpander::GetExpansion(const MacroDefinition& macro, const std::vector<std::vector<Token>>& arguments)
+	{
+		size_t key = macro.Id;
+		std::string argumentText;
+		for (const auto& argument : arguments)
+		{
+			for (const auto& token : argument)
+			{
+				std::string text = TokenText(token);
+				HashCombine(key, std::hash<std::string>()(text));
+				argumentText += text + "\x1F";
+			}
+			HashCombine(key, argument.size());
+			argumentText += "\x1E";
+		}
+
+		if (auto cached = m_Cache->Find(key, macro.Text, argumentText))
+		{
+			m_CacheHitCount++;
+			return cached;
+		}
+
+		auto expansion = std::make_shared<MacroExpansion>();
+		expansion->ArgumentText = std::move(argumentText);
+		expansion->DefinitionText = macro.Text;
+		for (const auto& token : macro.Body)
+		{
+			if (token.GetType() == TokenType::Identifier)
+			{
+				const std::string& name = token.GetValue<StringType>();
+				auto parameter = std::find(macro.Parameters.begin(), macro.Parameters.end(), name);
+				if (parameter != macro.Parameters.end())
+				{
+					const auto& argument = arguments[parameter - macro.Parameters.begin()];
+					expansion->Tokens.insert(expansion->Tokens.end(), argument.begin(), argument.end());
+					continue;
+				}
+
+				if (macro.Locals.contains(name))
+					expansion->LocalTokens.push_back(expansion->Tokens.size());
+			}
+			expansion->Tokens.push_back(token);
+		}
+
+		TokenView view;
+		for (const auto& token : expansion->Tokens)
+			view.push_back(&token);
+		for (size_t i = 0; i < view.size() && !expansion->HasInvocations; i++)
+			expansion->HasInvocations = IsInvocation(view, i);
+
+		return m_Cache->Insert(key, std::move(expansion));
+	}
+
+	size_t MacroExpander::SkipTrivia(const TokenView& tokens, size_t index) const
+	{
+		while (index < tokens.size() && IsTrivia(tokens[index]))
+			index++;
+		return index;
+	}
+
+	const Token* MacroExpander::ExpectToken(const TokenView& tokens, size_t& index, TokenType type, const std::string& expected)
+	{
+		index = SkipTrivia(tokens, index);
+		if (index >= tokens.size() || tokens[index]->GetType() != type)
+			throw Error::Exceptions::MacroException("Expected " + expected, Error::ErrorType::MacroExpanderSyntaxError, tokens[std::min(index, tokens.size() - 1)]->GetSource());
+		return tokens[index++];
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Eye/Lexer/Token.h"
+#include "Eye/Error/Error.h"
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+
+namespace Eye
+{
+	struct MacroDefinition
+	{
+		std::string Name;
+		// Hash of the whole Definition, Expansions are cached per Id so equal Definitions in other Sources share them (see MacroExpansionCache)
+		size_t Id = 0;
+		// Name, Parameters & Body as Text, guards Cache Hits against Id Collisions
+		std::string Text;
+		std::vector<std::string> Parameters;
+		std::vector<Token> Body;
+		// Identifiers the Body declares itself ('int x', 'int[8] x', 'V x'), renamed per Expansion so they never capture or shadow the Caller's
+		std::unordered_set<std::string> Locals;
+		// From 'macro' to the closing '}'
+		EyeSource Source;
+	};
+
+	// Body with its Arguments substituted, Invocations left in place
+	struct MacroExpansion
+	{
+		std::string ArgumentText;
+		std::string DefinitionText;
+		std::vector<Token> Tokens;
+		std::vector<size_t> LocalTokens;
+		bool HasInvocations = false;
+	};
+
+	/*
+		MacroExpansionCache
+			Substituted Bodies keyed by Macro Id combined with the Argument Token Hash, shared by every MacroExpander handed the Cache.
+			Thread-Safe, Expansions stay valid for as long as they are held. Emptied once it holds MaxSize Expansions.
+	*/
+	class MacroExpansionCache
+	{
+	public:
+		static constexpr size_t MaxSize = 1 << 16;
+
+	public:
+		std::shared_ptr<const MacroExpansion> Find(size_t key, const std::string& definitionText, const std::string& argumentText);
+		// Returns the cached Expansion if another Expander inserted an equal one first
+		std::shared_ptr<const MacroExpansion> Insert(size_t key, std::shared_ptr<const MacroExpansion> expansion);
+		void Clear();
+		size_t GetSize();
+
+	private:
+		std::mutex m_Mutex;
+		std::unordered_map<size_t, std::vector<std::shared_ptr<const MacroExpansion>>> m_Expansions;
+		size_t m_Size = 0;
+	};
+
+	/*
+		MacroExpander
+			Runs between Lexer & Parser on the Token Stream.
+
+			MacroDefinition
+				: 'macro' Identifier '(' OptionalIdentifierList ')' '{' Tokens '}'
+				;
+
+			MacroInvocation
+				: Identifier '!' '(' OptionalArgumentList ')'
+				;
+
+			Arguments are balanced Token Sequences split on Top-Level Commas, the Expansion is rescanned for Invocations.
+			Expansions are hygienic: Identifiers declared by the Body get a Name ("x#3") no Source can spell.
+			Expanded Tokens report the Invocation as their Source.
+			Substituted Bodies are cached by Macro Id & Argument Token Hash in a MacroExpansionCache, so repeated Invocations skip Argument Substitution.
+			ASTGenerator & ModuleLoader hand every Expander they create the same Cache, so Sources with equal Definitions share Expansions.
+	*/
+	class MacroExpander
+	{
+	public:
+		MacroExpander(std::shared_ptr<MacroExpansionCache> cache = std::make_shared<MacroExpansionCache>());
+
+		// definitions are visible from the first Token on, i.e the Definitions preceding a re-parsed Region (see IncrementalParser)
+		std::expected<std::vector<std::unique_ptr<Token>>, Error::Error> Expand(std::vector<std::unique_ptr<Token>>&& tokens, const std::vector<MacroDefinition>& definitions = {});
+		void ClearCache();
+
+		// Definitions of the last Expand, including the given ones
+		inline const std::unordered_map<std::string, MacroDefinition>& GetMacros() const { return m_Macros; }
+
+		inline size_t GetExpansionCount() const { return m_ExpansionCount; }
+		inline size_t GetCacheHitCount() const { return m_CacheHitCount; }
+		inline size_t GetCacheSize() const { return m_Cache->GetSize(); }
+
+		static constexpr size_t MaxExpansionDepth = 64;
+
+	private:
+		using TokenView = std::vector<const Token*>;
+
+		void DefineMacro(const TokenView& tokens, size_t& index);
+		bool IsInvocation(const TokenView& tokens, size_t index) const;
+		std::vector<std::vector<Token>> ParseArguments(const TokenView& tokens, size_t& index);
+		void ExpandInvocation(const TokenView& tokens, size_t& index, const EyeSource& source, std::vector<std::unique_ptr<Token>>& output, size_t depth);
+		std::shared_ptr<const MacroExpansion> GetExpansion(const MacroDefinition& macro, const std::vector<std::vector<Token>>& arguments);
+
+		size_t SkipTrivia(const TokenView& tokens, size_t index) const;
+		const Token* ExpectToken(const TokenView& tokens, size_t& index, TokenType type, const std::string& expected);
+
+	private:
+		std::unordered_map<std::string, MacroDefinition> m_Macros;
+		std::shared_ptr<MacroExpansionCache> m_Cache;
+		size_t m_NextHygieneId = 0;
+		size_t m_ExpansionCount = 0;
+		size_t m_CacheHitCount = 0;
+	};
+}
@@ -0,0 +1,168 @@
+#include "Eye/ModuleLoader/InterfaceSummary.h"
+#include "Eye/Semantic/Semantic.h"
+#include "Eye/TypeChecker/TypeChecker.h"
+#include "Eye/AST/Statements/FunctionStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace Eye
+{
+	static constexpr std::string_view SummaryMagic = "EYEI";
+	static constexpr uint32_t SummaryVersion = 1;
+
+	static void WriteInteger(std::string& data, uint64_t value, size_t size)
+	{
+		for (size_t i = 0; i < size; i++)
+			data.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+	}
+
+	static bool ReadInteger(std::string_view data, size_t& offset, uint64_t& value, size_t size)
+	{
+		if (data.size() - offset < size)
+			return false;
+
+		value = 0;
+		for (size_t i = 0; i < size; i++)
+			value |= static_cast<uint64_t>(static_cast<unsigned char>(data[offset + i])) << (i * 8);
+		offset += size;
+		return true;
+	}
+
+	static void ExtractFunctions(const std::vector<std::unique_ptr<AST::Statement>>& stmtList, ModuleInterface& moduleInterface)
+	{
+		// Namespace Members are exported by their qualified Names
+		for (const auto& stmt : stmtList)
+		{
+			if (stmt->GetType() == AST::StatementType::NamespaceStatement)
+				ExtractFunctions(static_cast<const AST::NamespaceStatement*>(stmt.get())->GetStatementList(), moduleInterface);
+			if (stmt->GetType() != AST::StatementType::FunctionStatement)
+				continue;
+
+			const AST::FunctionStatement* functionStmt = static_cast<const AST::FunctionStatement*>(stmt.get());
+			moduleInterface.Functions.push_back({ functionStmt->GetIdentifier()->GetValue(), TypeChecker::GetFunctionType(functionStmt), Semantic::GetFunctionDeclaration(functionStmt) });
+		}
+	}
+
+	std::shared_ptr<const ModuleInterface> InterfaceSummary::Extract(const AST::Program* ast)
+	{
+		auto moduleInterface = std::make_shared<ModuleInterface>();
+		ExtractFunctions(ast->GetStatementList(), *moduleInterface);
+		return moduleInterface;
+	}
+
+	std::string InterfaceSummary::Serialize() const
+	{
+		std::string data(SummaryMagic);
+		WriteInteger(data, SummaryVersion, 4);
+		WriteInteger(data, SourceHash, 8);
+		WriteInteger(data, ImportsHash, 8);
+
+		WriteInteger(data, Interface ? Interface->Functions.size() : 0, 4);
+		if (!Interface)
+			return data;
+
+		for (const auto& function : Interface->Functions)
+		{
+			WriteInteger(data, function.Name.size(), 4);
+			data += function.Name;
+			WriteInteger(data, static_cast<uint64_t>(function.Type.Return), 1);
+			WriteInteger(data, function.Type.Parameters.size(), 4);
+			for (size_t i = 0; i < function.Type.Parameters.size(); i++)
+			{
+				WriteInteger(data, static_cast<uint64_t>(function.Type.Parameters[i]), 1);
+				WriteInteger(data, i < function.Declaration.Parameters.size() ? static_cast<uint64_t>(function.Declaration.Parameters[i]) : static_cast<uint64_t>(FunctionParameterType::Required), 1);
+			}
+		}
+		return data;
+	}
+
+	std::expected<InterfaceSummary, Error::Error> InterfaceSummary::Deserialize(std::string_view data)
+	{
+		auto badSummary = [](const std::string& reason) { return std::unexpected(Error::Error(Error::ErrorType::ModuleLoaderBadSummary, "Bad Interface Summary: " + reason)); };
+
+		if (data.substr(0, SummaryMagic.size()) != SummaryMagic)
+			return badSummary("Missing Magic");
+
+		size_t offset = SummaryMagic.size();
+		uint64_t version = 0, functionCount = 0;
+		InterfaceSummary summary;
+		if (!ReadInteger(data, offset, version, 4) || !ReadInteger(data, offset, summary.SourceHash, 8) || !ReadInteger(data, offset, summary.ImportsHash, 8) || !ReadInteger(data, offset, functionCount, 4))
+			return badSummary("Truncated Header");
+		if (version != SummaryVersion)
+			return badSummary("Unsupported Version " + std::to_string(version));
+
+		auto moduleInterface = std::make_shared<ModuleInterface>();
+		for (uint64_t i = 0; i < functionCount; i++)
+		{
+			ModuleFunction function;
+			uint64_t nameLength = 0, returnType = 0, parameterCount = 0;
+			if (!ReadInteger(data, offset, nameLength, 4) || data.size() - offset < nameLength)
+				return badSummary("Truncated Function Name");
+			function.Name = data.substr(offset, nameLength);
+			offset += nameLength;
+
+			if (!ReadInteger(data, offset, returnType, 1) || !ReadInteger(data, offset, parameterCount, 4))
+				return badSummary("Truncated Function '" + function.Name + "'");
+			if (returnType > static_cast<uint64_t>(Type::Function))
+				return badSummary("Bad Return Type of '" + function.Name + "'");
+			function.Type.Return = static_cast<Type>(returnType);
+
+			for (uint64_t j = 0; j < parameterCount; j++)
+			{
+				uint64_t parameterType = 0, parameterKind = 0;
+				if (!ReadInteger(data, offset, parameterType, 1) || !ReadInteger(data, offset, parameterKind, 1))
+					return badSummary("Truncated Parameters of '" + function.Name + "'");
+				if (parameterType > static_cast<uint64_t>(Type::Function) || parameterKind > FunctionParameterType::Default)
+					return badSummary("Bad Parameter of '" + function.Name + "'");
+
+				function.Type.Parameters.push_back(static_cast<Type>(parameterType));
+				function.Declaration.Parameters.push_back(static_cast<FunctionParameterType>(parameterKind));
+				if (parameterKind == FunctionParameterType::Default)
+					function.Declaration.DefaultParameterCount++;
+				else
+					function.Declaration.RequiredParameterCount++;
+			}
+			function.Type.RequiredParameterCount = function.Declaration.RequiredParameterCount;
+			moduleInterface->Functions.push_back(std::move(function));
+		}
+
+		if (offset != data.size())
+			return badSummary("Trailing Data");
+
+		summary.Interface = moduleInterface;
+		return summary;
+	}
+
+	std::expected<bool, Error::Error> InterfaceSummary::Write(const std::string& filepath) const
+	{
+		std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+		std::string data = Serialize();
+		if (!stream.good() || !stream.write(data.data(), data.size()))
+			return std::unexpected(Error::Error(Error::ErrorType::ModuleLoaderBadSummary, "Failed to Write Interface Summary '" + filepath + "'"));
+		return true;
+	}
+
+	std::expected<InterfaceSummary, Error::Error> InterfaceSummary::Read(const std::string& filepath)
+	{
+		std::ifstream stream(filepath, std::ios::binary);
+		if (!stream.good())
+			return std::unexpected(Error::Error(Error::ErrorType::ModuleLoaderBadSummary, "Failed to Open Interface Summary '" + filepath + "'"));
+
+		std::ostringstream ss;
+		ss << stream.rdbuf();
+		return Deserialize(ss.str());
+	}
+
+	uint64_t InterfaceSummary::Hash(std::string_view data)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (char c : data)
+		{
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+}
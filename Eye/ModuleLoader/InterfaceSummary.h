@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Eye/ModuleLoader/ModuleInterface.h"
+#include "Eye/Error/Error.h"
+#include "Eye/AST/Program.h"
+
+#include <expected>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace Eye
+{
+	/*
+		InterfaceSummary
+			Binary, header-like Summary of a checked Module: the Signatures of its Top-Level & Namespace Functions.
+			Importers seed their Semantic & TypeChecker Function Environments from it without the Module's Body.
+			Layout (Little-Endian): "EYEI" Version:u32 SourceHash:u64 ImportsHash:u64 FunctionCount:u32
+				{ NameLength:u32 Name Return:u8 ParameterCount:u32 { Type:u8 ParameterType:u8 }* }*
+	*/
+	struct InterfaceSummary
+	{
+		// Hash of the summarized Source, the Summary is stale once the Source changes
+		uint64_t SourceHash = 0;
+		// Hash of the Import Signatures the Source was checked against
+		uint64_t ImportsHash = 0;
+		std::shared_ptr<const ModuleInterface> Interface;
+
+		static std::shared_ptr<const ModuleInterface> Extract(const AST::Program* ast);
+
+		std::string Serialize() const;
+		static std::expected<InterfaceSummary, Error::Error> Deserialize(std::string_view data);
+		std::expected<bool, Error::Error> Write(const std::string& filepath) const;
+		static std::expected<InterfaceSummary, Error::Error> Read(const std::string& filepath);
+
+		// FNV-1a, stable across Runs unlike std::hash
+		static uint64_t Hash(std::string_view data);
+	};
+}
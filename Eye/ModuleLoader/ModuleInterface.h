@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Eye/TypeChecker/Type.h"
+#include "Eye/Semantic/Types.h"
+
+#include <memory>
+#include <unordered_map>
+
+namespace Eye
+{
+	struct ModuleFunction
+	{
+		std::string Name;
+		FunctionType Type;
+		FunctionDeclaration Declaration;
+	};
+
+	/*
+		ModuleInterface
+			What a checked Module exports: its Top-Level Functions.
+			Importers are validated & type checked against the Interface alone, never against the Module's Body.
+	*/
+	struct ModuleInterface
+	{
+		std::vector<ModuleFunction> Functions;
+
+		const ModuleFunction* GetFunction(const std::string& name) const
+		{
+			for (const auto& function : Functions)
+			{
+				if (function.Name == name)
+					return &function;
+			}
+			return nullptr;
+		}
+
+		// Changes only when an exported Signature changes, Importers are re-checked only then
+		std::string GetSignature() const
+		{
+			std::string signature;
+			for (const auto& function : Functions)
+			{
+				signature += function.Name + "(";
+				for (size_t i = 0; i < function.Type.Parameters.size(); i++)
+				{
+					signature += TypeToString(function.Type.Parameters[i]);
+					if (i < function.Declaration.Parameters.size() && function.Declaration.Parameters[i] == FunctionParameterType::Default)
+						signature += "=";
+					signature += ",";
+				}
+				signature += ")" + TypeToString(function.Type.Return) + ";";
+			}
+			return signature;
+		}
+	};
+
+	// Interfaces of a Program's Imports keyed by the Path written in its ImportStatements
+	using ModuleImports = std::unordered_map<std::string, std::shared_ptr<const ModuleInterface>>;
+}
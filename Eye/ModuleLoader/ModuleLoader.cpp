@@ -0,0 +1,323 @@
+#include "Eye/ModuleLoader/ModuleLoader.h"
+#include "Eye/Utility/Logger.h"
+#include "Eye/Lexer/Lexer.h"
+#include "Eye/MacroExpander/MacroExpander.h"
+#include "Eye/Parser/Parser.h"
+#include "Eye/Semantic/NamespaceResolver.h"
+#include "Eye/Semantic/Semantic.h"
+#include "Eye/TypeChecker/TypeChecker.h"
+#include "Eye/AST/Statements/ImportStatement.h"
+
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <functional>
+#include <algorithm>
+
+namespace Eye
+{
+	ModuleLoader::ModuleLoader(size_t threadCount, bool useSummaries)
+		: m_ThreadPool(threadCount), m_UseSummaries(useSummaries)
+	{
+	}
+
+	std::expected<std::shared_ptr<const SourceModule>, Error::Error> ModuleLoader::Load(const std::string& filepath)
+	{
+		std::lock_guard<std::mutex> loadLock(m_LoadMutex);
+		std::string rootPath = CanonicalPath(filepath);
+
+		// Discovery: every parsed Module submits the Imports nobody has claimed yet
+		std::mutex discoveryMutex;
+		std::unordered_map<std::string, std::shared_ptr<const ParsedModule>> modules;
+		std::function<void(const std::string&)> discover = [this, &discoveryMutex, &modules, &discover](const std::string& path)
+			{
+				std::shared_ptr<const ParsedModule> module;
+				try
+				{
+					module = ParseModule(path);
+				}
+				catch (...)
+				{
+					auto failed = std::make_shared<ParsedModule>();
+					failed->Path = path;
+					failed->Diagnostic = Error::Error(Error::ErrorType::ModuleLoaderBadSource, "Unknown Exception while Loading '" + path + "'");
+					module = failed;
+				}
+
+				std::vector<std::string> unclaimed;
+				{
+					std::lock_guard<std::mutex> lock(discoveryMutex);
+					modules[path] = module;
+					for (const auto& [written, canonical] : module->Imports)
+					{
+						if (modules.emplace(canonical, nullptr).second)
+							unclaimed.push_back(canonical);
+					}
+				}
+
+				for (const auto& importPath : unclaimed)
+					m_ThreadPool.Submit([&discover, importPath]() { discover(importPath); });
+			};
+
+		modules.emplace(rootPath, nullptr);
+		m_ThreadPool.Submit([&discover, &rootPath]() { discover(rootPath); });
+		m_ThreadPool.Wait();
+
+		// Ordering: a Module's Level is one above its deepest Import, Modules of one Level never depend on each other
+		enum class VisitState
+		{
+			Visiting,
+			Visited,
+		};
+		std::unordered_map<std::string, VisitState> states;
+		std::unordered_map<std::string, size_t> levels;
+		std::vector<std::vector<const ParsedModule*>> levelModules;
+		std::vector<std::string> importStack;
+		std::function<std::optional<Error::Error>(const std::string&)> visit = [&](const std::string& path) -> std::optional<Error::Error>
+			{
+				const ParsedModule* module = modules.at(path).get();
+				if (module->Diagnostic)
+					return module->Diagnostic;
+
+				states[path] = VisitState::Visiting;
+				importStack.push_back(path);
+				size_t level = 0;
+				for (const auto& [written, canonical] : module->Imports)
+				{
+					auto state = states.find(canonical);
+					if (state != states.end() && state->second == VisitState::Visiting)
+					{
+						std::string cycle;
+						for (auto it = std::find(importStack.begin(), importStack.end(), canonical); it != importStack.end(); it++)
+							cycle += "'" + *it + "' -> ";
+						return Error::Error(Error::ErrorType::ModuleLoaderCyclicImport, "Cyclic Import " + cycle + "'" + canonical + "'");
+					}
+
+					if (state == states.end())
+					{
+						if (auto error = visit(canonical))
+							return error;
+					}
+					level = std::max(level, levels.at(canonical) + 1);
+				}
+				importStack.pop_back();
+				states[path] = VisitState::Visited;
+				levels[path] = level;
+
+				if (levelModules.size() <= level)
+					levelModules.resize(level + 1);
+				levelModules[level].push_back(module);
+				return std::nullopt;
+			};
+
+		if (auto error = visit(rootPath))
+			return std::unexpected(error.value());
+
+		// Checking
+		std::unordered_map<std::string, std::shared_ptr<const ModuleInterface>> interfaces;
+		for (const auto& level : levelModules)
+		{
+			std::vector<ModuleImports> imports(level.size());
+			for (size_t i = 0; i < level.size(); i++)
+			{
+				for (const auto& [written, canonical] : level[i]->Imports)
+					imports[i][written] = interfaces.at(canonical);
+			}
+
+			std::vector<std::expected<std::shared_ptr<const ModuleInterface>, Error::Error>> results(level.size());
+			for (size_t i = 0; i < level.size(); i++)
+			{
+				m_ThreadPool.Submit([this, &level, &imports, &results, i]()
+					{
+						try
+						{
+							results[i] = CheckModule(level[i], imports[i]);
+						}
+						catch (...)
+						{
+							results[i] = std::unexpected(Error::Error(Error::ErrorType::ModuleLoaderBadSource, "Unknown Exception while Checking '" + level[i]->Path + "'"));
+						}
+					});
+			}
+			m_ThreadPool.Wait();
+
+			for (size_t i = 0; i < level.size(); i++)
+			{
+				if (!results[i].has_value())
+					return std::unexpected(results[i].error());
+				interfaces[level[i]->Path] = results[i].value();
+			}
+		}
+
+		std::unordered_map<std::string, std::shared_ptr<const SourceModule>> sourceModules;
+		for (const auto& level : levelModules)
+		{
+			for (const ParsedModule* module : level)
+			{
+				auto sourceModule = std::make_shared<SourceModule>();
+				sourceModule->Path = module->Path;
+				sourceModule->ContentHash = module->ContentHash;
+				sourceModule->Program = module->Program;
+				sourceModule->Interface = interfaces.at(module->Path);
+				for (const auto& [written, canonical] : module->Imports)
+					sourceModule->Imports[written] = sourceModules.at(canonical);
+				sourceModules[module->Path] = sourceModule;
+			}
+		}
+
+		return sourceModules.at(rootPath);
+	}
+
+	void ModuleLoader::Clear()
+	{
+		std::lock_guard<std::mutex> loadLock(m_LoadMutex);
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		m_ParseCache.clear();
+		m_InterfaceCache.clear();
+		m_MacroExpansionCache->Clear();
+	}
+
+	std::shared_ptr<const ModuleLoader::ParsedModule> ModuleLoader::ParseModule(const std::string& path)
+	{
+		auto module = std::make_shared<ParsedModule>();
+		module->Path = path;
+
+		std::ifstream stream(path, std::ios::binary);
+		if (!stream.good())
+		{
+			module->Diagnostic = Error::Error(Error::ErrorType::ModuleLoaderBadSource, "Failed to Open Source '" + path + "'");
+			return module;
+		}
+
+		std::ostringstream ss;
+		ss << stream.rdbuf();
+		module->Content = ss.str();
+		module->ContentHash = std::hash<std::string>()(module->Content);
+
+		{
+			std::lock_guard<std::mutex> lock(m_CacheMutex);
+			auto it = m_ParseCache.find(path);
+			if (it != m_ParseCache.end() && it->second->ContentHash == module->ContentHash && it->second->Content == module->Content)
+				return it->second;
+		}
+
+		m_ParsedCount++;
+		Lexer lexer;
+		auto lexerRes = lexer.Tokenize(EyeSource(path, EyeSourceType::File), module->Content);
+		if (!lexerRes.has_value())
+		{
+			module->Diagnostic = lexerRes.error();
+			return module;
+		}
+
+		MacroExpander macroExpander(m_MacroExpansionCache);
+		auto macroExpanderRes = macroExpander.Expand(std::move(lexerRes.value()));
+		if (!macroExpanderRes.has_value())
+		{
+			module->Diagnostic = macroExpanderRes.error();
+			return module;
+		}
+
+		Parser parser;
+		auto parserRes = parser.Parse(std::move(macroExpanderRes.value()));
+		if (!parserRes.has_value())
+		{
+			module->Diagnostic = parserRes.error();
+			return module;
+		}
+		module->Program = std::move(parserRes.value());
+
+		std::filesystem::path directory = std::filesystem::path(path).parent_path();
+		for (const auto& stmt : module->Program->GetStatementList())
+		{
+			if (stmt->GetType() != AST::StatementType::ImportStatement)
+				continue;
+
+			const std::string& written = static_cast<const AST::ImportStatement*>(stmt.get())->GetPath()->GetValue<AST::LiteralStringType>();
+			module->Imports.emplace_back(written, CanonicalPath((directory / written).string()));
+		}
+
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		m_ParseCache[path] = module;
+		return module;
+	}
+
+	std::expected<std::shared_ptr<const ModuleInterface>, Error::Error> ModuleLoader::CheckModule(const ParsedModule* module, const ModuleImports& imports)
+	{
+		// Keyed by Content & the Signatures of the Imports, never by the Imports' Bodies
+		std::vector<std::string> importKeys;
+		for (const auto& [written, moduleInterface] : imports)
+			importKeys.push_back(written + "{" + moduleInterface->GetSignature() + "}");
+		std::sort(importKeys.begin(), importKeys.end());
+
+		std::string importsKey;
+		for (const auto& importKey : importKeys)
+			importsKey += "|" + importKey;
+		std::string key = std::to_string(module->ContentHash) + ":" + std::to_string(module->Content.size()) + importsKey;
+
+		{
+			std::lock_guard<std::mutex> lock(m_CacheMutex);
+			auto it = m_InterfaceCache.find(key);
+			if (it != m_InterfaceCache.end() && it->second.Content == module->Content)
+				return it->second.Interface;
+		}
+
+		InterfaceSummary summary;
+		if (m_UseSummaries)
+		{
+			summary.SourceHash = InterfaceSummary::Hash(module->Content);
+			summary.ImportsHash = InterfaceSummary::Hash(importsKey);
+
+			auto stored = InterfaceSummary::Read(SummaryPath(module->Path));
+			if (stored.has_value() && stored->SourceHash == summary.SourceHash && stored->ImportsHash == summary.ImportsHash)
+			{
+				std::lock_guard<std::mutex> lock(m_CacheMutex);
+				m_InterfaceCache[key] = { module->Content, stored->Interface };
+				return stored->Interface;
+			}
+		}
+
+		m_CheckedCount++;
+		NamespaceResolver namespaceResolver;
+		auto namespaceResolverRes = namespaceResolver.Resolve(module->Program.get(), imports);
+		if (!namespaceResolverRes)
+			return std::unexpected(namespaceResolverRes.error());
+
+		Semantic semanticValidator;
+		auto semanticRes = semanticValidator.Validate(module->Program.get(), imports);
+		if (!semanticRes)
+			return std::unexpected(semanticRes.error());
+
+		TypeChecker typeChecker;
+		auto typeCheckerRes = typeChecker.TypeCheck(module->Program.get(), imports);
+		if (!typeCheckerRes.has_value())
+			return std::unexpected(typeCheckerRes.error());
+
+		auto moduleInterface = InterfaceSummary::Extract(module->Program.get());
+		if (m_UseSummaries)
+		{
+			summary.Interface = moduleInterface;
+			// A missing Summary only costs the next Loader a re-check
+			if (auto writeRes = summary.Write(SummaryPath(module->Path)); !writeRes.has_value())
+				EYE_LOG_WARN(writeRes.error().GetMessage());
+		}
+
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		m_InterfaceCache[key] = { module->Content, moduleInterface };
+		return moduleInterface;
+	}
+
+	std::string ModuleLoader::SummaryPath(const std::string& path)
+	{
+		return path + ".eyei";
+	}
+
+	std::string ModuleLoader::CanonicalPath(const std::string& path)
+	{
+		std::error_code ec;
+		std::filesystem::path canonical = std::filesystem::weakly_canonical(path, ec);
+		if (ec)
+			return std::filesystem::absolute(path, ec).lexically_normal().string();
+		return canonical.string();
+	}
+}
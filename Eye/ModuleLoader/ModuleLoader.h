@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Eye/ModuleLoader/ModuleInterface.h"
+#include "Eye/ModuleLoader/InterfaceSummary.h"
+#include "Eye/MacroExpander/MacroExpander.h"
+#include "Eye/Utility/ThreadPool.h"
+#include "Eye/Error/Error.h"
+#include "Eye/AST/Program.h"
+
+#include <expected>
+#include <optional>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+
+namespace Eye
+{
+	struct SourceModule
+	{
+		// Canonical Path of the File
+		std::string Path;
+		size_t ContentHash = 0;
+		std::shared_ptr<const AST::Program> Program;
+		std::shared_ptr<const ModuleInterface> Interface;
+		// Keyed by the Path as written in the Module's ImportStatements
+		std::unordered_map<std::string, std::shared_ptr<const SourceModule>> Imports;
+	};
+
+	/*
+		ModuleLoader
+			Loads a File & everything it imports, Import Paths are relative to the importing File.
+			Files are read & parsed in parallel, then checked in parallel one Dependency Level at a time.
+			Parsed Files are reused while their Content is unchanged, checked Interfaces are reused while the Content & the Signatures of its Imports are unchanged,
+			so a Dependent is not re-checked when only the Body of an Import changes. Files with the same Content share one checked Interface.
+			With Summaries, every checked Module's InterfaceSummary is kept next to it as "<Path>.eyei" & reused by later Loaders while still current.
+	*/
+	class ModuleLoader
+	{
+	public:
+		ModuleLoader(size_t threadCount = 0, bool useSummaries = false);
+
+		std::expected<std::shared_ptr<const SourceModule>, Error::Error> Load(const std::string& filepath);
+		void Clear();
+
+		inline size_t GetParsedCount() const { return m_ParsedCount; }
+		inline size_t GetCheckedCount() const { return m_CheckedCount; }
+
+	private:
+		struct ParsedModule
+		{
+			std::string Path;
+			std::string Content;
+			size_t ContentHash = 0;
+			// Namespaces are resolved against the Imports whenever the Module is checked
+			std::shared_ptr<AST::Program> Program;
+			// (Written Path, Canonical Path) of every Top-Level ImportStatement
+			std::vector<std::pair<std::string, std::string>> Imports;
+			std::optional<Error::Error> Diagnostic;
+		};
+
+		struct CheckedModule
+		{
+			std::string Content;
+			std::shared_ptr<const ModuleInterface> Interface;
+		};
+
+		std::shared_ptr<const ParsedModule> ParseModule(const std::string& path);
+		std::expected<std::shared_ptr<const ModuleInterface>, Error::Error> CheckModule(const ParsedModule* module, const ModuleImports& imports);
+		static std::string CanonicalPath(const std::string& path);
+		static std::string SummaryPath(const std::string& path);
+
+	private:
+		ThreadPool m_ThreadPool;
+		bool m_UseSummaries;
+		std::mutex m_LoadMutex;
+		std::mutex m_CacheMutex;
+		std::unordered_map<std::string, std::shared_ptr<const ParsedModule>> m_ParseCache;
+		std::unordered_map<std::string, CheckedModule> m_InterfaceCache;
+		// Shared by every File this Loader parses
+		std::shared_ptr<MacroExpansionCache> m_MacroExpansionCache = std::make_shared<MacroExpansionCache>();
+		std::atomic<size_t> m_ParsedCount = 0;
+		std::atomic<size_t> m_CheckedCount = 0;
+	};
+}
@@ -0,0 +1,594 @@
+#include "Eye/Optimizer/ConstantFolder.h"
+#include "Eye/Utility/Logger.h"
+
+#include <cmath>
+#include <limits>
+
+namespace Eye
+{
+	using SignedIntegerType = long long;
+
+	void ConstantFolder::Fold(AST::Program* ast)
+	{
+		m_ConstantEnvironment = std::make_shared<Environment<std::optional<Constant>>>();
+		m_FoldedExpressionCount = 0;
+		m_PropagatedConstantCount = 0;
+
+		for (auto& stmt : ast->GetStatementList())
+			FoldStatement(stmt.get());
+	}
+
+	void ConstantFolder::FoldStatement(AST::Statement* stmt)
+	{
+		if (!stmt)
+			return;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::ExpressionStatement:
+			FoldExpressionStatement(static_cast<AST::ExpressionStatement*>(stmt));
+			break;
+		case AST::StatementType::BlockStatement:
+			FoldBlockStatement(static_cast<AST::BlockStatement*>(stmt));
+			break;
+		case AST::StatementType::VariableStatement:
+			FoldVariableStatement(static_cast<AST::VariableStatement*>(stmt));
+			break;
+		case AST::StatementType::ControlStatement:
+			FoldControlStatement(static_cast<AST::ControlStatement*>(stmt));
+			break;
+		case AST::StatementType::IterationStatement:
+			FoldIterationStatement(static_cast<AST::IterationStatement*>(stmt));
+			break;
+		case AST::StatementType::FunctionStatement:
+			FoldFunctionStatement(static_cast<AST::FunctionStatement*>(stmt));
+			break;
+		case AST::StatementType::ReturnStatement:
+			FoldReturnStatement(static_cast<AST::ReturnStatement*>(stmt));
+			break;
+		case AST::StatementType::NamespaceStatement:
+			// Members are Globals, their Constants stay visible after the Namespace
+			for (auto& member : static_cast<AST::NamespaceStatement*>(stmt)->GetStatementList())
+				FoldStatement(member.get());
+			break;
+		default:
+			break;
+		}
+	}
+
+	void ConstantFolder::FoldExpressionStatement(AST::ExpressionStatement* exprStmt)
+	{
+		if (auto folded = FoldExpression(exprStmt->GetExpression()))
+			exprStmt->SetExpression(std::move(folded));
+	}
+
+	void ConstantFolder::FoldBlockStatement(AST::BlockStatement* blockStmt, bool createScope)
+	{
+		// Directly Nested Blocks are walked with an explicit Stack instead of one Call per Level
+		struct Frame
+		{
+			AST::BlockStatement* Block;
+			size_t Index;
+			bool Scoped;
+		};
+
+		if (createScope)
+			BeginBlockScope();
+
+		std::vector<Frame> frames = { { blockStmt, 0, createScope } };
+		while (!frames.empty())
+		{
+			Frame& frame = frames.back();
+			if (frame.Index == frame.Block->GetStatementList().size())
+			{
+				if (frame.Scoped)
+					EndBlockScope();
+				frames.pop_back();
+				continue;
+			}
+
+			AST::Statement* stmt = frame.Block->GetStatementList()[frame.Index++].get();
+			if (stmt && stmt->GetType() == AST::StatementType::BlockStatement)
+			{
+				BeginBlockScope();
+				frames.push_back({ static_cast<AST::BlockStatement*>(stmt), 0, true });
+			}
+			else
+			{
+				FoldStatement(stmt);
+			}
+		}
+	}
+
+	void ConstantFolder::FoldVariableStatement(AST::VariableStatement* varStmt)
+	{
+		bool constant = varStmt->GetTypeSpecifier().IsConst();
+
+		for (auto& var : varStmt->GetVariableDeclarationList())
+		{
+			std::optional<Constant> value;
+			if (var->GetInitializer())
+			{
+				if (auto folded = FoldExpression(var->GetInitializer()))
+					var->SetInitializer(std::move(folded));
+				if (constant)
+					value = GetConstant(var->GetInitializer());
+			}
+
+			// 'const float x = 1;' is a Float wherever x is used
+			if (value && value->ValueType == Type::Integer && varStmt->GetTypeSpecifier().Type == AST::DataType::Float)
+				value = Constant{ Type::Float, (FloatType)(SignedIntegerType)std::get<IntegerType>(value->Value) };
+
+			m_ConstantEnvironment->Define(var->GetIdentifier()->GetValue(), value);
+		}
+	}
+
+	void ConstantFolder::FoldControlStatement(AST::ControlStatement* ctrlStmt)
+	{
+		if (auto folded = FoldExpression(ctrlStmt->GetCondition()))
+			ctrlStmt->SetCondition(std::move(folded));
+		FoldStatement(ctrlStmt->GetConsequent());
+		FoldStatement(ctrlStmt->GetAlternate());
+	}
+
+	void ConstantFolder::FoldIterationStatement(AST::IterationStatement* iterStmt)
+	{
+		switch (iterStmt->GetIterationType())
+		{
+		case AST::IterationStatementType::WhileStatement:
+		{
+			AST::WhileStatement* whileStmt = static_cast<AST::WhileStatement*>(iterStmt);
+			if (auto folded = FoldExpression(whileStmt->GetCondition()))
+				whileStmt->SetCondition(std::move(folded));
+			FoldStatement(whileStmt->GetBody());
+			break;
+		}
+		case AST::IterationStatementType::DoWhileStatement:
+		{
+			AST::DoWhileStatement* doStmt = static_cast<AST::DoWhileStatement*>(iterStmt);
+			FoldStatement(doStmt->GetBody());
+			if (auto folded = FoldExpression(doStmt->GetCondition()))
+				doStmt->SetCondition(std::move(folded));
+			break;
+		}
+		case AST::IterationStatementType::ForStatement:
+		{
+			AST::ForStatement* forStmt = static_cast<AST::ForStatement*>(iterStmt);
+			BeginBlockScope();
+
+			if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+				FoldVariableStatement(forStmt->GetInitializer<AST::VariableStatement>());
+			else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+				FoldExpression(forStmt->GetInitializer<AST::Expression>());
+
+			if (forStmt->GetCondition())
+			{
+				if (auto folded = FoldExpression(forStmt->GetCondition()))
+					forStmt->SetCondition(std::move(folded));
+			}
+
+			if (forStmt->GetUpdate())
+			{
+				if (auto folded = FoldExpression(forStmt->GetUpdate()))
+					forStmt->SetUpdate(std::move(folded));
+			}
+
+			FoldStatement(forStmt->GetBody());
+			EndBlockScope();
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void ConstantFolder::FoldFunctionStatement(AST::FunctionStatement* functionStmt)
+	{
+		m_ConstantEnvironment->Define(functionStmt->GetIdentifier()->GetValue(), std::nullopt);
+
+		for (auto& param : functionStmt->GetParameters())
+		{
+			if (param->GetInitializer())
+			{
+				if (auto folded = FoldExpression(param->GetInitializer()))
+					param->SetInitializer(std::move(folded));
+			}
+		}
+
+		BeginBlockScope();
+		for (const auto& param : functionStmt->GetParameters())
+			m_ConstantEnvironment->Define(param->GetIdentifier()->GetValue(), std::nullopt);
+		FoldBlockStatement(functionStmt->GetBody(), false);
+		EndBlockScope();
+	}
+
+	void ConstantFolder::FoldReturnStatement(AST::ReturnStatement* returnStmt)
+	{
+		if (!returnStmt->GetExpression())
+			return;
+
+		if (auto folded = FoldExpression(returnStmt->GetExpression()))
+			returnStmt->SetExpression(std::move(folded));
+	}
+
+	std::unique_ptr<AST::Expression> ConstantFolder::FoldExpression(AST::Expression* expr)
+	{
+		std::unique_ptr<AST::Expression> folded;
+		switch (expr->GetType())
+		{
+		case AST::ExpressionType::IdentifierExpression:
+			folded = FoldIdentifierExpression(static_cast<AST::IdentifierExpression*>(expr));
+			break;
+		case AST::ExpressionType::BinaryExpression:
+			folded = FoldBinaryExpression(static_cast<AST::BinaryExpression*>(expr));
+			break;
+		case AST::ExpressionType::UnaryExpression:
+			folded = FoldUnaryExpression(static_cast<AST::UnaryExpression*>(expr));
+			break;
+		case AST::ExpressionType::AssignmentExpression:
+		{
+			// The Target is written, only a computed Member Property within it may fold
+			AST::AssignmentExpression* assignExpr = static_cast<AST::AssignmentExpression*>(expr);
+			if (assignExpr->GetLHSExpression()->GetType() == AST::ExpressionType::MemberExpression)
+				FoldExpression(assignExpr->GetLHSExpression());
+			if (auto folded = FoldExpression(assignExpr->GetExpression()))
+				assignExpr->SetExpression(std::move(folded));
+			break;
+		}
+		case AST::ExpressionType::PostfixExpression:
+		{
+			AST::PostfixExpression* postfixExpr = static_cast<AST::PostfixExpression*>(expr);
+			if (postfixExpr->GetExpression()->GetType() == AST::ExpressionType::MemberExpression)
+				FoldExpression(postfixExpr->GetExpression());
+			break;
+		}
+		case AST::ExpressionType::MemberExpression:
+		{
+			AST::MemberExpression* memberExpr = static_cast<AST::MemberExpression*>(expr);
+			if (memberExpr->GetObject()->GetType() == AST::ExpressionType::MemberExpression)
+				FoldExpression(memberExpr->GetObject());
+			if (memberExpr->IsComputed())
+			{
+				if (auto folded = FoldExpression(memberExpr->GetProperty()))
+					memberExpr->SetProperty(std::move(folded));
+			}
+			break;
+		}
+		case AST::ExpressionType::CallExpression:
+		{
+			AST::CallExpression* callExpr = static_cast<AST::CallExpression*>(expr);
+			if (callExpr->GetCallee()->GetType() == AST::ExpressionType::MemberExpression)
+				FoldExpression(callExpr->GetCallee());
+			for (auto& arg : callExpr->GetArguments())
+			{
+				if (auto folded = FoldExpression(arg.get()))
+					arg = std::move(folded);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+
+		// A Constant has the Type of the Expression it replaces, the Program's TypeTable stays valid
+		if (folded)
+			folded->SetId(expr->GetId());
+		return folded;
+	}
+
+	std::unique_ptr<AST::Expression> ConstantFolder::FoldIdentifierExpression(AST::IdentifierExpression* identifierExpr)
+	{
+		std::string identifier = identifierExpr->GetValue();
+		if (!m_ConstantEnvironment->IsDefined(identifier))
+			return nullptr;
+
+		const std::optional<Constant>& value = m_ConstantEnvironment->Get(identifier);
+		if (!value)
+			return nullptr;
+
+		m_PropagatedConstantCount++;
+		return MakeConstantExpression(*value, identifierExpr->GetSource());
+	}
+
+	std::unique_ptr<AST::Expression> ConstantFolder::FoldBinaryExpression(AST::BinaryExpression* binaryExpr)
+	{
+		// Left-Deep Chains are folded bottom-up in a Loop, a folded Node replaces its Parent's Left Operand
+		std::vector<AST::BinaryExpression*> spine = binaryExpr->GetLeftSpine();
+		if (auto folded = FoldExpression(spine.back()->GetLeft()))
+			spine.back()->SetLeft(std::move(folded));
+
+		for (size_t i = spine.size() - 1; i > 0; i--)
+		{
+			if (auto folded = FoldBinaryOperator(spine[i]))
+			{
+				folded->SetId(spine[i]->GetId());
+				spine[i - 1]->SetLeft(std::move(folded));
+			}
+		}
+		return FoldBinaryOperator(binaryExpr);
+	}
+
+	std::unique_ptr<AST::Expression> ConstantFolder::FoldBinaryOperator(AST::BinaryExpression* binaryExpr)
+	{
+		if (auto folded = FoldExpression(binaryExpr->GetRight()))
+			binaryExpr->SetRight(std::move(folded));
+
+		TokenType op = binaryExpr->GetOperatorType();
+		std::optional<Constant> left = GetConstant(binaryExpr->GetLeft());
+
+		// Short-Circuit: the Right Operand is never evaluated
+		if (left && ((op == TokenType::OperatorLogicalAND && !IsTruthy(*left)) || (op == TokenType::OperatorLogicalOR && IsTruthy(*left))))
+		{
+			m_FoldedExpressionCount++;
+			return MakeConstantExpression({ Type::Boolean, op == TokenType::OperatorLogicalOR }, binaryExpr->GetSource());
+		}
+
+		std::optional<Constant> right = GetConstant(binaryExpr->GetRight());
+		if (!left || !right)
+			return nullptr;
+
+		std::optional<Constant> result = EvaluateBinary(op, *left, *right);
+		if (!result)
+			return nullptr;
+
+		m_FoldedExpressionCount++;
+		return MakeConstantExpression(*result, binaryExpr->GetSource());
+	}
+
+	std::unique_ptr<AST::Expression> ConstantFolder::FoldUnaryExpression(AST::UnaryExpression* unaryExpr)
+	{
+		if (auto folded = FoldExpression(unaryExpr->GetExpression()))
+			unaryExpr->SetExpression(std::move(folded));
+
+		std::optional<Constant> value = GetConstant(unaryExpr->GetExpression());
+		if (!value)
+			return nullptr;
+
+		// Already the Form negative Constants are written in
+		if (unaryExpr->GetOperatorType() == TokenType::OperatorBinaryMinus && unaryExpr->GetExpression()->GetType() == AST::ExpressionType::LiteralExpression)
+		{
+			const AST::LiteralExpression* literalExpr = static_cast<const AST::LiteralExpression*>(unaryExpr->GetExpression());
+			if (literalExpr->GetLiteralType() == AST::LiteralType::Integer && literalExpr->GetValue<AST::LiteralIntegerType>() != 0)
+				return nullptr;
+			if (literalExpr->GetLiteralType() == AST::LiteralType::Float && !std::signbit(literalExpr->GetValue<AST::LiteralFloatType>()))
+				return nullptr;
+		}
+
+		std::optional<Constant> result = EvaluateUnary(unaryExpr->GetOperatorType(), *value);
+		if (!result)
+			return nullptr;
+
+		m_FoldedExpressionCount++;
+		return MakeConstantExpression(*result, unaryExpr->GetSource());
+	}
+
+	std::optional<ConstantFolder::Constant> ConstantFolder::GetConstant(const AST::Expression* expr) const
+	{
+		if (expr->GetType() == AST::ExpressionType::LiteralExpression)
+		{
+			const AST::LiteralExpression* literalExpr = static_cast<const AST::LiteralExpression*>(expr);
+			switch (literalExpr->GetLiteralType())
+			{
+			case AST::LiteralType::Integer:
+				return Constant{ Type::Integer, literalExpr->GetValue<AST::LiteralIntegerType>() };
+			case AST::LiteralType::Float:
+				return Constant{ Type::Float, literalExpr->GetValue<AST::LiteralFloatType>() };
+			case AST::LiteralType::String:
+				return Constant{ Type::String, literalExpr->GetValue<AST::LiteralStringType>() };
+			case AST::LiteralType::Boolean:
+				return Constant{ Type::Boolean, literalExpr->GetValue<AST::LiteralBooleanType>() };
+			default:
+				break;
+			}
+		}
+		else if (expr->GetType() == AST::ExpressionType::UnaryExpression)
+		{
+			const AST::UnaryExpression* unaryExpr = static_cast<const AST::UnaryExpression*>(expr);
+			if (unaryExpr->GetOperatorType() == TokenType::OperatorBinaryMinus && unaryExpr->GetExpression()->GetType() == AST::ExpressionType::LiteralExpression)
+			{
+				std::optional<Constant> value = GetConstant(unaryExpr->GetExpression());
+				if (value && (value->ValueType == Type::Integer || value->ValueType == Type::Float))
+					return EvaluateUnary(TokenType::OperatorBinaryMinus, *value);
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional<ConstantFolder::Constant> ConstantFolder::EvaluateBinary(TokenType op, const Constant& left, const Constant& right) const
+	{
+		auto toFloat = [](const Constant& constant) -> FloatType
+			{
+				if (constant.ValueType == Type::Float)
+					return std::get<FloatType>(constant.Value);
+				return (FloatType)(SignedIntegerType)std::get<IntegerType>(constant.Value);
+			};
+
+		auto makeFloat = [](FloatType value) -> std::optional<Constant>
+			{
+				if (!std::isfinite(value))
+					return std::nullopt;
+				return Constant{ Type::Float, value };
+			};
+
+		bool floating = (left.ValueType == Type::Float || right.ValueType == Type::Float);
+		bool integral = (left.ValueType == Type::Integer && right.ValueType == Type::Integer);
+		IntegerType lhs = (integral ? std::get<IntegerType>(left.Value) : 0);
+		IntegerType rhs = (integral ? std::get<IntegerType>(right.Value) : 0);
+
+		switch (op)
+		{
+		case TokenType::OperatorBinaryPlus:
+			if (left.ValueType == Type::String && right.ValueType == Type::String)
+				return Constant{ Type::String, std::get<StringType>(left.Value) + std::get<StringType>(right.Value) };
+			if (floating)
+				return makeFloat(toFloat(left) + toFloat(right));
+			if (integral)
+				return Constant{ Type::Integer, lhs + rhs };
+			break;
+		case TokenType::OperatorBinaryMinus:
+			if (floating)
+				return makeFloat(toFloat(left) - toFloat(right));
+			if (integral)
+				return Constant{ Type::Integer, lhs - rhs };
+			break;
+		case TokenType::OperatorBinaryStar:
+			if (floating)
+				return makeFloat(toFloat(left) * toFloat(right));
+			if (integral)
+				return Constant{ Type::Integer, lhs * rhs };
+			break;
+		case TokenType::OperatorBinarySlash:
+		case TokenType::OperatorBinaryModulo:
+			if (floating)
+				return makeFloat(op == TokenType::OperatorBinarySlash ? toFloat(left) / toFloat(right) : std::fmod(toFloat(left), toFloat(right)));
+			if (integral)
+			{
+				SignedIntegerType dividend = (SignedIntegerType)lhs;
+				SignedIntegerType divisor = (SignedIntegerType)rhs;
+				if (divisor == 0 || (divisor == -1 && dividend == std::numeric_limits<SignedIntegerType>::min()))
+					return std::nullopt;
+				return Constant{ Type::Integer, (IntegerType)(op == TokenType::OperatorBinarySlash ? dividend / divisor : dividend % divisor) };
+			}
+			break;
+		case TokenType::OperatorRelationalEquals:
+		case TokenType::OperatorRelationalNotEquals:
+		case TokenType::OperatorRelationalSmaller:
+		case TokenType::OperatorRelationalGreater:
+		case TokenType::OperatorRelationalSmallerEquals:
+		case TokenType::OperatorRelationalGreaterEquals:
+		{
+			int compare;
+			if (left.ValueType == Type::String && right.ValueType == Type::String)
+				compare = std::get<StringType>(left.Value).compare(std::get<StringType>(right.Value));
+			else if (left.ValueType == Type::Boolean && right.ValueType == Type::Boolean)
+				compare = (int)std::get<BooleanType>(left.Value) - (int)std::get<BooleanType>(right.Value);
+			else if (floating)
+				compare = (toFloat(left) < toFloat(right) ? -1 : (toFloat(left) > toFloat(right) ? 1 : 0));
+			else if (integral)
+				compare = ((SignedIntegerType)lhs < (SignedIntegerType)rhs ? -1 : ((SignedIntegerType)lhs > (SignedIntegerType)rhs ? 1 : 0));
+			else
+				break;
+
+			if (op == TokenType::OperatorRelationalEquals)
+				return Constant{ Type::Boolean, compare == 0 };
+			else if (op == TokenType::OperatorRelationalNotEquals)
+				return Constant{ Type::Boolean, compare != 0 };
+			else if (op == TokenType::OperatorRelationalSmaller)
+				return Constant{ Type::Boolean, compare < 0 };
+			else if (op == TokenType::OperatorRelationalGreater)
+				return Constant{ Type::Boolean, compare > 0 };
+			else if (op == TokenType::OperatorRelationalSmallerEquals)
+				return Constant{ Type::Boolean, compare <= 0 };
+			return Constant{ Type::Boolean, compare >= 0 };
+		}
+		case TokenType::OperatorLogicalAND:
+			return Constant{ Type::Boolean, IsTruthy(left) && IsTruthy(right) };
+		case TokenType::OperatorLogicalOR:
+			return Constant{ Type::Boolean, IsTruthy(left) || IsTruthy(right) };
+		case TokenType::OperatorBitwiseBinaryAND:
+			if (integral)
+				return Constant{ Type::Integer, lhs & rhs };
+			break;
+		case TokenType::OperatorBitwiseBinaryOR:
+			if (integral)
+				return Constant{ Type::Integer, lhs | rhs };
+			break;
+		case TokenType::OperatorBitwiseBinaryXOR:
+			if (integral)
+				return Constant{ Type::Integer, lhs ^ rhs };
+			break;
+		case TokenType::OperatorBitwiseLeftShift:
+		case TokenType::OperatorBitwiseRightShift:
+			if (integral && rhs < 64)
+				return Constant{ Type::Integer, (op == TokenType::OperatorBitwiseLeftShift ? lhs << rhs : (IntegerType)((SignedIntegerType)lhs >> rhs)) };
+			break;
+		default:
+			break;
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional<ConstantFolder::Constant> ConstantFolder::EvaluateUnary(TokenType op, const Constant& value) const
+	{
+		switch (op)
+		{
+		case TokenType::OperatorBinaryPlus:
+			if (value.ValueType == Type::Integer || value.ValueType == Type::Float)
+				return value;
+			break;
+		case TokenType::OperatorBinaryMinus:
+			if (value.ValueType == Type::Integer)
+				return Constant{ Type::Integer, (IntegerType)0 - std::get<IntegerType>(value.Value) };
+			if (value.ValueType == Type::Float)
+				return Constant{ Type::Float, -std::get<FloatType>(value.Value) };
+			break;
+		case TokenType::OperatorLogicalNOT:
+			// '!' keeps the Operand Type, see TypeChecker::TypeCheckUnaryExpression
+			if (value.ValueType == Type::Boolean)
+				return Constant{ Type::Boolean, !std::get<BooleanType>(value.Value) };
+			if (value.ValueType == Type::Integer)
+				return Constant{ Type::Integer, (IntegerType)(std::get<IntegerType>(value.Value) == 0) };
+			break;
+		case TokenType::OperatorBitwiseNOT:
+			if (value.ValueType == Type::Integer)
+				return Constant{ Type::Integer, ~std::get<IntegerType>(value.Value) };
+			break;
+		default:
+			break;
+		}
+
+		return std::nullopt;
+	}
+
+	std::unique_ptr<AST::Expression> ConstantFolder::MakeConstantExpression(const Constant& constant, const EyeSource& source) const
+	{
+		switch (constant.ValueType)
+		{
+		case Type::Integer:
+		{
+			IntegerType value = std::get<IntegerType>(constant.Value);
+			if ((SignedIntegerType)value >= 0)
+				return std::make_unique<AST::LiteralExpression>(source, (AST::LiteralIntegerType)value);
+			return std::make_unique<AST::UnaryExpression>(source, TokenType::OperatorBinaryMinus, std::make_unique<AST::LiteralExpression>(source, (AST::LiteralIntegerType)((IntegerType)0 - value)));
+		}
+		case Type::Float:
+		{
+			FloatType value = std::get<FloatType>(constant.Value);
+			if (!std::signbit(value))
+				return std::make_unique<AST::LiteralExpression>(source, (AST::LiteralFloatType)value);
+			return std::make_unique<AST::UnaryExpression>(source, TokenType::OperatorBinaryMinus, std::make_unique<AST::LiteralExpression>(source, (AST::LiteralFloatType)-value));
+		}
+		case Type::String:
+			return std::make_unique<AST::LiteralExpression>(source, (AST::LiteralStringType)std::get<StringType>(constant.Value));
+		case Type::Boolean:
+			return std::make_unique<AST::LiteralExpression>(source, (AST::LiteralBooleanType)std::get<BooleanType>(constant.Value));
+		default:
+			break;
+		}
+
+		EYE_LOG_CRITICAL("EYEConstantFolder MakeConstantExpression Unsupported Type {}", TypeToString(constant.ValueType));
+	}
+
+	bool ConstantFolder::IsTruthy(const Constant& constant) const
+	{
+		if (constant.ValueType == Type::Boolean)
+			return std::get<BooleanType>(constant.Value);
+		else if (constant.ValueType == Type::Integer)
+			return std::get<IntegerType>(constant.Value) != 0;
+		else if (constant.ValueType == Type::Float)
+			return std::get<FloatType>(constant.Value) != 0;
+		return !std::get<StringType>(constant.Value).empty();
+	}
+
+	void ConstantFolder::BeginBlockScope()
+	{
+		m_ConstantEnvironment = std::make_shared<Environment<std::optional<Constant>>>(m_ConstantEnvironment);
+	}
+
+	void ConstantFolder::EndBlockScope()
+	{
+		m_ConstantEnvironment = m_ConstantEnvironment->GetParent();
+	}
+}
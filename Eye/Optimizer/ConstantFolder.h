@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Eye/TypeChecker/Type.h"
+#include "Eye/TypeChecker/Environment.h"
+#include "Eye/Lexer/Token.h"
+
+#include "Eye/AST/Program.h"
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Statements/ExpressionStatement.h"
+#include "Eye/AST/Statements/BlockStatement.h"
+#include "Eye/AST/Statements/VariableStatement.h"
+#include "Eye/AST/Statements/ControlStatement.h"
+#include "Eye/AST/Statements/IterationStatement.h"
+#include "Eye/AST/Statements/FunctionStatement.h"
+#include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
+
+#include "Eye/AST/Expressions/Expression.h"
+#include "Eye/AST/Expressions/LiteralExpression.h"
+#include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/Expressions/AssignmentExpression.h"
+#include "Eye/AST/Expressions/BinaryExpression.h"
+#include "Eye/AST/Expressions/CallExpression.h"
+#include "Eye/AST/Expressions/MemberExpression.h"
+#include "Eye/AST/Expressions/UnaryExpression.h"
+#include "Eye/AST/Expressions/PostfixExpression.h"
+
+#include <optional>
+#include <variant>
+
+namespace Eye
+{
+	/*
+		ConstantFolder
+			Replaces Unary/Binary Expressions over Constants with LiteralExpressions and Identifiers of const Variables with their Value.
+			Expects a Type-Checked AST, Integers are 64-bit two's complement and negative Integers stay '-' LiteralExpression.
+			Division/Modulo by Zero, out of range Shifts & non-finite Floats are left for Runtime.
+	*/
+	class ConstantFolder
+	{
+	public:
+		void Fold(AST::Program* ast);
+		inline size_t GetFoldedExpressionCount() const { return m_FoldedExpressionCount; }
+		inline size_t GetPropagatedConstantCount() const { return m_PropagatedConstantCount; }
+
+	private:
+		struct Constant
+		{
+			Type ValueType;
+			std::variant<IntegerType, FloatType, StringType, BooleanType> Value;
+		};
+
+	private:
+		void FoldStatement(AST::Statement* stmt);
+		void FoldExpressionStatement(AST::ExpressionStatement* exprStmt);
+		void FoldBlockStatement(AST::BlockStatement* blockStmt, bool createScope = true);
+		void FoldVariableStatement(AST::VariableStatement* varStmt);
+		void FoldControlStatement(AST::ControlStatement* ctrlStmt);
+		void FoldIterationStatement(AST::IterationStatement* iterStmt);
+		void FoldFunctionStatement(AST::FunctionStatement* functionStmt);
+		void FoldReturnStatement(AST::ReturnStatement* returnStmt);
+
+		// Folds expr in place & returns its Replacement if expr itself is Constant, nullptr otherwise
+		std::unique_ptr<AST::Expression> FoldExpression(AST::Expression* expr);
+		std::unique_ptr<AST::Expression> FoldIdentifierExpression(AST::IdentifierExpression* identifierExpr);
+		std::unique_ptr<AST::Expression> FoldBinaryExpression(AST::BinaryExpression* binaryExpr);
+		// Folds the Right Operand, the Left one is already folded
+		std::unique_ptr<AST::Expression> FoldBinaryOperator(AST::BinaryExpression* binaryExpr);
+		std::unique_ptr<AST::Expression> FoldUnaryExpression(AST::UnaryExpression* unaryExpr);
+
+	private:
+		std::optional<Constant> GetConstant(const AST::Expression* expr) const;
+		std::optional<Constant> EvaluateBinary(TokenType op, const Constant& left, const Constant& right) const;
+		std::optional<Constant> EvaluateUnary(TokenType op, const Constant& value) const;
+		std::unique_ptr<AST::Expression> MakeConstantExpression(const Constant& constant, const EyeSource& source) const;
+		bool IsTruthy(const Constant& constant) const;
+		void BeginBlockScope();
+		void EndBlockScope();
+
+	private:
+		// nullopt shadows outer const Variables of the same Name
+		std::shared_ptr<Environment<std::optional<Constant>>> m_ConstantEnvironment;
+		size_t m_FoldedExpressionCount = 0;
+		size_t m_PropagatedConstantCount = 0;
+	};
+}
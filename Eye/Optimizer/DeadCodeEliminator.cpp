@@ -0,0 +1,495 @@
+#include "Eye/Optimizer/DeadCodeEliminator.h"
+
+#include <unordered_map>
+#include <algorithm>
+
+namespace Eye
+{
+	void DeadCodeEliminator::Eliminate(AST::Program* ast, bool removeUncalledFunctions)
+	{
+		m_Statistics = {};
+
+		EliminateStatementList(ast->GetStatementList());
+
+		// Removing a Variable may leave the Variables its Initializer read unused
+		std::unordered_set<std::string> references;
+		do
+		{
+			references.clear();
+			for (const auto& stmt : ast->GetStatementList())
+				CollectStatementReferences(stmt.get(), references);
+		} while (EliminateUnusedVariables(ast->GetStatementList(), references, true));
+
+		if (removeUncalledFunctions)
+			EliminateUncalledFunctions(ast);
+	}
+
+	std::unique_ptr<AST::Statement> DeadCodeEliminator::EliminateStatement(AST::Statement* stmt)
+	{
+		if (!stmt)
+			return nullptr;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::BlockStatement:
+			EliminateStatementList(static_cast<AST::BlockStatement*>(stmt)->GetStatementList());
+			break;
+		case AST::StatementType::ControlStatement:
+			return EliminateControlStatement(static_cast<AST::ControlStatement*>(stmt));
+		case AST::StatementType::IterationStatement:
+			EliminateIterationStatement(static_cast<AST::IterationStatement*>(stmt));
+			break;
+		case AST::StatementType::FunctionStatement:
+			EliminateStatement(static_cast<AST::FunctionStatement*>(stmt)->GetBody());
+			break;
+		case AST::StatementType::NamespaceStatement:
+			EliminateStatementList(static_cast<AST::NamespaceStatement*>(stmt)->GetStatementList());
+			break;
+		default:
+			break;
+		}
+
+		return nullptr;
+	}
+
+	void DeadCodeEliminator::EliminateStatementList(std::vector<std::unique_ptr<AST::Statement>>& stmtList)
+	{
+		std::vector<std::unique_ptr<AST::Statement>> liveStmtList;
+		liveStmtList.reserve(stmtList.size());
+
+		for (size_t i = 0; i < stmtList.size(); i++)
+		{
+			if (auto replacement = EliminateStatement(stmtList[i].get()))
+				stmtList[i] = std::move(replacement);
+
+			if (!stmtList[i] || IsEmptyBlock(stmtList[i].get()))
+				continue;
+
+			// A Block without Declarations of its own does not need its Scope
+			if (stmtList[i]->GetType() == AST::StatementType::BlockStatement && !HasDeclarations(static_cast<AST::BlockStatement*>(stmtList[i].get())))
+			{
+				for (auto& stmt : static_cast<AST::BlockStatement*>(stmtList[i].get())->GetStatementList())
+					liveStmtList.push_back(std::move(stmt));
+			}
+			else
+			{
+				liveStmtList.push_back(std::move(stmtList[i]));
+			}
+
+			if (IsTerminator(liveStmtList.back().get()))
+			{
+				m_Statistics.UnreachableStatements += std::count_if(stmtList.begin() + i + 1, stmtList.end(), [](const auto& stmt) { return stmt != nullptr; });
+				break;
+			}
+		}
+
+		stmtList = std::move(liveStmtList);
+	}
+
+	std::unique_ptr<AST::Statement> DeadCodeEliminator::EliminateControlStatement(AST::ControlStatement* ctrlStmt)
+	{
+		if (auto replacement = EliminateStatement(ctrlStmt->GetConsequent()))
+			ctrlStmt->SetConsequent(std::move(replacement));
+
+		if (auto replacement = EliminateStatement(ctrlStmt->GetAlternate()))
+			ctrlStmt->SetAlternate(IsEmptyBlock(replacement.get()) ? nullptr : std::move(replacement));
+
+		std::optional<bool> condition = GetLiteralCondition(ctrlStmt->GetCondition());
+		if (!condition)
+			return nullptr;
+
+		m_Statistics.PrunedBranches++;
+		return MakeScopedStatement(*condition ? ctrlStmt->ReleaseConsequent() : ctrlStmt->ReleaseAlternate(), ctrlStmt->GetSource());
+	}
+
+	void DeadCodeEliminator::EliminateIterationStatement(AST::IterationStatement* iterStmt)
+	{
+		switch (iterStmt->GetIterationType())
+		{
+		case AST::IterationStatementType::WhileStatement:
+		{
+			AST::WhileStatement* whileStmt = static_cast<AST::WhileStatement*>(iterStmt);
+			if (auto replacement = EliminateStatement(whileStmt->GetBody()))
+				whileStmt->SetBody(std::move(replacement));
+			break;
+		}
+		case AST::IterationStatementType::DoWhileStatement:
+		{
+			AST::DoWhileStatement* doStmt = static_cast<AST::DoWhileStatement*>(iterStmt);
+			if (auto replacement = EliminateStatement(doStmt->GetBody()))
+				doStmt->SetBody(std::move(replacement));
+			break;
+		}
+		case AST::IterationStatementType::ForStatement:
+		{
+			AST::ForStatement* forStmt = static_cast<AST::ForStatement*>(iterStmt);
+			if (auto replacement = EliminateStatement(forStmt->GetBody()))
+				forStmt->SetBody(std::move(replacement));
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	bool DeadCodeEliminator::EliminateUnusedVariables(std::vector<std::unique_ptr<AST::Statement>>& stmtList, const std::unordered_set<std::string>& references, bool global)
+	{
+		bool eliminated = false;
+
+		for (auto& stmt : stmtList)
+		{
+			if (!stmt)
+				continue;
+
+			if (stmt->GetType() != AST::StatementType::VariableStatement)
+			{
+				eliminated |= EliminateUnusedVariables(stmt.get(), references);
+				continue;
+			}
+
+			AST::VariableStatement* varStmt = static_cast<AST::VariableStatement*>(stmt.get());
+			if (global || varStmt->GetTypeSpecifier().IsConst())
+				continue;
+
+			size_t removed = std::erase_if(varStmt->GetVariableDeclarationList(), [this, &references](const auto& var)
+				{
+					return !references.contains(var->GetIdentifier()->GetValue()) && !(var->GetInitializer() && HasSideEffects(var->GetInitializer()));
+				});
+
+			m_Statistics.UnusedVariables += removed;
+			eliminated |= (removed > 0);
+		}
+
+		std::erase_if(stmtList, [](const auto& stmt)
+			{
+				return stmt && stmt->GetType() == AST::StatementType::VariableStatement && static_cast<AST::VariableStatement*>(stmt.get())->GetVariableDeclarationList().empty();
+			});
+
+		return eliminated;
+	}
+
+	bool DeadCodeEliminator::EliminateUnusedVariables(AST::Statement* stmt, const std::unordered_set<std::string>& references)
+	{
+		if (!stmt)
+			return false;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::BlockStatement:
+			return EliminateUnusedVariables(static_cast<AST::BlockStatement*>(stmt)->GetStatementList(), references, false);
+		case AST::StatementType::ControlStatement:
+		{
+			AST::ControlStatement* ctrlStmt = static_cast<AST::ControlStatement*>(stmt);
+			bool eliminated = EliminateUnusedVariables(ctrlStmt->GetConsequent(), references);
+			return EliminateUnusedVariables(ctrlStmt->GetAlternate(), references) || eliminated;
+		}
+		case AST::StatementType::IterationStatement:
+		{
+			AST::IterationStatement* iterStmt = static_cast<AST::IterationStatement*>(stmt);
+			if (iterStmt->GetIterationType() == AST::IterationStatementType::WhileStatement)
+				return EliminateUnusedVariables(static_cast<AST::WhileStatement*>(iterStmt)->GetBody(), references);
+			else if (iterStmt->GetIterationType() == AST::IterationStatementType::DoWhileStatement)
+				return EliminateUnusedVariables(static_cast<AST::DoWhileStatement*>(iterStmt)->GetBody(), references);
+			else if (iterStmt->GetIterationType() == AST::IterationStatementType::ForStatement)
+				return EliminateUnusedVariables(static_cast<AST::ForStatement*>(iterStmt)->GetBody(), references);
+			break;
+		}
+		case AST::StatementType::FunctionStatement:
+		{
+			// A Function's Locals can only be referenced from within the Function
+			AST::FunctionStatement* functionStmt = static_cast<AST::FunctionStatement*>(stmt);
+			std::unordered_set<std::string> functionReferences;
+			CollectStatementReferences(functionStmt->GetBody(), functionReferences);
+			return EliminateUnusedVariables(functionStmt->GetBody()->GetStatementList(), functionReferences, false);
+		}
+		case AST::StatementType::NamespaceStatement:
+			return EliminateUnusedVariables(static_cast<AST::NamespaceStatement*>(stmt)->GetStatementList(), references, true);
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+	void DeadCodeEliminator::EliminateUncalledFunctions(AST::Program* ast)
+	{
+		std::unordered_map<std::string, const AST::FunctionStatement*> functions;
+		std::unordered_set<std::string> references;
+		CollectFunctions(ast->GetStatementList(), functions, references);
+
+		// Functions reachable from Top-Level Statements, directly or through other reachable Functions
+		std::unordered_set<std::string> reachable;
+		std::vector<std::string> pending(references.begin(), references.end());
+		while (!pending.empty())
+		{
+			std::string name = std::move(pending.back());
+			pending.pop_back();
+
+			auto function = functions.find(name);
+			if (function == functions.end() || !reachable.insert(name).second)
+				continue;
+
+			std::unordered_set<std::string> functionReferences;
+			CollectStatementReferences(function->second, functionReferences);
+			pending.insert(pending.end(), functionReferences.begin(), functionReferences.end());
+		}
+
+		EraseUncalledFunctions(ast->GetStatementList(), reachable);
+	}
+
+	void DeadCodeEliminator::CollectFunctions(const std::vector<std::unique_ptr<AST::Statement>>& stmtList, std::unordered_map<std::string, const AST::FunctionStatement*>& functions, std::unordered_set<std::string>& references) const
+	{
+		for (const auto& stmt : stmtList)
+		{
+			if (stmt && stmt->GetType() == AST::StatementType::FunctionStatement)
+				functions[static_cast<const AST::FunctionStatement*>(stmt.get())->GetIdentifier()->GetValue()] = static_cast<const AST::FunctionStatement*>(stmt.get());
+			else if (stmt && stmt->GetType() == AST::StatementType::NamespaceStatement)
+				CollectFunctions(static_cast<const AST::NamespaceStatement*>(stmt.get())->GetStatementList(), functions, references);
+			else
+				CollectStatementReferences(stmt.get(), references);
+		}
+	}
+
+	void DeadCodeEliminator::EraseUncalledFunctions(std::vector<std::unique_ptr<AST::Statement>>& stmtList, const std::unordered_set<std::string>& reachable)
+	{
+		for (auto& stmt : stmtList)
+		{
+			if (stmt && stmt->GetType() == AST::StatementType::NamespaceStatement)
+				EraseUncalledFunctions(static_cast<AST::NamespaceStatement*>(stmt.get())->GetStatementList(), reachable);
+		}
+
+		m_Statistics.UncalledFunctions += std::erase_if(stmtList, [&reachable](const auto& stmt)
+			{
+				return stmt && stmt->GetType() == AST::StatementType::FunctionStatement && !reachable.contains(static_cast<const AST::FunctionStatement*>(stmt.get())->GetIdentifier()->GetValue());
+			});
+	}
+
+	void DeadCodeEliminator::CollectStatementReferences(const AST::Statement* stmt, std::unordered_set<std::string>& references) const
+	{
+		if (!stmt)
+			return;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::ExpressionStatement:
+			CollectExpressionReferences(static_cast<const AST::ExpressionStatement*>(stmt)->GetExpression(), references);
+			break;
+		case AST::StatementType::BlockStatement:
+			for (const auto& blockStmt : static_cast<const AST::BlockStatement*>(stmt)->GetStatementList())
+				CollectStatementReferences(blockStmt.get(), references);
+			break;
+		case AST::StatementType::VariableStatement:
+			for (const auto& var : static_cast<const AST::VariableStatement*>(stmt)->GetVariableDeclarationList())
+				CollectExpressionReferences(var->GetInitializer(), references);
+			break;
+		case AST::StatementType::ControlStatement:
+		{
+			const AST::ControlStatement* ctrlStmt = static_cast<const AST::ControlStatement*>(stmt);
+			CollectExpressionReferences(ctrlStmt->GetCondition(), references);
+			CollectStatementReferences(ctrlStmt->GetConsequent(), references);
+			CollectStatementReferences(ctrlStmt->GetAlternate(), references);
+			break;
+		}
+		case AST::StatementType::IterationStatement:
+		{
+			const AST::IterationStatement* iterStmt = static_cast<const AST::IterationStatement*>(stmt);
+			if (iterStmt->GetIterationType() == AST::IterationStatementType::WhileStatement)
+			{
+				CollectExpressionReferences(static_cast<const AST::WhileStatement*>(iterStmt)->GetCondition(), references);
+				CollectStatementReferences(static_cast<const AST::WhileStatement*>(iterStmt)->GetBody(), references);
+			}
+			else if (iterStmt->GetIterationType() == AST::IterationStatementType::DoWhileStatement)
+			{
+				CollectExpressionReferences(static_cast<const AST::DoWhileStatement*>(iterStmt)->GetCondition(), references);
+				CollectStatementReferences(static_cast<const AST::DoWhileStatement*>(iterStmt)->GetBody(), references);
+			}
+			else if (iterStmt->GetIterationType() == AST::IterationStatementType::ForStatement)
+			{
+				const AST::ForStatement* forStmt = static_cast<const AST::ForStatement*>(iterStmt);
+				if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+					CollectStatementReferences(forStmt->GetInitializer<AST::VariableStatement>(), references);
+				else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+					CollectExpressionReferences(forStmt->GetInitializer<AST::Expression>(), references);
+				CollectExpressionReferences(forStmt->GetCondition(), references);
+				CollectExpressionReferences(forStmt->GetUpdate(), references);
+				CollectStatementReferences(forStmt->GetBody(), references);
+			}
+			break;
+		}
+		case AST::StatementType::FunctionStatement:
+		{
+			const AST::FunctionStatement* functionStmt = static_cast<const AST::FunctionStatement*>(stmt);
+			for (const auto& param : functionStmt->GetParameters())
+				CollectExpressionReferences(param->GetInitializer(), references);
+			CollectStatementReferences(functionStmt->GetBody(), references);
+			break;
+		}
+		case AST::StatementType::ReturnStatement:
+			CollectExpressionReferences(static_cast<const AST::ReturnStatement*>(stmt)->GetExpression(), references);
+			break;
+		case AST::StatementType::NamespaceStatement:
+			for (const auto& member : static_cast<const AST::NamespaceStatement*>(stmt)->GetStatementList())
+				CollectStatementReferences(member.get(), references);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void DeadCodeEliminator::CollectExpressionReferences(const AST::Expression* expr, std::unordered_set<std::string>& references) const
+	{
+		if (!expr)
+			return;
+
+		switch (expr->GetType())
+		{
+		case AST::ExpressionType::IdentifierExpression:
+			references.insert(static_cast<const AST::IdentifierExpression*>(expr)->GetValue());
+			break;
+		case AST::ExpressionType::AssignmentExpression:
+			// Assigned Variables count as used, their Declaration has to stay for the Assignment
+			CollectExpressionReferences(static_cast<const AST::AssignmentExpression*>(expr)->GetLHSExpression(), references);
+			CollectExpressionReferences(static_cast<const AST::AssignmentExpression*>(expr)->GetExpression(), references);
+			break;
+		case AST::ExpressionType::BinaryExpression:
+		{
+			std::vector<const AST::BinaryExpression*> spine = static_cast<const AST::BinaryExpression*>(expr)->GetLeftSpine();
+			CollectExpressionReferences(spine.back()->GetLeft(), references);
+			for (auto it = spine.rbegin(); it != spine.rend(); it++)
+				CollectExpressionReferences((*it)->GetRight(), references);
+			break;
+		}
+		case AST::ExpressionType::UnaryExpression:
+			CollectExpressionReferences(static_cast<const AST::UnaryExpression*>(expr)->GetExpression(), references);
+			break;
+		case AST::ExpressionType::PostfixExpression:
+			CollectExpressionReferences(static_cast<const AST::PostfixExpression*>(expr)->GetExpression(), references);
+			break;
+		case AST::ExpressionType::MemberExpression:
+			CollectExpressionReferences(static_cast<const AST::MemberExpression*>(expr)->GetObject(), references);
+			if (static_cast<const AST::MemberExpression*>(expr)->IsComputed())
+				CollectExpressionReferences(static_cast<const AST::MemberExpression*>(expr)->GetProperty(), references);
+			break;
+		case AST::ExpressionType::CallExpression:
+			CollectExpressionReferences(static_cast<const AST::CallExpression*>(expr)->GetCallee(), references);
+			for (const auto& arg : static_cast<const AST::CallExpression*>(expr)->GetArguments())
+				CollectExpressionReferences(arg.get(), references);
+			break;
+		default:
+			break;
+		}
+	}
+
+	std::optional<bool> DeadCodeEliminator::GetLiteralCondition(const AST::Expression* expr) const
+	{
+		if (expr->GetType() == AST::ExpressionType::UnaryExpression)
+		{
+			// '-' Literal is how negative Integers are written, non-Zero either way
+			const AST::UnaryExpression* unaryExpr = static_cast<const AST::UnaryExpression*>(expr);
+			if (unaryExpr->GetOperatorType() != TokenType::OperatorBinaryMinus)
+				return std::nullopt;
+			expr = unaryExpr->GetExpression();
+		}
+
+		if (expr->GetType() != AST::ExpressionType::LiteralExpression)
+			return std::nullopt;
+
+		const AST::LiteralExpression* literalExpr = static_cast<const AST::LiteralExpression*>(expr);
+		if (literalExpr->GetLiteralType() == AST::LiteralType::Boolean)
+			return literalExpr->GetValue<AST::LiteralBooleanType>();
+		else if (literalExpr->GetLiteralType() == AST::LiteralType::Integer)
+			return literalExpr->GetValue<AST::LiteralIntegerType>() != 0;
+		return std::nullopt;
+	}
+
+	bool DeadCodeEliminator::HasSideEffects(const AST::Expression* expr) const
+	{
+		if (!expr)
+			return false;
+
+		switch (expr->GetType())
+		{
+		case AST::ExpressionType::AssignmentExpression:
+		case AST::ExpressionType::PostfixExpression:
+		case AST::ExpressionType::CallExpression:
+			return true;
+		case AST::ExpressionType::BinaryExpression:
+		{
+			std::vector<const AST::BinaryExpression*> spine = static_cast<const AST::BinaryExpression*>(expr)->GetLeftSpine();
+			if (HasSideEffects(spine.back()->GetLeft()))
+				return true;
+			for (const AST::BinaryExpression* binaryExpr : spine)
+				if (HasSideEffects(binaryExpr->GetRight()))
+					return true;
+			return false;
+		}
+		case AST::ExpressionType::UnaryExpression:
+		{
+			// Prefix '++x' & '--x' are UnaryExpressions
+			const AST::UnaryExpression* unaryExpr = static_cast<const AST::UnaryExpression*>(expr);
+			if (unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticIncrement || unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticDecrement)
+				return true;
+			return HasSideEffects(unaryExpr->GetExpression());
+		}
+		case AST::ExpressionType::MemberExpression:
+			return HasSideEffects(static_cast<const AST::MemberExpression*>(expr)->GetObject()) || (static_cast<const AST::MemberExpression*>(expr)->IsComputed() && HasSideEffects(static_cast<const AST::MemberExpression*>(expr)->GetProperty()));
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+	bool DeadCodeEliminator::IsTerminator(const AST::Statement* stmt) const
+	{
+		if (!stmt)
+			return false;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::ReturnStatement:
+		case AST::StatementType::BreakStatement:
+		case AST::StatementType::ContinueStatement:
+			return true;
+		case AST::StatementType::BlockStatement:
+		{
+			const auto& stmtList = static_cast<const AST::BlockStatement*>(stmt)->GetStatementList();
+			return std::any_of(stmtList.begin(), stmtList.end(), [this](const auto& blockStmt) { return IsTerminator(blockStmt.get()); });
+		}
+		case AST::StatementType::ControlStatement:
+		{
+			const AST::ControlStatement* ctrlStmt = static_cast<const AST::ControlStatement*>(stmt);
+			return IsTerminator(ctrlStmt->GetConsequent()) && IsTerminator(ctrlStmt->GetAlternate());
+		}
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+	bool DeadCodeEliminator::IsEmptyBlock(const AST::Statement* stmt) const
+	{
+		return stmt->GetType() == AST::StatementType::BlockStatement && static_cast<const AST::BlockStatement*>(stmt)->GetStatementList().empty();
+	}
+
+	bool DeadCodeEliminator::HasDeclarations(const AST::BlockStatement* blockStmt) const
+	{
+		return std::any_of(blockStmt->GetStatementList().begin(), blockStmt->GetStatementList().end(), [](const auto& stmt)
+			{
+				return stmt && (stmt->GetType() == AST::StatementType::VariableStatement || stmt->GetType() == AST::StatementType::FunctionStatement);
+			});
+	}
+
+	std::unique_ptr<AST::Statement> DeadCodeEliminator::MakeScopedStatement(std::unique_ptr<AST::Statement> stmt, const EyeSource& source) const
+	{
+		if (stmt && stmt->GetType() != AST::StatementType::VariableStatement && stmt->GetType() != AST::StatementType::FunctionStatement)
+			return stmt;
+
+		// Keep a Declaration that was the whole Arm in a Scope of its own
+		std::vector<std::unique_ptr<AST::Statement>> stmtList;
+		if (stmt)
+			stmtList.push_back(std::move(stmt));
+		return std::make_unique<AST::BlockStatement>(source, std::move(stmtList));
+	}
+}
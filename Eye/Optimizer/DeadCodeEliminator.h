@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Eye/AST/Program.h"
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Statements/ExpressionStatement.h"
+#include "Eye/AST/Statements/BlockStatement.h"
+#include "Eye/AST/Statements/VariableStatement.h"
+#include "Eye/AST/Statements/ControlStatement.h"
+#include "Eye/AST/Statements/IterationStatement.h"
+#include "Eye/AST/Statements/FunctionStatement.h"
+#include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
+
+#include "Eye/AST/Expressions/Expression.h"
+#include "Eye/AST/Expressions/LiteralExpression.h"
+#include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/Expressions/AssignmentExpression.h"
+#include "Eye/AST/Expressions/BinaryExpression.h"
+#include "Eye/AST/Expressions/CallExpression.h"
+#include "Eye/AST/Expressions/MemberExpression.h"
+#include "Eye/AST/Expressions/UnaryExpression.h"
+#include "Eye/AST/Expressions/PostfixExpression.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <optional>
+
+namespace Eye
+{
+	struct DeadCodeStatistics
+	{
+		size_t PrunedBranches = 0;
+		size_t UnreachableStatements = 0;
+		size_t UnusedVariables = 0;
+		size_t UncalledFunctions = 0;
+	};
+
+	/*
+		DeadCodeEliminator
+			Prunes if/else Arms behind Literal Conditions, Statements after return/break/continue & unused non-const Locals.
+			Top-Level & Namespace Functions no Top-Level Statement can reach are removed on request.
+			Names are matched without Scopes, a Name used anywhere in a Function keeps every Local of that Name.
+	*/
+	class DeadCodeEliminator
+	{
+	public:
+		void Eliminate(AST::Program* ast, bool removeUncalledFunctions = false);
+		inline const DeadCodeStatistics& GetStatistics() const { return m_Statistics; }
+
+	private:
+		// Returns a Replacement for stmt, an empty BlockStatement stands for a removed Statement
+		std::unique_ptr<AST::Statement> EliminateStatement(AST::Statement* stmt);
+		void EliminateStatementList(std::vector<std::unique_ptr<AST::Statement>>& stmtList);
+		std::unique_ptr<AST::Statement> EliminateControlStatement(AST::ControlStatement* ctrlStmt);
+		void EliminateIterationStatement(AST::IterationStatement* iterStmt);
+
+		bool EliminateUnusedVariables(std::vector<std::unique_ptr<AST::Statement>>& stmtList, const std::unordered_set<std::string>& references, bool global);
+		bool EliminateUnusedVariables(AST::Statement* stmt, const std::unordered_set<std::string>& references);
+		void EliminateUncalledFunctions(AST::Program* ast);
+		// Top-Level & Namespace Member Functions by Name, references collects what every other Statement uses
+		void CollectFunctions(const std::vector<std::unique_ptr<AST::Statement>>& stmtList, std::unordered_map<std::string, const AST::FunctionStatement*>& functions, std::unordered_set<std::string>& references) const;
+		void EraseUncalledFunctions(std::vector<std::unique_ptr<AST::Statement>>& stmtList, const std::unordered_set<std::string>& reachable);
+
+	private:
+		void CollectStatementReferences(const AST::Statement* stmt, std::unordered_set<std::string>& references) const;
+		void CollectExpressionReferences(const AST::Expression* expr, std::unordered_set<std::string>& references) const;
+		std::optional<bool> GetLiteralCondition(const AST::Expression* expr) const;
+		bool HasSideEffects(const AST::Expression* expr) const;
+		bool IsTerminator(const AST::Statement* stmt) const;
+		bool IsEmptyBlock(const AST::Statement* stmt) const;
+		bool HasDeclarations(const AST::BlockStatement* blockStmt) const;
+		std::unique_ptr<AST::Statement> MakeScopedStatement(std::unique_ptr<AST::Statement> stmt, const EyeSource& source) const;
+
+	private:
+		DeadCodeStatistics m_Statistics;
+	};
+}
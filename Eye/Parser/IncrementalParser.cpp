@@ -0,0 +1,476 @@
+#include "Eye/Parser/IncrementalParser.h"
+#include "Eye/Lexer/Lexer.h"
+#include "Eye/Utility/FileIO.h"
+
+#include <fstream>
+#include <algorithm>
+#include <ranges>
+#include <limits>
+
+namespace Eye
+{
+	// Replaces vector[first, last) by [begin, end), moves the Tail only if the Count changes
+	template<typename T, typename Iterator>
+	static void ReplaceRange(std::vector<T>& vector, size_t first, size_t last, Iterator begin, Iterator end)
+	{
+		size_t count = std::distance(begin, end);
+		size_t replaced = std::min(count, last - first);
+		std::move(begin, begin + replaced, vector.begin() + first);
+		if (count < last - first)
+			vector.erase(vector.begin() + first + count, vector.begin() + last);
+		else
+			vector.insert(vector.begin() + last, begin + replaced, end);
+	}
+
+	static void RelocateSource(EyeSource& source, long long offsetDelta, long long lineDelta)
+	{
+		source.Line += lineDelta;
+		source.Start += offsetDelta;
+		source.End += offsetDelta;
+	}
+
+	static void RelocateLocation(AST::SourceLocation& location, long long offsetDelta, long long lineDelta)
+	{
+		location.Line += (uint32_t)lineDelta;
+		location.Start += (uint32_t)offsetDelta;
+		if (location.End != std::numeric_limits<uint32_t>::max())
+			location.End += (uint32_t)offsetDelta;
+	}
+
+	IncrementalParserResult IncrementalParser::Parse(const EyeSource& source, const ModuleImports& imports)
+	{
+		if (source.Type == EyeSourceType::File && !std::ifstream(source.Source).good())
+			return std::unexpected(Error::Error(Error::ErrorType::ParserBadSource, "Failed to Open Source '" + source.Source + "'"));
+
+		m_Source = (source.Type == EyeSourceType::File ? source : EyeSource("<document>", EyeSourceType::String));
+		m_Text = (source.Type == EyeSourceType::File ? FileIO::ReadFileContent(source.Source) : source.Source);
+		m_Imports = imports;
+		return ParseDocument();
+	}
+
+	std::expected<bool, Error::Error> IncrementalParser::Edit(size_t offset, size_t removedLength, const std::string& insertedText)
+	{
+		if (offset > m_Text.size() || removedLength > m_Text.size() - offset)
+			return std::unexpected(Error::Error(Error::ErrorType::ParserBadEdit, "Edit [" + std::to_string(offset) + ", " + std::to_string(offset + removedLength) + ") is out of Range"));
+
+		// The Last Edit left the Document Unparsable or the Edit changes what Macros expand to, nothing to Reuse
+		if (!m_Program || TouchesMacroDefinition(offset, offset + removedLength, insertedText))
+		{
+			m_Text.replace(offset, removedLength, insertedText);
+			auto res = ParseDocument();
+			if (!res.has_value())
+				return std::unexpected(res.error());
+			return true;
+		}
+
+		size_t editEnd = offset + removedLength;
+		size_t oldSize = m_Text.size();
+		size_t count = m_StatementRanges.size();
+
+		// Touched Statements: [first, last), Statements Ending right at the Edit or Starting right after it are Touched too
+		size_t first = *std::ranges::partition_point(std::views::iota(size_t(0), count), [this, offset](size_t index) { return GetStatementRange(index).End < offset; });
+		size_t last = *std::ranges::partition_point(std::views::iota(first, count), [this, editEnd](size_t index) { return GetStatementRange(index).Begin <= editEnd; });
+
+		// Statements Starting on the Line the Edit Ends on would Change Columns, Re-Parse them as well
+		ParserStatementRange previous = (first ? GetStatementRange(first - 1) : ParserStatementRange{ 0, 0, 1, 1, 1, 1 });
+		size_t editEndLine = previous.EndLine + std::count(m_Text.begin() + previous.End, m_Text.begin() + editEnd, '\n');
+		while (last < count && GetStatementRange(last).BeginLine == editEndLine)
+			last++;
+
+		long long lineDelta = (long long)std::count(insertedText.begin(), insertedText.end(), '\n') - (long long)std::count(m_Text.begin() + offset, m_Text.begin() + editEnd, '\n');
+		long long offsetDelta = (long long)insertedText.size() - (long long)removedLength;
+		m_Text.replace(offset, removedLength, insertedText);
+
+		std::unique_ptr<AST::Program> program;
+		std::vector<ParserStatementRange> ranges;
+		for (size_t growth = 1;; growth *= 2)
+		{
+			previous = (first ? GetStatementRange(first - 1) : ParserStatementRange{ 0, 0, 1, 1, 1, 1 });
+			size_t regionEnd = (last < count ? GetStatementRange(last).Begin : oldSize) + offsetDelta;
+
+			ranges.clear();
+			auto res = ParseRegion(previous.End, regionEnd, previous.EndLine, previous.EndCol, ranges);
+			if (res.has_value() && (last == count || IsRegionBoundary(regionEnd)))
+			{
+				program = std::move(res.value());
+				break;
+			}
+
+			if (!first && last == count)
+			{
+				m_Program.reset();
+				m_StatementRanges.clear();
+				m_StatementRevisions.clear();
+				m_ShiftIndex = 0;
+				m_ShiftOffset = m_ShiftLine = 0;
+				return std::unexpected(res.has_value() ? Error::Error(Error::ErrorType::ParserSyntaxError, "Unterminated Region at Offset " + std::to_string(regionEnd)) : res.error());
+			}
+
+			first = (first > growth ? first - growth : 0);
+			last = std::min(last + growth, count);
+		}
+
+		// Make the pending Delta cover exactly the Statements after the Region, then add the Edit to it
+		if (m_ShiftIndex < first)
+			ShiftStatements(m_ShiftIndex, first, m_ShiftOffset, m_ShiftLine);
+		else if (m_ShiftIndex > last)
+			ShiftStatements(last, m_ShiftIndex, -m_ShiftOffset, -m_ShiftLine);
+
+		std::vector<std::unique_ptr<AST::Statement>>& regionStatementList = program->GetStatementList();
+		ReplaceRange(m_Program->GetStatementList(), first, last, std::make_move_iterator(regionStatementList.begin()), std::make_move_iterator(regionStatementList.end()));
+		m_Program->SetExpressionIdCount(program->GetExpressionIdCount());
+		ReplaceRange(m_StatementRanges, first, last, ranges.begin(), ranges.end());
+
+		std::vector<size_t> revisions(ranges.size());
+		for (size_t& revision : revisions)
+			revision = m_NextRevision++;
+		ReplaceRange(m_StatementRevisions, first, last, revisions.begin(), revisions.end());
+
+		m_ShiftIndex = first + ranges.size();
+		m_ShiftOffset += offsetDelta;
+		m_ShiftLine += lineDelta;
+
+		for (MacroDefinition& definition : m_MacroDefinitions)
+		{
+			if (definition.Source.Start + 1 >= editEnd)
+				RelocateSource(definition.Source, offsetDelta, lineDelta);
+		}
+
+		m_ReparsedStatementCount = ranges.size();
+		return ResolveNamespaces();
+	}
+
+	const AST::Program* IncrementalParser::GetProgram()
+	{
+		ApplyPendingShift();
+		return m_Program.get();
+	}
+
+	const std::vector<ParserStatementRange>& IncrementalParser::GetStatementRanges()
+	{
+		ApplyPendingShift();
+		return m_StatementRanges;
+	}
+
+	IncrementalParserResult IncrementalParser::ParseDocument()
+	{
+		m_Program.reset();
+		m_StatementRanges.clear();
+		m_StatementRevisions.clear();
+		m_ShiftIndex = 0;
+		m_ShiftOffset = m_ShiftLine = 0;
+		m_MacroDefinitions.clear();
+
+		std::vector<ParserStatementRange> ranges;
+		auto program = ParseRegion(0, m_Text.size(), 1, 1, ranges);
+		if (!program.has_value())
+			return std::unexpected(program.error());
+
+		for (const auto& [name, definition] : m_MacroExpander.GetMacros())
+			m_MacroDefinitions.push_back(definition);
+		std::ranges::sort(m_MacroDefinitions, {}, [](const MacroDefinition& definition) { return definition.Source.Start; });
+
+		m_Program = std::move(program.value());
+		m_StatementRanges = std::move(ranges);
+		for (size_t i = 0; i < m_StatementRanges.size(); i++)
+			m_StatementRevisions.push_back(m_NextRevision++);
+		m_ReparsedStatementCount = m_StatementRanges.size();
+
+		auto namespaceResolverRes = ResolveNamespaces();
+		if (!namespaceResolverRes.has_value())
+			return std::unexpected(namespaceResolverRes.error());
+		return m_Program.get();
+	}
+
+	std::expected<std::unique_ptr<AST::Program>, Error::Error> IncrementalParser::ParseRegion(size_t begin, size_t end, size_t line, size_t col, std::vector<ParserStatementRange>& ranges)
+	{
+		// Lexer Offsets are One Behind the Character they Point at
+		EyeSource source(m_Source.Source, m_Source.Type, line, col, begin, begin - 1);
+
+		Lexer lexer;
+		auto lexerRes = lexer.Tokenize(source, m_Text.substr(begin, end - begin));
+		if (!lexerRes.has_value())
+			return std::unexpected(lexerRes.error());
+
+		std::vector<MacroDefinition> definitions;
+		for (const MacroDefinition& definition : m_MacroDefinitions)
+		{
+			if (definition.Source.Start + 1 < begin)
+				definitions.push_back(definition);
+		}
+
+		auto macroExpanderRes = m_MacroExpander.Expand(std::move(lexerRes.value()), definitions);
+		if (!macroExpanderRes.has_value())
+			return std::unexpected(macroExpanderRes.error());
+
+		// Reused Statements keep their Expression Ids, the Region continues after the highest Id handed out
+		Parser parser;
+		auto parserRes = parser.Parse(std::move(macroExpanderRes.value()), (m_Program ? m_Program->GetExpressionIdCount() : 0));
+		if (!parserRes.has_value())
+			return std::unexpected(parserRes.error());
+
+		ranges = parser.GetStatementRanges();
+		return std::move(parserRes.value());
+	}
+
+	std::expected<bool, Error::Error> IncrementalParser::ResolveNamespaces()
+	{
+		NamespaceResolver namespaceResolver;
+		auto namespaceResolverRes = namespaceResolver.Resolve(m_Program.get(), m_Imports);
+		if (!namespaceResolverRes.has_value())
+			return std::unexpected(namespaceResolverRes.error());
+
+		// Reused Statements resolve as before unless a Namespace or one of its Members was added or removed
+		const SymbolIndex& symbolIndex = *namespaceResolver.GetSymbolIndex();
+		std::string signature;
+		for (uint32_t ns = SymbolIndex::RootNamespace + 1; ns < symbolIndex.GetNamespaceCount(); ns++)
+			signature += symbolIndex.GetNamespaceName(ns) + ";";
+		for (uint32_t symbol = 0; symbol < symbolIndex.GetSymbolCount(); symbol++)
+		{
+			if (symbolIndex.GetSymbol(symbol).Namespace != SymbolIndex::RootNamespace)
+				signature += symbolIndex.GetSymbol(symbol).Name + (symbolIndex.GetSymbol(symbol).Kind == SymbolKind::Function ? "();" : ";");
+		}
+
+		if (signature != m_NamespaceSignature)
+		{
+			for (size_t& revision : m_StatementRevisions)
+				revision = m_NextRevision++;
+			m_NamespaceSignature = std::move(signature);
+		}
+		return true;
+	}
+
+	ParserStatementRange IncrementalParser::GetStatementRange(size_t index) const
+	{
+		ParserStatementRange range = m_StatementRanges[index];
+		if (index >= m_ShiftIndex)
+		{
+			range.Begin += m_ShiftOffset;
+			range.End += m_ShiftOffset;
+			range.BeginLine += m_ShiftLine;
+			range.EndLine += m_ShiftLine;
+		}
+		return range;
+	}
+
+	void IncrementalParser::ShiftStatements(size_t begin, size_t end, long long offsetDelta, long long lineDelta)
+	{
+		if (!offsetDelta && !lineDelta)
+			return;
+
+		for (size_t i = begin; i < end; i++)
+		{
+			ParserStatementRange& range = m_StatementRanges[i];
+			range.Begin += offsetDelta;
+			range.End += offsetDelta;
+			range.BeginLine += lineDelta;
+			range.EndLine += lineDelta;
+			RelocateStatement(m_Program->GetStatementList()[i].get(), offsetDelta, lineDelta);
+		}
+	}
+
+	void IncrementalParser::ApplyPendingShift()
+	{
+		if (!m_Program)
+			return;
+
+		ShiftStatements(m_ShiftIndex, m_StatementRanges.size(), m_ShiftOffset, m_ShiftLine);
+		m_ShiftIndex = m_StatementRanges.size();
+		m_ShiftOffset = m_ShiftLine = 0;
+	}
+
+	bool IncrementalParser::IsRegionBoundary(size_t offset) const
+	{
+		// A Region must not End inside a Token that continues into the next Statement
+		if (!offset)
+			return true;
+
+		char c = m_Text[offset - 1];
+		return (c == ' ' || c == '\t' || c == '\n' || c == ';' || c == '}');
+	}
+
+	bool IncrementalParser::TouchesMacroDefinition(size_t offset, size_t editEnd, const std::string& insertedText) const
+	{
+		for (const MacroDefinition& definition : m_MacroDefinitions)
+		{
+			if (definition.Source.Start + 1 <= editEnd && offset <= definition.Source.End + 2)
+				return true;
+		}
+
+		// 'macro' may be spelled by the Edit together with the Text around it
+		size_t contextBegin = (offset > 4 ? offset - 4 : 0);
+		std::string context = m_Text.substr(contextBegin, offset - contextBegin) + insertedText + m_Text.substr(editEnd, 4);
+		return context.find("macro") != std::string::npos;
+	}
+
+	void IncrementalParser::RelocateStatement(AST::Statement* statement, long long offsetDelta, long long lineDelta)
+	{
+		if (!statement)
+			return;
+
+		RelocateSource(statement->GetSource(), offsetDelta, lineDelta);
+		switch (statement->GetType())
+		{
+		case AST::StatementType::ExpressionStatement:
+			RelocateExpression(static_cast<AST::ExpressionStatement*>(statement)->GetExpression(), offsetDelta, lineDelta);
+			break;
+		case AST::StatementType::BlockStatement:
+			for (auto& stmt : static_cast<AST::BlockStatement*>(statement)->GetStatementList())
+				RelocateStatement(stmt.get(), offsetDelta, lineDelta);
+			break;
+		case AST::StatementType::VariableStatement:
+		{
+			AST::VariableStatement* variableStmt = static_cast<AST::VariableStatement*>(statement);
+			RelocateTypeSpecifier(variableStmt->GetTypeSpecifier(), offsetDelta, lineDelta);
+			for (auto& variableDeclaration : variableStmt->GetVariableDeclarationList())
+			{
+				RelocateExpression(variableDeclaration->GetIdentifier(), offsetDelta, lineDelta);
+				RelocateExpression(variableDeclaration->GetInitializer(), offsetDelta, lineDelta);
+			}
+			break;
+		}
+		case AST::StatementType::ControlStatement:
+		{
+			AST::ControlStatement* controlStmt = static_cast<AST::ControlStatement*>(statement);
+			RelocateExpression(controlStmt->GetCondition(), offsetDelta, lineDelta);
+			RelocateStatement(controlStmt->GetConsequent(), offsetDelta, lineDelta);
+			RelocateStatement(controlStmt->GetAlternate(), offsetDelta, lineDelta);
+			break;
+		}
+		case AST::StatementType::IterationStatement:
+		{
+			AST::IterationStatement* iterationStmt = static_cast<AST::IterationStatement*>(statement);
+			if (iterationStmt->GetIterationType() == AST::IterationStatementType::WhileStatement)
+			{
+				AST::WhileStatement* whileStmt = static_cast<AST::WhileStatement*>(iterationStmt);
+				RelocateExpression(whileStmt->GetCondition(), offsetDelta, lineDelta);
+				RelocateStatement(whileStmt->GetBody(), offsetDelta, lineDelta);
+			}
+			else if (iterationStmt->GetIterationType() == AST::IterationStatementType::DoWhileStatement)
+			{
+				AST::DoWhileStatement* doWhileStmt = static_cast<AST::DoWhileStatement*>(iterationStmt);
+				RelocateExpression(doWhileStmt->GetCondition(), offsetDelta, lineDelta);
+				RelocateStatement(doWhileStmt->GetBody(), offsetDelta, lineDelta);
+			}
+			else if (iterationStmt->GetIterationType() == AST::IterationStatementType::ForStatement)
+			{
+				AST::ForStatement* forStmt = static_cast<AST::ForStatement*>(iterationStmt);
+				if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+					RelocateStatement(forStmt->GetInitializer<AST::VariableStatement>(), offsetDelta, lineDelta);
+				else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+					RelocateExpression(forStmt->GetInitializer<AST::Expression>(), offsetDelta, lineDelta);
+				RelocateExpression(forStmt->GetCondition(), offsetDelta, lineDelta);
+				RelocateExpression(forStmt->GetUpdate(), offsetDelta, lineDelta);
+				RelocateStatement(forStmt->GetBody(), offsetDelta, lineDelta);
+			}
+			break;
+		}
+		case AST::StatementType::FunctionStatement:
+		{
+			AST::FunctionStatement* functionStmt = static_cast<AST::FunctionStatement*>(statement);
+			RelocateTypeSpecifier(functionStmt->GetReturnTypeSpecifier(), offsetDelta, lineDelta);
+			RelocateExpression(functionStmt->GetIdentifier(), offsetDelta, lineDelta);
+			for (auto& parameter : functionStmt->GetParameters())
+			{
+				RelocateTypeSpecifier(parameter->GetTypeSpecifier(), offsetDelta, lineDelta);
+				RelocateExpression(parameter->GetIdentifier(), offsetDelta, lineDelta);
+				RelocateExpression(parameter->GetInitializer(), offsetDelta, lineDelta);
+			}
+			RelocateStatement(functionStmt->GetBody(), offsetDelta, lineDelta);
+			break;
+		}
+		case AST::StatementType::ReturnStatement:
+			RelocateExpression(static_cast<AST::ReturnStatement*>(statement)->GetExpression(), offsetDelta, lineDelta);
+			break;
+		case AST::StatementType::ImportStatement:
+			RelocateExpression(static_cast<AST::ImportStatement*>(statement)->GetPath(), offsetDelta, lineDelta);
+			break;
+		case AST::StatementType::StructStatement:
+		{
+			AST::StructStatement* structStmt = static_cast<AST::StructStatement*>(statement);
+			RelocateExpression(structStmt->GetIdentifier(), offsetDelta, lineDelta);
+			for (auto& field : structStmt->GetFields())
+			{
+				RelocateTypeSpecifier(field->GetTypeSpecifier(), offsetDelta, lineDelta);
+				RelocateExpression(field->GetIdentifier(), offsetDelta, lineDelta);
+			}
+			break;
+		}
+		case AST::StatementType::NamespaceStatement:
+		{
+			AST::NamespaceStatement* namespaceStmt = static_cast<AST::NamespaceStatement*>(statement);
+			RelocateExpression(namespaceStmt->GetIdentifier(), offsetDelta, lineDelta);
+			for (auto& stmt : namespaceStmt->GetStatementList())
+				RelocateStatement(stmt.get(), offsetDelta, lineDelta);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void IncrementalParser::RelocateExpression(AST::Expression* expression, long long offsetDelta, long long lineDelta)
+	{
+		if (!expression)
+			return;
+
+		RelocateSource(expression->GetSource(), offsetDelta, lineDelta);
+		switch (expression->GetType())
+		{
+		case AST::ExpressionType::BinaryExpression:
+		{
+			// Left-Deep Chains are relocated in a Loop, only Right Operands recurse
+			std::vector<AST::BinaryExpression*> spine = static_cast<AST::BinaryExpression*>(expression)->GetLeftSpine();
+			for (size_t i = 1; i < spine.size(); i++)
+				RelocateSource(spine[i]->GetSource(), offsetDelta, lineDelta);
+			RelocateExpression(spine.back()->GetLeft(), offsetDelta, lineDelta);
+			for (AST::BinaryExpression* binaryExpr : spine)
+				RelocateExpression(binaryExpr->GetRight(), offsetDelta, lineDelta);
+			break;
+		}
+		case AST::ExpressionType::UnaryExpression:
+		{
+			AST::UnaryExpression* unaryExpr = static_cast<AST::UnaryExpression*>(expression);
+			RelocateExpression(unaryExpr->GetExpression(), offsetDelta, lineDelta);
+			break;
+		}
+		case AST::ExpressionType::PostfixExpression:
+		{
+			AST::PostfixExpression* postfixExpr = static_cast<AST::PostfixExpression*>(expression);
+			RelocateExpression(postfixExpr->GetExpression(), offsetDelta, lineDelta);
+			break;
+		}
+		case AST::ExpressionType::AssignmentExpression:
+		{
+			AST::AssignmentExpression* assignExpr = static_cast<AST::AssignmentExpression*>(expression);
+			RelocateExpression(assignExpr->GetLHSExpression(), offsetDelta, lineDelta);
+			RelocateExpression(assignExpr->GetExpression(), offsetDelta, lineDelta);
+			break;
+		}
+		case AST::ExpressionType::MemberExpression:
+		{
+			AST::MemberExpression* memberExpr = static_cast<AST::MemberExpression*>(expression);
+			RelocateExpression(memberExpr->GetObject(), offsetDelta, lineDelta);
+			RelocateExpression(memberExpr->GetProperty(), offsetDelta, lineDelta);
+			break;
+		}
+		case AST::ExpressionType::CallExpression:
+		{
+			AST::CallExpression* callExpr = static_cast<AST::CallExpression*>(expression);
+			RelocateExpression(callExpr->GetCallee(), offsetDelta, lineDelta);
+			for (auto& argument : callExpr->GetArguments())
+				RelocateExpression(argument.get(), offsetDelta, lineDelta);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	void IncrementalParser::RelocateTypeSpecifier(AST::TypeSpecifier& typeSpecifier, long long offsetDelta, long long lineDelta)
+	{
+		RelocateLocation(typeSpecifier.TypeLocation, offsetDelta, lineDelta);
+		if (typeSpecifier.Qualifiers != AST::TypeQualifier::None)
+			RelocateLocation(typeSpecifier.QualifierLocation, offsetDelta, lineDelta);
+	}
+}
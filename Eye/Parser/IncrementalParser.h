@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Eye/Parser/Parser.h"
+#include "Eye/MacroExpander/MacroExpander.h"
+#include "Eye/Semantic/NamespaceResolver.h"
+#include "Eye/AST/TypeSpecifier.h"
+#include "Eye/Utility/EyeSource.h"
+
+#include <expected>
+#include <string>
+#include <vector>
+
+namespace Eye
+{
+	using IncrementalParserResult = std::expected<const AST::Program*, Error::Error>;
+
+	/*
+		IncrementalParser
+			Keeps a Document and its Program alive across Edits.
+			An Edit re-lexes and re-parses only the Top-Level Statements it touches, every other Statement is reused as is.
+			Reused Statements after an Edit are shifted lazily: one pending Line & Offset Delta covers every Statement from an Index on,
+			an Edit only touches the Statements between it and the previous Edit, GetProgram() & GetStatementRanges() apply the pending Delta.
+			If the touched Statements no longer parse on their own (i.e a '}' was removed) the Region grows until it does or covers the whole Document.
+			Every parsed Top-Level Statement gets a new Revision, a reused Statement keeps its Revision.
+			Tokens of String Documents name their Source '<document>' instead of copying the Text.
+			Regions are macro expanded with the Document's Definitions preceding them, an Edit touching or spelling a Definition re-parses the whole Document.
+			One MacroExpander serves every Region, so hygienic Names stay unique across Edits.
+			After every Parse & Edit the NamespaceResolver runs over the whole Program, as ASTGenerator runs it after Parsing.
+			Namespace Errors are returned but keep the Program, the next Edit resolves again. Adding or removing a Namespace or one of its Members gives every Statement a new Revision.
+	*/
+	class IncrementalParser
+	{
+	public:
+		// imports resolves the Document's ImportStatements, see ModuleLoader
+		IncrementalParserResult Parse(const EyeSource& source, const ModuleImports& imports = {});
+		std::expected<bool, Error::Error> Edit(size_t offset, size_t removedLength, const std::string& insertedText);
+
+		const AST::Program* GetProgram();
+		const std::vector<ParserStatementRange>& GetStatementRanges();
+		inline const std::string& GetText() const { return m_Text; }
+		inline const std::vector<size_t>& GetStatementRevisions() const { return m_StatementRevisions; }
+		inline size_t GetReparsedStatementCount() const { return m_ReparsedStatementCount; }
+
+	private:
+		IncrementalParserResult ParseDocument();
+		std::expected<std::unique_ptr<AST::Program>, Error::Error> ParseRegion(size_t begin, size_t end, size_t line, size_t col, std::vector<ParserStatementRange>& ranges);
+		bool IsRegionBoundary(size_t offset) const;
+		std::expected<bool, Error::Error> ResolveNamespaces();
+		// Whether the Edit changes, removes or adds a MacroDefinition, checked before the Text is replaced
+		bool TouchesMacroDefinition(size_t offset, size_t editEnd, const std::string& insertedText) const;
+
+		// Range of a Statement including the pending Delta
+		ParserStatementRange GetStatementRange(size_t index) const;
+		void ShiftStatements(size_t begin, size_t end, long long offsetDelta, long long lineDelta);
+		void ApplyPendingShift();
+
+		void RelocateStatement(AST::Statement* statement, long long offsetDelta, long long lineDelta);
+		void RelocateExpression(AST::Expression* expression, long long offsetDelta, long long lineDelta);
+		void RelocateTypeSpecifier(AST::TypeSpecifier& typeSpecifier, long long offsetDelta, long long lineDelta);
+
+	private:
+		EyeSource m_Source;
+		std::string m_Text;
+		std::unique_ptr<AST::Program> m_Program;
+		std::vector<ParserStatementRange> m_StatementRanges;
+		std::vector<size_t> m_StatementRevisions;
+		MacroExpander m_MacroExpander;
+		ModuleImports m_Imports;
+		// Namespaces & their Members, Globals outside any Namespace never change what an existing Name resolves to
+		std::string m_NamespaceSignature;
+		// Every MacroDefinition of the Document in Source Order, Sources are kept current on every Edit
+		std::vector<MacroDefinition> m_MacroDefinitions;
+		size_t m_NextRevision = 0;
+		size_t m_ReparsedStatementCount = 0;
+		// Statements from m_ShiftIndex on are still missing m_ShiftOffset & m_ShiftLine
+		size_t m_ShiftIndex = 0;
+		long long m_ShiftOffset = 0;
+		long long m_ShiftLine = 0;
+	};
+}
@@ -2,12 +2,22 @@
 #include "Eye/Utility/Logger.h"
 #include "Eye/Error/Exceptions/SyntaxErrorException.h"
 
+#include <array>
+
 namespace Eye
 {
-	std::expected<std::unique_ptr<AST::Program>, Error::Error> Parser::Parse(std::vector<std::unique_ptr<Token>>&& tokens)
+	Parser::Parser(size_t maxNestingDepth)
+		: m_MaxNestingDepth(maxNestingDepth)
+	{
+	}
+
+	std::expected<std::unique_ptr<AST::Program>, Error::Error> Parser::Parse(std::vector<std::unique_ptr<Token>>&& tokens, uint32_t firstExpressionId)
 	{
 		m_Tokens = std::move(tokens);
 		m_CurrentTokenIndex = 0;
+		m_NextExpressionId = firstExpressionId;
+		m_NestingDepth = 0;
+		m_StatementRanges.clear();
 
 		try
 		{
@@ -33,7 +43,21 @@ namespace Eye
 	*/
 	std::unique_ptr<AST::Program> Parser::Program()
 	{
-		return std::make_unique<AST::Program>(std::move(StatementList()));
+		std::vector<std::unique_ptr<AST::Statement>> statementList;
+		while (m_LookAhead && m_LookAhead->GetType() != TokenType::EndOfFile)
+		{
+			const EyeSource& source = m_LookAhead->GetSource();
+			ParserStatementRange range = { source.Start + 1, 0, source.Line, source.Col, 0, 0 };
+			statementList.push_back(std::move(Statement()));
+
+			range.End = m_LastTokenRange.End;
+			range.EndLine = m_LastTokenRange.EndLine;
+			range.EndCol = m_LastTokenRange.EndCol;
+			m_StatementRanges.push_back(range);
+		}
+		std::unique_ptr<AST::Program> program = std::make_unique<AST::Program>(std::move(statementList));
+		program->SetExpressionIdCount(m_NextExpressionId);
+		return program;
 	}
 
 	/*
@@ -61,10 +85,14 @@ namespace Eye
 			| BreakStatement
 			| FunctionStatement
 			| ReturnStatement
+			| ImportStatement
+			| StructStatement
+			| NamespaceStatement
 			;
 	*/
 	std::unique_ptr<AST::Statement> Parser::Statement()
 	{
+		NestingGuard nestingGuard(*this);
 		switch (m_LookAhead->GetType())
 		{
 		case TokenType::SymbolLeftBrace:
@@ -90,6 +118,16 @@ namespace Eye
 			return FunctionStatement();
 		case TokenType::KeywordReturn:
 			return ReturnStatement();
+		case TokenType::KeywordImport:
+			return ImportStatement();
+		case TokenType::KeywordStruct:
+			return StructStatement();
+		case TokenType::KeywordNamespace:
+			return NamespaceStatement();
+		case TokenType::Identifier:
+			if (IsStructTypeName())
+				return VariableStatement();
+			break;
 		default:
 			break;
 		}
@@ -131,7 +169,8 @@ namespace Eye
 
 	/*
 		VariableStatement
-			: OptionalTypeQualifier DatatypeKeyword VariableDeclarationList ';'
+			: OptionalTypeQualifier DatatypeKeyword OptionalArrayLength VariableDeclarationList ';'
+			| OptionalTypeQualifier Identifier VariableDeclarationList ';'
 			;
 
 		DatatypeKeyword
@@ -151,12 +190,15 @@ namespace Eye
 		if (IsTypeQualifierKeyword(m_LookAhead.get()))
 			typeQualifier = EatToken(m_LookAhead->GetType());
 
-		if (!IsDataTypeKeyword(m_LookAhead.get()))
+		if (!IsDataTypeKeyword(m_LookAhead.get()) && !IsLookAhead(TokenType::Identifier))
 			throw Error::Exceptions::SyntaxErrorException("Unexpected Datatype '" + m_LookAhead->GetValueString() + "'", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
 
 		std::unique_ptr<Token> dataType = EatToken(m_LookAhead->GetType());
 		const auto& varToken = (typeQualifier ? typeQualifier : dataType);
-		std::unique_ptr<AST::VariableStatement> variableStatement = std::make_unique<AST::VariableStatement>(varToken->GetSource(), std::move(typeQualifier), std::move(dataType), std::move(VariableDeclarationList()));
+		AST::TypeSpecifier typeSpecifier(typeQualifier.get(), dataType.get());
+		if (!typeSpecifier.IsStruct())
+			typeSpecifier.ArrayLength = OptionalArrayLength();
+		std::unique_ptr<AST::VariableStatement> variableStatement = std::make_unique<AST::VariableStatement>(varToken->GetSource(), std::move(typeSpecifier), std::move(VariableDeclarationList()));
 		EatToken(TokenType::SymbolSemiColon);
 		return variableStatement;
 	}
@@ -201,6 +243,27 @@ namespace Eye
 		return AssignmentExpression();
 	}
 
+	/*
+		OptionalArrayLength
+			: '[' IntegerLiteral ']'
+			| empty
+			;
+
+		0 when absent, a Length of 0 declares no Elements & is rejected.
+	*/
+	uint32_t Parser::OptionalArrayLength()
+	{
+		if (!IsLookAhead(TokenType::OperatorLeftBracket))
+			return 0;
+
+		EatToken(TokenType::OperatorLeftBracket);
+		std::unique_ptr<Token> length = EatToken(TokenType::LiteralInteger);
+		if (length->GetValue<IntegerType>() == 0 || length->GetValue<IntegerType>() > std::numeric_limits<uint32_t>::max())
+			throw Error::Exceptions::SyntaxErrorException("Invalid Array Length '" + std::to_string(length->GetValue<IntegerType>()) + "'", Error::ErrorType::ParserSyntaxError, length->GetSource());
+		EatToken(TokenType::SymbolRightBracket);
+		return (uint32_t)length->GetValue<IntegerType>();
+	}
+
 	/*
 		ControlStatement
 			: 'if' '(' Expression ')' Statement
@@ -334,7 +397,9 @@ namespace Eye
 
 				std::unique_ptr<Token> dataType = EatToken(m_LookAhead->GetType());
 				const auto& varToken = (typeQualifier ? typeQualifier : dataType);
-				initializer = std::make_unique<AST::VariableStatement>(varToken->GetSource(), std::move(typeQualifier), std::move(dataType), std::move(VariableDeclarationList()));
+				AST::TypeSpecifier typeSpecifier(typeQualifier.get(), dataType.get());
+				typeSpecifier.ArrayLength = OptionalArrayLength();
+				initializer = std::make_unique<AST::VariableStatement>(varToken->GetSource(), std::move(typeSpecifier), std::move(VariableDeclarationList()));
 				initializerType = AST::ForInitializerType::VariableStatement;
 			}
 			else
@@ -383,7 +448,7 @@ namespace Eye
 		EatToken(TokenType::SymbolRightParenthesis);
 
 		std::unique_ptr<AST::BlockStatement> body = BlockStatement();
-		return std::make_unique<AST::FunctionStatement>(functionToken->GetSource(), std::move(returnType), std::move(identifier), std::move(parameters), std::move(body));
+		return std::make_unique<AST::FunctionStatement>(functionToken->GetSource(), AST::TypeSpecifier(nullptr, returnType.get()), std::move(identifier), std::move(parameters), std::move(body));
 	}
 
 	/*
@@ -419,8 +484,8 @@ namespace Eye
 		std::unique_ptr<Token> dataType = EatToken(m_LookAhead->GetType());
 		std::unique_ptr<AST::IdentifierExpression> identifier = IdentifierExpression();
 		if (!IsLookAhead(TokenType::SymbolRightParenthesis) && !IsLookAhead(TokenType::OperatorComma))
-			return std::make_unique<AST::FunctionParameter>(std::move(typeQualifier), std::move(dataType), std::move(identifier), VariableInitializer());
-		return std::make_unique<AST::FunctionParameter>(std::move(typeQualifier), std::move(dataType), std::move(identifier), nullptr);
+			return std::make_unique<AST::FunctionParameter>(AST::TypeSpecifier(typeQualifier.get(), dataType.get()), std::move(identifier), VariableInitializer());
+		return std::make_unique<AST::FunctionParameter>(AST::TypeSpecifier(typeQualifier.get(), dataType.get()), std::move(identifier), nullptr);
 	}
 
 	/*
@@ -437,262 +502,160 @@ namespace Eye
 	}
 
 	/*
-		Expression
-			: AdditiveBinaryExpression
+		ImportStatement
+			: 'import' StringLiteral ';'
 			;
 	*/
-	std::unique_ptr<AST::Expression> Parser::Expression()
+	std::unique_ptr<AST::ImportStatement> Parser::ImportStatement()
 	{
-		return AssignmentExpression();
-	}
-
-	/*
-		AssignmentExpression
-			: LogicalORExpression
-			| LHSExpression AssignmentOperator AssignmentExpression
-	*/
-	std::unique_ptr<AST::Expression> Parser::AssignmentExpression()
-	{
-		std::unique_ptr<AST::Expression> left = LogicalORExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-
-		if (!IsAssignmentOperator(m_LookAhead.get()))
-			return left;
-
-		if (!IsLHSExpression(left.get()))
-			throw Error::Exceptions::SyntaxErrorException("Unexpected LHSExpression '" + m_LookAhead->GetValueString() + "'", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-
-		std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-		return std::make_unique<AST::AssignmentExpression>(op->GetSource(), std::move(op), std::move(left), AssignmentExpression());
+		const auto& importToken = EatToken(TokenType::KeywordImport);
+		if (!IsLookAhead(TokenType::LiteralString))
+			throw Error::Exceptions::SyntaxErrorException("Expected Import Path", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
+		std::unique_ptr<AST::LiteralExpression> path = StringLiteral();
+		EatToken(TokenType::SymbolSemiColon);
+		return std::make_unique<AST::ImportStatement>(importToken->GetSource(), std::move(path));
 	}
 
 	/*
-		LogicalORExpression
-			: LogicalANDExpression '||' LogicalORExpression
-			| LogicalANDExpression
+		StructStatement
+			: 'struct' Identifier '{' StructFieldList '}'
 			;
-	*/
-	std::unique_ptr<AST::Expression> Parser::LogicalORExpression()
-	{
-		std::unique_ptr<AST::Expression> left = LogicalANDExpression();
-		if(!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-
-		while (IsLookAhead(TokenType::OperatorLogicalOR))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = LogicalANDExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
-	}
 
-	/*
-		LogicalANDExpression
-			: BitwiseORExpression '&&' LogicalANDExpression
-			| BitwiseORExpression
+		StructFieldList
+			: StructField
+			| StructFieldList StructField
 			;
 	*/
-	std::unique_ptr<AST::Expression> Parser::LogicalANDExpression()
+	std::unique_ptr<AST::StructStatement> Parser::StructStatement()
 	{
-		std::unique_ptr<AST::Expression> left = BitwiseORExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
+		const auto& structToken = EatToken(TokenType::KeywordStruct);
+		std::unique_ptr<AST::IdentifierExpression> identifier = IdentifierExpression();
 
-		while (IsLookAhead(TokenType::OperatorLogicalAND))
+		EatToken(TokenType::SymbolLeftBrace);
+		std::vector<std::unique_ptr<AST::StructField>> fields;
+		do
 		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = BitwiseORExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
+			fields.push_back(StructField());
+		} while (!IsLookAhead(TokenType::SymbolRightBrace));
+		EatToken(TokenType::SymbolRightBrace);
+
+		return std::make_unique<AST::StructStatement>(structToken->GetSource(), std::move(identifier), std::move(fields));
 	}
 
 	/*
-		BitwiseORExpression
-			: BitwiseXORExpression '|' BitwiseORExpression
-			| BitwiseXORExpression
+		StructField
+			: DataTypeKeyword IdentifierExpression ';'
+			| Identifier IdentifierExpression ';'
 			;
 	*/
-	std::unique_ptr<AST::Expression> Parser::BitwiseORExpression()
+	std::unique_ptr<AST::StructField> Parser::StructField()
 	{
-		std::unique_ptr<AST::Expression> left = BitwiseXORExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
+		if (!IsDataTypeKeyword(m_LookAhead.get()) && !IsLookAhead(TokenType::Identifier))
+			throw Error::Exceptions::SyntaxErrorException("Unexpected Datatype '" + m_LookAhead->GetValueString() + "'", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
 
-		while (IsLookAhead(TokenType::OperatorBitwiseBinaryOR))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = BitwiseXORExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
+		std::unique_ptr<Token> dataType = EatToken(m_LookAhead->GetType());
+		std::unique_ptr<AST::IdentifierExpression> identifier = IdentifierExpression();
+		EatToken(TokenType::SymbolSemiColon);
+		return std::make_unique<AST::StructField>(AST::TypeSpecifier(nullptr, dataType.get()), std::move(identifier));
 	}
 
 	/*
-		BitwiseXORExpression
-			: BitwiseANDExpression '^' BitwiseXORExpression
-			| BitwiseANDExpression
+		NamespaceStatement
+			: 'namespace' IdentifierExpression '{' OptionalNamespaceMemberList '}'
 			;
-	*/
-	std::unique_ptr<AST::Expression> Parser::BitwiseXORExpression()
-	{
-		std::unique_ptr<AST::Expression> left = BitwiseANDExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
 
-		while (IsLookAhead(TokenType::OperatorBitwiseBinaryXOR))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = BitwiseANDExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
-	}
-
-	/*
-		BitwiseANDExpression
-			: EqualityExpression '&' BitwiseANDExpression
-			| EqualityExpression
+		NamespaceMemberList
+			: NamespaceMember
+			| NamespaceMemberList NamespaceMember
 			;
 	*/
-	std::unique_ptr<AST::Expression> Parser::BitwiseANDExpression()
+	std::unique_ptr<AST::NamespaceStatement> Parser::NamespaceStatement()
 	{
-		std::unique_ptr<AST::Expression> left = EqualityExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
+		const auto& namespaceToken = EatToken(TokenType::KeywordNamespace);
+		std::unique_ptr<AST::IdentifierExpression> identifier = IdentifierExpression();
 
-		while (IsLookAhead(TokenType::OperatorBitwiseBinaryAND))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = EqualityExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
+		EatToken(TokenType::SymbolLeftBrace);
+		std::vector<std::unique_ptr<AST::Statement>> statementList;
+		while (m_LookAhead && m_LookAhead->GetType() != TokenType::EndOfFile && !IsLookAhead(TokenType::SymbolRightBrace))
+			statementList.push_back(NamespaceMember());
+		EatToken(TokenType::SymbolRightBrace);
+
+		return std::make_unique<AST::NamespaceStatement>(namespaceToken->GetSource(), std::move(identifier), std::move(statementList));
 	}
 
 	/*
-		EqualityExpression
-			: RelationalExpression EqualityOperator EqualityExpression
-			| RelationalExpression
+		NamespaceMember
+			: VariableStatement
+			| FunctionStatement
+			| NamespaceStatement
 			;
 	*/
-	std::unique_ptr<AST::Expression> Parser::EqualityExpression()
+	std::unique_ptr<AST::Statement> Parser::NamespaceMember()
 	{
-		std::unique_ptr<AST::Expression> left = RelationalExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-
-		while (IsEqualityOperator(m_LookAhead.get()))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = RelationalExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
+		NestingGuard nestingGuard(*this);
+		if (IsLookAhead(TokenType::KeywordFunction))
+			return FunctionStatement();
+		else if (IsLookAhead(TokenType::KeywordNamespace))
+			return NamespaceStatement();
+		else if (IsTypeQualifierKeyword(m_LookAhead.get()) || IsDataTypeKeyword(m_LookAhead.get()) || IsStructTypeName())
+			return VariableStatement();
+		throw Error::Exceptions::SyntaxErrorException("Namespaces may only declare Variables, Functions & Namespaces", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
 	}
 
 	/*
-		RelationalExpression
-			: BitwiseShiftExpression
-			| BitwiseShiftExpression RelationalOperator RelationalExpression
+		Expression
+			: AssignmentExpression
 			;
 	*/
-	std::unique_ptr<AST::Expression> Parser::RelationalExpression()
+	std::unique_ptr<AST::Expression> Parser::Expression()
 	{
-		std::unique_ptr<AST::Expression> left = BitwiseShiftExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-
-		while (IsRelationalOperator(m_LookAhead.get()))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = BitwiseShiftExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
+		return AssignmentExpression();
 	}
 
 	/*
-		BitwiseShiftExpression
-			: AdditiveBinaryExpression
-			| AdditiveBinaryExpression BitwiseShiftOperator BitwiseShiftExpression
-			;
+		AssignmentExpression
+			: BinaryExpression
+			| LHSExpression AssignmentOperator AssignmentExpression
 	*/
-	std::unique_ptr<AST::Expression> Parser::BitwiseShiftExpression()
+	std::unique_ptr<AST::Expression> Parser::AssignmentExpression()
 	{
-		std::unique_ptr<AST::Expression> left = AdditiveBinaryExpression();
+		NestingGuard nestingGuard(*this);
+		std::unique_ptr<AST::Expression> left = BinaryExpression();
 		if (!left)
 			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
 
-		while (IsBitwiseShiftOperator(m_LookAhead.get()))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = AdditiveBinaryExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
-	}
+		if (!IsAssignmentOperator(m_LookAhead.get()))
+			return left;
 
-	/*
-		AdditiveBinaryExpression
-			: MultiplicativeBinaryExpression
-			| AdditiveBinaryExpression AdditiveOperator MultiplicativeBinaryExpression
-			;
-	*/
-	std::unique_ptr<AST::Expression> Parser::AdditiveBinaryExpression()
-	{
-		std::unique_ptr<AST::Expression> left = MultiplicativeBinaryExpression();
-		if (!left)
-			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
+		if (!IsLHSExpression(left.get()))
+			throw Error::Exceptions::SyntaxErrorException("Unexpected LHSExpression '" + m_LookAhead->GetValueString() + "'", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
 
-		while (IsAdditiveOperator(m_LookAhead.get()))
-		{
-			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = MultiplicativeBinaryExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
-		}
-		return left;
+		std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
+		return MakeExpression<AST::AssignmentExpression>(op->GetSource(), op->GetType(), std::move(left), AssignmentExpression());
 	}
 
 	/*
-		MultiplicativeBinaryExpression
+		BinaryExpression
 			: UnaryExpression
-			| MultiplicativeBinaryExpression MultiplicativeOperator UnaryExpression
+			| BinaryExpression BinaryOperator BinaryExpression
 			;
+
+		Precedence Climbing over the Binding Powers of GetBindingPower, every Level is Left-Associative:
+			'||' < '&&' < '|' < '^' < '&' < EqualityOperator < RelationalOperator < BitwiseShiftOperator < AdditiveOperator < MultiplicativeOperator
 	*/
-	std::unique_ptr<AST::Expression> Parser::MultiplicativeBinaryExpression()
+	std::unique_ptr<AST::Expression> Parser::BinaryExpression(uint8_t minBindingPower)
 	{
 		std::unique_ptr<AST::Expression> left = UnaryExpression();
 		if (!left)
 			throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
 
-		while (IsMultiplicativeOperator(m_LookAhead.get()))
+		uint8_t bindingPower = GetBindingPower(m_LookAhead->GetType());
+		while (bindingPower > minBindingPower)
 		{
 			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			std::unique_ptr<AST::Expression> right = UnaryExpression();
-			if (!right)
-				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			left = std::make_unique<AST::BinaryExpression>(op->GetSource(), std::move(op), std::move(left), std::move(right));
+			std::unique_ptr<AST::Expression> right = BinaryExpression(bindingPower);
+			left = MakeExpression<AST::BinaryExpression>(op->GetSource(), op->GetType(), std::move(left), std::move(right));
+			bindingPower = GetBindingPower(m_LookAhead->GetType());
 		}
 		return left;
 	}
@@ -707,11 +670,12 @@ namespace Eye
 	{
 		if (IsUnaryOperator(m_LookAhead.get()))
 		{
+			NestingGuard nestingGuard(*this);
 			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
 			std::unique_ptr<AST::Expression> unaryExpr = UnaryExpression();
 			if (!unaryExpr)
 				throw Error::Exceptions::SyntaxErrorException("Unexpected Expression", Error::ErrorType::ParserSyntaxError, m_LookAhead->GetSource());
-			return std::make_unique<AST::UnaryExpression>(op->GetSource(), std::move(op), std::move(unaryExpr));
+			return MakeExpression<AST::UnaryExpression>(op->GetSource(), op->GetType(), std::move(unaryExpr));
 		}
 
 		return LHSExpression();
@@ -746,14 +710,14 @@ namespace Eye
 			{
 				const auto& op = EatToken(TokenType::OperatorDot);
 				std::unique_ptr<AST::IdentifierExpression> prop = IdentifierExpression();
-				obj = std::make_unique<AST::MemberExpression>(op->GetSource(), std::move(obj), std::move(prop), false);
+				obj = MakeExpression<AST::MemberExpression>(op->GetSource(), std::move(obj), std::move(prop), false);
 			}
 			else if (IsLookAhead(TokenType::OperatorLeftBracket))
 			{
 				const auto& op = EatToken(TokenType::OperatorLeftBracket);
 				std::unique_ptr<AST::Expression> prop = Expression();
 				EatToken(TokenType::SymbolRightBracket);
-				obj = std::make_unique<AST::MemberExpression>(op->GetSource(), std::move(obj), std::move(prop), true);
+				obj = MakeExpression<AST::MemberExpression>(op->GetSource(), std::move(obj), std::move(prop), true);
 			}
 		}
 		return obj;
@@ -771,7 +735,7 @@ namespace Eye
 	*/
 	std::unique_ptr<AST::Expression> Parser::CallExpression(std::unique_ptr<AST::Expression> callee)
 	{
-		std::unique_ptr<AST::Expression> callExpression = std::make_unique<AST::CallExpression>(m_LookAhead->GetSource(), std::move(callee), std::move(CallArguments()));
+		std::unique_ptr<AST::Expression> callExpression = MakeExpression<AST::CallExpression>(m_LookAhead->GetSource(), std::move(callee), std::move(CallArguments()));
 		if (IsLookAhead(TokenType::OperatorLeftParenthesis))
 			callExpression = CallExpression(std::move(callExpression));
 		return callExpression;
@@ -814,7 +778,7 @@ namespace Eye
 		if (IsPostfixOperator(m_LookAhead.get()))
 		{
 			std::unique_ptr<Token> op = EatToken(m_LookAhead->GetType());
-			return std::make_unique<AST::PostfixExpression>(op->GetSource(), std::move(op), std::move(primaryExpression));
+			return MakeExpression<AST::PostfixExpression>(op->GetSource(), op->GetType(), std::move(primaryExpression));
 		}
 		return primaryExpression;
 	}
@@ -823,7 +787,7 @@ namespace Eye
 		PrimaryExpression
 			: LiteralExpression
 			| ParenthesizedExpression
-			| IdentifierExpression
+			| QualifiedIdentifierExpression
 			;
 	*/
 	std::unique_ptr<AST::Expression> Parser::PrimaryExpression()
@@ -832,8 +796,8 @@ namespace Eye
 			return LiteralExpression();
 		else if (IsLookAhead(TokenType::OperatorLeftParenthesis))
 			return ParenthesizedExpression();
-		else if (IsLookAhead(TokenType::Identifier))
-			return IdentifierExpression();
+		else if (IsLookAhead(TokenType::Identifier) || IsLookAhead(TokenType::SymbolScope))
+			return QualifiedIdentifierExpression();
 		return nullptr;
 	}
 
@@ -876,7 +840,7 @@ namespace Eye
 	std::unique_ptr<AST::LiteralExpression> Parser::IntegerLiteral()
 	{
 		std::unique_ptr<Token> token = EatToken(TokenType::LiteralInteger);
-		return std::make_unique<AST::LiteralExpression>(token->GetSource(), (AST::LiteralIntegerType)token->GetValue<IntegerType>());
+		return MakeExpression<AST::LiteralExpression>(token->GetSource(), (AST::LiteralIntegerType)token->GetValue<IntegerType>());
 	}
 
 	/*
@@ -887,7 +851,7 @@ namespace Eye
 	std::unique_ptr<AST::LiteralExpression> Parser::FloatLiteral()
 	{
 		std::unique_ptr<Token> token = EatToken(TokenType::LiteralFloat);
-		return std::make_unique<AST::LiteralExpression>(token->GetSource(), (AST::LiteralFloatType)token->GetValue<FloatType>());
+		return MakeExpression<AST::LiteralExpression>(token->GetSource(), (AST::LiteralFloatType)token->GetValue<FloatType>());
 	}
 
 	/*
@@ -898,7 +862,7 @@ namespace Eye
 	std::unique_ptr<AST::LiteralExpression> Parser::StringLiteral()
 	{
 		std::unique_ptr<Token> token = EatToken(TokenType::LiteralString);
-		return std::make_unique<AST::LiteralExpression>(token->GetSource(), (AST::LiteralStringType)token->GetValue<StringType>());
+		return MakeExpression<AST::LiteralExpression>(token->GetSource(), (AST::LiteralStringType)token->GetValue<StringType>());
 	}
 
 	/*
@@ -909,7 +873,7 @@ namespace Eye
 	std::unique_ptr<AST::LiteralExpression> Parser::BooleanLiteral()
 	{
 		std::unique_ptr<Token> token = EatToken(TokenType::LiteralBoolean);
-		return std::make_unique<AST::LiteralExpression>(token->GetSource(), (AST::LiteralBooleanType)token->GetValue<BooleanType>());
+		return MakeExpression<AST::LiteralExpression>(token->GetSource(), (AST::LiteralBooleanType)token->GetValue<BooleanType>());
 	}
 
 	/*
@@ -920,7 +884,7 @@ namespace Eye
 	std::unique_ptr<AST::LiteralExpression> Parser::NullLiteral()
 	{
 		std::unique_ptr<Token> token = EatToken(TokenType::LiteralNull);
-		return std::make_unique<AST::LiteralExpression>(token->GetSource(), AST::LiteralType::Null);
+		return MakeExpression<AST::LiteralExpression>(token->GetSource(), AST::LiteralType::Null);
 	}
 
 	/*
@@ -944,7 +908,28 @@ namespace Eye
 	std::unique_ptr<AST::IdentifierExpression> Parser::IdentifierExpression()
 	{
 		std::unique_ptr<Token> id = EatToken(TokenType::Identifier);
-		return std::make_unique<AST::IdentifierExpression>(id->GetSource(), std::move(id));
+		return MakeExpression<AST::IdentifierExpression>(id->GetSource(), id->GetValue<StringType>());
+	}
+
+	/*
+		QualifiedIdentifierExpression
+			: IdentifierToken
+			| '::' IdentifierToken
+			| QualifiedIdentifierExpression '::' IdentifierToken
+			;
+
+		One IdentifierExpression named as written, i.e 'Math::Trig::sin', the NamespaceResolver resolves it
+	*/
+	std::unique_ptr<AST::IdentifierExpression> Parser::QualifiedIdentifierExpression()
+	{
+		EyeSource source = m_LookAhead->GetSource();
+		std::string name;
+		if (IsLookAhead(TokenType::SymbolScope) && EatToken(TokenType::SymbolScope))
+			name += "::";
+		name += EatToken(TokenType::Identifier)->GetValue<StringType>();
+		while (IsLookAhead(TokenType::SymbolScope) && EatToken(TokenType::SymbolScope))
+			name += "::" + EatToken(TokenType::Identifier)->GetValue<StringType>();
+		return MakeExpression<AST::IdentifierExpression>(source, name);
 	}
 
 	bool Parser::IsLookAhead(TokenType type) const
@@ -990,62 +975,47 @@ namespace Eye
 	}
 
 	/*
-		EqualityOperator
-			: '=='
-			| '!=
-			;
-	*/
-	bool Parser::IsEqualityOperator(const Token* token) const
-	{
-		return (token->GetType() == TokenType::OperatorRelationalEquals || token->GetType() == TokenType::OperatorRelationalNotEquals);
-	}
-
-	/*
-		RelationalOperator
-			: '<'
-			| '<='
-			| '>'
-			| '>='
-			;
-	*/
-	bool Parser::IsRelationalOperator(const Token* token) const
-	{
-		return (token->GetType() == TokenType::OperatorRelationalSmaller || token->GetType() == TokenType::OperatorRelationalSmallerEquals || token->GetType() == TokenType::OperatorRelationalGreater ||
-			token->GetType() == TokenType::OperatorRelationalGreaterEquals);
-	}
-
-	/*
-		BitwiseShiftOperator
-			: '<<'
-			| '>>'
+		BinaryOperator
+			: '||'
+			| '&&'
+			| '|'
+			| '^'
+			| '&'
+			| EqualityOperator: '==' | '!='
+			| RelationalOperator: '<' | '<=' | '>' | '>='
+			| BitwiseShiftOperator: '<<' | '>>'
+			| AdditiveOperator: '+' | '-'
+			| MultiplicativeOperator: '*' | '/' | '%'
 			;
-	*/
-	bool Parser::IsBitwiseShiftOperator(const Token* token) const
-	{
-		return (token->GetType() == TokenType::OperatorBitwiseLeftShift || token->GetType() == TokenType::OperatorBitwiseRightShift);
-	}
 
-	/*
-		AdditiveOperator
-			: '+'
-			| '-'
-			;
+		0 for every other Token, which ends a BinaryExpression
 	*/
-	bool Parser::IsAdditiveOperator(const Token* token) const
+	uint8_t Parser::GetBindingPower(TokenType type)
 	{
-		return (token->GetType() == TokenType::OperatorBinaryPlus || token->GetType() == TokenType::OperatorBinaryMinus);
-	}
-
-	/*
-		MultiplicativeOperator
-			: '*'
-			| '/'
-			| '%'
-			;
-	*/
-	bool Parser::IsMultiplicativeOperator(const Token* token) const
-	{
-		return (token->GetType() == TokenType::OperatorBinaryStar || token->GetType() == TokenType::OperatorBinarySlash || token->GetType() == TokenType::OperatorBinaryModulo);
+		static constexpr auto bindingPowers = []()
+			{
+				std::array<uint8_t, (size_t)TokenType::EndOfFile + 1> powers = {};
+				powers[(size_t)TokenType::OperatorLogicalOR] = 1;
+				powers[(size_t)TokenType::OperatorLogicalAND] = 2;
+				powers[(size_t)TokenType::OperatorBitwiseBinaryOR] = 3;
+				powers[(size_t)TokenType::OperatorBitwiseBinaryXOR] = 4;
+				powers[(size_t)TokenType::OperatorBitwiseBinaryAND] = 5;
+				powers[(size_t)TokenType::OperatorRelationalEquals] = 6;
+				powers[(size_t)TokenType::OperatorRelationalNotEquals] = 6;
+				powers[(size_t)TokenType::OperatorRelationalSmaller] = 7;
+				powers[(size_t)TokenType::OperatorRelationalSmallerEquals] = 7;
+				powers[(size_t)TokenType::OperatorRelationalGreater] = 7;
+				powers[(size_t)TokenType::OperatorRelationalGreaterEquals] = 7;
+				powers[(size_t)TokenType::OperatorBitwiseLeftShift] = 8;
+				powers[(size_t)TokenType::OperatorBitwiseRightShift] = 8;
+				powers[(size_t)TokenType::OperatorBinaryPlus] = 9;
+				powers[(size_t)TokenType::OperatorBinaryMinus] = 9;
+				powers[(size_t)TokenType::OperatorBinaryStar] = 10;
+				powers[(size_t)TokenType::OperatorBinarySlash] = 10;
+				powers[(size_t)TokenType::OperatorBinaryModulo] = 10;
+				return powers;
+			}();
+		return bindingPowers[(size_t)type];
 	}
 
 	/*
@@ -1097,6 +1067,12 @@ namespace Eye
 		return (token->GetType() == TokenType::KeywordDataTypeInt || token->GetType() == TokenType::KeywordDataTypeFloat || token->GetType() == TokenType::KeywordDataTypeStr || token->GetType() == TokenType::KeywordDataTypeBool || token->GetType() == TokenType::KeywordDataTypeVoid);
 	}
 
+	bool Parser::IsStructTypeName()
+	{
+		const Token* next = PeekToken();
+		return (IsLookAhead(TokenType::Identifier) && next && next->GetType() == TokenType::Identifier);
+	}
+
 	/*
 		LHSExpression
 			: IdentifierExpression
@@ -1131,19 +1107,14 @@ namespace Eye
 
 	const Token* Parser::PeekToken()
 	{
-		if (!HasToken())
-			return {};
-
-		const Token* token = m_Tokens[m_CurrentTokenIndex].get();
-		while (token && (token->GetType() == TokenType::Newline || token->GetType() == TokenType::Comment || (token->GetType() == TokenType::SymbolBackslash)))
+		// Skipped Tokens stay in place, NextToken skips them again
+		for (size_t index = m_CurrentTokenIndex; index < m_Tokens.size(); index++)
 		{
-			if (HasToken())
-				token = m_Tokens[++m_CurrentTokenIndex].get();
-			else
-				return {};
+			const Token* token = m_Tokens[index].get();
+			if (token && token->GetType() != TokenType::Newline && token->GetType() != TokenType::Comment && token->GetType() != TokenType::SymbolBackslash)
+				return token;
 		}
-
-		return token;
+		return {};
 	}
 
 	std::unique_ptr<Token> Parser::EatToken(TokenType type)
@@ -1151,7 +1122,29 @@ namespace Eye
 		std::unique_ptr<Token> token = std::move(m_LookAhead);
 		if (!token || token->GetType() != type)
 			throw Error::Exceptions::SyntaxErrorException("Unexpected " + std::string(token->GetTypeString()), Error::ErrorType::ParserSyntaxError, token->GetSource());
+
+		// Lexer Offsets are One Behind the Character they Point at
+		const EyeSource& source = token->GetSource();
+		m_LastTokenRange.End = source.End + 2;
+		m_LastTokenRange.EndLine = source.Line;
+		m_LastTokenRange.EndCol = source.Col + (source.End - source.Start) + 1;
+
 		m_LookAhead = NextToken();
 		return token;
 	}
+
+	Parser::NestingGuard::NestingGuard(Parser& parser)
+		: Owner(parser)
+	{
+		if (++Owner.m_NestingDepth > Owner.m_MaxNestingDepth)
+		{
+			Owner.m_NestingDepth--;
+			throw Error::Exceptions::SyntaxErrorException("Nesting Exceeds the Limit of " + std::to_string(Owner.m_MaxNestingDepth), Error::ErrorType::ParserNestingLimit, Owner.m_LookAhead ? Owner.m_LookAhead->GetSource() : EyeSource());
+		}
+	}
+
+	Parser::NestingGuard::~NestingGuard()
+	{
+		Owner.m_NestingDepth--;
+	}
 }
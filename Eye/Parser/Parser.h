@@ -14,6 +14,9 @@
 #include "Eye/AST/Statements/BreakStatement.h"
 #include "Eye/AST/Statements/FunctionStatement.h"
 #include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/ImportStatement.h"
+#include "Eye/AST/Statements/StructStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
 
 #include "Eye/AST/Expressions/Expression.h"
 #include "Eye/AST/Expressions/LiteralExpression.h"
@@ -26,13 +29,32 @@
 
 
 #include <expected>
+#include <cstdint>
 
 namespace Eye
 {
+	// Source Range of a Top-Level Statement, [Begin, End) Offsets with the Line & Col at both Ends
+	struct ParserStatementRange
+	{
+		size_t Begin;
+		size_t End;
+		size_t BeginLine;
+		size_t BeginCol;
+		size_t EndLine;
+		size_t EndCol;
+	};
+
 	class Parser
 	{
 	public:
-		std::expected<std::unique_ptr<AST::Program>, Error::Error> Parse(std::vector<std::unique_ptr<Token>>&& tokens);
+		// Statements, Assignments & Unary Operators nested deeper than maxNestingDepth fail with ParserNestingLimit instead of exhausting the Stack
+		Parser(size_t maxNestingDepth = DefaultMaxNestingDepth);
+
+		// Expressions are numbered from firstExpressionId on, see AST::Expression::GetId
+		std::expected<std::unique_ptr<AST::Program>, Error::Error> Parse(std::vector<std::unique_ptr<Token>>&& tokens, uint32_t firstExpressionId = 0);
+		inline const std::vector<ParserStatementRange>& GetStatementRanges() const { return m_StatementRanges; }
+
+		static constexpr size_t DefaultMaxNestingDepth = 1024;
 
 	private:
 		std::unique_ptr<AST::Program> Program();
@@ -46,6 +68,7 @@ namespace Eye
 		std::vector<std::unique_ptr<AST::VariableDeclaration>> VariableDeclarationList();
 		std::unique_ptr<AST::VariableDeclaration> VariableDeclaration();
 		std::unique_ptr<AST::Expression> VariableInitializer();
+		uint32_t OptionalArrayLength();
 		std::unique_ptr<AST::ControlStatement> ControlStatement();
 		std::unique_ptr<AST::IterationStatement> IterationStatement();
 		std::unique_ptr<AST::ContinueStatement> ContinueStatement();
@@ -57,20 +80,16 @@ namespace Eye
 		std::vector<std::unique_ptr<AST::FunctionParameter>> FunctionParameterList();
 		std::unique_ptr<AST::FunctionParameter> FunctionParameter();
 		std::unique_ptr<AST::ReturnStatement> ReturnStatement();
+		std::unique_ptr<AST::ImportStatement> ImportStatement();
+		std::unique_ptr<AST::StructStatement> StructStatement();
+		std::unique_ptr<AST::StructField> StructField();
+		std::unique_ptr<AST::NamespaceStatement> NamespaceStatement();
+		std::unique_ptr<AST::Statement> NamespaceMember();
 
 		// Expressions
 		std::unique_ptr<AST::Expression> Expression();
 		std::unique_ptr<AST::Expression> AssignmentExpression();
-		std::unique_ptr<AST::Expression> LogicalORExpression();
-		std::unique_ptr<AST::Expression> LogicalANDExpression();
-		std::unique_ptr<AST::Expression> BitwiseORExpression();
-		std::unique_ptr<AST::Expression> BitwiseXORExpression();
-		std::unique_ptr<AST::Expression> BitwiseANDExpression();
-		std::unique_ptr<AST::Expression> EqualityExpression();
-		std::unique_ptr<AST::Expression> RelationalExpression();
-		std::unique_ptr<AST::Expression> BitwiseShiftExpression();
-		std::unique_ptr<AST::Expression> AdditiveBinaryExpression();
-		std::unique_ptr<AST::Expression> MultiplicativeBinaryExpression();
+		std::unique_ptr<AST::Expression> BinaryExpression(uint8_t minBindingPower = 0);
 		std::unique_ptr<AST::Expression> UnaryExpression();
 		std::unique_ptr<AST::Expression> LHSExpression();
 		std::unique_ptr<AST::Expression> MemberExpression();
@@ -86,20 +105,19 @@ namespace Eye
 		std::unique_ptr<AST::LiteralExpression> NullLiteral();
 		std::unique_ptr<AST::Expression> ParenthesizedExpression();
 		std::unique_ptr<AST::IdentifierExpression> IdentifierExpression();
+		std::unique_ptr<AST::IdentifierExpression> QualifiedIdentifierExpression();
 
 	private:
 		bool IsLookAhead(TokenType type) const;
 		bool IsLiteral(const Token* token) const;
 		bool IsAssignmentOperator(const Token* token) const;
-		bool IsEqualityOperator(const Token* token) const;
-		bool IsRelationalOperator(const Token* token) const;
-		bool IsBitwiseShiftOperator(const Token* token) const;
-		bool IsAdditiveOperator(const Token* token) const;
-		bool IsMultiplicativeOperator(const Token* token) const;
+		static uint8_t GetBindingPower(TokenType type);
 		bool IsUnaryOperator(const Token* token) const;
 		bool IsPostfixOperator(const Token* token) const;
 		bool IsTypeQualifierKeyword(const Token* token) const;
 		bool IsDataTypeKeyword(const Token* token) const;
+		// An Identifier followed by another Identifier names a Struct Type, 'Point p;'
+		bool IsStructTypeName();
 		bool IsLHSExpression(const AST::Expression* expression) const;
 
 	private:
@@ -108,10 +126,32 @@ namespace Eye
 		const Token* PeekToken();
 		std::unique_ptr<Token> EatToken(TokenType type);
 
+		// One Level of Recursion while alive, Left-Deep Binary Chains are parsed in a Loop and do not count
+		struct NestingGuard
+		{
+			NestingGuard(Parser& parser);
+			~NestingGuard();
+
+			Parser& Owner;
+		};
+
+		template<typename T, typename... Args>
+		std::unique_ptr<T> MakeExpression(Args&&... args)
+		{
+			std::unique_ptr<T> expression = std::make_unique<T>(std::forward<Args>(args)...);
+			expression->SetId(m_NextExpressionId++);
+			return expression;
+		}
+
 	private:
 		std::unique_ptr<AST::Program> m_Program;
 		std::vector<std::unique_ptr<Token>> m_Tokens;
 		size_t m_CurrentTokenIndex;
 		std::unique_ptr<Token> m_LookAhead;
+		std::vector<ParserStatementRange> m_StatementRanges;
+		ParserStatementRange m_LastTokenRange;
+		uint32_t m_NextExpressionId = 0;
+		size_t m_MaxNestingDepth;
+		size_t m_NestingDepth = 0;
 	};
 }
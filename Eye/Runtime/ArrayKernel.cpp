@@ -0,0 +1,289 @@
+#include "Eye/Runtime/ArrayKernel.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define EYE_KERNEL_X86 1
+	#include <immintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		// MSVC emits any Intrinsic, Callers check the CPU first
+		#define EYE_TARGET_AVX2
+	#else
+		#define EYE_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		std::string_view KernelISAToString(KernelISA isa)
+		{
+			switch (isa)
+			{
+			case KernelISA::Scalar:
+				return "Scalar";
+			case KernelISA::SSE2:
+				return "SSE2";
+			case KernelISA::AVX2:
+				return "AVX2";
+			default:
+				return "Unknown";
+			}
+		}
+
+		KernelISA GetKernelISA()
+		{
+			static const KernelISA s_ISA = []()
+				{
+#if defined(EYE_KERNEL_X86) && defined(_MSC_VER)
+					// AVX2 needs the CPU Feature & the OS saving the YMM Registers
+					int info[4];
+					__cpuid(info, 0);
+					if (info[0] < 7)
+						return KernelISA::SSE2;
+					__cpuidex(info, 7, 0);
+					bool avx2 = (info[1] & (1 << 5));
+					__cpuid(info, 1);
+					bool osxsave = (info[2] & (1 << 27));
+					return (avx2 && osxsave && (_xgetbv(0) & 6) == 6 ? KernelISA::AVX2 : KernelISA::SSE2);
+#elif defined(EYE_KERNEL_X86)
+					__builtin_cpu_init();
+					return (__builtin_cpu_supports("avx2") ? KernelISA::AVX2 : KernelISA::SSE2);
+#else
+					return KernelISA::Scalar;
+#endif
+				}();
+			return s_ISA;
+		}
+
+		bool IsKernelSupported(KernelOperation operation, bool isFloat)
+		{
+			switch (operation)
+			{
+			case KernelOperation::Add:
+			case KernelOperation::Sub:
+			case KernelOperation::Mul:
+				return true;
+			case KernelOperation::Div:
+				return isFloat;
+			default:
+				return !isFloat;
+			}
+		}
+
+		template<KernelOperation Operation, typename T>
+		static inline T ApplyScalar(T left, T right)
+		{
+			if constexpr (Operation == KernelOperation::Add)
+				return left + right;
+			else if constexpr (Operation == KernelOperation::Sub)
+				return left - right;
+			else if constexpr (Operation == KernelOperation::Mul)
+				return left * right;
+			else if constexpr (Operation == KernelOperation::Div)
+				return left / right;
+			else if constexpr (Operation == KernelOperation::And)
+				return left & right;
+			else if constexpr (Operation == KernelOperation::Or)
+				return left | right;
+			else
+				return left ^ right;
+		}
+
+		// Broadcast Kernels read their single right Element through right[0]
+		template<KernelOperation Operation, typename T, bool Broadcast>
+		static void RunScalar(T* target, const T* left, const T* right, size_t begin, size_t count)
+		{
+			for (size_t i = begin; i < count; i++)
+				target[i] = ApplyScalar<Operation>(left[i], right[Broadcast ? 0 : i]);
+		}
+
+#ifdef EYE_KERNEL_X86
+		// SSE2 is part of every x86-64 CPU
+		template<KernelOperation Operation>
+		static inline __m128i ApplySSE2(__m128i left, __m128i right)
+		{
+			if constexpr (Operation == KernelOperation::Add)
+				return _mm_add_epi64(left, right);
+			else if constexpr (Operation == KernelOperation::Sub)
+				return _mm_sub_epi64(left, right);
+			else if constexpr (Operation == KernelOperation::Mul)
+			{
+				// Low 64 Bits of the Product from 32-Bit Halves: lo * lo + ((hi * lo + lo * hi) << 32)
+				__m128i low = _mm_mul_epu32(left, right);
+				__m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(left, 32), right), _mm_mul_epu32(left, _mm_srli_epi64(right, 32)));
+				return _mm_add_epi64(low, _mm_slli_epi64(cross, 32));
+			}
+			else if constexpr (Operation == KernelOperation::And)
+				return _mm_and_si128(left, right);
+			else if constexpr (Operation == KernelOperation::Or)
+				return _mm_or_si128(left, right);
+			else
+				return _mm_xor_si128(left, right);
+		}
+
+		template<KernelOperation Operation>
+		static inline __m128d ApplySSE2(__m128d left, __m128d right)
+		{
+			if constexpr (Operation == KernelOperation::Add)
+				return _mm_add_pd(left, right);
+			else if constexpr (Operation == KernelOperation::Sub)
+				return _mm_sub_pd(left, right);
+			else if constexpr (Operation == KernelOperation::Mul)
+				return _mm_mul_pd(left, right);
+			else
+				return _mm_div_pd(left, right);
+		}
+
+		template<KernelOperation Operation, typename T, bool Broadcast>
+		static void RunSSE2(T* target, const T* left, const T* right, size_t count)
+		{
+			size_t i = 0;
+			if constexpr (std::is_same_v<T, IntegerType>)
+			{
+				for (; i + 2 <= count; i += 2)
+				{
+					__m128i leftVector = _mm_loadu_si128((const __m128i*)(left + i));
+					__m128i rightVector = (Broadcast ? _mm_set1_epi64x((long long)right[0]) : _mm_loadu_si128((const __m128i*)(right + i)));
+					_mm_storeu_si128((__m128i*)(target + i), ApplySSE2<Operation>(leftVector, rightVector));
+				}
+			}
+			else
+			{
+				for (; i + 2 <= count; i += 2)
+				{
+					__m128d rightVector = (Broadcast ? _mm_set1_pd(right[0]) : _mm_loadu_pd(right + i));
+					_mm_storeu_pd(target + i, ApplySSE2<Operation>(_mm_loadu_pd(left + i), rightVector));
+				}
+			}
+			RunScalar<Operation, T, Broadcast>(target, left, right, i, count);
+		}
+
+		template<KernelOperation Operation>
+		EYE_TARGET_AVX2 static inline __m256i ApplyAVX2(__m256i left, __m256i right)
+		{
+			if constexpr (Operation == KernelOperation::Add)
+				return _mm256_add_epi64(left, right);
+			else if constexpr (Operation == KernelOperation::Sub)
+				return _mm256_sub_epi64(left, right);
+			else if constexpr (Operation == KernelOperation::Mul)
+			{
+				// No 64-Bit Multiply before AVX-512, same Decomposition as SSE2
+				__m256i low = _mm256_mul_epu32(left, right);
+				__m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(left, 32), right), _mm256_mul_epu32(left, _mm256_srli_epi64(right, 32)));
+				return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+			}
+			else if constexpr (Operation == KernelOperation::And)
+				return _mm256_and_si256(left, right);
+			else if constexpr (Operation == KernelOperation::Or)
+				return _mm256_or_si256(left, right);
+			else
+				return _mm256_xor_si256(left, right);
+		}
+
+		template<KernelOperation Operation>
+		EYE_TARGET_AVX2 static inline __m256d ApplyAVX2(__m256d left, __m256d right)
+		{
+			if constexpr (Operation == KernelOperation::Add)
+				return _mm256_add_pd(left, right);
+			else if constexpr (Operation == KernelOperation::Sub)
+				return _mm256_sub_pd(left, right);
+			else if constexpr (Operation == KernelOperation::Mul)
+				return _mm256_mul_pd(left, right);
+			else
+				return _mm256_div_pd(left, right);
+		}
+
+		template<KernelOperation Operation, typename T, bool Broadcast>
+		EYE_TARGET_AVX2 static void RunAVX2(T* target, const T* left, const T* right, size_t count)
+		{
+			size_t i = 0;
+			if constexpr (std::is_same_v<T, IntegerType>)
+			{
+				for (; i + 4 <= count; i += 4)
+				{
+					__m256i leftVector = _mm256_loadu_si256((const __m256i*)(left + i));
+					__m256i rightVector = (Broadcast ? _mm256_set1_epi64x((long long)right[0]) : _mm256_loadu_si256((const __m256i*)(right + i)));
+					_mm256_storeu_si256((__m256i*)(target + i), ApplyAVX2<Operation>(leftVector, rightVector));
+				}
+			}
+			else
+			{
+				for (; i + 4 <= count; i += 4)
+				{
+					__m256d rightVector = (Broadcast ? _mm256_set1_pd(right[0]) : _mm256_loadu_pd(right + i));
+					_mm256_storeu_pd(target + i, ApplyAVX2<Operation>(_mm256_loadu_pd(left + i), rightVector));
+				}
+			}
+			RunScalar<Operation, T, Broadcast>(target, left, right, i, count);
+		}
+#endif
+
+		template<KernelOperation Operation, typename T, bool Broadcast>
+		static void Dispatch(T* target, const T* left, const T* right, size_t count, KernelISA isa)
+		{
+#ifdef EYE_KERNEL_X86
+			isa = std::min(isa, GetKernelISA());
+			if (isa == KernelISA::AVX2)
+				return RunAVX2<Operation, T, Broadcast>(target, left, right, count);
+			if (isa == KernelISA::SSE2)
+				return RunSSE2<Operation, T, Broadcast>(target, left, right, count);
+#endif
+			RunScalar<Operation, T, Broadcast>(target, left, right, 0, count);
+		}
+
+		template<typename T, bool Broadcast>
+		static bool Dispatch(KernelOperation operation, T* target, const T* left, const T* right, size_t count, KernelISA isa)
+		{
+			if (!IsKernelSupported(operation, std::is_same_v<T, FloatType>))
+				return false;
+
+			switch (operation)
+			{
+			case KernelOperation::Add:
+				Dispatch<KernelOperation::Add, T, Broadcast>(target, left, right, count, isa);
+				break;
+			case KernelOperation::Sub:
+				Dispatch<KernelOperation::Sub, T, Broadcast>(target, left, right, count, isa);
+				break;
+			case KernelOperation::Mul:
+				Dispatch<KernelOperation::Mul, T, Broadcast>(target, left, right, count, isa);
+				break;
+			default:
+				if constexpr (std::is_same_v<T, FloatType>)
+					Dispatch<KernelOperation::Div, T, Broadcast>(target, left, right, count, isa);
+				else if (operation == KernelOperation::And)
+					Dispatch<KernelOperation::And, T, Broadcast>(target, left, right, count, isa);
+				else if (operation == KernelOperation::Or)
+					Dispatch<KernelOperation::Or, T, Broadcast>(target, left, right, count, isa);
+				else
+					Dispatch<KernelOperation::Xor, T, Broadcast>(target, left, right, count, isa);
+				break;
+			}
+			return true;
+		}
+
+		bool RunKernel(KernelOperation operation, IntegerType* target, const IntegerType* left, const IntegerType* right, size_t count, KernelISA isa)
+		{
+			return Dispatch<IntegerType, false>(operation, target, left, right, count, isa);
+		}
+
+		bool RunKernel(KernelOperation operation, FloatType* target, const FloatType* left, const FloatType* right, size_t count, KernelISA isa)
+		{
+			return Dispatch<FloatType, false>(operation, target, left, right, count, isa);
+		}
+
+		bool RunKernel(KernelOperation operation, IntegerType* target, const IntegerType* left, IntegerType right, size_t count, KernelISA isa)
+		{
+			return Dispatch<IntegerType, true>(operation, target, left, &right, count, isa);
+		}
+
+		bool RunKernel(KernelOperation operation, FloatType* target, const FloatType* left, FloatType right, size_t count, KernelISA isa)
+		{
+			return Dispatch<FloatType, true>(operation, target, left, &right, count, isa);
+		}
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Eye/Lexer/Token.h"
+
+#include <string_view>
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		enum class KernelOperation
+		{
+			Add,
+			Sub,
+			Mul,
+			// float only, int Division traps on Zero
+			Div,
+			// int only
+			And,
+			Or,
+			Xor,
+		};
+
+		// Ordered by Width, every ISA supports the ones before it
+		enum class KernelISA
+		{
+			Scalar,
+			SSE2,
+			AVX2,
+		};
+
+		std::string_view KernelISAToString(KernelISA isa);
+		// Widest ISA of the running CPU, detected once
+		KernelISA GetKernelISA();
+		bool IsKernelSupported(KernelOperation operation, bool isFloat);
+
+		/*
+			ArrayKernel
+				target[i] = left[i] Operation right[i] for i in [0, count), the Lowering of the IR's arraykernel.
+				Vectors of the requested ISA (capped at GetKernelISA()) cover the Elements, the Remainder runs scalar.
+				int Elements wrap around like int Arithmetic, float Elements round per Element exactly like scalar Code.
+				target may alias left or right exactly, partially overlapping Arrays are not supported.
+				Returns false without writing anything if the Operation is not supported for the Element Type.
+		*/
+		bool RunKernel(KernelOperation operation, IntegerType* target, const IntegerType* left, const IntegerType* right, size_t count, KernelISA isa = KernelISA::AVX2);
+		bool RunKernel(KernelOperation operation, FloatType* target, const FloatType* left, const FloatType* right, size_t count, KernelISA isa = KernelISA::AVX2);
+		// right is broadcast to every Element
+		bool RunKernel(KernelOperation operation, IntegerType* target, const IntegerType* left, IntegerType right, size_t count, KernelISA isa = KernelISA::AVX2);
+		bool RunKernel(KernelOperation operation, FloatType* target, const FloatType* left, FloatType right, size_t count, KernelISA isa = KernelISA::AVX2);
+	}
+}
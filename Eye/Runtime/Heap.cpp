@@ -0,0 +1,84 @@
+#include "Eye/Runtime/Heap.h"
+
+#include <charconv>
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		Value Heap::MakeInteger(IntegerType value)
+		{
+			if (Value::FitsInline(value))
+				return Value::Integer(value);
+			return Value::FromObject(Allocate<IntegerObject>(value));
+		}
+
+		Value Heap::MakeString(const String& value)
+		{
+			return Value::FromObject(Allocate<StringObject>(value, false));
+		}
+
+		Value Heap::InternString(std::string_view value)
+		{
+			auto it = m_InternTable.find(value);
+			if (it != m_InternTable.end())
+				return Value::FromObject(it->second);
+
+			const StringObject* string = Allocate<StringObject>(String(value), true);
+			m_InternTable[string->GetValue()] = string;
+			return Value::FromObject(string);
+		}
+
+		Value Heap::Concat(Value left, Value right)
+		{
+			return MakeString(left.AsString()->GetString() + right.AsString()->GetString());
+		}
+
+		bool Heap::Equals(Value left, Value right) const
+		{
+			// Before the Bit Identity, every NaN shares one Bit Pattern but never equals itself
+			if (left.IsFloat() && right.IsFloat())
+				return left.AsFloat() == right.AsFloat();
+			if (left == right)
+				return true;
+
+			if (left.IsInteger() && right.IsInteger())
+				return left.AsInteger() == right.AsInteger();
+			if (left.IsString() && right.IsString())
+			{
+				const StringObject* leftString = left.AsString();
+				const StringObject* rightString = right.AsString();
+				// Two distinct interned Strings never have equal Contents
+				if (leftString->IsInterned() && rightString->IsInterned())
+					return false;
+				return leftString->GetString() == rightString->GetString();
+			}
+			return false;
+		}
+
+		StringType Heap::ToString(Value value) const
+		{
+			switch (value.GetType())
+			{
+			case ValueType::Integer:
+				return std::to_string(value.AsInteger());
+			case ValueType::Float:
+			{
+				char buffer[32];
+				auto result = std::to_chars(buffer, buffer + sizeof(buffer), value.AsFloat());
+				return StringType(buffer, result.ptr);
+			}
+			case ValueType::Boolean:
+				return (value.AsBoolean() ? "true" : "false");
+			case ValueType::Object:
+			{
+				if (value.IsString())
+					return StringType(value.AsString()->GetValue());
+				return std::to_string(value.AsInteger());
+			}
+			default:
+				return "void";
+			}
+		}
+	}
+}
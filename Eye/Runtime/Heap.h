@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Eye/Runtime/Value.h"
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		/*
+			Heap
+				Owns every Object a Value can point to, Objects live as long as their Heap.
+				String Literals & Identifiers are interned, Strings built at Runtime are allocated fresh.
+		*/
+		class Heap
+		{
+		public:
+			Heap() = default;
+			Heap(const Heap&) = delete;
+			Heap& operator=(const Heap&) = delete;
+
+			Value MakeInteger(IntegerType value);
+			Value MakeString(const String& value);
+			Value InternString(std::string_view value);
+			// Both Operands must be Strings, the Result is a Rope sharing their Characters
+			Value Concat(Value left, Value right);
+
+			// Content Equality: equal Strings & Integers compare equal even if only one of them is boxed
+			bool Equals(Value left, Value right) const;
+			StringType ToString(Value value) const;
+
+			inline size_t GetObjectCount() const { return m_Objects.size(); }
+			inline size_t GetInternedCount() const { return m_InternTable.size(); }
+
+		private:
+			template<typename T, typename... Args>
+			T* Allocate(Args&&... args)
+			{
+				m_Objects.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+				return static_cast<T*>(m_Objects.back().get());
+			}
+
+		private:
+			std::vector<std::unique_ptr<Object>> m_Objects;
+			// Keys view into the interned Object's own Characters
+			std::unordered_map<std::string_view, const StringObject*> m_InternTable;
+		};
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Eye/Runtime/String.h"
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		enum class ObjectType
+		{
+			String,
+			Integer,
+		};
+
+		/*
+			Object
+				: StringObject
+				| IntegerObject
+				;
+
+			Heap allocated Payload of a Value, immutable once created & owned by a Heap.
+		*/
+		class Object
+		{
+		public:
+			virtual ~Object() = default;
+
+			inline ObjectType GetObjectType() const { return m_ObjectType; }
+
+		protected:
+			Object(ObjectType objectType)
+				: m_ObjectType(objectType)
+			{
+			}
+
+		private:
+			ObjectType m_ObjectType;
+		};
+
+		class StringObject : public Object
+		{
+		public:
+			StringObject(const String& value, bool interned)
+				: Object(ObjectType::String), m_Value(value), m_Interned(interned)
+			{
+			}
+
+			inline const String& GetString() const { return m_Value; }
+			// Flattens a Rope on first Access
+			inline std::string_view GetValue() const { return m_Value.GetView(); }
+			inline size_t GetLength() const { return m_Value.GetLength(); }
+			// Interned Strings are unique per Heap, equal Contents share one Object
+			inline bool IsInterned() const { return m_Interned; }
+
+		private:
+			const String m_Value;
+			const bool m_Interned;
+		};
+
+		// Integers outside the 48-Bit inline Range of a Value
+		class IntegerObject : public Object
+		{
+		public:
+			IntegerObject(IntegerType value)
+				: Object(ObjectType::Integer), m_Value(value)
+			{
+			}
+
+			inline IntegerType GetValue() const { return m_Value; }
+
+		private:
+			const IntegerType m_Value;
+		};
+	}
+}
@@ -0,0 +1,217 @@
+#include "Eye/Runtime/String.h"
+
+#include <cstring>
+#include <vector>
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		/*
+			Node
+				Leaf: Flat holds the Characters.
+				Rope: Left + Right until the first Read, then Flat holds the Concatenation & the Children are released.
+		*/
+		struct String::Node
+		{
+			size_t RefCount = 1;
+			mutable bool Flattened = true;
+			mutable StringType Flat;
+			mutable String Left = {};
+			mutable String Right = {};
+		};
+
+		String::String(std::string_view value)
+			: m_Length(value.size())
+		{
+			if (IsInline())
+				std::memcpy(m_Inline, value.data(), value.size());
+			else
+				m_Node = new Node{ 1, true, StringType(value) };
+		}
+
+		String::String(StringType&& value)
+			: m_Length(value.size())
+		{
+			if (IsInline())
+				std::memcpy(m_Inline, value.data(), value.size());
+			else
+				m_Node = new Node{ 1, true, std::move(value) };
+		}
+
+		String::String(Node* node, size_t length)
+			: m_Length(length)
+		{
+			m_Node = node;
+		}
+
+		String::String(const String& other)
+			: m_Length(other.m_Length)
+		{
+			if (IsInline())
+				std::memcpy(m_Inline, other.m_Inline, s_InlineCapacity);
+			else
+				(m_Node = other.m_Node)->RefCount++;
+		}
+
+		String::String(String&& other) noexcept
+			: m_Length(other.m_Length)
+		{
+			if (IsInline())
+				std::memcpy(m_Inline, other.m_Inline, s_InlineCapacity);
+			else
+				m_Node = other.m_Node;
+			other.m_Length = 0;
+		}
+
+		String& String::operator=(const String& other)
+		{
+			if (this != &other)
+			{
+				String copy(other);
+				*this = std::move(copy);
+			}
+			return *this;
+		}
+
+		String& String::operator=(String&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (!IsInline())
+					Release(m_Node);
+
+				m_Length = other.m_Length;
+				if (IsInline())
+					std::memcpy(m_Inline, other.m_Inline, s_InlineCapacity);
+				else
+					m_Node = other.m_Node;
+				other.m_Length = 0;
+			}
+			return *this;
+		}
+
+		String::~String()
+		{
+			if (!IsInline())
+				Release(m_Node);
+		}
+
+		bool String::IsRope() const
+		{
+			return !IsInline() && !m_Node->Flattened;
+		}
+
+		std::string_view String::GetView() const
+		{
+			if (IsInline())
+				return std::string_view(m_Inline, m_Length);
+
+			if (!m_Node->Flattened)
+				Flatten(m_Node);
+			return m_Node->Flat;
+		}
+
+		size_t String::GetHash() const
+		{
+			return std::hash<std::string_view>()(GetView());
+		}
+
+		String operator+(const String& left, const String& right)
+		{
+			if (right.IsEmpty())
+				return left;
+			if (left.IsEmpty())
+				return right;
+
+			size_t length = left.m_Length + right.m_Length;
+			if (length <= String::s_InlineCapacity)
+			{
+				String result;
+				result.m_Length = length;
+				std::memcpy(result.m_Inline, left.m_Inline, left.m_Length);
+				std::memcpy(result.m_Inline + left.m_Length, right.m_Inline, right.m_Length);
+				return result;
+			}
+
+			return String(new String::Node{ 1, false, StringType(), left, right }, length);
+		}
+
+		bool String::operator==(const String& other) const
+		{
+			if (m_Length != other.m_Length)
+				return false;
+			if (!IsInline() && m_Node == other.m_Node)
+				return true;
+			return GetView() == other.GetView();
+		}
+
+		void String::Release(Node* node)
+		{
+			// Iterative, a Rope built in a Loop is as deep as the Loop ran
+			std::vector<Node*> worklist = { node };
+			while (!worklist.empty())
+			{
+				Node* current = worklist.back();
+				worklist.pop_back();
+				if (--current->RefCount)
+					continue;
+
+				for (String* child : { &current->Left, &current->Right })
+				{
+					if (!child->IsInline())
+						worklist.push_back(child->m_Node);
+					child->m_Length = 0;
+				}
+				delete current;
+			}
+		}
+
+		void String::Flatten(const Node* node)
+		{
+			StringType flat;
+			flat.reserve(node->Left.m_Length + node->Right.m_Length);
+
+			std::vector<const String*> pieces = { &node->Right, &node->Left };
+			while (!pieces.empty())
+			{
+				const String* piece = pieces.back();
+				pieces.pop_back();
+
+				if (piece->IsInline())
+					flat.append(piece->m_Inline, piece->m_Length);
+				else if (piece->m_Node->Flattened)
+					flat.append(piece->m_Node->Flat);
+				else
+				{
+					pieces.push_back(&piece->m_Node->Right);
+					pieces.push_back(&piece->m_Node->Left);
+				}
+			}
+
+			node->Flat = std::move(flat);
+			node->Flattened = true;
+			node->Left = String();
+			node->Right = String();
+		}
+
+		StringBuilder& StringBuilder::Append(std::string_view value)
+		{
+			m_Buffer.append(value);
+			return *this;
+		}
+
+		StringBuilder& StringBuilder::Append(const String& value)
+		{
+			m_Buffer.append(value.GetView());
+			return *this;
+		}
+
+		String StringBuilder::Build()
+		{
+			String result(std::move(m_Buffer));
+			m_Buffer.clear();
+			return result;
+		}
+	}
+}
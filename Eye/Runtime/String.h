@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Eye/Lexer/Token.h"
+
+#include <string_view>
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		/*
+			String
+				Immutable Runtime Value of Eye's str.
+				Up to s_InlineCapacity Characters are stored inline, longer Strings share a reference-counted Node.
+				Concatenation builds a Rope Node in O(1), the Rope is flattened once when its Characters are first read.
+				Reference Counts are not atomic, a String & its Copies belong to one Thread.
+		*/
+		class String
+		{
+		public:
+			static constexpr size_t s_InlineCapacity = 15;
+
+		public:
+			String() = default;
+			String(const char* value)
+				: String(std::string_view(value))
+			{
+			}
+
+			String(std::string_view value);
+			// Takes over the Buffer of a long Value instead of copying it
+			String(StringType&& value);
+			String(const String& other);
+			String(String&& other) noexcept;
+			String& operator=(const String& other);
+			String& operator=(String&& other) noexcept;
+			~String();
+
+			inline size_t GetLength() const { return m_Length; }
+			inline bool IsEmpty() const { return m_Length == 0; }
+			inline bool IsInline() const { return m_Length <= s_InlineCapacity; }
+			// Unflattened Concatenation
+			bool IsRope() const;
+
+			// Flattens a Rope, the View stays valid as long as this String or a Copy of it
+			std::string_view GetView() const;
+			inline char At(size_t index) const { return GetView()[index]; }
+			size_t GetHash() const;
+
+			friend String operator+(const String& left, const String& right);
+			bool operator==(const String& other) const;
+
+		private:
+			struct Node;
+
+			String(Node* node, size_t length);
+			static void Release(Node* node);
+			static void Flatten(const Node* node);
+
+		private:
+			size_t m_Length = 0;
+			union
+			{
+				char m_Inline[s_InlineCapacity];
+				Node* m_Node;
+			};
+		};
+
+		/*
+			StringBuilder
+				Appends into one growing Buffer, Build() hands the Buffer to a String without copying it again.
+		*/
+		class StringBuilder
+		{
+		public:
+			inline StringBuilder& Append(const char* value) { return Append(std::string_view(value)); }
+			StringBuilder& Append(std::string_view value);
+			StringBuilder& Append(const String& value);
+			inline size_t GetLength() const { return m_Buffer.size(); }
+
+			String Build();
+
+		private:
+			StringType m_Buffer;
+		};
+	}
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Eye/Runtime/Object.h"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+namespace Eye
+{
+	namespace Runtime
+	{
+		enum class ValueType
+		{
+			Void,
+			Integer,
+			Float,
+			Boolean,
+			Object,
+		};
+
+		/*
+			Value
+				8-Byte NaN-boxed Representation of every Runtime Value.
+				Floats are stored as their own Bits, NaNs are canonicalized so no Float sets all Bits of s_BoxMask.
+				Everything else lives in the Payload of a negative quiet NaN:
+
+				63       50 49  48 47                                        0
+				[ s_BoxMask ][ Tag ][ Payload                                  ]
+
+				Integers in [-2^47, 2^47) are stored inline as 48-Bit Two's Complement, larger ones are IntegerObjects.
+				Objects are stored as their 48-Bit Address, Values never own them.
+		*/
+		class Value
+		{
+		public:
+			static constexpr int64_t s_InlineIntegerMin = -(1ll << 47);
+			static constexpr int64_t s_InlineIntegerMax = (1ll << 47) - 1;
+
+		public:
+			constexpr Value()
+				: m_Bits(s_BoxMask | s_TagVoid)
+			{
+			}
+
+			static inline Value Float(FloatType value)
+			{
+				if (std::isnan(value))
+					return Value(s_CanonicalNaN);
+				return Value(std::bit_cast<uint64_t>(value));
+			}
+
+			static constexpr Value Boolean(BooleanType value)
+			{
+				return Value(s_BoxMask | s_TagBoolean | (value ? 1 : 0));
+			}
+
+			// Requires FitsInline(value), Heap::MakeInteger boxes the Rest
+			static constexpr Value Integer(IntegerType value)
+			{
+				return Value(s_BoxMask | s_TagInteger | (value & s_PayloadMask));
+			}
+
+			static inline Value FromObject(const Object* object)
+			{
+				return Value(s_BoxMask | s_TagObject | (reinterpret_cast<uintptr_t>(object) & s_PayloadMask));
+			}
+
+			static constexpr bool FitsInline(IntegerType value)
+			{
+				return (int64_t)value >= s_InlineIntegerMin && (int64_t)value <= s_InlineIntegerMax;
+			}
+
+			constexpr ValueType GetType() const
+			{
+				if ((m_Bits & s_BoxMask) != s_BoxMask)
+					return ValueType::Float;
+
+				switch (m_Bits & s_TagMask)
+				{
+				case s_TagInteger:
+					return ValueType::Integer;
+				case s_TagBoolean:
+					return ValueType::Boolean;
+				case s_TagObject:
+					return ValueType::Object;
+				default:
+					return ValueType::Void;
+				}
+			}
+
+			constexpr bool IsVoid() const { return m_Bits == (s_BoxMask | s_TagVoid); }
+			constexpr bool IsFloat() const { return (m_Bits & s_BoxMask) != s_BoxMask; }
+			constexpr bool IsBoolean() const { return (m_Bits & (s_BoxMask | s_TagMask)) == (s_BoxMask | s_TagBoolean); }
+			constexpr bool IsObject() const { return (m_Bits & (s_BoxMask | s_TagMask)) == (s_BoxMask | s_TagObject); }
+			constexpr bool IsInlineInteger() const { return (m_Bits & (s_BoxMask | s_TagMask)) == (s_BoxMask | s_TagInteger); }
+
+			inline bool IsInteger() const { return IsInlineInteger() || IsObjectOfType(ObjectType::Integer); }
+			inline bool IsString() const { return IsObjectOfType(ObjectType::String); }
+
+			inline FloatType AsFloat() const { return std::bit_cast<FloatType>(m_Bits); }
+			constexpr BooleanType AsBoolean() const { return (m_Bits & 1) != 0; }
+			inline const Object* AsObject() const { return reinterpret_cast<const Object*>(static_cast<uintptr_t>(m_Bits & s_PayloadMask)); }
+			inline const StringObject* AsString() const { return static_cast<const StringObject*>(AsObject()); }
+
+			inline IntegerType AsInteger() const
+			{
+				if (IsInlineInteger())
+				{
+					// Sign extend the 48-Bit Payload
+					return (IntegerType)((int64_t)(m_Bits << 16) >> 16);
+				}
+				return static_cast<const IntegerObject*>(AsObject())->GetValue();
+			}
+
+			// Identity: same Bits, equal Contents of boxed Values are compared by Heap::Equals
+			constexpr bool operator==(const Value& other) const { return m_Bits == other.m_Bits; }
+			constexpr uint64_t GetBits() const { return m_Bits; }
+
+		private:
+			constexpr explicit Value(uint64_t bits)
+				: m_Bits(bits)
+			{
+			}
+
+			inline bool IsObjectOfType(ObjectType objectType) const
+			{
+				return IsObject() && AsObject()->GetObjectType() == objectType;
+			}
+
+		private:
+			static constexpr uint64_t s_BoxMask = 0xFFFC000000000000;
+			static constexpr uint64_t s_TagMask = 0x0003000000000000;
+			static constexpr uint64_t s_PayloadMask = 0x0000FFFFFFFFFFFF;
+			static constexpr uint64_t s_TagVoid = 0x0000000000000000;
+			static constexpr uint64_t s_TagInteger = 0x0001000000000000;
+			static constexpr uint64_t s_TagBoolean = 0x0002000000000000;
+			static constexpr uint64_t s_TagObject = 0x0003000000000000;
+			static constexpr uint64_t s_CanonicalNaN = 0x7FF8000000000000;
+
+			uint64_t m_Bits;
+		};
+
+		static_assert(sizeof(Value) == 8, "EYERuntimeValue->Error Value is not 8 Bytes");
+		static_assert(sizeof(void*) == 8, "EYERuntimeValue->Error Pointer Tagging requires 64-Bit Pointers");
+	}
+}
@@ -0,0 +1,315 @@
+#include "Eye/Semantic/CaptureAnalysis.h"
+
+#include <algorithm>
+
+namespace Eye
+{
+	void CaptureAnalysis::Analyze(const AST::Program* ast)
+	{
+		m_Environment = std::make_shared<MapEnvironment<Binding>>();
+		m_Functions = { nullptr };
+		m_ScopeDepth = 0;
+		m_Closures.clear();
+		m_DeclarationDepths.clear();
+		m_CallSites.clear();
+		m_Captured.clear();
+		m_Written.clear();
+		m_Boxed.clear();
+
+		for (const auto& stmt : ast->GetStatementList())
+			AnalyzeStatement(stmt.get());
+
+		// Callers capture what their Callees capture, until nothing changes
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (const CallSite& callSite : m_CallSites)
+			{
+				std::vector<const AST::IdentifierExpression*> captures = m_Closures[callSite.Callee].Captures;
+				for (const AST::IdentifierExpression* declaration : captures)
+					changed |= Capture(callSite.Callers, declaration, m_DeclarationDepths[declaration]);
+			}
+		}
+
+		m_Boxed = m_Written;
+		for (const auto& [functionStmt, closure] : m_Closures)
+		{
+			if (closure.Escapes)
+				m_Boxed.insert(closure.Captures.begin(), closure.Captures.end());
+		}
+	}
+
+	bool CaptureAnalysis::IsClosure(const AST::FunctionStatement* functionStmt) const
+	{
+		return m_Closures.contains(functionStmt);
+	}
+
+	bool CaptureAnalysis::Escapes(const AST::FunctionStatement* functionStmt) const
+	{
+		auto it = m_Closures.find(functionStmt);
+		return (it != m_Closures.end() && it->second.Escapes);
+	}
+
+	const std::vector<const AST::IdentifierExpression*>& CaptureAnalysis::GetCaptures(const AST::FunctionStatement* functionStmt) const
+	{
+		static const std::vector<const AST::IdentifierExpression*> s_NoCaptures;
+		auto it = m_Closures.find(functionStmt);
+		return (it != m_Closures.end() ? it->second.Captures : s_NoCaptures);
+	}
+
+	bool CaptureAnalysis::IsCaptured(const AST::IdentifierExpression* declaration) const
+	{
+		return m_Captured.contains(declaration);
+	}
+
+	bool CaptureAnalysis::IsBoxed(const AST::IdentifierExpression* declaration) const
+	{
+		return m_Boxed.contains(declaration);
+	}
+
+	void CaptureAnalysis::AnalyzeStatement(const AST::Statement* stmt)
+	{
+		if (!stmt)
+			return;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::ExpressionStatement:
+			AnalyzeExpression(static_cast<const AST::ExpressionStatement*>(stmt)->GetExpression());
+			break;
+		case AST::StatementType::BlockStatement:
+			AnalyzeBlockStatement(static_cast<const AST::BlockStatement*>(stmt));
+			break;
+		case AST::StatementType::VariableStatement:
+			AnalyzeVariableStatement(static_cast<const AST::VariableStatement*>(stmt));
+			break;
+		case AST::StatementType::ControlStatement:
+		{
+			const AST::ControlStatement* ctrlStmt = static_cast<const AST::ControlStatement*>(stmt);
+			AnalyzeExpression(ctrlStmt->GetCondition());
+			AnalyzeStatement(ctrlStmt->GetConsequent());
+			AnalyzeStatement(ctrlStmt->GetAlternate());
+			break;
+		}
+		case AST::StatementType::IterationStatement:
+			AnalyzeIterationStatement(static_cast<const AST::IterationStatement*>(stmt));
+			break;
+		case AST::StatementType::FunctionStatement:
+			AnalyzeFunctionStatement(static_cast<const AST::FunctionStatement*>(stmt));
+			break;
+		case AST::StatementType::ReturnStatement:
+			if (static_cast<const AST::ReturnStatement*>(stmt)->GetExpression())
+				AnalyzeExpression(static_cast<const AST::ReturnStatement*>(stmt)->GetExpression());
+			break;
+		case AST::StatementType::NamespaceStatement:
+			// Members are Top-Level Declarations
+			for (const auto& member : static_cast<const AST::NamespaceStatement*>(stmt)->GetStatementList())
+				AnalyzeStatement(member.get());
+			break;
+		default:
+			// Jumps, Imports & Structs use no Variables
+			break;
+		}
+	}
+
+	void CaptureAnalysis::AnalyzeBlockStatement(const AST::BlockStatement* blockStmt, bool createScope)
+	{
+		if (createScope)
+			BeginBlockScope();
+
+		for (const auto& stmt : blockStmt->GetStatementList())
+			AnalyzeStatement(stmt.get());
+
+		if (createScope)
+			EndBlockScope();
+	}
+
+	void CaptureAnalysis::AnalyzeVariableStatement(const AST::VariableStatement* varStmt)
+	{
+		// The Initializer runs before the Variable is in Scope
+		for (const auto& var : varStmt->GetVariableDeclarationList())
+		{
+			if (var->GetInitializer())
+				AnalyzeExpression(var->GetInitializer());
+			DefineVariable(var->GetIdentifier());
+		}
+	}
+
+	void CaptureAnalysis::AnalyzeIterationStatement(const AST::IterationStatement* iterStmt)
+	{
+		switch (iterStmt->GetIterationType())
+		{
+		case AST::IterationStatementType::WhileStatement:
+			AnalyzeExpression(static_cast<const AST::WhileStatement*>(iterStmt)->GetCondition());
+			AnalyzeStatement(static_cast<const AST::WhileStatement*>(iterStmt)->GetBody());
+			break;
+		case AST::IterationStatementType::DoWhileStatement:
+			AnalyzeStatement(static_cast<const AST::DoWhileStatement*>(iterStmt)->GetBody());
+			AnalyzeExpression(static_cast<const AST::DoWhileStatement*>(iterStmt)->GetCondition());
+			break;
+		case AST::IterationStatementType::ForStatement:
+		{
+			const AST::ForStatement* forStmt = static_cast<const AST::ForStatement*>(iterStmt);
+			BeginBlockScope();
+			if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+				AnalyzeVariableStatement(forStmt->GetInitializer<AST::VariableStatement>());
+			else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+				AnalyzeExpression(forStmt->GetInitializer<AST::Expression>());
+			if (forStmt->GetCondition())
+				AnalyzeExpression(forStmt->GetCondition());
+			if (forStmt->GetUpdate())
+				AnalyzeExpression(forStmt->GetUpdate());
+			AnalyzeStatement(forStmt->GetBody());
+			EndBlockScope();
+			break;
+		}
+		}
+	}
+
+	void CaptureAnalysis::AnalyzeFunctionStatement(const AST::FunctionStatement* functionStmt)
+	{
+		// Defaults are evaluated where the Function is declared
+		for (const auto& param : functionStmt->GetParameters())
+		{
+			if (param->GetInitializer())
+				AnalyzeExpression(param->GetInitializer());
+		}
+
+		if (m_Functions.size() > 1 || m_ScopeDepth > 0)
+			m_Closures[functionStmt];
+		m_Environment->Define(functionStmt->GetIdentifier()->GetValue(), { nullptr, functionStmt, m_Functions.size() - 1, false });
+
+		m_Functions.push_back(functionStmt);
+		BeginBlockScope();
+		for (const auto& param : functionStmt->GetParameters())
+			DefineVariable(param->GetIdentifier());
+		AnalyzeBlockStatement(functionStmt->GetBody(), false);
+		EndBlockScope();
+		m_Functions.pop_back();
+	}
+
+	void CaptureAnalysis::AnalyzeExpression(const AST::Expression* expr, bool write)
+	{
+		switch (expr->GetType())
+		{
+		case AST::ExpressionType::IdentifierExpression:
+			AnalyzeIdentifierExpression(static_cast<const AST::IdentifierExpression*>(expr), write);
+			break;
+		case AST::ExpressionType::AssignmentExpression:
+			AnalyzeExpression(static_cast<const AST::AssignmentExpression*>(expr)->GetLHSExpression(), true);
+			AnalyzeExpression(static_cast<const AST::AssignmentExpression*>(expr)->GetExpression());
+			break;
+		case AST::ExpressionType::BinaryExpression:
+		{
+			std::vector<const AST::BinaryExpression*> spine = static_cast<const AST::BinaryExpression*>(expr)->GetLeftSpine();
+			AnalyzeExpression(spine.back()->GetLeft());
+			for (auto it = spine.rbegin(); it != spine.rend(); it++)
+				AnalyzeExpression((*it)->GetRight());
+			break;
+		}
+		case AST::ExpressionType::UnaryExpression:
+		{
+			const AST::UnaryExpression* unaryExpr = static_cast<const AST::UnaryExpression*>(expr);
+			AnalyzeExpression(unaryExpr->GetExpression(), unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticIncrement || unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticDecrement);
+			break;
+		}
+		case AST::ExpressionType::PostfixExpression:
+			AnalyzeExpression(static_cast<const AST::PostfixExpression*>(expr)->GetExpression(), true);
+			break;
+		case AST::ExpressionType::MemberExpression:
+		{
+			// Writing a Field or an Element writes the Variable holding it
+			const AST::MemberExpression* memberExpr = static_cast<const AST::MemberExpression*>(expr);
+			AnalyzeExpression(memberExpr->GetObject(), write);
+			if (memberExpr->IsComputed())
+				AnalyzeExpression(memberExpr->GetProperty());
+			break;
+		}
+		case AST::ExpressionType::CallExpression:
+			AnalyzeCallExpression(static_cast<const AST::CallExpression*>(expr));
+			break;
+		default:
+			break;
+		}
+	}
+
+	void CaptureAnalysis::AnalyzeIdentifierExpression(const AST::IdentifierExpression* identifierExpr, bool write)
+	{
+		if (!m_Environment->Has(identifierExpr->GetValue()))
+			return;
+
+		const Binding& binding = m_Environment->Get(identifierExpr->GetValue());
+		if (binding.Function)
+		{
+			// Used as a Value, the Closure can be called after its Frame is gone
+			if (IsClosure(binding.Function))
+				m_Closures[binding.Function].Escapes = true;
+			return;
+		}
+
+		if (binding.Global || binding.Depth + 1 >= m_Functions.size())
+			return;
+
+		Capture(m_Functions, binding.Declaration, binding.Depth);
+		if (write)
+			m_Written.insert(binding.Declaration);
+	}
+
+	void CaptureAnalysis::AnalyzeCallExpression(const AST::CallExpression* callExpr)
+	{
+		const AST::Expression* callee = callExpr->GetCallee();
+		const std::string* identifier = (callee->GetType() == AST::ExpressionType::IdentifierExpression ? &static_cast<const AST::IdentifierExpression*>(callee)->GetValue() : nullptr);
+		if (identifier && m_Environment->Has(*identifier) && m_Environment->Get(*identifier).Function)
+		{
+			const AST::FunctionStatement* functionStmt = m_Environment->Get(*identifier).Function;
+			if (IsClosure(functionStmt))
+				m_CallSites.push_back({ functionStmt, m_Functions });
+		}
+		else
+		{
+			AnalyzeExpression(callee);
+		}
+
+		for (const auto& arg : callExpr->GetArguments())
+			AnalyzeExpression(arg.get());
+	}
+
+	void CaptureAnalysis::DefineVariable(const AST::IdentifierExpression* declaration)
+	{
+		bool global = (m_Functions.size() == 1 && m_ScopeDepth == 0);
+		m_Environment->Define(declaration->GetValue(), { declaration, nullptr, m_Functions.size() - 1, global });
+		m_DeclarationDepths[declaration] = m_Functions.size() - 1;
+	}
+
+	bool CaptureAnalysis::Capture(const std::vector<const AST::FunctionStatement*>& functions, const AST::IdentifierExpression* declaration, size_t depth)
+	{
+		bool changed = false;
+		for (size_t i = depth + 1; i < functions.size(); i++)
+		{
+			auto it = m_Closures.find(functions[i]);
+			if (it == m_Closures.end())
+				continue;
+
+			std::vector<const AST::IdentifierExpression*>& captures = it->second.Captures;
+			if (std::find(captures.begin(), captures.end(), declaration) != captures.end())
+				continue;
+			captures.push_back(declaration);
+			m_Captured.insert(declaration);
+			changed = true;
+		}
+		return changed;
+	}
+
+	void CaptureAnalysis::BeginBlockScope()
+	{
+		m_Environment = std::make_shared<MapEnvironment<Binding>>(m_Environment);
+		m_ScopeDepth++;
+	}
+
+	void CaptureAnalysis::EndBlockScope()
+	{
+		m_Environment = m_Environment->GetParent();
+		m_ScopeDepth--;
+	}
+}
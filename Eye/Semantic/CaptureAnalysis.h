@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Eye/Semantic/MapEnvironment.h"
+
+#include "Eye/AST/Program.h"
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Statements/ExpressionStatement.h"
+#include "Eye/AST/Statements/BlockStatement.h"
+#include "Eye/AST/Statements/VariableStatement.h"
+#include "Eye/AST/Statements/ControlStatement.h"
+#include "Eye/AST/Statements/IterationStatement.h"
+#include "Eye/AST/Statements/FunctionStatement.h"
+#include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
+
+#include "Eye/AST/Expressions/Expression.h"
+#include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/Expressions/AssignmentExpression.h"
+#include "Eye/AST/Expressions/BinaryExpression.h"
+#include "Eye/AST/Expressions/UnaryExpression.h"
+#include "Eye/AST/Expressions/PostfixExpression.h"
+#include "Eye/AST/Expressions/MemberExpression.h"
+#include "Eye/AST/Expressions/CallExpression.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Eye
+{
+	/*
+		CaptureAnalysis
+			Closures are Functions declared anywhere but the Top-Level, they capture the Locals of enclosing Functions they use.
+			Closures calling a Closure also capture what it captures, so every Call Site can pass the Captures along.
+			A Closure escapes if its Name is used other than as a Callee, it may then outlive the Frame holding its Captures.
+			Captures stay plain Values on the Stack unless a Closure assigns them or an escaping Closure captures them, only those are boxed.
+			Variables are identified by the IdentifierExpression declaring them, a Variable's or a Parameter's.
+	*/
+	class CaptureAnalysis
+	{
+	public:
+		void Analyze(const AST::Program* ast);
+
+		bool IsClosure(const AST::FunctionStatement* functionStmt) const;
+		bool Escapes(const AST::FunctionStatement* functionStmt) const;
+		// In the Order a Closure takes them as trailing Parameters, empty for Top-Level Functions
+		const std::vector<const AST::IdentifierExpression*>& GetCaptures(const AST::FunctionStatement* functionStmt) const;
+		bool IsCaptured(const AST::IdentifierExpression* declaration) const;
+		bool IsBoxed(const AST::IdentifierExpression* declaration) const;
+
+	private:
+		struct Binding
+		{
+			// nullptr for Functions
+			const AST::IdentifierExpression* Declaration;
+			const AST::FunctionStatement* Function;
+			// Index into m_Functions of the Function declaring it
+			size_t Depth;
+			bool Global;
+		};
+
+		struct Closure
+		{
+			std::vector<const AST::IdentifierExpression*> Captures;
+			bool Escapes = false;
+		};
+
+		// Callers are the Functions enclosing the Call, outermost first
+		struct CallSite
+		{
+			const AST::FunctionStatement* Callee;
+			std::vector<const AST::FunctionStatement*> Callers;
+		};
+
+	private:
+		void AnalyzeStatement(const AST::Statement* stmt);
+		void AnalyzeBlockStatement(const AST::BlockStatement* blockStmt, bool createScope = true);
+		void AnalyzeVariableStatement(const AST::VariableStatement* varStmt);
+		void AnalyzeIterationStatement(const AST::IterationStatement* iterStmt);
+		void AnalyzeFunctionStatement(const AST::FunctionStatement* functionStmt);
+		// write marks Assignment Targets
+		void AnalyzeExpression(const AST::Expression* expr, bool write = false);
+		void AnalyzeIdentifierExpression(const AST::IdentifierExpression* identifierExpr, bool write);
+		void AnalyzeCallExpression(const AST::CallExpression* callExpr);
+
+	private:
+		void DefineVariable(const AST::IdentifierExpression* declaration);
+		// Adds the Capture to the Closures among functions deeper than depth
+		bool Capture(const std::vector<const AST::FunctionStatement*>& functions, const AST::IdentifierExpression* declaration, size_t depth);
+		void BeginBlockScope();
+		void EndBlockScope();
+
+	private:
+		std::shared_ptr<MapEnvironment<Binding>> m_Environment;
+		// Functions whose Bodies enclose the current Statement, nullptr stands for the Top-Level
+		std::vector<const AST::FunctionStatement*> m_Functions;
+		size_t m_ScopeDepth = 0;
+		std::unordered_map<const AST::FunctionStatement*, Closure> m_Closures;
+		std::unordered_map<const AST::IdentifierExpression*, size_t> m_DeclarationDepths;
+		std::vector<CallSite> m_CallSites;
+		std::unordered_set<const AST::IdentifierExpression*> m_Captured;
+		// Assigned by a Closure capturing them
+		std::unordered_set<const AST::IdentifierExpression*> m_Written;
+		std::unordered_set<const AST::IdentifierExpression*> m_Boxed;
+	};
+}
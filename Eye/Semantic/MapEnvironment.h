@@ -34,7 +34,7 @@ namespace Eye
 			else if (m_Parent)
 				m_Parent->Assign(identifier, value);
 
-			EYE_LOG_CRITICAL("MapEnvironment->Assign " + identifier + " Not Defined!");
+			EYE_LOG_CRITICAL("MapEnvironment->Assign {} Not Defined!", identifier);
 		}
 
 		const T& Get(const std::string& identifier)
@@ -44,7 +44,7 @@ namespace Eye
 			else if (m_Parent)
 				return m_Parent->Get(identifier);
 
-			EYE_LOG_CRITICAL("MapEnvironment->Get " + identifier + " Not Defined!");
+			EYE_LOG_CRITICAL("MapEnvironment->Get {} Not Defined!", identifier);
 		}
 
 		bool Has(const std::string& identifier, bool checkParent = true) const
@@ -0,0 +1,462 @@
+#include "Eye/Semantic/NamespaceResolver.h"
+#include "Eye/Utility/Logger.h"
+#include "Eye/Error/Exceptions/NamespaceException.h"
+#include "Eye/Error/Exceptions/NotDeclaredException.h"
+#include "Eye/Error/Exceptions/ReDeclarationException.h"
+
+namespace Eye
+{
+	std::expected<bool, Error::Error> NamespaceResolver::Resolve(AST::Program* ast, const ModuleImports& imports)
+	{
+		m_SymbolIndex = std::make_shared<SymbolIndex>();
+		m_Imports = &imports;
+		m_CurrentNamespace = SymbolIndex::RootNamespace;
+		m_LocalScopes.clear();
+
+		try
+		{
+			for (auto& stmt : ast->GetStatementList())
+				ResolveStatement(stmt.get());
+		}
+		catch (const Error::Exceptions::EyeException& ex)
+		{
+			return std::unexpected(ex.GetError());
+		}
+		catch (...)
+		{
+			EYE_LOG_CRITICAL("EYENamespaceResolver->Resolve Unsupported Exception!");
+		}
+
+		ast->SetSymbolIndex(m_SymbolIndex);
+		return true;
+	}
+
+	void NamespaceResolver::ResolveStatement(AST::Statement* stmt)
+	{
+		if (!stmt)
+			return;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::ExpressionStatement:
+		{
+			AST::ExpressionStatement* exprStmt = static_cast<AST::ExpressionStatement*>(stmt);
+			if (auto resolved = ResolveExpression(exprStmt->GetExpression()))
+				exprStmt->SetExpression(std::move(resolved));
+			break;
+		}
+		case AST::StatementType::BlockStatement:
+			ResolveBlockStatement(static_cast<AST::BlockStatement*>(stmt));
+			break;
+		case AST::StatementType::VariableStatement:
+			ResolveVariableStatement(static_cast<AST::VariableStatement*>(stmt));
+			break;
+		case AST::StatementType::ControlStatement:
+			ResolveControlStatement(static_cast<AST::ControlStatement*>(stmt));
+			break;
+		case AST::StatementType::IterationStatement:
+			ResolveIterationStatement(static_cast<AST::IterationStatement*>(stmt));
+			break;
+		case AST::StatementType::FunctionStatement:
+			ResolveFunctionStatement(static_cast<AST::FunctionStatement*>(stmt));
+			break;
+		case AST::StatementType::ReturnStatement:
+		{
+			AST::ReturnStatement* returnStmt = static_cast<AST::ReturnStatement*>(stmt);
+			if (returnStmt->GetExpression())
+			{
+				if (auto resolved = ResolveExpression(returnStmt->GetExpression()))
+					returnStmt->SetExpression(std::move(resolved));
+			}
+			break;
+		}
+		case AST::StatementType::ImportStatement:
+			ResolveImportStatement(static_cast<AST::ImportStatement*>(stmt));
+			break;
+		case AST::StatementType::NamespaceStatement:
+			ResolveNamespaceStatement(static_cast<AST::NamespaceStatement*>(stmt));
+			break;
+		default:
+			// Jumps & Structs name no Variables or Functions
+			break;
+		}
+	}
+
+	void NamespaceResolver::ResolveBlockStatement(AST::BlockStatement* blockStmt, bool createScope)
+	{
+		if (createScope)
+			BeginBlockScope();
+
+		for (auto& stmt : blockStmt->GetStatementList())
+			ResolveStatement(stmt.get());
+
+		if (createScope)
+			EndBlockScope();
+	}
+
+	void NamespaceResolver::ResolveVariableStatement(AST::VariableStatement* varStmt)
+	{
+		// The Initializer is resolved before the Variable is in Scope
+		for (auto& var : varStmt->GetVariableDeclarationList())
+		{
+			if (var->GetInitializer())
+			{
+				if (auto resolved = ResolveExpression(var->GetInitializer()))
+					var->SetInitializer(std::move(resolved));
+			}
+
+			if (m_LocalScopes.empty())
+				DeclareGlobal(var->GetIdentifier(), SymbolKind::Variable);
+			else
+				DeclareLocal(var->GetIdentifier());
+		}
+	}
+
+	void NamespaceResolver::ResolveControlStatement(AST::ControlStatement* ctrlStmt)
+	{
+		if (auto resolved = ResolveExpression(ctrlStmt->GetCondition()))
+			ctrlStmt->SetCondition(std::move(resolved));
+		ResolveStatement(ctrlStmt->GetConsequent());
+		ResolveStatement(ctrlStmt->GetAlternate());
+	}
+
+	void NamespaceResolver::ResolveIterationStatement(AST::IterationStatement* iterStmt)
+	{
+		switch (iterStmt->GetIterationType())
+		{
+		case AST::IterationStatementType::WhileStatement:
+		{
+			AST::WhileStatement* whileStmt = static_cast<AST::WhileStatement*>(iterStmt);
+			if (auto resolved = ResolveExpression(whileStmt->GetCondition()))
+				whileStmt->SetCondition(std::move(resolved));
+			ResolveStatement(whileStmt->GetBody());
+			break;
+		}
+		case AST::IterationStatementType::DoWhileStatement:
+		{
+			AST::DoWhileStatement* doStmt = static_cast<AST::DoWhileStatement*>(iterStmt);
+			ResolveStatement(doStmt->GetBody());
+			if (auto resolved = ResolveExpression(doStmt->GetCondition()))
+				doStmt->SetCondition(std::move(resolved));
+			break;
+		}
+		case AST::IterationStatementType::ForStatement:
+		{
+			AST::ForStatement* forStmt = static_cast<AST::ForStatement*>(iterStmt);
+			BeginBlockScope();
+			if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+			{
+				ResolveVariableStatement(forStmt->GetInitializer<AST::VariableStatement>());
+			}
+			else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+			{
+				if (auto resolved = ResolveExpression(forStmt->GetInitializer<AST::Expression>()))
+					forStmt->SetInitializer(std::move(resolved));
+			}
+			if (forStmt->GetCondition())
+			{
+				if (auto resolved = ResolveExpression(forStmt->GetCondition()))
+					forStmt->SetCondition(std::move(resolved));
+			}
+			if (forStmt->GetUpdate())
+			{
+				if (auto resolved = ResolveExpression(forStmt->GetUpdate()))
+					forStmt->SetUpdate(std::move(resolved));
+			}
+			ResolveStatement(forStmt->GetBody());
+			EndBlockScope();
+			break;
+		}
+		}
+	}
+
+	void NamespaceResolver::ResolveFunctionStatement(AST::FunctionStatement* functionStmt)
+	{
+		// Defaults are evaluated where the Function is declared
+		for (auto& param : functionStmt->GetParameters())
+		{
+			if (param->GetInitializer())
+			{
+				if (auto resolved = ResolveExpression(param->GetInitializer()))
+					param->SetInitializer(std::move(resolved));
+			}
+		}
+
+		// Declared before its Body, the Function may call itself
+		if (m_LocalScopes.empty())
+			DeclareGlobal(functionStmt->GetIdentifier(), SymbolKind::Function);
+		else
+			DeclareLocal(functionStmt->GetIdentifier());
+
+		BeginBlockScope();
+		for (const auto& param : functionStmt->GetParameters())
+			DeclareLocal(param->GetIdentifier());
+		ResolveBlockStatement(functionStmt->GetBody(), false);
+		EndBlockScope();
+	}
+
+	void NamespaceResolver::ResolveImportStatement(AST::ImportStatement* importStmt)
+	{
+		// Unresolved Imports are reported by the Semantic
+		auto it = m_Imports->find(importStmt->GetPath()->GetValue<AST::LiteralStringType>());
+		if (it == m_Imports->end() || !it->second)
+			return;
+
+		// Interfaces export Namespace Members by their qualified Names
+		for (const auto& function : it->second->Functions)
+		{
+			uint32_t ns = SymbolIndex::RootNamespace;
+			size_t begin = 0;
+			for (size_t end = function.Name.find("::"); end != std::string::npos; end = function.Name.find("::", begin))
+			{
+				ns = m_SymbolIndex->AddNamespace(ns, function.Name.substr(begin, end - begin));
+				begin = end + 2;
+			}
+			m_SymbolIndex->AddSymbol(ns, function.Name.substr(begin), SymbolKind::Function);
+		}
+	}
+
+	void NamespaceResolver::ResolveNamespaceStatement(AST::NamespaceStatement* namespaceStmt)
+	{
+		const std::string& name = namespaceStmt->GetIdentifier()->GetName();
+		if (!m_LocalScopes.empty())
+			throw Error::Exceptions::NamespaceException("Namespace '" + name + "' Declared outside of the Global Scope", Error::ErrorType::SemanticBadNamespace, namespaceStmt->GetSource());
+
+		if (m_SymbolIndex->FindSymbol(m_CurrentNamespace, name) != SymbolIndex::InvalidId)
+			throw Error::Exceptions::ReDeclarationException("ReDeclaration of '" + m_SymbolIndex->Qualify(m_CurrentNamespace, name) + "' as a Namespace", Error::ErrorType::SemanticReDeclaration, namespaceStmt->GetIdentifier()->GetSource());
+
+		uint32_t parent = m_CurrentNamespace;
+		m_CurrentNamespace = m_SymbolIndex->AddNamespace(parent, name);
+		for (auto& stmt : namespaceStmt->GetStatementList())
+			ResolveStatement(stmt.get());
+		m_CurrentNamespace = parent;
+	}
+
+	std::unique_ptr<AST::Expression> NamespaceResolver::ResolveExpression(AST::Expression* expr)
+	{
+		std::unique_ptr<AST::Expression> resolved;
+		switch (expr->GetType())
+		{
+		case AST::ExpressionType::IdentifierExpression:
+			ResolveIdentifierExpression(static_cast<AST::IdentifierExpression*>(expr));
+			break;
+		case AST::ExpressionType::AssignmentExpression:
+		{
+			AST::AssignmentExpression* assignExpr = static_cast<AST::AssignmentExpression*>(expr);
+			if (auto lhs = ResolveExpression(assignExpr->GetLHSExpression()))
+				assignExpr->SetLHSExpression(std::move(lhs));
+			if (auto rhs = ResolveExpression(assignExpr->GetExpression()))
+				assignExpr->SetExpression(std::move(rhs));
+			break;
+		}
+		case AST::ExpressionType::BinaryExpression:
+		{
+			// Left-Deep Chains are walked in a Loop
+			std::vector<AST::BinaryExpression*> spine = static_cast<AST::BinaryExpression*>(expr)->GetLeftSpine();
+			if (auto left = ResolveExpression(spine.back()->GetLeft()))
+				spine.back()->SetLeft(std::move(left));
+			for (auto it = spine.rbegin(); it != spine.rend(); it++)
+			{
+				if (auto right = ResolveExpression((*it)->GetRight()))
+					(*it)->SetRight(std::move(right));
+			}
+			break;
+		}
+		case AST::ExpressionType::UnaryExpression:
+		{
+			AST::UnaryExpression* unaryExpr = static_cast<AST::UnaryExpression*>(expr);
+			if (auto operand = ResolveExpression(unaryExpr->GetExpression()))
+				unaryExpr->SetExpression(std::move(operand));
+			break;
+		}
+		case AST::ExpressionType::PostfixExpression:
+		{
+			AST::PostfixExpression* postfixExpr = static_cast<AST::PostfixExpression*>(expr);
+			if (auto operand = ResolveExpression(postfixExpr->GetExpression()))
+				postfixExpr->SetExpression(std::move(operand));
+			break;
+		}
+		case AST::ExpressionType::MemberExpression:
+			resolved = ResolveMemberExpression(static_cast<AST::MemberExpression*>(expr));
+			break;
+		case AST::ExpressionType::CallExpression:
+		{
+			AST::CallExpression* callExpr = static_cast<AST::CallExpression*>(expr);
+			if (auto callee = ResolveExpression(callExpr->GetCallee()))
+				callExpr->SetCallee(std::move(callee));
+			for (auto& arg : callExpr->GetArguments())
+			{
+				if (auto resolvedArg = ResolveExpression(arg.get()))
+					arg = std::move(resolvedArg);
+			}
+			break;
+		}
+		default:
+			break;
+		}
+
+		// The Replacement takes the Id of the Expression it replaces
+		if (resolved)
+			resolved->SetId(expr->GetId());
+		return resolved;
+	}
+
+	void NamespaceResolver::ResolveIdentifierExpression(AST::IdentifierExpression* identifierExpr)
+	{
+		const std::string& name = identifierExpr->GetName();
+		if (IsLocal(name))
+		{
+			identifierExpr->SetSymbol("");
+			return;
+		}
+
+		Lookup lookup = Find(name);
+		if (lookup.Namespace != SymbolIndex::InvalidId)
+			throw Error::Exceptions::NamespaceException("Namespace '" + name + "' Used as a Value", Error::ErrorType::SemanticBadNamespace, identifierExpr->GetSource());
+
+		if (lookup.Symbol != SymbolIndex::InvalidId)
+			identifierExpr->SetSymbol(m_SymbolIndex->GetSymbol(lookup.Symbol).Name);
+		else
+			identifierExpr->SetSymbol("");
+	}
+
+	std::unique_ptr<AST::Expression> NamespaceResolver::ResolveMemberExpression(AST::MemberExpression* memberExpr)
+	{
+		uint32_t ns = (memberExpr->IsComputed() ? SymbolIndex::InvalidId : GetNamespace(memberExpr->GetObject()));
+		if (ns == SymbolIndex::InvalidId)
+		{
+			if (auto object = ResolveExpression(memberExpr->GetObject()))
+				memberExpr->SetObject(std::move(object));
+			// Field Names are not resolved
+			if (memberExpr->IsComputed())
+			{
+				if (auto property = ResolveExpression(memberExpr->GetProperty()))
+					memberExpr->SetProperty(std::move(property));
+			}
+			return nullptr;
+		}
+
+		// 'A.B.name' is written 'A::B::name', the Replacement is named so & starts where the Chain does
+		std::string name = static_cast<const AST::IdentifierExpression*>(memberExpr->GetProperty())->GetName();
+		const AST::Expression* object = memberExpr->GetObject();
+		while (object->GetType() == AST::ExpressionType::MemberExpression)
+		{
+			const AST::MemberExpression* objectMember = static_cast<const AST::MemberExpression*>(object);
+			name = static_cast<const AST::IdentifierExpression*>(objectMember->GetProperty())->GetName() + "::" + name;
+			object = objectMember->GetObject();
+		}
+		const std::string& member = static_cast<const AST::IdentifierExpression*>(memberExpr->GetProperty())->GetName();
+		name = static_cast<const AST::IdentifierExpression*>(object)->GetName() + "::" + name;
+
+		uint32_t symbol = m_SymbolIndex->FindSymbol(ns, member);
+		if (symbol == SymbolIndex::InvalidId)
+		{
+			if (m_SymbolIndex->FindNamespace(ns, member) != SymbolIndex::InvalidId)
+				throw Error::Exceptions::NamespaceException("Namespace '" + name + "' Used as a Value", Error::ErrorType::SemanticBadNamespace, memberExpr->GetSource());
+			throw Error::Exceptions::NotDeclaredException("'" + member + "' is not a Member of Namespace '" + m_SymbolIndex->GetNamespaceName(ns) + "'", Error::ErrorType::SemanticNotDeclared, memberExpr->GetProperty()->GetSource());
+		}
+
+		std::unique_ptr<AST::IdentifierExpression> resolved = std::make_unique<AST::IdentifierExpression>(object->GetSource(), name);
+		resolved->SetSymbol(m_SymbolIndex->GetSymbol(symbol).Name);
+		return resolved;
+	}
+
+	void NamespaceResolver::DeclareGlobal(AST::IdentifierExpression* identifier, SymbolKind kind)
+	{
+		const std::string& name = identifier->GetName();
+		if (m_SymbolIndex->FindNamespace(m_CurrentNamespace, name) != SymbolIndex::InvalidId)
+			throw Error::Exceptions::ReDeclarationException("ReDeclaration of Namespace '" + m_SymbolIndex->Qualify(m_CurrentNamespace, name) + "'", Error::ErrorType::SemanticReDeclaration, identifier->GetSource());
+
+		// ReDeclared Symbols share the Id, the Semantic reports them
+		uint32_t symbol = m_SymbolIndex->AddSymbol(m_CurrentNamespace, name, kind);
+		identifier->SetSymbol(m_SymbolIndex->GetSymbol(symbol).Name);
+	}
+
+	void NamespaceResolver::DeclareLocal(AST::IdentifierExpression* identifier)
+	{
+		m_LocalScopes.back().insert(identifier->GetName());
+		identifier->SetSymbol("");
+	}
+
+	bool NamespaceResolver::IsLocal(const std::string& name) const
+	{
+		for (auto it = m_LocalScopes.rbegin(); it != m_LocalScopes.rend(); it++)
+		{
+			if (it->contains(name))
+				return true;
+		}
+		return false;
+	}
+
+	NamespaceResolver::Lookup NamespaceResolver::Find(const std::string& name) const
+	{
+		// 'name' & 'A::B::name' search from the current Namespace outwards, '::name' from the Root only
+		std::vector<std::string_view> segments;
+		std::string_view rest = name;
+		bool rooted = rest.starts_with("::");
+		if (rooted)
+			rest.remove_prefix(2);
+		for (size_t end = rest.find("::"); end != std::string_view::npos; end = rest.find("::"))
+		{
+			segments.push_back(rest.substr(0, end));
+			rest.remove_prefix(end + 2);
+		}
+		segments.push_back(rest);
+
+		uint32_t ns = (rooted ? SymbolIndex::RootNamespace : m_CurrentNamespace);
+		if (segments.size() == 1)
+		{
+			for (; ns != SymbolIndex::InvalidId; ns = (rooted ? SymbolIndex::InvalidId : m_SymbolIndex->GetParentNamespace(ns)))
+			{
+				Lookup lookup = { m_SymbolIndex->FindSymbol(ns, segments[0]), m_SymbolIndex->FindNamespace(ns, segments[0]) };
+				if (lookup.Symbol != SymbolIndex::InvalidId || lookup.Namespace != SymbolIndex::InvalidId)
+					return lookup;
+			}
+			return {};
+		}
+
+		// The first Segment names the innermost visible Namespace, every other one a Member of the Previous
+		if (!rooted)
+		{
+			while (ns != SymbolIndex::InvalidId && m_SymbolIndex->FindNamespace(ns, segments[0]) == SymbolIndex::InvalidId)
+				ns = m_SymbolIndex->GetParentNamespace(ns);
+			if (ns == SymbolIndex::InvalidId)
+				return {};
+		}
+		for (size_t i = 0; i + 1 < segments.size(); i++)
+		{
+			ns = m_SymbolIndex->FindNamespace(ns, segments[i]);
+			if (ns == SymbolIndex::InvalidId)
+				return {};
+		}
+		return { m_SymbolIndex->FindSymbol(ns, segments.back()), m_SymbolIndex->FindNamespace(ns, segments.back()) };
+	}
+
+	uint32_t NamespaceResolver::GetNamespace(const AST::Expression* expr) const
+	{
+		if (expr->GetType() == AST::ExpressionType::IdentifierExpression)
+		{
+			const std::string& name = static_cast<const AST::IdentifierExpression*>(expr)->GetName();
+			return (IsLocal(name) ? SymbolIndex::InvalidId : Find(name).Namespace);
+		}
+
+		if (expr->GetType() == AST::ExpressionType::MemberExpression && !static_cast<const AST::MemberExpression*>(expr)->IsComputed())
+		{
+			const AST::MemberExpression* memberExpr = static_cast<const AST::MemberExpression*>(expr);
+			uint32_t ns = GetNamespace(memberExpr->GetObject());
+			if (ns != SymbolIndex::InvalidId)
+				return m_SymbolIndex->FindNamespace(ns, static_cast<const AST::IdentifierExpression*>(memberExpr->GetProperty())->GetName());
+		}
+		return SymbolIndex::InvalidId;
+	}
+
+	void NamespaceResolver::BeginBlockScope()
+	{
+		m_LocalScopes.emplace_back();
+	}
+
+	void NamespaceResolver::EndBlockScope()
+	{
+		m_LocalScopes.pop_back();
+	}
+}
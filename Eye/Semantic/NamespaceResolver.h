@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Eye/Semantic/SymbolIndex.h"
+#include "Eye/ModuleLoader/ModuleInterface.h"
+#include "Eye/Error/Error.h"
+
+#include "Eye/AST/Program.h"
+#include "Eye/AST/Statements/Statement.h"
+#include "Eye/AST/Statements/ExpressionStatement.h"
+#include "Eye/AST/Statements/BlockStatement.h"
+#include "Eye/AST/Statements/VariableStatement.h"
+#include "Eye/AST/Statements/ControlStatement.h"
+#include "Eye/AST/Statements/IterationStatement.h"
+#include "Eye/AST/Statements/FunctionStatement.h"
+#include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/ImportStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
+
+#include "Eye/AST/Expressions/Expression.h"
+#include "Eye/AST/Expressions/IdentifierExpression.h"
+#include "Eye/AST/Expressions/AssignmentExpression.h"
+#include "Eye/AST/Expressions/BinaryExpression.h"
+#include "Eye/AST/Expressions/UnaryExpression.h"
+#include "Eye/AST/Expressions/PostfixExpression.h"
+#include "Eye/AST/Expressions/MemberExpression.h"
+#include "Eye/AST/Expressions/CallExpression.h"
+
+#include <expected>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Eye
+{
+	/*
+		NamespaceResolver
+			Runs right after Parsing, builds the Program's SymbolIndex & rewrites every Use of a Namespace Member into its qualified Symbol.
+			Globals declared in a Namespace are renamed 'Namespace::Member' (see IdentifierExpression::GetValue), so every later Pass sees plain Globals.
+			'Math::square' & 'Math.square' both become one IdentifierExpression, unqualified Names search the enclosing Namespaces outwards, Locals first.
+			Names it cannot resolve are left as written for the Semantic to report, resolving a Program twice gives the same Result.
+	*/
+	class NamespaceResolver
+	{
+	public:
+		// imports resolves the Program's ImportStatements, see ModuleLoader
+		std::expected<bool, Error::Error> Resolve(AST::Program* ast, const ModuleImports& imports = {});
+		inline const std::shared_ptr<SymbolIndex>& GetSymbolIndex() const { return m_SymbolIndex; }
+
+	private:
+		// Innermost Declaration of a Name, at most one of both is valid
+		struct Lookup
+		{
+			uint32_t Symbol = SymbolIndex::InvalidId;
+			uint32_t Namespace = SymbolIndex::InvalidId;
+		};
+
+	private:
+		void ResolveStatement(AST::Statement* stmt);
+		void ResolveBlockStatement(AST::BlockStatement* blockStmt, bool createScope = true);
+		void ResolveVariableStatement(AST::VariableStatement* varStmt);
+		void ResolveControlStatement(AST::ControlStatement* ctrlStmt);
+		void ResolveIterationStatement(AST::IterationStatement* iterStmt);
+		void ResolveFunctionStatement(AST::FunctionStatement* functionStmt);
+		void ResolveImportStatement(AST::ImportStatement* importStmt);
+		void ResolveNamespaceStatement(AST::NamespaceStatement* namespaceStmt);
+
+		// Resolves expr in place & returns its Replacement if expr itself names a Namespace Member, nullptr otherwise
+		std::unique_ptr<AST::Expression> ResolveExpression(AST::Expression* expr);
+		void ResolveIdentifierExpression(AST::IdentifierExpression* identifierExpr);
+		std::unique_ptr<AST::Expression> ResolveMemberExpression(AST::MemberExpression* memberExpr);
+
+	private:
+		void DeclareGlobal(AST::IdentifierExpression* identifier, SymbolKind kind);
+		void DeclareLocal(AST::IdentifierExpression* identifier);
+		bool IsLocal(const std::string& name) const;
+		Lookup Find(const std::string& name) const;
+		// Namespace an Expression denotes, 'A', 'A::B' or 'A.B', InvalidId if it denotes none
+		uint32_t GetNamespace(const AST::Expression* expr) const;
+		void BeginBlockScope();
+		void EndBlockScope();
+
+	private:
+		std::shared_ptr<SymbolIndex> m_SymbolIndex;
+		const ModuleImports* m_Imports = nullptr;
+		uint32_t m_CurrentNamespace = SymbolIndex::RootNamespace;
+		// Names of the Locals in every open Scope, empty at Namespace Level
+		std::vector<std::unordered_set<std::string>> m_LocalScopes;
+	};
+}
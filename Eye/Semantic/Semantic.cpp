@@ -7,16 +7,19 @@
 #include "Eye/Error/Exceptions/ReturnException.h"
 #include "Eye/Error/Exceptions/CallException.h"
 #include "Eye/Error/Exceptions/ArgumentException.h"
+#include "Eye/Error/Exceptions/ImportException.h"
 
 #include <functional>
 
 namespace Eye
 {
-	std::expected<bool, Error::Error> Semantic::Validate(const AST::Program* ast)
+	std::expected<bool, Error::Error> Semantic::Validate(const AST::Program* ast, const ModuleImports& imports)
 	{
 		m_DeclarationEnvironment = std::make_shared<MapEnvironment<DeclarationType>>();
 		m_FunctionDeclarationEnvironment = std::make_shared<MapEnvironment<FunctionDeclaration>>();
 		m_VariableTypeQualifierEnvironment = std::make_shared<MapEnvironment<VariableTypeQualifier>>();
+		m_Imports = &imports;
+		m_ImportedInterfaces.clear();
 
 		try
 		{
@@ -37,6 +40,9 @@ namespace Eye
 
 	void Semantic::ValidateStatement(const AST::Statement* stmt)
 	{
+		if (!stmt)
+			return;
+
 		switch (stmt->GetType())
 		{
 		case AST::StatementType::ExpressionStatement:
@@ -48,12 +54,30 @@ namespace Eye
 		case AST::StatementType::VariableStatement:
 			ValidateVariableStatement(static_cast<const AST::VariableStatement*>(stmt));
 			break;
+		case AST::StatementType::ControlStatement:
+			ValidateControlStatement(static_cast<const AST::ControlStatement*>(stmt));
+			break;
+		case AST::StatementType::IterationStatement:
+			ValidateIterationStatement(static_cast<const AST::IterationStatement*>(stmt));
+			break;
+		case AST::StatementType::ContinueStatement:
+		case AST::StatementType::BreakStatement:
+			break;
 		case AST::StatementType::FunctionStatement:
 			ValidateFunctionStatement(static_cast<const AST::FunctionStatement*>(stmt));
 			break;
 		case AST::StatementType::ReturnStatement:
 			ValidateReturnStatement(static_cast<const AST::ReturnStatement*>(stmt));
 			break;
+		case AST::StatementType::ImportStatement:
+			ValidateImportStatement(static_cast<const AST::ImportStatement*>(stmt));
+			break;
+		case AST::StatementType::StructStatement:
+			ValidateStructStatement(static_cast<const AST::StructStatement*>(stmt));
+			break;
+		case AST::StatementType::NamespaceStatement:
+			ValidateNamespaceStatement(static_cast<const AST::NamespaceStatement*>(stmt));
+			break;
 		default:
 			EYE_LOG_CRITICAL("EYESemantic ValidateStatement Unsupported Statement Type!");
 			break;
@@ -67,21 +91,49 @@ namespace Eye
 
 	void Semantic::ValidateBlockStatement(const AST::BlockStatement* blockStmt, bool createScope)
 	{
+		// Directly Nested Blocks are walked with an explicit Stack instead of one Call per Level
+		struct Frame
+		{
+			const AST::BlockStatement* Block;
+			size_t Index;
+			bool Scoped;
+		};
+
 		if (createScope)
 			BeginBlockScope();
-		for (const auto& stmt : blockStmt->GetStatementList())
-			ValidateStatement(stmt.get());
-		if (createScope)
-			EndBlockScope();
+		std::vector<Frame> frames = { { blockStmt, 0, createScope } };
+		while (!frames.empty())
+		{
+			Frame& frame = frames.back();
+			if (frame.Index == frame.Block->GetStatementList().size())
+			{
+				if (frame.Scoped)
+					EndBlockScope();
+				frames.pop_back();
+				continue;
+			}
+
+			const AST::Statement* stmt = frame.Block->GetStatementList()[frame.Index++].get();
+			if (stmt && stmt->GetType() == AST::StatementType::BlockStatement)
+			{
+				BeginBlockScope();
+				frames.push_back({ static_cast<const AST::BlockStatement*>(stmt), 0, true });
+			}
+			else
+			{
+				ValidateStatement(stmt);
+			}
+		}
 	}
 
 	void Semantic::ValidateVariableStatement(const AST::VariableStatement* varStmt)
 	{
-		if (varStmt->GetDataType()->GetType() == TokenType::KeywordDataTypeVoid)
+		if (varStmt->GetTypeSpecifier().Type == AST::DataType::Void)
 			throw Error::Exceptions::BadDataTypeException("Variable Declared as void", Error::ErrorType::SemanticBadDataType, varStmt->GetSource());
+		ValidateStructTypeSpecifier(varStmt->GetTypeSpecifier(), varStmt->GetSource());
 
 		VariableTypeQualifier typeQualifier = VariableTypeQualifier::None;
-		if (varStmt->GetTypeQualifier() && varStmt->GetTypeQualifier()->GetType() == TokenType::KeywordTypeQualifierConst)
+		if (varStmt->GetTypeSpecifier().IsConst())
 			typeQualifier = VariableTypeQualifier::Const;
 
 		for (const auto& var : varStmt->GetVariableDeclarationList())
@@ -97,28 +149,63 @@ namespace Eye
 		}
 	}
 
+	void Semantic::ValidateControlStatement(const AST::ControlStatement* ctrlStmt)
+	{
+		ValidateExpression(ctrlStmt->GetCondition());
+		ValidateStatement(ctrlStmt->GetConsequent());
+		ValidateStatement(ctrlStmt->GetAlternate());
+	}
+
+	void Semantic::ValidateIterationStatement(const AST::IterationStatement* iterStmt)
+	{
+		switch (iterStmt->GetIterationType())
+		{
+		case AST::IterationStatementType::WhileStatement:
+		{
+			const auto& whileStmt = static_cast<const AST::WhileStatement*>(iterStmt);
+			ValidateExpression(whileStmt->GetCondition());
+			ValidateStatement(whileStmt->GetBody());
+			break;
+		}
+		case AST::IterationStatementType::DoWhileStatement:
+		{
+			const auto& doWhileStmt = static_cast<const AST::DoWhileStatement*>(iterStmt);
+			ValidateStatement(doWhileStmt->GetBody());
+			ValidateExpression(doWhileStmt->GetCondition());
+			break;
+		}
+		case AST::IterationStatementType::ForStatement:
+		{
+			const auto& forStmt = static_cast<const AST::ForStatement*>(iterStmt);
+			BeginBlockScope();
+			if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+				ValidateVariableStatement(forStmt->GetInitializer<AST::VariableStatement>());
+			else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+				ValidateExpression(forStmt->GetInitializer<AST::Expression>());
+			if (forStmt->GetCondition())
+				ValidateExpression(forStmt->GetCondition());
+			if (forStmt->GetUpdate())
+				ValidateExpression(forStmt->GetUpdate());
+			ValidateStatement(forStmt->GetBody());
+			EndBlockScope();
+			break;
+		}
+		default:
+			EYE_LOG_CRITICAL("EYESemantic ValidateIterationStatement Unsupported Iteration Type!");
+			break;
+		}
+	}
+
 	void Semantic::ValidateFunctionStatement(const AST::FunctionStatement* functionStmt)
 	{
 		if (m_DeclarationEnvironment->Has(functionStmt->GetIdentifier()->GetValue()))
 			throw Error::Exceptions::ReDeclarationException("ReDeclaration of '" + functionStmt->GetIdentifier()->GetValue() + "'", Error::ErrorType::SemanticReDeclaration, functionStmt->GetIdentifier()->GetSource());
 	
-		FunctionDeclaration funcDec;
-		FunctionParameterType paramType;
+		FunctionDeclaration funcDec = GetFunctionDeclaration(functionStmt);
 		for (const auto& param : functionStmt->GetParameters())
 		{
 			if (param->GetInitializer())
-			{
 				ValidateExpression(param->GetInitializer());
-				funcDec.DefaultParameterCount++;
-				paramType = FunctionParameterType::Default;
-			}
-			else
-			{
-				funcDec.RequiredParameterCount++;
-				paramType = FunctionParameterType::Required;
-			}
-
-			funcDec.Parameters.push_back(paramType);
 		}
 
 		ValidateFunctionParameters(functionStmt, funcDec);
@@ -131,7 +218,7 @@ namespace Eye
 		for (const auto& param : functionStmt->GetParameters())
 		{
 			VariableTypeQualifier typeQualifier = VariableTypeQualifier::None;
-			if (param->GetTypeQualifier() && param->GetTypeQualifier()->GetType() == TokenType::KeywordTypeQualifierConst)
+			if (param->GetTypeSpecifier().IsConst())
 				typeQualifier = VariableTypeQualifier::Const;
 
 			m_DeclarationEnvironment->Define(param->GetIdentifier()->GetValue(), DeclarationType::Variable);
@@ -144,15 +231,38 @@ namespace Eye
 		EndBlockScope();
 	}
 
+	FunctionDeclaration Semantic::GetFunctionDeclaration(const AST::FunctionStatement* functionStmt)
+	{
+		FunctionDeclaration funcDec;
+		for (const auto& param : functionStmt->GetParameters())
+		{
+			if (param->GetInitializer())
+			{
+				funcDec.DefaultParameterCount++;
+				funcDec.Parameters.push_back(FunctionParameterType::Default);
+			}
+			else
+			{
+				funcDec.RequiredParameterCount++;
+				funcDec.Parameters.push_back(FunctionParameterType::Required);
+			}
+		}
+		return funcDec;
+	}
+
 	void Semantic::ValidateFunctionReturnStatement(const AST::FunctionStatement* functionStmt)
 	{
-		bool functionReturns = (functionStmt->GetReturnType()->GetType() != TokenType::KeywordDataTypeVoid);
+		bool functionReturns = (functionStmt->GetReturnTypeSpecifier().Type != AST::DataType::Void);
 		bool foundReturn = false;
 	
 		std::function<void(const AST::BlockStatement* block)> validateReturn = [&](const AST::BlockStatement* block) -> void
 			{
 				for (const auto& stmt : block->GetStatementList())
 				{
+					// Empty Statements ';' are kept as Null
+					if (!stmt)
+						continue;
+
 					if (stmt->GetType() == AST::StatementType::ReturnStatement)
 					{
 						if (!functionReturns)
@@ -188,7 +298,64 @@ namespace Eye
 
 	void Semantic::ValidateReturnStatement(const AST::ReturnStatement* returnStmt)
 	{
-		ValidateExpression(returnStmt->GetExpression());
+		if (returnStmt->GetExpression())
+			ValidateExpression(returnStmt->GetExpression());
+	}
+
+	void Semantic::ValidateImportStatement(const AST::ImportStatement* importStmt)
+	{
+		const std::string& path = importStmt->GetPath()->GetValue<AST::LiteralStringType>();
+		if (m_DeclarationEnvironment->GetParent())
+			throw Error::Exceptions::ImportException("Import of '" + path + "' outside of the Global Scope", Error::ErrorType::SemanticBadImport, importStmt->GetSource());
+
+		auto it = m_Imports->find(path);
+		if (it == m_Imports->end() || !it->second)
+			throw Error::Exceptions::ImportException("Unresolved Import '" + path + "'", Error::ErrorType::SemanticBadImport, importStmt->GetSource());
+
+		// Importing the same Module twice is harmless
+		if (!m_ImportedInterfaces.insert(it->second.get()).second)
+			return;
+
+		for (const auto& function : it->second->Functions)
+		{
+			if (m_DeclarationEnvironment->Has(function.Name))
+				throw Error::Exceptions::ReDeclarationException("ReDeclaration of '" + function.Name + "' imported from '" + path + "'", Error::ErrorType::SemanticReDeclaration, importStmt->GetSource());
+
+			m_DeclarationEnvironment->Define(function.Name, DeclarationType::Function);
+			m_FunctionDeclarationEnvironment->Define(function.Name, function.Declaration);
+		}
+	}
+
+	void Semantic::ValidateStructStatement(const AST::StructStatement* structStmt)
+	{
+		const std::string& name = structStmt->GetIdentifier()->GetValue();
+		if (m_DeclarationEnvironment->GetParent())
+			throw Error::Exceptions::BadDataTypeException("Struct '" + name + "' Declared outside of the Global Scope", Error::ErrorType::SemanticBadDataType, structStmt->GetSource());
+
+		if (m_DeclarationEnvironment->Has(name))
+			throw Error::Exceptions::ReDeclarationException("ReDeclaration of '" + name + "'", Error::ErrorType::SemanticReDeclaration, structStmt->GetIdentifier()->GetSource());
+
+		std::unordered_set<std::string> fieldNames;
+		for (const auto& field : structStmt->GetFields())
+		{
+			if (field->GetTypeSpecifier().Type == AST::DataType::Void)
+				throw Error::Exceptions::BadDataTypeException("Field '" + field->GetIdentifier()->GetValue() + "' Declared as void", Error::ErrorType::SemanticBadDataType, field->GetIdentifier()->GetSource());
+
+			// A Struct can only hold Structs declared before it, which also rules out Recursive Structs
+			ValidateStructTypeSpecifier(field->GetTypeSpecifier(), field->GetIdentifier()->GetSource());
+
+			if (!fieldNames.insert(field->GetIdentifier()->GetValue()).second)
+				throw Error::Exceptions::ReDeclarationException("ReDeclaration of Field '" + field->GetIdentifier()->GetValue() + "' in Struct '" + name + "'", Error::ErrorType::SemanticReDeclaration, field->GetIdentifier()->GetSource());
+		}
+
+		m_DeclarationEnvironment->Define(name, DeclarationType::Struct);
+	}
+
+	void Semantic::ValidateNamespaceStatement(const AST::NamespaceStatement* namespaceStmt)
+	{
+		// Opens no Scope, Members are Globals under their qualified Names (see NamespaceResolver)
+		for (const auto& stmt : namespaceStmt->GetStatementList())
+			ValidateStatement(stmt.get());
 	}
 
 	void Semantic::ValidateExpression(const AST::Expression* expr)
@@ -204,6 +371,18 @@ namespace Eye
 		case AST::ExpressionType::AssignmentExpression:
 			ValidateAssignmentExpression(static_cast<const AST::AssignmentExpression*>(expr));
 			break;
+		case AST::ExpressionType::BinaryExpression:
+			ValidateBinaryExpression(static_cast<const AST::BinaryExpression*>(expr));
+			break;
+		case AST::ExpressionType::UnaryExpression:
+			ValidateUnaryExpression(static_cast<const AST::UnaryExpression*>(expr));
+			break;
+		case AST::ExpressionType::PostfixExpression:
+			ValidatePostfixExpression(static_cast<const AST::PostfixExpression*>(expr));
+			break;
+		case AST::ExpressionType::MemberExpression:
+			ValidateMemberExpression(static_cast<const AST::MemberExpression*>(expr));
+			break;
 		case AST::ExpressionType::CallExpression:
 			ValidateCallExpression(static_cast<const AST::CallExpression*>(expr));
 			break;
@@ -221,20 +400,45 @@ namespace Eye
 	{
 		if (!m_DeclarationEnvironment->Has(identifierExpr->GetValue()))
 			throw Error::Exceptions::NotDeclaredException("'" + identifierExpr->GetValue() + "' Was Not Declared in this Scope", Error::ErrorType::SemanticNotDeclared, identifierExpr->GetSource());
+
+		if (m_DeclarationEnvironment->Get(identifierExpr->GetValue()) == DeclarationType::Struct)
+			throw Error::Exceptions::BadDataTypeException("Struct '" + identifierExpr->GetValue() + "' Used as a Value", Error::ErrorType::SemanticBadDataType, identifierExpr->GetSource());
 	}
 
 	void Semantic::ValidateAssignmentExpression(const AST::AssignmentExpression* assignExpr)
 	{
 		ValidateExpression(assignExpr->GetLHSExpression());
+		ValidateWriteable(assignExpr->GetLHSExpression());
+		ValidateExpression(assignExpr->GetExpression());
+	}
 
-		if (assignExpr->GetLHSExpression()->GetType() == AST::ExpressionType::IdentifierExpression)
-		{
-			const auto& astIdentifierExpr = static_cast<const AST::IdentifierExpression*>(assignExpr->GetLHSExpression());
-			if (m_VariableTypeQualifierEnvironment->Get(astIdentifierExpr->GetValue()) == VariableTypeQualifier::Const)
-				throw Error::Exceptions::WriteReadOnlyException("Assignment of Read-Only Variable: '" + astIdentifierExpr->GetValue() + "'", Error::ErrorType::SemanticWriteReadOnly, astIdentifierExpr->GetSource());
-		}
+	void Semantic::ValidateBinaryExpression(const AST::BinaryExpression* binaryExpr)
+	{
+		// Left-Deep Chains are validated in a Loop, only Right Operands recurse
+		std::vector<const AST::BinaryExpression*> spine = binaryExpr->GetLeftSpine();
+		ValidateExpression(spine.back()->GetLeft());
+		for (auto it = spine.rbegin(); it != spine.rend(); it++)
+			ValidateExpression((*it)->GetRight());
+	}
 
-		ValidateExpression(assignExpr->GetExpression());
+	void Semantic::ValidateUnaryExpression(const AST::UnaryExpression* unaryExpr)
+	{
+		ValidateExpression(unaryExpr->GetExpression());
+		if (unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticIncrement || unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticDecrement)
+			ValidateWriteable(unaryExpr->GetExpression());
+	}
+
+	void Semantic::ValidatePostfixExpression(const AST::PostfixExpression* postfixExpr)
+	{
+		ValidateExpression(postfixExpr->GetExpression());
+		ValidateWriteable(postfixExpr->GetExpression());
+	}
+
+	void Semantic::ValidateMemberExpression(const AST::MemberExpression* memberExpr)
+	{
+		ValidateExpression(memberExpr->GetObject());
+		if (memberExpr->IsComputed())
+			ValidateExpression(memberExpr->GetProperty());
 	}
 
 	void Semantic::ValidateCallExpression(const AST::CallExpression* callExpr)
@@ -259,6 +463,32 @@ namespace Eye
 			ValidateExpression(arg.get());
 	}
 
+	void Semantic::ValidateWriteable(const AST::Expression* expr)
+	{
+		// Fields are as Writeable as the Variable holding them
+		while (expr->GetType() == AST::ExpressionType::MemberExpression)
+			expr = static_cast<const AST::MemberExpression*>(expr)->GetObject();
+
+		if (expr->GetType() == AST::ExpressionType::IdentifierExpression)
+		{
+			const auto& astIdentifierExpr = static_cast<const AST::IdentifierExpression*>(expr);
+			if (m_DeclarationEnvironment->Get(astIdentifierExpr->GetValue()) == DeclarationType::Variable && m_VariableTypeQualifierEnvironment->Get(astIdentifierExpr->GetValue()) == VariableTypeQualifier::Const)
+				throw Error::Exceptions::WriteReadOnlyException("Assignment of Read-Only Variable: '" + astIdentifierExpr->GetValue() + "'", Error::ErrorType::SemanticWriteReadOnly, astIdentifierExpr->GetSource());
+		}
+	}
+
+	void Semantic::ValidateStructTypeSpecifier(const AST::TypeSpecifier& typeSpecifier, const EyeSource& source)
+	{
+		if (!typeSpecifier.IsStruct())
+			return;
+
+		if (!m_DeclarationEnvironment->Has(typeSpecifier.StructName))
+			throw Error::Exceptions::NotDeclaredException("Struct '" + typeSpecifier.StructName + "' Was Not Declared in this Scope", Error::ErrorType::SemanticNotDeclared, source);
+
+		if (m_DeclarationEnvironment->Get(typeSpecifier.StructName) != DeclarationType::Struct)
+			throw Error::Exceptions::BadDataTypeException("'" + typeSpecifier.StructName + "' Does Not Name a Struct", Error::ErrorType::SemanticBadDataType, source);
+	}
+
 	void Semantic::BeginBlockScope()
 	{
 		m_DeclarationEnvironment = std::make_shared<MapEnvironment<DeclarationType>>(m_DeclarationEnvironment);
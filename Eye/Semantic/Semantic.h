@@ -2,6 +2,7 @@
 
 #include "Eye/Semantic/MapEnvironment.h"
 #include "Eye/Semantic/Types.h"
+#include "Eye/ModuleLoader/ModuleInterface.h"
 #include "Eye/Error/Error.h"
 
 #include "Eye/AST/Program.h"
@@ -9,42 +10,65 @@
 #include "Eye/AST/Statements/ExpressionStatement.h"
 #include "Eye/AST/Statements/BlockStatement.h"
 #include "Eye/AST/Statements/VariableStatement.h"
+#include "Eye/AST/Statements/ControlStatement.h"
+#include "Eye/AST/Statements/IterationStatement.h"
 #include "Eye/AST/Statements/FunctionStatement.h"
 #include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/ImportStatement.h"
+#include "Eye/AST/Statements/StructStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
 
 #include "Eye/AST/Expressions/Expression.h"
 #include "Eye/AST/Expressions/LiteralExpression.h"
 #include "Eye/AST/Expressions/IdentifierExpression.h"
 #include "Eye/AST/Expressions/AssignmentExpression.h"
+#include "Eye/AST/Expressions/BinaryExpression.h"
+#include "Eye/AST/Expressions/UnaryExpression.h"
+#include "Eye/AST/Expressions/PostfixExpression.h"
+#include "Eye/AST/Expressions/MemberExpression.h"
 #include "Eye/AST/Expressions/CallExpression.h"
 
 #include <expected>
 #include <string>
+#include <unordered_set>
 
 namespace Eye
 {
 	class Semantic
 	{
 	public:
-		std::expected<bool, Error::Error> Validate(const AST::Program* ast);
+		// imports resolves the Program's ImportStatements, see ModuleLoader
+		std::expected<bool, Error::Error> Validate(const AST::Program* ast, const ModuleImports& imports = {});
+		static FunctionDeclaration GetFunctionDeclaration(const AST::FunctionStatement* functionStmt);
 
 	private:
 		void ValidateStatement(const AST::Statement* stmt);
 		void ValidateExpressionStatement(const AST::ExpressionStatement* exprStmt);
 		void ValidateBlockStatement(const AST::BlockStatement* blockStmt, bool createScope = true);
 		void ValidateVariableStatement(const AST::VariableStatement* varStmt);
+		void ValidateControlStatement(const AST::ControlStatement* ctrlStmt);
+		void ValidateIterationStatement(const AST::IterationStatement* iterStmt);
 		void ValidateFunctionStatement(const AST::FunctionStatement* functionStmt);
 		void ValidateFunctionReturnStatement(const AST::FunctionStatement* functionStmt);
 		void ValidateFunctionParameters(const AST::FunctionStatement* functionStmt, const FunctionDeclaration& functionDec);
 		void ValidateReturnStatement(const AST::ReturnStatement* returnStmt);
+		void ValidateImportStatement(const AST::ImportStatement* importStmt);
+		void ValidateStructStatement(const AST::StructStatement* structStmt);
+		void ValidateNamespaceStatement(const AST::NamespaceStatement* namespaceStmt);
 
 		void ValidateExpression(const AST::Expression* expr);
 		void ValidateLiteralExpression(const AST::LiteralExpression* literalExpr);
 		void ValidateIdentifierExpression(const AST::IdentifierExpression* identifierExpr);
 		void ValidateAssignmentExpression(const AST::AssignmentExpression* assignExpr);
+		void ValidateBinaryExpression(const AST::BinaryExpression* binaryExpr);
+		void ValidateUnaryExpression(const AST::UnaryExpression* unaryExpr);
+		void ValidatePostfixExpression(const AST::PostfixExpression* postfixExpr);
+		void ValidateMemberExpression(const AST::MemberExpression* memberExpr);
 		void ValidateCallExpression(const AST::CallExpression* callExpr);
 
 	private:
+		void ValidateWriteable(const AST::Expression* expr);
+		void ValidateStructTypeSpecifier(const AST::TypeSpecifier& typeSpecifier, const EyeSource& source);
 		void BeginBlockScope();
 		void EndBlockScope();
 
@@ -52,5 +76,7 @@ namespace Eye
 		std::shared_ptr<MapEnvironment<DeclarationType>> m_DeclarationEnvironment;
 		std::shared_ptr<MapEnvironment<FunctionDeclaration>> m_FunctionDeclarationEnvironment;
 		std::shared_ptr<MapEnvironment<VariableTypeQualifier>> m_VariableTypeQualifierEnvironment;
+		const ModuleImports* m_Imports = nullptr;
+		std::unordered_set<const ModuleInterface*> m_ImportedInterfaces;
 	};
 }
@@ -0,0 +1,46 @@
+#include "Eye/Semantic/SymbolIndex.h"
+
+namespace Eye
+{
+	SymbolIndex::SymbolIndex()
+	{
+		m_Namespaces.push_back({ "", InvalidId, {}, {} });
+	}
+
+	uint32_t SymbolIndex::AddNamespace(uint32_t parent, const std::string& name)
+	{
+		auto [it, inserted] = m_Namespaces[parent].Namespaces.try_emplace(name, (uint32_t)m_Namespaces.size());
+		if (inserted)
+			m_Namespaces.push_back({ Qualify(parent, name), parent, {}, {} });
+		return it->second;
+	}
+
+	uint32_t SymbolIndex::AddSymbol(uint32_t ns, const std::string& name, SymbolKind kind)
+	{
+		auto [it, inserted] = m_Namespaces[ns].Symbols.try_emplace(name, (uint32_t)m_Symbols.size());
+		if (inserted)
+			m_Symbols.push_back({ Qualify(ns, name), kind, ns });
+		return it->second;
+	}
+
+	uint32_t SymbolIndex::FindNamespace(uint32_t parent, std::string_view name) const
+	{
+		return Find(m_Namespaces[parent].Namespaces, name);
+	}
+
+	uint32_t SymbolIndex::FindSymbol(uint32_t ns, std::string_view name) const
+	{
+		return Find(m_Namespaces[ns].Symbols, name);
+	}
+
+	std::string SymbolIndex::Qualify(uint32_t ns, const std::string& name) const
+	{
+		return (ns == RootNamespace ? name : m_Namespaces[ns].Name + "::" + name);
+	}
+
+	uint32_t SymbolIndex::Find(const NameMap& map, std::string_view name)
+	{
+		auto it = map.find(name);
+		return (it != map.end() ? it->second : InvalidId);
+	}
+}
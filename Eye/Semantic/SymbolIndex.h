@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Eye
+{
+	enum class SymbolKind
+	{
+		Variable,
+		Function,
+	};
+
+	struct Symbol
+	{
+		// Qualified, i.e 'Math::Trig::sin', Globals outside any Namespace keep their Name
+		std::string Name;
+		SymbolKind Kind;
+		uint32_t Namespace;
+	};
+
+	/*
+		SymbolIndex
+			Globals of a Program by Namespace, every Namespace maps its Members' Names to Ids with one Hash Table.
+			Resolving 'A::B::name' costs one Lookup per Segment, however many Symbols the Program & its Imports declare.
+			Namespaces & Symbols get dense Ids in Declaration Order, the Global Namespace is RootNamespace.
+	*/
+	class SymbolIndex
+	{
+	public:
+		static constexpr uint32_t RootNamespace = 0;
+		static constexpr uint32_t InvalidId = UINT32_MAX;
+
+		SymbolIndex();
+
+		// Returns the existing Namespace if parent already has one named name
+		uint32_t AddNamespace(uint32_t parent, const std::string& name);
+		// Returns the existing Symbol if ns already has one named name
+		uint32_t AddSymbol(uint32_t ns, const std::string& name, SymbolKind kind);
+
+		uint32_t FindNamespace(uint32_t parent, std::string_view name) const;
+		uint32_t FindSymbol(uint32_t ns, std::string_view name) const;
+
+		inline const Symbol& GetSymbol(uint32_t id) const { return m_Symbols[id]; }
+		inline const std::string& GetNamespaceName(uint32_t ns) const { return m_Namespaces[ns].Name; }
+		inline uint32_t GetParentNamespace(uint32_t ns) const { return m_Namespaces[ns].Parent; }
+		inline size_t GetSymbolCount() const { return m_Symbols.size(); }
+		inline size_t GetNamespaceCount() const { return m_Namespaces.size(); }
+
+		std::string Qualify(uint32_t ns, const std::string& name) const;
+
+	private:
+		// Heterogeneous Lookup, Segments of a qualified Name are found without copying them
+		struct NameHash
+		{
+			using is_transparent = void;
+			inline size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+		};
+
+		using NameMap = std::unordered_map<std::string, uint32_t, NameHash, std::equal_to<>>;
+
+		struct Namespace
+		{
+			// Qualified, empty for the Root
+			std::string Name;
+			uint32_t Parent;
+			NameMap Namespaces;
+			NameMap Symbols;
+		};
+
+		static uint32_t Find(const NameMap& map, std::string_view name);
+
+	private:
+		std::vector<Namespace> m_Namespaces;
+		std::vector<Symbol> m_Symbols;
+	};
+}
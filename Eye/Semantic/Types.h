@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 namespace Eye
 {
 	enum class VariableTypeQualifier
@@ -11,7 +13,8 @@ namespace Eye
 	enum class DeclarationType
 	{
 		Variable,
-		Function
+		Function,
+		Struct
 	};
 
 	enum FunctionParameterType
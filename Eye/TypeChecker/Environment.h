@@ -35,6 +35,13 @@ namespace Eye
 			return GetResolve(identifier);
 		}
 
+		bool IsDefined(const std::string& identifier) const
+		{
+			if (m_Values.find(identifier) != m_Values.end())
+				return true;
+			return (m_Parent && m_Parent->IsDefined(identifier));
+		}
+
 	private:
 		const T& GetResolve(const std::string& identifier)
 		{
@@ -0,0 +1,35 @@
+#include "Eye/TypeChecker/StructLayout.h"
+
+namespace Eye
+{
+	StructLayout::StructLayout(const std::string& name)
+		: m_Name(name)
+	{
+	}
+
+	void StructLayout::AddField(const std::string& name, Type type, const StructLayout* layout)
+	{
+		m_Fields.push_back({ name, type, layout, GetSize() });
+		if (layout)
+			m_Slots.insert(m_Slots.end(), layout->GetSlots().begin(), layout->GetSlots().end());
+		else
+			m_Slots.push_back(type);
+	}
+
+	const FieldLayout* StructLayout::GetField(const std::string& name) const
+	{
+		// Structs are small & only looked up while checking, a linear Scan beats hashing
+		for (const FieldLayout& field : m_Fields)
+			if (field.Name == name)
+				return &field;
+		return nullptr;
+	}
+
+	std::string StructLayout::GetSignature() const
+	{
+		std::string signature = m_Name + " {";
+		for (const FieldLayout& field : m_Fields)
+			signature += " " + (field.Layout ? field.Layout->GetSignature() : TypeToString(field.FieldType)) + " " + field.Name + "@" + std::to_string(field.Offset) + ";";
+		return signature + " }";
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Eye/TypeChecker/Type.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace Eye
+{
+	class StructLayout;
+
+	// Offset counts Slots from the Start of the enclosing Struct, Layout is set for Struct Fields only
+	struct FieldLayout
+	{
+		std::string Name;
+		Type FieldType;
+		const StructLayout* Layout;
+		uint32_t Offset;
+	};
+
+	/*
+		StructLayout
+			Flat Layout of a Struct resolved at Compile Time, every scalar Field takes one Slot.
+			Struct Fields are stored inline, 'a.b.c' is one Offset into 'a' and Instances carry no Field Names.
+	*/
+	class StructLayout
+	{
+	public:
+		StructLayout(const std::string& name);
+
+		// Fields are laid out in Declaration Order
+		void AddField(const std::string& name, Type type, const StructLayout* layout = nullptr);
+		const FieldLayout* GetField(const std::string& name) const;
+
+		inline const std::string& GetName() const { return m_Name; }
+		inline const std::vector<FieldLayout>& GetFields() const { return m_Fields; }
+		// Type of every Slot, Struct Fields contribute their own Slots
+		inline const std::vector<Type>& GetSlots() const { return m_Slots; }
+		inline uint32_t GetSize() const { return (uint32_t)m_Slots.size(); }
+
+		// Name, Fields & Offsets, equal Signatures mean interchangeable Layouts
+		std::string GetSignature() const;
+
+	private:
+		std::string m_Name;
+		std::vector<FieldLayout> m_Fields;
+		std::vector<Type> m_Slots;
+	};
+}
@@ -19,9 +19,18 @@ namespace Eye
 		case Eye::Type::Boolean:
 			return "Boolean";
 			break;
+		case Eye::Type::Void:
+			return "Void";
+			break;
 		case Eye::Type::Function:
 			return "Function";
 			break;
+		case Eye::Type::Struct:
+			return "Struct";
+			break;
+		case Eye::Type::Array:
+			return "Array";
+			break;
 		default:
 			EYE_LOG_CRITICAL("EYETypeToString Unknown Type!");
 			break;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 #include <vector>
 
 namespace Eye
@@ -13,6 +14,10 @@ namespace Eye
 		Boolean,
 		Void,
 		Function,
+		// Layout given by a StructLayout
+		Struct,
+		// Elements given by an ArrayType
+		Array,
 	};
 
 	std::string TypeToString(Type type);
@@ -21,5 +26,18 @@ namespace Eye
 	{
 		Type Return;
 		std::vector<Type> Parameters;
+		// Parameters past it have a Default & may be left out
+		size_t RequiredParameterCount = 0;
+
+		bool operator==(const FunctionType&) const = default;
+	};
+
+	// Fixed Length & Element Type, Elements are stored contiguously & unboxed
+	struct ArrayType
+	{
+		Type Element = Type::Void;
+		uint32_t Length = 0;
+
+		bool operator==(const ArrayType&) const = default;
 	};
 }
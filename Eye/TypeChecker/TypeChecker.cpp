@@ -3,18 +3,78 @@
 #include "Eye/Error/Exceptions/BadTypeConversionException.h"
 #include "Eye/Error/Exceptions/BadTypeCompareException.h"
 #include "Eye/Error/Exceptions/BadOperandTypeException.h"
+#include "Eye/Error/Exceptions/ImportException.h"
+#include "Eye/Error/Exceptions/BadMemberException.h"
+#include "Eye/Error/Exceptions/ArgumentException.h"
+
+#include <algorithm>
+#include <unordered_set>
 
 namespace Eye
 {
-	std::expected<bool, Error::Error> TypeChecker::TypeCheck(const AST::Program* ast)
+	std::expected<bool, Error::Error> TypeChecker::TypeCheck(const AST::Program* ast, const ModuleImports& imports)
 	{
 		m_TypeEnvironment = std::make_shared<Environment<Type>>();
 		m_FunctionEnvironment = std::make_shared<Environment<FunctionType>>();
+		m_StructEnvironment = std::make_shared<Environment<const StructLayout*>>();
+		m_StructLayouts.clear();
+		m_ArrayEnvironment = std::make_shared<Environment<ArrayType>>();
+		m_CheckedFunctionCount = 0;
+		m_Imports = &imports;
+		m_TypeTable = std::make_shared<TypeTable>(ast->GetExpressionIdCount());
 
 		try
 		{
 			for (const auto& stmt : ast->GetStatementList())
+			{
 				TypeCheckStatement(stmt.get());
+				if (stmt && stmt->GetType() == AST::StatementType::FunctionStatement)
+					m_CheckedFunctionCount++;
+			}
+		}
+		catch (const Error::Exceptions::EyeException& ex)
+		{
+			return std::unexpected(ex.GetError());
+		}
+		catch (...)
+		{
+			EYE_LOG_CRITICAL("EYETypeChecker->TypeCheck Unsupported Exception!");
+		}
+
+		return true;
+	}
+
+	std::expected<bool, Error::Error> TypeChecker::TypeCheck(const AST::Program* ast, const std::vector<size_t>& revisions, const ModuleImports& imports)
+	{
+		if (revisions.size() != ast->GetStatementList().size())
+			EYE_LOG_CRITICAL("EYETypeChecker->TypeCheck Revision Count does not match Statement Count!");
+
+		m_TypeEnvironment = std::make_shared<Environment<Type>>();
+		m_FunctionEnvironment = std::make_shared<Environment<FunctionType>>();
+		m_StructEnvironment = std::make_shared<Environment<const StructLayout*>>();
+		m_StructLayouts.clear();
+		m_ArrayEnvironment = std::make_shared<Environment<ArrayType>>();
+		m_CheckedFunctionCount = 0;
+		m_Imports = &imports;
+		// Functions that are not re-checked keep the Annotations of the Call that checked them
+		if (!m_TypeTable)
+			m_TypeTable = std::make_shared<TypeTable>(ast->GetExpressionIdCount());
+
+		// Drop Functions that are no longer part of the Program
+		std::unordered_set<size_t> liveRevisions(revisions.begin(), revisions.end());
+		std::erase_if(m_FunctionCache, [&liveRevisions](const auto& entry) { return !liveRevisions.contains(entry.first); });
+
+		try
+		{
+			// Non-Function Statements are cheap & define Globals in Order, they are always checked
+			for (size_t i = 0; i < ast->GetStatementList().size(); i++)
+			{
+				const AST::Statement* stmt = ast->GetStatementList()[i].get();
+				if (stmt && stmt->GetType() == AST::StatementType::FunctionStatement)
+					TypeCheckCachedFunctionStatement(static_cast<const AST::FunctionStatement*>(stmt), revisions[i]);
+				else
+					TypeCheckStatement(stmt);
+			}
 		}
 		catch (const Error::Exceptions::EyeException& ex)
 		{
@@ -50,12 +110,24 @@ namespace Eye
 		case AST::StatementType::IterationStatement:
 			TypeCheckIterationStatement(static_cast<const AST::IterationStatement*>(stmt));
 			break;
+		case AST::StatementType::ContinueStatement:
+		case AST::StatementType::BreakStatement:
+			break;
 		case AST::StatementType::FunctionStatement:
 			TypeCheckFunctionStatement(static_cast<const AST::FunctionStatement*>(stmt));
 			break;
 		case AST::StatementType::ReturnStatement:
 			TypeCheckReturnStatement(static_cast<const AST::ReturnStatement*>(stmt));
 			break;
+		case AST::StatementType::ImportStatement:
+			TypeCheckImportStatement(static_cast<const AST::ImportStatement*>(stmt));
+			break;
+		case AST::StatementType::StructStatement:
+			TypeCheckStructStatement(static_cast<const AST::StructStatement*>(stmt));
+			break;
+		case AST::StatementType::NamespaceStatement:
+			TypeCheckNamespaceStatement(static_cast<const AST::NamespaceStatement*>(stmt));
+			break;
 		default:
 			EYE_LOG_CRITICAL("EYETypeChecker Unsupported Statement Type!");
 			break;
@@ -69,24 +141,60 @@ namespace Eye
 
 	void TypeChecker::TypeCheckBlockStatement(const AST::BlockStatement* blockStmt, bool createScope)
 	{
+		// Directly Nested Blocks are walked with an explicit Stack instead of one Call per Level
+		struct Frame
+		{
+			const AST::BlockStatement* Block;
+			size_t Index;
+			bool Scoped;
+		};
+
 		if (createScope)
 			BeginBlockScope();
-		for (const auto& stmt : blockStmt->GetStatementList())
-			TypeCheckStatement(stmt.get());
-		if (createScope)
-			EndBlockScope();
+		std::vector<Frame> frames = { { blockStmt, 0, createScope } };
+		while (!frames.empty())
+		{
+			Frame& frame = frames.back();
+			if (frame.Index == frame.Block->GetStatementList().size())
+			{
+				if (frame.Scoped)
+					EndBlockScope();
+				frames.pop_back();
+				continue;
+			}
+
+			const AST::Statement* stmt = frame.Block->GetStatementList()[frame.Index++].get();
+			if (stmt && stmt->GetType() == AST::StatementType::BlockStatement)
+			{
+				BeginBlockScope();
+				frames.push_back({ static_cast<const AST::BlockStatement*>(stmt), 0, true });
+			}
+			else
+			{
+				TypeCheckStatement(stmt);
+			}
+		}
 	}
 
 	void TypeChecker::TypeCheckVariableStatement(const AST::VariableStatement* varStmt)
 	{
-		Type variableType = LexerToTypeCheckerType(varStmt->GetDataType()->GetType());
+		const StructLayout* variableLayout = (varStmt->GetTypeSpecifier().IsStruct() ? GetStructLayout(varStmt->GetTypeSpecifier().StructName, varStmt->GetSource()) : nullptr);
+		Type variableType = (variableLayout ? Type::Struct : LexerToTypeCheckerType(AST::DataTypeToToken(varStmt->GetTypeSpecifier().Type)));
+		ArrayType arrayType = { variableType, varStmt->GetTypeSpecifier().ArrayLength };
+		if (varStmt->GetTypeSpecifier().IsArray())
+			variableType = Type::Array;
 
 		for (const auto& var : varStmt->GetVariableDeclarationList())
 		{
 			if (var->GetInitializer())
 			{
 				Type initializerType = TypeCheckExpression(var->GetInitializer());
-				if (variableType == Type::String && initializerType != Type::String)
+				// Array Elements start out as Defaults, there are no Array Values
+				if (variableType == Type::Array)
+					throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + TypeToString(initializerType) + " to " + TypeToString(variableType), Error::ErrorType::TypeCheckerBadTypeConversion, var->GetInitializer()->GetSource());
+				else if (variableType == Type::Struct || initializerType == Type::Struct)
+					TypeCheckStructConversion(variableLayout, variableType, initializerType, var->GetInitializer());
+				else if (variableType == Type::String && initializerType != Type::String)
 					throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + TypeToString(initializerType) + " to " + TypeToString(variableType), Error::ErrorType::TypeCheckerBadTypeConversion, var->GetInitializer()->GetSource());
 				else if (variableType == Type::Float && (initializerType != Type::Float && initializerType != Type::Integer))
 					throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + TypeToString(initializerType) + " to " + TypeToString(variableType), Error::ErrorType::TypeCheckerBadTypeConversion, var->GetInitializer()->GetSource());
@@ -96,6 +204,10 @@ namespace Eye
 					throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + TypeToString(initializerType) + " to " + TypeToString(variableType), Error::ErrorType::TypeCheckerBadTypeConversion, var->GetInitializer()->GetSource());
 			}
 			m_TypeEnvironment->Define(var->GetIdentifier()->GetValue(), variableType);
+			if (variableLayout)
+				m_StructEnvironment->Define(var->GetIdentifier()->GetValue(), variableLayout);
+			if (variableType == Type::Array)
+				m_ArrayEnvironment->Define(var->GetIdentifier()->GetValue(), arrayType);
 		}
 	}
 
@@ -168,10 +280,7 @@ namespace Eye
 
 	void TypeChecker::TypeCheckFunctionStatement(const AST::FunctionStatement* functionStmt)
 	{
-		FunctionType funcType;
-		funcType.Return = LexerToTypeCheckerType(functionStmt->GetReturnType()->GetType());
-		for (const auto& param : functionStmt->GetParameters())
-			funcType.Parameters.push_back(LexerToTypeCheckerType(param->GetDataType()->GetType()));
+		FunctionType funcType = GetFunctionType(functionStmt);
 
 		m_FunctionEnvironment->Define(functionStmt->GetIdentifier()->GetValue(), funcType);
 		m_TypeEnvironment->Define(functionStmt->GetIdentifier()->GetValue(), Type::Function);
@@ -179,7 +288,7 @@ namespace Eye
 		BeginBlockScope();
 
 		for (const auto& param : functionStmt->GetParameters())
-			m_TypeEnvironment->Define(param->GetIdentifier()->GetValue(), LexerToTypeCheckerType(param->GetDataType()->GetType()));
+			m_TypeEnvironment->Define(param->GetIdentifier()->GetValue(), LexerToTypeCheckerType(AST::DataTypeToToken(param->GetTypeSpecifier().Type)));
 
 		TypeCheckBlockStatement(functionStmt->GetBody(), false);
 
@@ -187,9 +296,10 @@ namespace Eye
 		{
 			for (const auto& stmt : functionStmt->GetBody()->GetStatementList())
 			{
-				if (stmt->GetType() == AST::StatementType::ReturnStatement)
+				if (stmt && stmt->GetType() == AST::StatementType::ReturnStatement)
 				{
-					Type returnType = TypeCheckExpression(static_cast<const AST::ReturnStatement*>(stmt.get())->GetExpression());
+					const AST::Expression* returnExpr = static_cast<const AST::ReturnStatement*>(stmt.get())->GetExpression();
+					Type returnType = (returnExpr ? TypeCheckExpression(returnExpr) : Type::Void);
 					if (funcType.Return == Type::Float && returnType == Type::Integer)
 						continue;
 					else if (funcType.Return != returnType)
@@ -205,28 +315,277 @@ namespace Eye
 	{
 	}
 
+	void TypeChecker::TypeCheckImportStatement(const AST::ImportStatement* importStmt)
+	{
+		const std::string& path = importStmt->GetPath()->GetValue<AST::LiteralStringType>();
+		auto it = m_Imports->find(path);
+		if (it == m_Imports->end() || !it->second)
+			throw Error::Exceptions::ImportException("Unresolved Import '" + path + "'", Error::ErrorType::TypeCheckerBadImport, importStmt->GetSource());
+
+		for (const auto& function : it->second->Functions)
+		{
+			m_FunctionEnvironment->Define(function.Name, function.Type);
+			m_TypeEnvironment->Define(function.Name, Type::Function);
+		}
+	}
+
+	void TypeChecker::TypeCheckStructStatement(const AST::StructStatement* structStmt)
+	{
+		const std::string& name = structStmt->GetIdentifier()->GetValue();
+		StructLayout layout(name);
+		for (const auto& field : structStmt->GetFields())
+		{
+			if (field->GetTypeSpecifier().IsStruct())
+				layout.AddField(field->GetIdentifier()->GetValue(), Type::Struct, GetStructLayout(field->GetTypeSpecifier().StructName, field->GetIdentifier()->GetSource()));
+			else
+				layout.AddField(field->GetIdentifier()->GetValue(), LexerToTypeCheckerType(AST::DataTypeToToken(field->GetTypeSpecifier().Type)));
+		}
+
+		m_StructLayouts[name] = m_TypeTable->AddStructLayout(std::move(layout));
+	}
+
+	void TypeChecker::TypeCheckNamespaceStatement(const AST::NamespaceStatement* namespaceStmt)
+	{
+		// Members are Globals under their qualified Names, they are checked like Top-Level Statements
+		for (const auto& stmt : namespaceStmt->GetStatementList())
+			TypeCheckStatement(stmt.get());
+	}
+
+	FunctionType TypeChecker::GetFunctionType(const AST::FunctionStatement* functionStmt)
+	{
+		FunctionType funcType;
+		funcType.Return = LexerToTypeCheckerType(AST::DataTypeToToken(functionStmt->GetReturnTypeSpecifier().Type));
+		for (const auto& param : functionStmt->GetParameters())
+		{
+			funcType.Parameters.push_back(LexerToTypeCheckerType(AST::DataTypeToToken(param->GetTypeSpecifier().Type)));
+			if (!param->GetInitializer())
+				funcType.RequiredParameterCount = funcType.Parameters.size();
+		}
+		return funcType;
+	}
+
+	void TypeChecker::TypeCheckCachedFunctionStatement(const AST::FunctionStatement* functionStmt, size_t revision)
+	{
+		FunctionType funcType = GetFunctionType(functionStmt);
+
+		m_FunctionEnvironment->Define(functionStmt->GetIdentifier()->GetValue(), funcType);
+		m_TypeEnvironment->Define(functionStmt->GetIdentifier()->GetValue(), Type::Function);
+
+		FunctionCacheEntry& entry = m_FunctionCache[revision];
+		if (!entry.DependenciesCollected)
+		{
+			CollectStatementDependencies(functionStmt->GetBody(), entry.Dependencies);
+			for (const auto& param : functionStmt->GetParameters())
+				CollectExpressionDependencies(param->GetInitializer(), entry.Dependencies);
+			std::sort(entry.Dependencies.begin(), entry.Dependencies.end());
+			entry.Dependencies.erase(std::unique(entry.Dependencies.begin(), entry.Dependencies.end()), entry.Dependencies.end());
+			entry.DependenciesCollected = true;
+		}
+
+		// Names shadowed by Locals resolve as Globals here too, that only costs an extra re-check when the Global changes
+		std::vector<FunctionDependency> resolvedDependencies;
+		resolvedDependencies.reserve(entry.Dependencies.size());
+		for (const auto& dependency : entry.Dependencies)
+		{
+			FunctionDependency resolved = { m_TypeEnvironment->IsDefined(dependency), Type::Void, {}, {}, {} };
+			if (resolved.Defined)
+			{
+				resolved.VariableType = m_TypeEnvironment->Get(dependency);
+				if (resolved.VariableType == Type::Function)
+					resolved.Function = m_FunctionEnvironment->Get(dependency);
+				else if (resolved.VariableType == Type::Struct)
+					resolved.Struct = m_StructEnvironment->Get(dependency)->GetSignature();
+				else if (resolved.VariableType == Type::Array)
+					resolved.Array = m_ArrayEnvironment->Get(dependency);
+			}
+			else if (auto it = m_StructLayouts.find(dependency); it != m_StructLayouts.end())
+			{
+				resolved.Struct = it->second->GetSignature();
+			}
+			resolvedDependencies.push_back(std::move(resolved));
+		}
+
+		if (entry.Checked && entry.ResolvedDependencies == resolvedDependencies)
+			return;
+
+		entry.Checked = false;
+		m_CheckedFunctionCount++;
+		TypeCheckFunctionStatement(functionStmt);
+
+		entry.ResolvedDependencies = std::move(resolvedDependencies);
+		entry.Checked = true;
+	}
+
+	void TypeChecker::CollectStatementDependencies(const AST::Statement* stmt, std::vector<std::string>& dependencies)
+	{
+		if (!stmt)
+			return;
+
+		switch (stmt->GetType())
+		{
+		case AST::StatementType::ExpressionStatement:
+			CollectExpressionDependencies(static_cast<const AST::ExpressionStatement*>(stmt)->GetExpression(), dependencies);
+			break;
+		case AST::StatementType::BlockStatement:
+		{
+			std::vector<const AST::Statement*> pending = { stmt };
+			while (!pending.empty())
+			{
+				const AST::Statement* current = pending.back();
+				pending.pop_back();
+				if (current->GetType() != AST::StatementType::BlockStatement)
+				{
+					CollectStatementDependencies(current, dependencies);
+					continue;
+				}
+
+				const auto& statementList = static_cast<const AST::BlockStatement*>(current)->GetStatementList();
+				for (auto it = statementList.rbegin(); it != statementList.rend(); it++)
+					if (*it)
+						pending.push_back(it->get());
+			}
+			break;
+		}
+		case AST::StatementType::VariableStatement:
+		{
+			const AST::VariableStatement* varStmt = static_cast<const AST::VariableStatement*>(stmt);
+			// Locals of a Struct Type depend on its Layout
+			if (varStmt->GetTypeSpecifier().IsStruct())
+				dependencies.push_back(varStmt->GetTypeSpecifier().StructName);
+			for (const auto& var : varStmt->GetVariableDeclarationList())
+				CollectExpressionDependencies(var->GetInitializer(), dependencies);
+			break;
+		}
+		case AST::StatementType::ControlStatement:
+		{
+			const AST::ControlStatement* ctrlStmt = static_cast<const AST::ControlStatement*>(stmt);
+			CollectExpressionDependencies(ctrlStmt->GetCondition(), dependencies);
+			CollectStatementDependencies(ctrlStmt->GetConsequent(), dependencies);
+			CollectStatementDependencies(ctrlStmt->GetAlternate(), dependencies);
+			break;
+		}
+		case AST::StatementType::IterationStatement:
+		{
+			const AST::IterationStatement* iterStmt = static_cast<const AST::IterationStatement*>(stmt);
+			if (iterStmt->GetIterationType() == AST::IterationStatementType::WhileStatement)
+			{
+				CollectExpressionDependencies(static_cast<const AST::WhileStatement*>(iterStmt)->GetCondition(), dependencies);
+				CollectStatementDependencies(static_cast<const AST::WhileStatement*>(iterStmt)->GetBody(), dependencies);
+			}
+			else if (iterStmt->GetIterationType() == AST::IterationStatementType::DoWhileStatement)
+			{
+				CollectExpressionDependencies(static_cast<const AST::DoWhileStatement*>(iterStmt)->GetCondition(), dependencies);
+				CollectStatementDependencies(static_cast<const AST::DoWhileStatement*>(iterStmt)->GetBody(), dependencies);
+			}
+			else if (iterStmt->GetIterationType() == AST::IterationStatementType::ForStatement)
+			{
+				const AST::ForStatement* forStmt = static_cast<const AST::ForStatement*>(iterStmt);
+				if (forStmt->GetInitializerType() == AST::ForInitializerType::VariableStatement)
+					CollectStatementDependencies(forStmt->GetInitializer<AST::VariableStatement>(), dependencies);
+				else if (forStmt->GetInitializerType() == AST::ForInitializerType::Expression)
+					CollectExpressionDependencies(forStmt->GetInitializer<AST::Expression>(), dependencies);
+				CollectExpressionDependencies(forStmt->GetCondition(), dependencies);
+				CollectExpressionDependencies(forStmt->GetUpdate(), dependencies);
+				CollectStatementDependencies(forStmt->GetBody(), dependencies);
+			}
+			break;
+		}
+		case AST::StatementType::FunctionStatement:
+		{
+			const AST::FunctionStatement* functionStmt = static_cast<const AST::FunctionStatement*>(stmt);
+			for (const auto& param : functionStmt->GetParameters())
+				CollectExpressionDependencies(param->GetInitializer(), dependencies);
+			CollectStatementDependencies(functionStmt->GetBody(), dependencies);
+			break;
+		}
+		case AST::StatementType::ReturnStatement:
+			CollectExpressionDependencies(static_cast<const AST::ReturnStatement*>(stmt)->GetExpression(), dependencies);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void TypeChecker::CollectExpressionDependencies(const AST::Expression* expr, std::vector<std::string>& dependencies)
+	{
+		if (!expr)
+			return;
+
+		switch (expr->GetType())
+		{
+		case AST::ExpressionType::IdentifierExpression:
+			dependencies.push_back(static_cast<const AST::IdentifierExpression*>(expr)->GetValue());
+			break;
+		case AST::ExpressionType::AssignmentExpression:
+			CollectExpressionDependencies(static_cast<const AST::AssignmentExpression*>(expr)->GetLHSExpression(), dependencies);
+			CollectExpressionDependencies(static_cast<const AST::AssignmentExpression*>(expr)->GetExpression(), dependencies);
+			break;
+		case AST::ExpressionType::BinaryExpression:
+		{
+			std::vector<const AST::BinaryExpression*> spine = static_cast<const AST::BinaryExpression*>(expr)->GetLeftSpine();
+			CollectExpressionDependencies(spine.back()->GetLeft(), dependencies);
+			for (auto it = spine.rbegin(); it != spine.rend(); it++)
+				CollectExpressionDependencies((*it)->GetRight(), dependencies);
+			break;
+		}
+		case AST::ExpressionType::CallExpression:
+			CollectExpressionDependencies(static_cast<const AST::CallExpression*>(expr)->GetCallee(), dependencies);
+			for (const auto& argument : static_cast<const AST::CallExpression*>(expr)->GetArguments())
+				CollectExpressionDependencies(argument.get(), dependencies);
+			break;
+		case AST::ExpressionType::UnaryExpression:
+			CollectExpressionDependencies(static_cast<const AST::UnaryExpression*>(expr)->GetExpression(), dependencies);
+			break;
+		case AST::ExpressionType::PostfixExpression:
+			CollectExpressionDependencies(static_cast<const AST::PostfixExpression*>(expr)->GetExpression(), dependencies);
+			break;
+		case AST::ExpressionType::MemberExpression:
+			CollectExpressionDependencies(static_cast<const AST::MemberExpression*>(expr)->GetObject(), dependencies);
+			// Field Names are not Globals
+			if (static_cast<const AST::MemberExpression*>(expr)->IsComputed())
+				CollectExpressionDependencies(static_cast<const AST::MemberExpression*>(expr)->GetProperty(), dependencies);
+			break;
+		default:
+			break;
+		}
+	}
+
 	Type TypeChecker::TypeCheckExpression(const AST::Expression* expr)
 	{
+		Type type;
 		switch (expr->GetType())
 		{
 		case AST::ExpressionType::LiteralExpression:
-			return TypeCheckLiteralExpression(static_cast<const AST::LiteralExpression*>(expr));
+			type = TypeCheckLiteralExpression(static_cast<const AST::LiteralExpression*>(expr));
+			break;
 		case AST::ExpressionType::IdentifierExpression:
-			return TypeCheckIdentifierExpression(static_cast<const AST::IdentifierExpression*>(expr));
+			type = TypeCheckIdentifierExpression(static_cast<const AST::IdentifierExpression*>(expr));
+			break;
 		case AST::ExpressionType::AssignmentExpression:
-			return TypeCheckAssignmentExpression(static_cast<const AST::AssignmentExpression*>(expr));
+			type = TypeCheckAssignmentExpression(static_cast<const AST::AssignmentExpression*>(expr));
+			break;
 		case AST::ExpressionType::BinaryExpression:
-			return TypeCheckBinaryExpression(static_cast<const AST::BinaryExpression*>(expr));
+			type = TypeCheckBinaryExpression(static_cast<const AST::BinaryExpression*>(expr));
+			break;
 		case AST::ExpressionType::CallExpression:
-			return TypeCheckCallExpression(static_cast<const AST::CallExpression*>(expr));
+			type = TypeCheckCallExpression(static_cast<const AST::CallExpression*>(expr));
+			break;
 		case AST::ExpressionType::UnaryExpression:
-			return TypeCheckUnaryExpression(static_cast<const AST::UnaryExpression*>(expr));
+			type = TypeCheckUnaryExpression(static_cast<const AST::UnaryExpression*>(expr));
+			break;
 		case AST::ExpressionType::PostfixExpression:
-			return TypeCheckPostfixExpression(static_cast<const AST::PostfixExpression*>(expr));
+			type = TypeCheckPostfixExpression(static_cast<const AST::PostfixExpression*>(expr));
+			break;
+		case AST::ExpressionType::MemberExpression:
+			type = TypeCheckMemberExpression(static_cast<const AST::MemberExpression*>(expr));
+			break;
 		default:
 			EYE_LOG_CRITICAL("EYETypeChecker TypeCheckExpression Unsupported Expression Type!");
 			break;
 		}
+
+		m_TypeTable->SetType(expr, type);
+		return type;
 	}
 
 	Type TypeChecker::TypeCheckLiteralExpression(const AST::LiteralExpression* literalExpr)
@@ -241,6 +600,8 @@ namespace Eye
 			return Type::String;
 		case AST::LiteralType::Boolean:
 			return Type::Boolean;
+		case AST::LiteralType::Null:
+			throw Error::Exceptions::BadTypeConversionException("Null has no Type to Convert from", Error::ErrorType::TypeCheckerBadTypeConversion, literalExpr->GetSource());
 		default:
 			EYE_LOG_CRITICAL("EYETypeChecker TypeCheckLiteralExpression Unsupported Type!");
 			break;
@@ -257,7 +618,20 @@ namespace Eye
 		Type lhsType = TypeCheckExpression(assignExpr->GetLHSExpression());
 		Type rightType = TypeCheckExpression(assignExpr->GetExpression());
 
-		switch (assignExpr->GetOperator()->GetType())
+		// Arrays are only ever accessed by Element
+		if (lhsType == Type::Array || rightType == Type::Array)
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(Type::Array) + " for Assignment Operator '" + std::string(TokenTypeToString(assignExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
+
+		// Structs are only ever copied as a Whole
+		if (lhsType == Type::Struct || rightType == Type::Struct)
+		{
+			if (assignExpr->GetOperatorType() != TokenType::OperatorAssignment)
+				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(Type::Struct) + " for Assignment Operator '" + std::string(TokenTypeToString(assignExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
+			TypeCheckStructConversion(GetStructLayout(assignExpr->GetLHSExpression()), lhsType, rightType, assignExpr->GetExpression());
+			return lhsType;
+		}
+
+		switch (assignExpr->GetOperatorType())
 		{
 		case TokenType::OperatorAssignment:
 			return TypeCheckAssignmentExpressionAssignment(lhsType, rightType, assignExpr);
@@ -277,7 +651,7 @@ namespace Eye
 			break;
 		}
 
-		EYE_LOG_CRITICAL("EYETypeChecker TypeCheckAssignmentExpression Unsupported Operator {}", assignExpr->GetOperator()->GetValueString());
+		EYE_LOG_CRITICAL("EYETypeChecker TypeCheckAssignmentExpression Unsupported Operator {}", TokenTypeToString(assignExpr->GetOperatorType()));
 	}
 
 	Type TypeChecker::TypeCheckAssignmentExpressionAssignment(Type lhsType, Type rightType, const AST::AssignmentExpression* assignExpr)
@@ -296,11 +670,11 @@ namespace Eye
 	Type TypeChecker::TypeCheckAssignmentExpressionAssignmentArithmetic(Type lhsType, Type rightType, const AST::AssignmentExpression* assignExpr)
 	{
 		if (lhsType == Type::Boolean || rightType == Type::Boolean)
-			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (lhsType == Type::Boolean ? TypeToString(lhsType) : TypeToString(rightType)) + " for Assignment Operator '" + assignExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (lhsType == Type::Boolean ? TypeToString(lhsType) : TypeToString(rightType)) + " for Assignment Operator '" + std::string(TokenTypeToString(assignExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
 
-		if (assignExpr->GetOperator()->GetType() != TokenType::OperatorAssignmentPlus)
+		if (assignExpr->GetOperatorType() != TokenType::OperatorAssignmentPlus)
 			if (lhsType == Type::String || rightType == Type::String)
-				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (lhsType == Type::String ? TypeToString(lhsType) : TypeToString(rightType)) + " for Assignment Operator '" + assignExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
+				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (lhsType == Type::String ? TypeToString(lhsType) : TypeToString(rightType)) + " for Assignment Operator '" + std::string(TokenTypeToString(assignExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
 
 		if (lhsType == Type::String && rightType != Type::String)
 			throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + TypeToString(rightType) + " to " + TypeToString(lhsType), Error::ErrorType::TypeCheckerBadTypeConversion, assignExpr->GetSource());
@@ -317,16 +691,31 @@ namespace Eye
 	Type TypeChecker::TypeCheckAssignmentExpressionAssignmentBitwsie(Type lhsType, Type rightType, const AST::AssignmentExpression* assignExpr)
 	{
 		if (lhsType != Type::Integer || rightType != Type::Integer)
-			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (lhsType != Type::Integer ? TypeToString(lhsType) : TypeToString(rightType)) + " for Assignment Operator '" + assignExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (lhsType != Type::Integer ? TypeToString(lhsType) : TypeToString(rightType)) + " for Assignment Operator '" + std::string(TokenTypeToString(assignExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, assignExpr->GetSource());
 		return lhsType;
 	}
 
 	Type TypeChecker::TypeCheckBinaryExpression(const AST::BinaryExpression* binaryExpr)
 	{
-		Type leftType = TypeCheckExpression(binaryExpr->GetLeft());
-		Type rightType = TypeCheckExpression(binaryExpr->GetRight());
+		// Left-Deep Chains are checked bottom-up in a Loop, only Right Operands recurse
+		std::vector<const AST::BinaryExpression*> spine = binaryExpr->GetLeftSpine();
+		Type leftType = TypeCheckExpression(spine.back()->GetLeft());
+		for (auto it = spine.rbegin(); it != spine.rend(); it++)
+		{
+			leftType = TypeCheckBinaryOperator(leftType, TypeCheckExpression((*it)->GetRight()), *it);
+			m_TypeTable->SetType(*it, leftType);
+		}
+		return leftType;
+	}
 
-		switch (binaryExpr->GetOperator()->GetType())
+	Type TypeChecker::TypeCheckBinaryOperator(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr)
+	{
+		if (leftType == Type::Struct || rightType == Type::Struct)
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(Type::Struct) + " for Binary Operator '" + std::string(TokenTypeToString(binaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
+		if (leftType == Type::Array || rightType == Type::Array)
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(Type::Array) + " for Binary Operator '" + std::string(TokenTypeToString(binaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
+
+		switch (binaryExpr->GetOperatorType())
 		{
 		case TokenType::OperatorBinaryPlus:
 		case TokenType::OperatorBinaryMinus:
@@ -354,15 +743,15 @@ namespace Eye
 			break;
 		}
 
-		EYE_LOG_CRITICAL("EYETypeChecker TypeCheckBinaryExpression Unsupported Operator {}", binaryExpr->GetOperator()->GetValueString());
+		EYE_LOG_CRITICAL("EYETypeChecker TypeCheckBinaryOperator Unsupported Operator {}", TokenTypeToString(binaryExpr->GetOperatorType()));
 	}
 
 	Type TypeChecker::TypeCheckBinaryExpressionArithmetic(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr)
 	{
 		if (leftType == Type::Boolean || rightType == Type::Boolean)
-			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (leftType == Type::Boolean ? TypeToString(leftType) : TypeToString(rightType)) + " for Binary Operator '" + binaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (leftType == Type::Boolean ? TypeToString(leftType) : TypeToString(rightType)) + " for Binary Operator '" + std::string(TokenTypeToString(binaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
 
-		if (binaryExpr->GetOperator()->GetType() == TokenType::OperatorBinaryPlus)
+		if (binaryExpr->GetOperatorType() == TokenType::OperatorBinaryPlus)
 		{
 			if (leftType == Type::String && rightType == Type::String)
 				return Type::String;
@@ -373,7 +762,7 @@ namespace Eye
 		else
 		{
 			if (leftType == Type::String || rightType == Type::String)
-				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (leftType == Type::String ? TypeToString(leftType) : TypeToString(rightType)) + " for Binary Operator '" + binaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
+				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (leftType == Type::String ? TypeToString(leftType) : TypeToString(rightType)) + " for Binary Operator '" + std::string(TokenTypeToString(binaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
 		}
 
 		if (leftType == Type::Float || rightType == Type::Float)
@@ -388,17 +777,17 @@ namespace Eye
 	Type TypeChecker::TypeCheckBinaryExpressionRelational(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr)
 	{
 		if ((leftType == Type::String && rightType != Type::String) || (leftType != Type::String && rightType == Type::String))
-			throw Error::Exceptions::BadTypeCompareException("Incomparable Types: " + TypeToString(leftType) + " and " + TypeToString(rightType), Error::ErrorType::TypeCheckerBadTypeCompare, binaryExpr->GetOperator()->GetSource());
+			throw Error::Exceptions::BadTypeCompareException("Incomparable Types: " + TypeToString(leftType) + " and " + TypeToString(rightType), Error::ErrorType::TypeCheckerBadTypeCompare, binaryExpr->GetSource());
 
-		if (binaryExpr->GetOperator()->GetType() == TokenType::OperatorRelationalEquals || binaryExpr->GetOperator()->GetType() == TokenType::OperatorRelationalNotEquals)
+		if (binaryExpr->GetOperatorType() == TokenType::OperatorRelationalEquals || binaryExpr->GetOperatorType() == TokenType::OperatorRelationalNotEquals)
 		{
 			if ((leftType == Type::Boolean && rightType != Type::Boolean) || (leftType != Type::Boolean && rightType == Type::Boolean))
-				throw Error::Exceptions::BadTypeCompareException("Incomparable Types: " + TypeToString(leftType) + " and " + TypeToString(rightType), Error::ErrorType::TypeCheckerBadTypeCompare, binaryExpr->GetOperator()->GetSource());
+				throw Error::Exceptions::BadTypeCompareException("Incomparable Types: " + TypeToString(leftType) + " and " + TypeToString(rightType), Error::ErrorType::TypeCheckerBadTypeCompare, binaryExpr->GetSource());
 		}
 		else
 		{
 			if (leftType == Type::Boolean || rightType == Type::Boolean)
-				throw Error::Exceptions::BadTypeCompareException("Incomparable Types: " + TypeToString(leftType) + " and " + TypeToString(rightType), Error::ErrorType::TypeCheckerBadTypeCompare, binaryExpr->GetOperator()->GetSource());
+				throw Error::Exceptions::BadTypeCompareException("Incomparable Types: " + TypeToString(leftType) + " and " + TypeToString(rightType), Error::ErrorType::TypeCheckerBadTypeCompare, binaryExpr->GetSource());
 		}
 
 		return Type::Boolean;
@@ -407,16 +796,16 @@ namespace Eye
 	Type TypeChecker::TypeCheckBinaryExpressionLogical(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr)
 	{
 		if (leftType != Type::Boolean && leftType != Type::Integer)
-			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(leftType) + " for Binary Operator '" + binaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(leftType) + " for Binary Operator '" + std::string(TokenTypeToString(binaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
 		else if (rightType != Type::Boolean && rightType != Type::Integer)
-			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(rightType) + " for Binary Operator '" + binaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(rightType) + " for Binary Operator '" + std::string(TokenTypeToString(binaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
 		return Type::Boolean;
 	}
 
 	Type TypeChecker::TypeCheckBinaryExpressionBitwise(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr)
 	{
 		if (leftType != Type::Integer || rightType != Type::Integer)
-			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (leftType != Type::Integer ? TypeToString(leftType) : TypeToString(rightType)) + " for Binary Operator '" + binaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
+			throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + (leftType != Type::Integer ? TypeToString(leftType) : TypeToString(rightType)) + " for Binary Operator '" + std::string(TokenTypeToString(binaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, binaryExpr->GetSource());
 		return Type::Integer;
 	}
 
@@ -425,16 +814,25 @@ namespace Eye
 		Type calleeType = TypeCheckExpression(callExpr->GetCallee());
 		if (calleeType == Type::Function)
 		{
-			const FunctionType& funcType = m_FunctionEnvironment->Get(static_cast<const AST::IdentifierExpression*>(callExpr->GetCallee())->GetValue());
+			const std::string& name = static_cast<const AST::IdentifierExpression*>(callExpr->GetCallee())->GetValue();
+			const FunctionType& funcType = m_FunctionEnvironment->Get(name);
+
+			// Left out Arguments take their Parameter's Default
+			const auto& arguments = callExpr->GetArguments();
+			if (arguments.size() < funcType.RequiredParameterCount)
+				throw Error::Exceptions::ArgumentException("Too Few Arguments for Function '" + name + "'", Error::ErrorType::SemanticTooFewArguments, callExpr->GetSource());
+			else if (arguments.size() > funcType.Parameters.size())
+				throw Error::Exceptions::ArgumentException("Too Many Arguments for Function '" + name + "'", Error::ErrorType::SemanticTooManyArguments, callExpr->GetSource());
 
-			for (size_t i = 0; i < funcType.Parameters.size(); i++)
+			for (size_t i = 0; i < arguments.size(); i++)
 			{
 				Type paramType = funcType.Parameters[i];
-				Type argType = TypeCheckExpression(callExpr->GetArguments()[i].get());
+				Type argType = TypeCheckExpression(arguments[i].get());
 				if (argType != paramType)
 					throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + TypeToString(argType) + " to " + TypeToString(paramType), Error::ErrorType::TypeCheckerBadTypeConversion, callExpr->GetSource());
 			}
 
+			m_TypeTable->SetCallType(callExpr, funcType);
 			return funcType.Return;
 		}
 
@@ -444,24 +842,25 @@ namespace Eye
 	Type TypeChecker::TypeCheckUnaryExpression(const AST::UnaryExpression* unaryExpr)
 	{
 		Type exprType = TypeCheckExpression(unaryExpr->GetExpression());
-		if (unaryExpr->GetOperator()->GetType() == TokenType::OperatorBinaryPlus || unaryExpr->GetOperator()->GetType() == TokenType::OperatorBinaryMinus)
+		if (unaryExpr->GetOperatorType() == TokenType::OperatorBinaryPlus || unaryExpr->GetOperatorType() == TokenType::OperatorBinaryMinus
+			|| unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticIncrement || unaryExpr->GetOperatorType() == TokenType::OperatorArithmeticDecrement)
 		{
 			if (exprType != Type::Integer && exprType != Type::Float)
-				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Unary Operator '" + unaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, unaryExpr->GetSource());
+				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Unary Operator '" + std::string(TokenTypeToString(unaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, unaryExpr->GetSource());
 		}
-		else if (unaryExpr->GetOperator()->GetType() == TokenType::OperatorLogicalNOT)
+		else if (unaryExpr->GetOperatorType() == TokenType::OperatorLogicalNOT)
 		{
 			if (exprType != Type::Boolean && exprType != Type::Integer)
-				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Unary Operator '" + unaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, unaryExpr->GetSource());
+				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Unary Operator '" + std::string(TokenTypeToString(unaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, unaryExpr->GetSource());
 		}
-		else if (unaryExpr->GetOperator()->GetType() == TokenType::OperatorBitwiseNOT)
+		else if (unaryExpr->GetOperatorType() == TokenType::OperatorBitwiseNOT)
 		{
 			if (exprType != Type::Integer)
-				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Unary Operator '" + unaryExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, unaryExpr->GetSource());
+				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Unary Operator '" + std::string(TokenTypeToString(unaryExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, unaryExpr->GetSource());
 		}
 		else
 		{
-			EYE_LOG_CRITICAL("EYETypeChecker TypeCheckUnaryExpression Unsupported Operator {}", unaryExpr->GetOperator()->GetValueString());
+			EYE_LOG_CRITICAL("EYETypeChecker TypeCheckUnaryExpression Unsupported Operator {}", TokenTypeToString(unaryExpr->GetOperatorType()));
 		}
 
 		return exprType;
@@ -469,15 +868,107 @@ namespace Eye
 
 	Type TypeChecker::TypeCheckPostfixExpression(const AST::PostfixExpression* postfixExpr)
 	{
-		if (postfixExpr->GetOperator()->GetType() == TokenType::OperatorArithmeticIncrement || postfixExpr->GetOperator()->GetType() == TokenType::OperatorArithmeticDecrement)
+		if (postfixExpr->GetOperatorType() == TokenType::OperatorArithmeticIncrement || postfixExpr->GetOperatorType() == TokenType::OperatorArithmeticDecrement)
 		{
 			Type exprType = TypeCheckExpression(postfixExpr->GetExpression());
 			if (exprType != Type::Integer && exprType != Type::Float)
-				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Postfix Operator '" + postfixExpr->GetOperator()->GetValueString() + "'", Error::ErrorType::TypeCheckerBadOperandType, postfixExpr->GetSource());
+				throw Error::Exceptions::BadOperandTypeException("Bad Operand Type " + TypeToString(exprType) + " for Postfix Operator '" + std::string(TokenTypeToString(postfixExpr->GetOperatorType())) + "'", Error::ErrorType::TypeCheckerBadOperandType, postfixExpr->GetSource());
 			return exprType;
 		}
 
-		EYE_LOG_CRITICAL("EYETypeChecker TypeCheckPostfixExpression Unsupported Operator {}", postfixExpr->GetOperator()->GetValueString());
+		EYE_LOG_CRITICAL("EYETypeChecker TypeCheckPostfixExpression Unsupported Operator {}", TokenTypeToString(postfixExpr->GetOperatorType()));
+	}
+
+	Type TypeChecker::TypeCheckMemberExpression(const AST::MemberExpression* memberExpr)
+	{
+		if (memberExpr->IsComputed())
+			return TypeCheckArrayElement(memberExpr);
+
+		Type objectType = TypeCheckExpression(memberExpr->GetObject());
+		if (objectType != Type::Struct)
+			throw Error::Exceptions::BadMemberException("Member Access on Non-Struct Type " + TypeToString(objectType), Error::ErrorType::TypeCheckerBadMember, memberExpr->GetSource());
+
+		const StructLayout* layout = GetStructLayout(memberExpr->GetObject());
+		if (!layout)
+			throw Error::Exceptions::BadMemberException("Member Access on a Struct of Unknown Layout", Error::ErrorType::TypeCheckerBadMember, memberExpr->GetSource());
+
+		const std::string& fieldName = static_cast<const AST::IdentifierExpression*>(memberExpr->GetProperty())->GetValue();
+		const FieldLayout* field = layout->GetField(fieldName);
+		if (!field)
+			throw Error::Exceptions::BadMemberException("Struct '" + layout->GetName() + "' has no Field '" + fieldName + "'", Error::ErrorType::TypeCheckerBadMember, memberExpr->GetProperty()->GetSource());
+
+		m_TypeTable->SetMemberField(memberExpr, field);
+		return field->FieldType;
+	}
+
+	Type TypeChecker::TypeCheckArrayElement(const AST::MemberExpression* memberExpr)
+	{
+		Type objectType = TypeCheckExpression(memberExpr->GetObject());
+		if (objectType != Type::Array)
+			throw Error::Exceptions::BadMemberException("Indexing Non-Array Type " + TypeToString(objectType), Error::ErrorType::TypeCheckerBadMember, memberExpr->GetSource());
+
+		const ArrayType* arrayType = GetArrayType(memberExpr->GetObject());
+		if (!arrayType)
+			throw Error::Exceptions::BadMemberException("Indexing an Array of Unknown Type", Error::ErrorType::TypeCheckerBadMember, memberExpr->GetSource());
+
+		Type indexType = TypeCheckExpression(memberExpr->GetProperty());
+		if (indexType != Type::Integer)
+			throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + TypeToString(indexType) + " to " + TypeToString(Type::Integer), Error::ErrorType::TypeCheckerBadTypeConversion, memberExpr->GetProperty()->GetSource());
+
+		// Literal Indices are checked here, every other Index at Runtime
+		if (memberExpr->GetProperty()->GetType() == AST::ExpressionType::LiteralExpression)
+		{
+			AST::LiteralIntegerType index = static_cast<const AST::LiteralExpression*>(memberExpr->GetProperty())->GetValue<AST::LiteralIntegerType>();
+			if (index >= arrayType->Length)
+				throw Error::Exceptions::BadMemberException("Index " + std::to_string(index) + " out of Bounds for an Array of " + std::to_string(arrayType->Length) + " Elements", Error::ErrorType::TypeCheckerBadMember, memberExpr->GetProperty()->GetSource());
+		}
+
+		return arrayType->Element;
+	}
+
+	void TypeChecker::TypeCheckStructConversion(const StructLayout* targetLayout, Type targetType, Type sourceType, const AST::Expression* sourceExpr)
+	{
+		const StructLayout* sourceLayout = (sourceType == Type::Struct ? GetStructLayout(sourceExpr) : nullptr);
+		// Equal Layouts are shared by the TypeTable
+		if (targetLayout && targetLayout == sourceLayout)
+			return;
+
+		std::string sourceName = (sourceLayout ? sourceLayout->GetName() : TypeToString(sourceType));
+		std::string targetName = (targetLayout ? targetLayout->GetName() : TypeToString(targetType));
+		throw Error::Exceptions::BadTypeConversionException("Invalid Conversion from " + sourceName + " to " + targetName, Error::ErrorType::TypeCheckerBadTypeConversion, sourceExpr->GetSource());
+	}
+
+	const StructLayout* TypeChecker::GetStructLayout(const std::string& name, const EyeSource& source) const
+	{
+		auto it = m_StructLayouts.find(name);
+		if (it == m_StructLayouts.end())
+			throw Error::Exceptions::BadMemberException("'" + name + "' Does Not Name a Struct", Error::ErrorType::TypeCheckerBadMember, source);
+		return it->second;
+	}
+
+	const StructLayout* TypeChecker::GetStructLayout(const AST::Expression* expr)
+	{
+		switch (expr->GetType())
+		{
+		case AST::ExpressionType::IdentifierExpression:
+			return m_StructEnvironment->Get(static_cast<const AST::IdentifierExpression*>(expr)->GetValue());
+		case AST::ExpressionType::MemberExpression:
+		{
+			const FieldLayout* field = m_TypeTable->GetMemberField(expr);
+			return (field ? field->Layout : nullptr);
+		}
+		case AST::ExpressionType::AssignmentExpression:
+			return GetStructLayout(static_cast<const AST::AssignmentExpression*>(expr)->GetLHSExpression());
+		default:
+			return nullptr;
+		}
+	}
+
+	const ArrayType* TypeChecker::GetArrayType(const AST::Expression* expr)
+	{
+		if (expr->GetType() != AST::ExpressionType::IdentifierExpression)
+			return nullptr;
+		return &m_ArrayEnvironment->Get(static_cast<const AST::IdentifierExpression*>(expr)->GetValue());
 	}
 
 	Type TypeChecker::LexerToTypeCheckerType(TokenType type)
@@ -501,10 +992,14 @@ namespace Eye
 	{
 		m_TypeEnvironment = std::make_shared<Environment<Type>>(m_TypeEnvironment);
 		m_FunctionEnvironment = std::make_shared<Environment<FunctionType>>(m_FunctionEnvironment);
+		m_StructEnvironment = std::make_shared<Environment<const StructLayout*>>(m_StructEnvironment);
+		m_ArrayEnvironment = std::make_shared<Environment<ArrayType>>(m_ArrayEnvironment);
 	}
 
 	void TypeChecker::EndBlockScope()
 	{
+		m_ArrayEnvironment = m_ArrayEnvironment->GetParent();
+		m_StructEnvironment = m_StructEnvironment->GetParent();
 		m_FunctionEnvironment = m_FunctionEnvironment->GetParent();
 		m_TypeEnvironment = m_TypeEnvironment->GetParent();
 	}
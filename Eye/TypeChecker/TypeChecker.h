@@ -2,7 +2,9 @@
 
 #include "Eye/TypeChecker/Type.h"
 #include "Eye/TypeChecker/Environment.h"
+#include "Eye/TypeChecker/TypeTable.h"
 #include "Eye/Error/Error.h"
+#include "Eye/ModuleLoader/ModuleInterface.h"
 
 #include "Eye/AST/Program.h"
 #include "Eye/AST/Statements/Statement.h"
@@ -13,6 +15,9 @@
 #include "Eye/AST/Statements/IterationStatement.h"
 #include "Eye/AST/Statements/FunctionStatement.h"
 #include "Eye/AST/Statements/ReturnStatement.h"
+#include "Eye/AST/Statements/ImportStatement.h"
+#include "Eye/AST/Statements/StructStatement.h"
+#include "Eye/AST/Statements/NamespaceStatement.h"
 
 #include "Eye/AST/Expressions/Expression.h"
 #include "Eye/AST/Expressions/LiteralExpression.h"
@@ -20,17 +25,52 @@
 #include "Eye/AST/Expressions/AssignmentExpression.h"
 #include "Eye/AST/Expressions/BinaryExpression.h"
 #include "Eye/AST/Expressions/CallExpression.h"
+#include "Eye/AST/Expressions/MemberExpression.h"
 #include "Eye/AST/Expressions/UnaryExpression.h"
 #include "Eye/AST/Expressions/PostfixExpression.h"
 
 #include <expected>
+#include <unordered_map>
 
 namespace Eye
 {
 	class TypeChecker
 	{
 	public:
-		std::expected<bool, Error::Error> TypeCheck(const AST::Program* ast);
+		// imports resolves the Program's ImportStatements, see ModuleLoader
+		std::expected<bool, Error::Error> TypeCheck(const AST::Program* ast, const ModuleImports& imports = {});
+		// revisions[i] identifies ast->GetStatementList()[i] (see IncrementalParser), FunctionStatements whose Revision and Dependencies are unchanged since the last call are not re-checked
+		std::expected<bool, Error::Error> TypeCheck(const AST::Program* ast, const std::vector<size_t>& revisions, const ModuleImports& imports = {});
+		static FunctionType GetFunctionType(const AST::FunctionStatement* functionStmt);
+		inline size_t GetCheckedFunctionCount() const { return m_CheckedFunctionCount; }
+		// Type of every checked Expression & the FunctionType of every checked Call, see TypeTable
+		inline std::shared_ptr<const TypeTable> GetTypeTable() const { return m_TypeTable; }
+
+	private:
+		// Type of a Global Name a Function refers to, as seen at the Function's Declaration
+		struct FunctionDependency
+		{
+			bool Defined;
+			Type VariableType;
+			FunctionType Function;
+			// Signature of the StructLayout the Name is or holds, Empty otherwise
+			std::string Struct;
+			ArrayType Array;
+
+			bool operator==(const FunctionDependency&) const = default;
+		};
+
+		struct FunctionCacheEntry
+		{
+			bool Checked = false;
+			bool DependenciesCollected = false;
+			std::vector<std::string> Dependencies;
+			std::vector<FunctionDependency> ResolvedDependencies;
+		};
+
+		void TypeCheckCachedFunctionStatement(const AST::FunctionStatement* functionStmt, size_t revision);
+		void CollectStatementDependencies(const AST::Statement* stmt, std::vector<std::string>& dependencies);
+		void CollectExpressionDependencies(const AST::Expression* expr, std::vector<std::string>& dependencies);
 
 	private:
 		void TypeCheckStatement(const AST::Statement* stmt);
@@ -44,6 +84,9 @@ namespace Eye
 		void TypeCheckForStatement(const AST::ForStatement* forStmt);
 		void TypeCheckFunctionStatement(const AST::FunctionStatement* functionStmt);
 		void TypeCheckReturnStatement(const AST::ReturnStatement* returnStmt);
+		void TypeCheckImportStatement(const AST::ImportStatement* importStmt);
+		void TypeCheckStructStatement(const AST::StructStatement* structStmt);
+		void TypeCheckNamespaceStatement(const AST::NamespaceStatement* namespaceStmt);
 
 		Type TypeCheckExpression(const AST::Expression* expr);
 		Type TypeCheckLiteralExpression(const AST::LiteralExpression* literalExpr);
@@ -53,6 +96,7 @@ namespace Eye
 		Type TypeCheckAssignmentExpressionAssignmentArithmetic(Type lhsType, Type rightType, const AST::AssignmentExpression* assignExpr);
 		Type TypeCheckAssignmentExpressionAssignmentBitwsie(Type lhsType, Type rightType, const AST::AssignmentExpression* assignExpr);
 		Type TypeCheckBinaryExpression(const AST::BinaryExpression* binaryExpr);
+		Type TypeCheckBinaryOperator(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr);
 		Type TypeCheckBinaryExpressionArithmetic(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr);
 		Type TypeCheckBinaryExpressionRelational(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr);
 		Type TypeCheckBinaryExpressionLogical(Type leftType, Type rightType, const AST::BinaryExpression* binaryExpr);
@@ -60,14 +104,31 @@ namespace Eye
 		Type TypeCheckCallExpression(const AST::CallExpression* callExpr);
 		Type TypeCheckUnaryExpression(const AST::UnaryExpression* unaryExpr);
 		Type TypeCheckPostfixExpression(const AST::PostfixExpression* postfixExpr);
+		Type TypeCheckMemberExpression(const AST::MemberExpression* memberExpr);
+		Type TypeCheckArrayElement(const AST::MemberExpression* memberExpr);
+		void TypeCheckStructConversion(const StructLayout* targetLayout, Type targetType, Type sourceType, const AST::Expression* sourceExpr);
 
 	private:
-		Type LexerToTypeCheckerType(TokenType type);
+		static Type LexerToTypeCheckerType(TokenType type);
+		// Layout of a Struct Type Name, Layout of the Struct an already checked Expression evaluates to
+		const StructLayout* GetStructLayout(const std::string& name, const EyeSource& source) const;
+		const StructLayout* GetStructLayout(const AST::Expression* expr);
+		// ArrayType of an already checked Expression, Arrays are only ever named
+		const ArrayType* GetArrayType(const AST::Expression* expr);
 		void BeginBlockScope();
 		void EndBlockScope();
 
 	private:
 		std::shared_ptr<Environment<Type>> m_TypeEnvironment;
 		std::shared_ptr<Environment<FunctionType>> m_FunctionEnvironment;
+		// Defined for every Name of Type::Struct, alongside m_TypeEnvironment
+		std::shared_ptr<Environment<const StructLayout*>> m_StructEnvironment;
+		std::unordered_map<std::string, const StructLayout*> m_StructLayouts;
+		// Defined for every Name of Type::Array, alongside m_TypeEnvironment
+		std::shared_ptr<Environment<ArrayType>> m_ArrayEnvironment;
+		std::unordered_map<size_t, FunctionCacheEntry> m_FunctionCache;
+		size_t m_CheckedFunctionCount = 0;
+		const ModuleImports* m_Imports = nullptr;
+		std::shared_ptr<TypeTable> m_TypeTable;
 	};
 }
@@ -0,0 +1,100 @@
+#include "Eye/TypeChecker/TypeTable.h"
+
+#include <algorithm>
+
+namespace Eye
+{
+	TypeTable::TypeTable(size_t expressionCount)
+		: m_Types(expressionCount, NoType)
+	{
+	}
+
+	void TypeTable::SetType(const AST::Expression* expression, Type type)
+	{
+		uint32_t id = expression->GetId();
+		if (id == AST::Expression::InvalidId)
+			return;
+
+		if (id >= m_Types.size())
+			m_Types.resize(id + 1, NoType);
+		if (m_Types[id] == NoType)
+			m_AnnotatedCount++;
+		m_Types[id] = (uint8_t)type + 1;
+	}
+
+	std::optional<Type> TypeTable::GetType(const AST::Expression* expression) const
+	{
+		uint32_t id = expression->GetId();
+		if (id >= m_Types.size() || m_Types[id] == NoType)
+			return std::nullopt;
+		return (Type)(m_Types[id] - 1);
+	}
+
+	void TypeTable::SetCallType(const AST::Expression* callExpression, const FunctionType& functionType)
+	{
+		uint32_t id = callExpression->GetId();
+		if (id == AST::Expression::InvalidId)
+			return;
+
+		if (id >= m_CallIndices.size())
+			m_CallIndices.resize(std::max<size_t>(id + 1, m_Types.size()), NoCall);
+
+		if (m_CallIndices[id] == NoCall)
+		{
+			m_CallIndices[id] = (uint32_t)m_CallTypes.size();
+			m_CallTypes.push_back(functionType);
+		}
+		else
+		{
+			m_CallTypes[m_CallIndices[id]] = functionType;
+		}
+	}
+
+	const FunctionType* TypeTable::GetCallType(const AST::Expression* callExpression) const
+	{
+		uint32_t id = callExpression->GetId();
+		if (id >= m_CallIndices.size() || m_CallIndices[id] == NoCall)
+			return nullptr;
+		return &m_CallTypes[m_CallIndices[id]];
+	}
+
+	void TypeTable::SetMemberField(const AST::Expression* memberExpression, const FieldLayout* field)
+	{
+		uint32_t id = memberExpression->GetId();
+		if (id == AST::Expression::InvalidId)
+			return;
+
+		if (id >= m_MemberFields.size())
+			m_MemberFields.resize(id + 1, nullptr);
+		m_MemberFields[id] = field;
+	}
+
+	const FieldLayout* TypeTable::GetMemberField(const AST::Expression* memberExpression) const
+	{
+		uint32_t id = memberExpression->GetId();
+		if (id >= m_MemberFields.size())
+			return nullptr;
+		return m_MemberFields[id];
+	}
+
+	const StructLayout* TypeTable::AddStructLayout(StructLayout&& layout)
+	{
+		// Re-checking a Program declares the same Structs again
+		std::string signature = layout.GetSignature();
+		auto it = std::find_if(m_StructLayouts.begin(), m_StructLayouts.end(), [&signature](const auto& existing) { return existing->GetSignature() == signature; });
+		if (it == m_StructLayouts.end())
+		{
+			m_StructLayouts.push_back(std::make_unique<StructLayout>(std::move(layout)));
+			it = m_StructLayouts.end() - 1;
+		}
+
+		m_StructNames[(*it)->GetName()] = it->get();
+		return it->get();
+	}
+
+	const StructLayout* TypeTable::GetStructLayout(const std::string& name) const
+	{
+		auto it = m_StructNames.find(name);
+		return (it != m_StructNames.end() ? it->second : nullptr);
+	}
+}
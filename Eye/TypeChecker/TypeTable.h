@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Eye/TypeChecker/Type.h"
+#include "Eye/TypeChecker/StructLayout.h"
+#include "Eye/AST/Expressions/Expression.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+namespace Eye
+{
+	/*
+		TypeTable
+			Types the TypeChecker inferred, indexed by AST::Expression::GetId.
+			Every Expression takes one Byte, Call Sites additionally the FunctionType they resolved to & Member Accesses the Field they resolved to.
+			StructLayouts live as long as the Table, so Fields handed out stay valid.
+			Expressions without an Id (i.e created by an Optimizer) are never annotated.
+	*/
+	class TypeTable
+	{
+	public:
+		TypeTable(size_t expressionCount = 0);
+
+		void SetType(const AST::Expression* expression, Type type);
+		std::optional<Type> GetType(const AST::Expression* expression) const;
+		void SetCallType(const AST::Expression* callExpression, const FunctionType& functionType);
+		const FunctionType* GetCallType(const AST::Expression* callExpression) const;
+		void SetMemberField(const AST::Expression* memberExpression, const FieldLayout* field);
+		const FieldLayout* GetMemberField(const AST::Expression* memberExpression) const;
+
+		// Equal Layouts are shared, the Layout becomes the one GetStructLayout returns for its Name
+		const StructLayout* AddStructLayout(StructLayout&& layout);
+		const StructLayout* GetStructLayout(const std::string& name) const;
+
+		inline size_t GetAnnotatedCount() const { return m_AnnotatedCount; }
+
+	private:
+		static constexpr uint8_t NoType = 0;
+		static constexpr uint32_t NoCall = UINT32_MAX;
+
+		// Type + 1, NoType if the Expression was not annotated
+		std::vector<uint8_t> m_Types;
+		std::vector<uint32_t> m_CallIndices;
+		std::vector<FunctionType> m_CallTypes;
+		std::vector<const FieldLayout*> m_MemberFields;
+		std::vector<std::unique_ptr<StructLayout>> m_StructLayouts;
+		std::unordered_map<std::string, const StructLayout*> m_StructNames;
+		size_t m_AnnotatedCount = 0;
+	};
+}
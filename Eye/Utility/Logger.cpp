@@ -1,18 +1,58 @@
 #include "Eye/Utility/Logger.h"
 
 #include <spdlog/sinks/stdout_color_sinks.h>
-#include <spdlog/sinks/ostream_sink.h>
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/details/null_mutex.h>
+
+#include <array>
+#include <algorithm>
+#include <cstring>
 
 namespace Eye
 {
+	namespace
+	{
+		struct CapturedLog
+		{
+			size_t Size = 0;
+			char Message[Logger::CaptureMessageSize];
+		};
+
+		struct CaptureRing
+		{
+			std::array<CapturedLog, Logger::CaptureCapacity> Logs;
+			size_t Head = 0;
+			size_t Count = 0;
+		};
+
+		thread_local CaptureRing s_CaptureRing;
+
+		// State lives in the thread_local ring, so the sink itself needs no mutex
+		class CaptureSink : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+		{
+		protected:
+			void sink_it_(const spdlog::details::log_msg& msg) override
+			{
+				CapturedLog& log = s_CaptureRing.Logs[s_CaptureRing.Head];
+				log.Size = std::min(msg.payload.size(), Logger::CaptureMessageSize);
+				std::memcpy(log.Message, msg.payload.data(), log.Size);
+
+				s_CaptureRing.Head = (s_CaptureRing.Head + 1) % Logger::CaptureCapacity;
+				s_CaptureRing.Count = std::min(s_CaptureRing.Count + 1, Logger::CaptureCapacity);
+			}
+
+			void flush_() override
+			{
+			}
+		};
+	}
+
 	void Logger::Init(const std::string& name)
 	{
 		spdlog::set_pattern("%^[%T] %n: %v%$");
 		s_Logger = spdlog::stdout_color_mt(name);
+		s_Logger->sinks().push_back(std::make_shared<CaptureSink>());
 		s_Logger->set_level(spdlog::level::trace);
-
-		/*std::vector<spdlog::sink_ptr>& sinks{ s_Logger->sinks() };
-		sinks[0] = std::make_shared<spdlog::sinks::ostream_sink_st>(s_Stream);*/
 		EYE_LOG_INFO("EYELogger->Initialized!");
 	}
 
@@ -21,19 +61,23 @@ namespace Eye
 		EYE_LOG_INFO("EYELogger->Destroyed!");
 	}
 
-	void Logger::SaveLastLog()
-	{
-		s_Logs.push_back(s_Stream.str());
-		s_Stream.str("");
-	}
-
 	void Logger::Clear()
 	{
-		s_Logs.clear();
+		s_CaptureRing.Head = 0;
+		s_CaptureRing.Count = 0;
 	}
 
-	const std::vector<std::string>& Logger::GetLogs()
+	std::vector<std::string> Logger::GetLogs()
 	{
-		return s_Logs;
+		std::vector<std::string> logs;
+		logs.reserve(s_CaptureRing.Count);
+
+		size_t first = (s_CaptureRing.Head + CaptureCapacity - s_CaptureRing.Count) % CaptureCapacity;
+		for (size_t i = 0; i < s_CaptureRing.Count; i++)
+		{
+			const CapturedLog& log = s_CaptureRing.Logs[(first + i) % CaptureCapacity];
+			logs.emplace_back(log.Message, log.Size);
+		}
+		return logs;
 	}
 }
@@ -3,36 +3,87 @@
 #include <spdlog/spdlog.h>
 
 #include <string>
-#include <sstream>
+#include <vector>
 #include <memory>
+#include <stdexcept>
+
+#define EYE_LOG_LEVEL_TRACE		0
+#define EYE_LOG_LEVEL_DEBUG		1
+#define EYE_LOG_LEVEL_INFO		2
+#define EYE_LOG_LEVEL_WARN		3
+#define EYE_LOG_LEVEL_ERROR		4
+#define EYE_LOG_LEVEL_CRITICAL	5
+
+// Levels below EYE_LOG_ACTIVE_LEVEL compile to nothing, CRITICAL is always active since it throws a CriticalError.
+#ifndef EYE_LOG_ACTIVE_LEVEL
+	#ifdef EYE_DEBUG
+		#define EYE_LOG_ACTIVE_LEVEL EYE_LOG_LEVEL_TRACE
+	#else
+		#define EYE_LOG_ACTIVE_LEVEL EYE_LOG_LEVEL_INFO
+	#endif
+#endif
 
 namespace Eye
 {
+	// Thrown by EYE_LOG_CRITICAL, holds the logged Message
+	class CriticalError : public std::runtime_error
+	{
+	public:
+		using std::runtime_error::runtime_error;
+	};
+
+	/*
+		Logger
+			Every message is also captured in a fixed-size ring owned by the logging thread.
+			Capturing never allocates and never locks, GetLogs()/Clear() only see the calling thread's ring.
+	*/
 	class Logger
 	{
+	public:
+		static constexpr size_t CaptureCapacity = 64;
+		static constexpr size_t CaptureMessageSize = 512;
+
 	public:
 		static void Init(const std::string& name = "EYELogger");
 		static void Destroy();
-		inline static std::shared_ptr<spdlog::logger> GetLogger() { return s_Logger; }
+		inline static const std::shared_ptr<spdlog::logger>& GetLogger() { return s_Logger; }
 
-		static void SaveLastLog();
 		static void Clear();
-		static const std::vector<std::string>& GetLogs();
+		static std::vector<std::string> GetLogs();
 
 	private:
 		inline static std::shared_ptr<spdlog::logger> s_Logger;
-		inline static std::vector<std::string> s_Logs;
-		inline static std::ostringstream s_Stream;
 	};
 }
 
-#define EYE_LOG_INFO(...)		(Eye::Logger::GetLogger()->info(__VA_ARGS__), Eye::Logger::SaveLastLog())
-#define EYE_LOG_WARN(...)		(Eye::Logger::GetLogger()->warn(__VA_ARGS__), Eye::Logger::SaveLastLog())
-#ifdef EYE_DEBUG
-	#define EYE_LOG_DEBUG(...)		(Eye::Logger::GetLogger()->debug(__VA_ARGS__), Eye::Logger::SaveLastLog())
+#if EYE_LOG_ACTIVE_LEVEL <= EYE_LOG_LEVEL_TRACE
+	#define EYE_LOG_TRACE(...)		(Eye::Logger::GetLogger()->trace(__VA_ARGS__))
+#else
+	#define EYE_LOG_TRACE(...)		((void)0)
+#endif
+
+#if EYE_LOG_ACTIVE_LEVEL <= EYE_LOG_LEVEL_DEBUG
+	#define EYE_LOG_DEBUG(...)		(Eye::Logger::GetLogger()->debug(__VA_ARGS__))
+#else
+	#define EYE_LOG_DEBUG(...)		((void)0)
+#endif
+
+#if EYE_LOG_ACTIVE_LEVEL <= EYE_LOG_LEVEL_INFO
+	#define EYE_LOG_INFO(...)		(Eye::Logger::GetLogger()->info(__VA_ARGS__))
 #else
-	#define EYE_LOG_DEBUG(...)
+	#define EYE_LOG_INFO(...)		((void)0)
 #endif
-#define EYE_LOG_ERROR(...)		(Eye::Logger::GetLogger()->error(__VA_ARGS__), Eye::Logger::SaveLastLog())
-#define EYE_LOG_CRITICAL(...)	(Eye::Logger::GetLogger()->critical(__VA_ARGS__), Eye::Logger::SaveLastLog(), throw)
-#define EYE_LOG_TRACE(...)		(Eye::Logger::GetLogger()->trace(__VA_ARGS__), Eye::Logger::SaveLastLog(), __VA_ARGS__))
+
+#if EYE_LOG_ACTIVE_LEVEL <= EYE_LOG_LEVEL_WARN
+	#define EYE_LOG_WARN(...)		(Eye::Logger::GetLogger()->warn(__VA_ARGS__))
+#else
+	#define EYE_LOG_WARN(...)		((void)0)
+#endif
+
+#if EYE_LOG_ACTIVE_LEVEL <= EYE_LOG_LEVEL_ERROR
+	#define EYE_LOG_ERROR(...)		(Eye::Logger::GetLogger()->error(__VA_ARGS__))
+#else
+	#define EYE_LOG_ERROR(...)		((void)0)
+#endif
+
+#define EYE_LOG_CRITICAL(...)	(Eye::Logger::GetLogger()->critical(__VA_ARGS__), throw Eye::CriticalError(fmt::format(__VA_ARGS__)))
@@ -0,0 +1,142 @@
+#include "Eye/Utility/ThreadPool.h"
+
+#include <utility>
+
+namespace Eye
+{
+	ThreadPool::ThreadPool(size_t threadCount)
+	{
+		if (!threadCount)
+			threadCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+		for (size_t i = 0; i < threadCount; i++)
+			m_Queues.push_back(std::make_unique<WorkQueue>());
+
+		for (size_t i = 0; i < threadCount; i++)
+			m_Threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		WaitIdle();
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Running = false;
+		}
+		m_WorkAvailable.notify_all();
+
+		for (auto& thread : m_Threads)
+			thread.join();
+	}
+
+	void ThreadPool::Submit(std::function<void()> task)
+	{
+		m_PendingTasks++;
+
+		size_t queueIndex;
+		if (s_WorkerPool == this)
+		{
+			queueIndex = s_WorkerIndex;
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			queueIndex = m_NextQueue;
+			m_NextQueue = (m_NextQueue + 1) % m_Queues.size();
+		}
+
+		// Counted before the Queue is unlocked, a Stealer can only take the Task after it is counted
+		{
+			std::lock_guard<std::mutex> queueLock(m_Queues[queueIndex]->Mutex);
+			m_Queues[queueIndex]->Tasks.push_back(std::move(task));
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_QueuedTasks++;
+		}
+		m_WorkAvailable.notify_one();
+	}
+
+	void ThreadPool::Wait()
+	{
+		WaitIdle();
+
+		std::exception_ptr exception;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			exception = std::exchange(m_Exception, nullptr);
+		}
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	void ThreadPool::WaitIdle()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_WorkDone.wait(lock, [this]() { return m_PendingTasks == 0; });
+	}
+
+	void ThreadPool::WorkerLoop(size_t index)
+	{
+		s_WorkerPool = this;
+		s_WorkerIndex = index;
+
+		while (true)
+		{
+			std::function<void()> task;
+			if (PopTask(index, task) || StealTask(index, task))
+			{
+				m_QueuedTasks--;
+				try
+				{
+					task();
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					if (!m_Exception)
+						m_Exception = std::current_exception();
+				}
+
+				if (--m_PendingTasks == 0)
+				{
+					std::lock_guard<std::mutex> lock(m_Mutex);
+					m_WorkDone.notify_all();
+				}
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_WorkAvailable.wait(lock, [this]() { return m_QueuedTasks > 0 || !m_Running; });
+			if (!m_Running && m_QueuedTasks == 0)
+				break;
+		}
+	}
+
+	bool ThreadPool::PopTask(size_t index, std::function<void()>& task)
+	{
+		WorkQueue& queue = *m_Queues[index];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+		if (queue.Tasks.empty())
+			return false;
+
+		task = std::move(queue.Tasks.back());
+		queue.Tasks.pop_back();
+		return true;
+	}
+
+	bool ThreadPool::StealTask(size_t index, std::function<void()>& task)
+	{
+		for (size_t i = 1; i < m_Queues.size(); i++)
+		{
+			WorkQueue& queue = *m_Queues[(index + i) % m_Queues.size()];
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+			if (queue.Tasks.empty())
+				continue;
+
+			task = std::move(queue.Tasks.front());
+			queue.Tasks.pop_front();
+			return true;
+		}
+		return false;
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+namespace Eye
+{
+	/*
+		Work-Stealing ThreadPool
+			Every worker owns a queue, pops its own work LIFO and steals FIFO from the other workers once it runs dry.
+			Tasks submitted from inside a worker go to that worker's queue, external submissions are spread round-robin.
+			Wait() rethrows the first Exception a Task threw since the last Wait(), the other Tasks still run.
+	*/
+	class ThreadPool
+	{
+	public:
+		ThreadPool(size_t threadCount = 0);
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		void Submit(std::function<void()> task);
+		void Wait();
+		inline size_t GetThreadCount() const { return m_Threads.size(); }
+
+	private:
+		void WaitIdle();
+		void WorkerLoop(size_t index);
+		bool PopTask(size_t index, std::function<void()>& task);
+		bool StealTask(size_t index, std::function<void()>& task);
+
+	private:
+		struct WorkQueue
+		{
+			std::mutex Mutex;
+			std::deque<std::function<void()>> Tasks;
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> m_Queues;
+		std::vector<std::thread> m_Threads;
+		std::mutex m_Mutex;
+		std::condition_variable m_WorkAvailable;
+		std::condition_variable m_WorkDone;
+		std::atomic<size_t> m_QueuedTasks = 0;
+		std::atomic<size_t> m_PendingTasks = 0;
+		size_t m_NextQueue = 0;
+		std::exception_ptr m_Exception;
+		bool m_Running = true;
+
+		inline static thread_local ThreadPool* s_WorkerPool = nullptr;
+		inline static thread_local size_t s_WorkerIndex = 0;
+	};
+}